@@ -79,25 +79,25 @@ namespace detail
 	template <typename T>
 	GLM_FUNC_QUALIFIER T taylorInvSqrt(T const & r)
 	{
-		return T(1.79284291400159) - T(0.85373472095314) * r;
+		return fma(T(-0.85373472095314), r, T(1.79284291400159));
 	}
 	
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tvec2<T, P> taylorInvSqrt(tvec2<T, P> const & r)
 	{
-		return T(1.79284291400159) - T(0.85373472095314) * r;
+		return fma(tvec2<T, P>(T(-0.85373472095314)), r, tvec2<T, P>(T(1.79284291400159)));
 	}
 	
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tvec3<T, P> taylorInvSqrt(tvec3<T, P> const & r)
 	{
-		return T(1.79284291400159) - T(0.85373472095314) * r;
+		return fma(tvec3<T, P>(T(-0.85373472095314)), r, tvec3<T, P>(T(1.79284291400159)));
 	}
 	
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tvec4<T, P> taylorInvSqrt(tvec4<T, P> const & r)
 	{
-		return T(1.79284291400159) - T(0.85373472095314) * r;
+		return fma(tvec4<T, P>(T(-0.85373472095314)), r, tvec4<T, P>(T(1.79284291400159)));
 	}
 /*
 	template <typename T, precision P, template<typename> class vecType>
@@ -110,19 +110,19 @@ namespace detail
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tvec2<T, P> fade(tvec2<T, P> const & t)
 	{
-		return (t * t * t) * (t * (t * T(6) - T(15)) + T(10));
+		return (t * t * t) * fma(t, fma(t, tvec2<T, P>(T(6)), tvec2<T, P>(T(-15))), tvec2<T, P>(T(10)));
 	}
 	
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tvec3<T, P> fade(tvec3<T, P> const & t)
 	{
-		return (t * t * t) * (t * (t * T(6) - T(15)) + T(10));
+		return (t * t * t) * fma(t, fma(t, tvec3<T, P>(T(6)), tvec3<T, P>(T(-15))), tvec3<T, P>(T(10)));
 	}
 	
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tvec4<T, P> fade(tvec4<T, P> const & t)
 	{
-		return (t * t * t) * (t * (t * T(6) - T(15)) + T(10));
+		return (t * t * t) * fma(t, fma(t, tvec4<T, P>(T(6)), tvec4<T, P>(T(-15))), tvec4<T, P>(T(10)));
 	}
 /*
 	template <typename T, precision P, template <typename> class vecType>
@@ -56,7 +56,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/abs.xml">GLSL abs man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.3 Common Functions</a>
 	template <typename genType>
-	GLM_FUNC_DECL genType abs(genType x);
+	GLM_FUNC_DECL GLM_CONSTEXPR genType abs(genType x);
 
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_DECL vecType<T, P> abs(vecType<T, P> const & x);
@@ -410,6 +410,7 @@ namespace glm
 	GLM_FUNC_DECL vecType<float, P> uintBitsToFloat(vecType<uint, P> const & v);
 
 	/// Computes and returns a * b + c.
+	/// When GLM_HAS_FMA is set, float and double scalars and vectors are computed with a single rounding.
 	/// 
 	/// @tparam genType Floating-point scalar or vector types.
 	/// 
@@ -47,7 +47,7 @@ namespace detail
 	template <typename genFIType>
 	struct compute_abs<genFIType, true>
 	{
-		GLM_FUNC_QUALIFIER static genFIType call(genFIType x)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static genFIType call(genFIType x)
 		{
 			GLM_STATIC_ASSERT(
 				std::numeric_limits<genFIType>::is_iec559 || std::numeric_limits<genFIType>::is_signed,
@@ -61,7 +61,7 @@ namespace detail
 	template <typename genFIType>
 	struct compute_abs<genFIType, false>
 	{
-		GLM_FUNC_QUALIFIER static genFIType call(genFIType x)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static genFIType call(genFIType x)
 		{
 			GLM_STATIC_ASSERT(
 				!std::numeric_limits<genFIType>::is_signed && std::numeric_limits<genFIType>::is_integer,
@@ -70,6 +70,131 @@ namespace detail
 		}
 	};
 
+	template <typename genType>
+	struct compute_fma
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static genType call(genType const & a, genType const & b, genType const & c)
+		{
+			return a * b + c;
+		}
+	};
+
+#	if GLM_HAS_FMA
+		// GCC builtins generate the same instruction and remain usable in constant expressions
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+			template <>
+			struct compute_fma<float>
+			{
+				GLM_FUNC_QUALIFIER GLM_CONSTEXPR static float call(float const & a, float const & b, float const & c)
+				{
+					return __builtin_fmaf(a, b, c);
+				}
+			};
+
+			template <>
+			struct compute_fma<double>
+			{
+				GLM_FUNC_QUALIFIER GLM_CONSTEXPR static double call(double const & a, double const & b, double const & c)
+				{
+					return __builtin_fma(a, b, c);
+				}
+			};
+#		else
+			template <>
+			struct compute_fma<float>
+			{
+				GLM_FUNC_QUALIFIER static float call(float const & a, float const & b, float const & c)
+				{
+					return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(a), _mm_set_ss(b), _mm_set_ss(c)));
+				}
+			};
+
+			template <>
+			struct compute_fma<double>
+			{
+				GLM_FUNC_QUALIFIER static double call(double const & a, double const & b, double const & c)
+				{
+					return _mm_cvtsd_f64(_mm_fmadd_sd(_mm_set_sd(a), _mm_set_sd(b), _mm_set_sd(c)));
+				}
+			};
+#		endif
+
+		template <typename T, precision P>
+		struct compute_fma<tvec2<T, P> >
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR static tvec2<T, P> call(tvec2<T, P> const & a, tvec2<T, P> const & b, tvec2<T, P> const & c)
+			{
+				return tvec2<T, P>(
+					compute_fma<T>::call(a.x, b.x, c.x),
+					compute_fma<T>::call(a.y, b.y, c.y));
+			}
+		};
+
+		template <typename T, precision P>
+		struct compute_fma<tvec3<T, P> >
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR static tvec3<T, P> call(tvec3<T, P> const & a, tvec3<T, P> const & b, tvec3<T, P> const & c)
+			{
+				return tvec3<T, P>(
+					compute_fma<T>::call(a.x, b.x, c.x),
+					compute_fma<T>::call(a.y, b.y, c.y),
+					compute_fma<T>::call(a.z, b.z, c.z));
+			}
+		};
+
+		template <typename T, precision P>
+		struct compute_fma<tvec4<T, P> >
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR static tvec4<T, P> call(tvec4<T, P> const & a, tvec4<T, P> const & b, tvec4<T, P> const & c)
+			{
+				return tvec4<T, P>(
+					compute_fma<T>::call(a.x, b.x, c.x),
+					compute_fma<T>::call(a.y, b.y, c.y),
+					compute_fma<T>::call(a.z, b.z, c.z),
+					compute_fma<T>::call(a.w, b.w, c.w));
+			}
+		};
+
+		// Constant evaluations use the component-wise fma
+		template <precision P>
+		struct compute_fma<tvec4<float, P> >
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b, tvec4<float, P> const & c)
+			{
+				if(GLM_NOT_CONSTANT_EVALUATED)
+				{
+					tvec4<float, P> Result(uninitialize);
+					_mm_storeu_ps(&Result[0], _mm_fmadd_ps(_mm_loadu_ps(&a[0]), _mm_loadu_ps(&b[0]), _mm_loadu_ps(&c[0])));
+					return Result;
+				}
+				return tvec4<float, P>(
+					compute_fma<float>::call(a.x, b.x, c.x),
+					compute_fma<float>::call(a.y, b.y, c.y),
+					compute_fma<float>::call(a.z, b.z, c.z),
+					compute_fma<float>::call(a.w, b.w, c.w));
+			}
+		};
+
+		template <precision P>
+		struct compute_fma<tvec4<double, P> >
+		{
+			GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 static tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b, tvec4<double, P> const & c)
+			{
+				if(GLM_NOT_CONSTANT_EVALUATED)
+				{
+					tvec4<double, P> Result(uninitialize);
+					_mm256_storeu_pd(&Result[0], _mm256_fmadd_pd(_mm256_loadu_pd(&a[0]), _mm256_loadu_pd(&b[0]), _mm256_loadu_pd(&c[0])));
+					return Result;
+				}
+				return tvec4<double, P>(
+					compute_fma<double>::call(a.x, b.x, c.x),
+					compute_fma<double>::call(a.y, b.y, c.y),
+					compute_fma<double>::call(a.z, b.z, c.z),
+					compute_fma<double>::call(a.w, b.w, c.w));
+			}
+		};
+#	endif//GLM_HAS_FMA
+
 	template <typename T, typename U, precision P, template <class, precision> class vecType>
 	struct compute_mix_vector
 	{
@@ -77,7 +202,7 @@ namespace detail
 		{
 			GLM_STATIC_ASSERT(std::numeric_limits<U>::is_iec559, "'mix' only accept floating-point inputs for the interpolator a");
 
-			return vecType<T, P>(vecType<U, P>(x) + a * vecType<U, P>(y - x));
+			return vecType<T, P>(compute_fma<vecType<U, P> >::call(a, vecType<U, P>(y - x), vecType<U, P>(x)));
 		}
 	};
 
@@ -100,7 +225,7 @@ namespace detail
 		{
 			GLM_STATIC_ASSERT(std::numeric_limits<U>::is_iec559, "'mix' only accept floating-point inputs for the interpolator a");
 
-			return vecType<T, P>(vecType<U, P>(x) + a * vecType<U, P>(y - x));
+			return vecType<T, P>(compute_fma<vecType<U, P> >::call(vecType<U, P>(a), vecType<U, P>(y - x), vecType<U, P>(x)));
 		}
 	};
 
@@ -120,7 +245,7 @@ namespace detail
 		{
 			GLM_STATIC_ASSERT(std::numeric_limits<U>::is_iec559, "'mix' only accept floating-point inputs for the interpolator a");
 
-			return static_cast<T>(static_cast<U>(x) + a * static_cast<U>(y - x));
+			return static_cast<T>(compute_fma<U>::call(a, static_cast<U>(y - x), static_cast<U>(x)));
 		}
 	};
 
@@ -183,7 +308,7 @@ namespace detail
 	}
 
 	template <typename genFIType>
-	GLM_FUNC_QUALIFIER genFIType abs(genFIType x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genFIType abs(genFIType x)
 	{
 		return detail::compute_abs<genFIType, std::numeric_limits<genFIType>::is_signed>::call(x);
 	}
@@ -654,7 +779,7 @@ namespace detail
 	template <typename genType>
 	GLM_FUNC_QUALIFIER genType fma(genType const & a, genType const & b, genType const & c)
 	{
-		return a * b + c;
+		return detail::compute_fma<genType>::call(a, b, c);
 	}
 
 	template <typename genType>
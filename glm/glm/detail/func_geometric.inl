@@ -45,7 +45,7 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_dot<tvec1, T, P>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec1<T, P> const & a, tvec1<T, P> const & b)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(tvec1<T, P> const & a, tvec1<T, P> const & b)
 		{
 			return a.x * b.x;
 		}
@@ -54,30 +54,27 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_dot<tvec2, T, P>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec2<T, P> const & x, tvec2<T, P> const & y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(tvec2<T, P> const & x, tvec2<T, P> const & y)
 		{
-			tvec2<T, P> tmp(x * y);
-			return tmp.x + tmp.y;
+			return compute_fma<T>::call(x.y, y.y, x.x * y.x);
 		}
 	};
 
 	template <typename T, precision P>
 	struct compute_dot<tvec3, T, P>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec3<T, P> const & x, tvec3<T, P> const & y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(tvec3<T, P> const & x, tvec3<T, P> const & y)
 		{
-			tvec3<T, P> tmp(x * y);
-			return tmp.x + tmp.y + tmp.z;
+			return compute_fma<T>::call(x.z, y.z, compute_fma<T>::call(x.y, y.y, x.x * y.x));
 		}
 	};
 
 	template <typename T, precision P>
 	struct compute_dot<tvec4, T, P>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec4<T, P> const & x, tvec4<T, P> const & y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static T call(tvec4<T, P> const & x, tvec4<T, P> const & y)
 		{
-			tvec4<T, P> tmp(x * y);
-			return (tmp.x + tmp.y) + (tmp.z + tmp.w);
+			return compute_fma<T>::call(x.y, y.y, x.x * y.x) + compute_fma<T>::call(x.w, y.w, x.z * y.z);
 		}
 	};
 }//namespace detail
@@ -116,14 +113,14 @@ namespace detail
 
 	// dot
 	template <typename T>
-	GLM_FUNC_QUALIFIER T dot(T x, T y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T dot(T x, T y)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'dot' only accept floating-point inputs");
 		return x * y;
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER T dot(vecType<T, P> const & x, vecType<T, P> const & y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T dot(vecType<T, P> const & x, vecType<T, P> const & y)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'dot' only accept floating-point inputs");
 		return detail::compute_dot<vecType, T, P>::call(x, y);
@@ -131,7 +128,7 @@ namespace detail
 
 	// cross
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> cross(tvec3<T, P> const & x, tvec3<T, P> const & y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR tvec3<T, P> cross(tvec3<T, P> const & x, tvec3<T, P> const & y)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cross' only accept floating-point inputs");
 
@@ -41,6 +41,9 @@
 #	pragma intrinsic(_BitScanReverse)
 #endif//(GLM_COMPILER & GLM_COMPILER_VC)
 #endif//(GLM_ARCH != GLM_ARCH_PURE)
+#if GLM_ARCH & GLM_ARCH_SSE2
+#	include "intrinsic_integer.hpp"
+#endif
 #include <limits>
 
 namespace glm{
@@ -128,8 +131,35 @@ namespace detail
 			}
 		};
 #		endif
+#	elif GLM_HAS_BITSCAN_BUILTIN
+		template <typename genIUType>
+		struct compute_findLSB<genIUType, 32>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+				return Value == 0 ? -1 : __builtin_ctz(static_cast<unsigned int>(Value));
+			}
+		};
+
+		template <typename genIUType>
+		struct compute_findLSB<genIUType, 64>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+				return Value == 0 ? -1 : __builtin_ctzll(static_cast<unsigned long long>(Value));
+			}
+		};
 #	endif//GLM_HAS_BITSCAN_WINDOWS
 
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType>
+	struct compute_findLSB_vec
+	{
+		GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<int, T, P, vecType>::call(findLSB, x);
+		}
+	};
+
 	template <typename T, glm::precision P, template <class, glm::precision> class vecType, bool EXEC = true>
 	struct compute_findMSB_step_vec
 	{
@@ -200,7 +230,207 @@ namespace detail
 			}
 		};
 #		endif
+#	elif GLM_HAS_BITSCAN_BUILTIN
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_findMSB_32(genIUType Value)
+		{
+			return Value == 0 ? -1 : 31 - __builtin_clz(static_cast<unsigned int>(Value));
+		}
+
+		template <typename T, glm::precision P, template <class, glm::precision> class vecType>
+		struct compute_findMSB_vec<T, P, vecType, 32>
+		{
+			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+			{
+				return detail::functor1<int, T, P, vecType>::call(compute_findMSB_32, x);
+			}
+		};
+
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_findMSB_64(genIUType Value)
+		{
+			return Value == 0 ? -1 : 63 - __builtin_clzll(static_cast<unsigned long long>(Value));
+		}
+
+		template <typename T, glm::precision P, template <class, glm::precision> class vecType>
+		struct compute_findMSB_vec<T, P, vecType, 64>
+		{
+			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+			{
+				return detail::functor1<int, T, P, vecType>::call(compute_findMSB_64, x);
+			}
+		};
 #	endif//GLM_HAS_BITSCAN_WINDOWS
+
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, int>
+	struct compute_bitCount_vec
+	{
+		GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & v)
+		{
+			typedef typename detail::make_unsigned<T>::type utype;
+
+			vecType<utype, P> x(*reinterpret_cast<vecType<utype, P> const *>(&v));
+			x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >=  2>::call(x, utype(0x5555555555555555ull), utype( 1));
+			x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >=  4>::call(x, utype(0x3333333333333333ull), utype( 2));
+			x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >=  8>::call(x, utype(0x0F0F0F0F0F0F0F0Full), utype( 4));
+			x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >= 16>::call(x, utype(0x00FF00FF00FF00FFull), utype( 8));
+			x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >= 32>::call(x, utype(0x0000FFFF0000FFFFull), utype(16));
+			x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >= 64>::call(x, utype(0x00000000FFFFFFFFull), utype(32));
+			return vecType<int, P>(x);
+		}
+	};
+
+#	if GLM_HAS_POPCNT
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_bitCount_32(genIUType Value)
+		{
+#			if GLM_HAS_BITSCAN_BUILTIN
+				return __builtin_popcount(static_cast<unsigned int>(Value));
+#			else
+				return static_cast<int>(__popcnt(static_cast<unsigned int>(Value)));
+#			endif
+		}
+
+		template <typename T, glm::precision P, template <class, glm::precision> class vecType>
+		struct compute_bitCount_vec<T, P, vecType, 32>
+		{
+			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+			{
+				return detail::functor1<int, T, P, vecType>::call(compute_bitCount_32, x);
+			}
+		};
+
+#		if !((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_MODEL == GLM_MODEL_32))
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_bitCount_64(genIUType Value)
+		{
+#			if GLM_HAS_BITSCAN_BUILTIN
+				return __builtin_popcountll(static_cast<unsigned long long>(Value));
+#			else
+				return static_cast<int>(__popcnt64(static_cast<unsigned __int64>(Value)));
+#			endif
+		}
+
+		template <typename T, glm::precision P, template <class, glm::precision> class vecType>
+		struct compute_bitCount_vec<T, P, vecType, 64>
+		{
+			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+			{
+				return detail::functor1<int, T, P, vecType>::call(compute_bitCount_64, x);
+			}
+		};
+#		endif
+#	endif//GLM_HAS_POPCNT
+
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType>
+	struct compute_bitfieldReverse_vec
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & v)
+		{
+			typedef typename detail::make_unsigned<T>::type utype;
+
+			// Logical shifts, the sign bit of signed values would be replicated by the arithmetic ones
+			vecType<utype, P> x(*reinterpret_cast<vecType<utype, P> const *>(&v));
+			x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >=  2>::call(x, utype(0x5555555555555555ull), static_cast<utype>( 1));
+			x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >=  4>::call(x, utype(0x3333333333333333ull), static_cast<utype>( 2));
+			x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >=  8>::call(x, utype(0x0F0F0F0F0F0F0F0Full), static_cast<utype>( 4));
+			x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >= 16>::call(x, utype(0x00FF00FF00FF00FFull), static_cast<utype>( 8));
+			x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >= 32>::call(x, utype(0x0000FFFF0000FFFFull), static_cast<utype>(16));
+			x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >= 64>::call(x, utype(0x00000000FFFFFFFFull), static_cast<utype>(32));
+			return vecType<T, P>(x);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2
+		// The four 32-bit components of tvec4<int> and tvec4<uint> are processed in a single register
+		template <glm::precision P>
+		struct compute_bitCount_vec<int, P, tvec4, 32>
+		{
+			GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & v)
+			{
+				tvec4<int, P> Result(uninitialize);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Result), sse_bitcount_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&v))));
+				return Result;
+			}
+		};
+
+		template <glm::precision P>
+		struct compute_bitCount_vec<uint, P, tvec4, 32>
+		{
+			GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint, P> const & v)
+			{
+				tvec4<int, P> Result(uninitialize);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Result), sse_bitcount_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&v))));
+				return Result;
+			}
+		};
+
+		template <glm::precision P>
+		struct compute_findLSB_vec<int, P, tvec4>
+		{
+			GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & v)
+			{
+				tvec4<int, P> Result(uninitialize);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Result), sse_findlsb_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&v))));
+				return Result;
+			}
+		};
+
+		template <glm::precision P>
+		struct compute_findLSB_vec<uint, P, tvec4>
+		{
+			GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint, P> const & v)
+			{
+				tvec4<int, P> Result(uninitialize);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Result), sse_findlsb_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&v))));
+				return Result;
+			}
+		};
+
+		template <glm::precision P>
+		struct compute_findMSB_vec<int, P, tvec4, 32>
+		{
+			GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & v)
+			{
+				tvec4<int, P> Result(uninitialize);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Result), sse_findmsb_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&v))));
+				return Result;
+			}
+		};
+
+		template <glm::precision P>
+		struct compute_findMSB_vec<uint, P, tvec4, 32>
+		{
+			GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint, P> const & v)
+			{
+				tvec4<int, P> Result(uninitialize);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Result), sse_findmsb_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&v))));
+				return Result;
+			}
+		};
+
+		template <glm::precision P>
+		struct compute_bitfieldReverse_vec<int, P, tvec4>
+		{
+			GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & v)
+			{
+				tvec4<int, P> Result(uninitialize);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Result), sse_bitreverse_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&v))));
+				return Result;
+			}
+		};
+
+		template <glm::precision P>
+		struct compute_bitfieldReverse_vec<uint, P, tvec4>
+		{
+			GLM_FUNC_QUALIFIER static tvec4<uint, P> call(tvec4<uint, P> const & v)
+			{
+				tvec4<uint, P> Result(uninitialize);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Result), sse_bitreverse_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&v))));
+				return Result;
+			}
+		};
+#	endif
 }//namespace detail
 
 	// uaddCarry
@@ -323,14 +553,7 @@ namespace detail
 	template <typename T, glm::precision P, template <typename, glm::precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> bitfieldReverse(vecType<T, P> const & v)
 	{
-		vecType<T, P> x(v);
-		x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >=  2>::call(x, T(0x5555555555555555ull), static_cast<T>( 1));
-		x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >=  4>::call(x, T(0x3333333333333333ull), static_cast<T>( 2));
-		x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >=  8>::call(x, T(0x0F0F0F0F0F0F0F0Full), static_cast<T>( 4));
-		x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >= 16>::call(x, T(0x00FF00FF00FF00FFull), static_cast<T>( 8));
-		x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >= 32>::call(x, T(0x0000FFFF0000FFFFull), static_cast<T>(16));
-		x = detail::compute_bitfieldReverseStep<sizeof(T) * 8 >= 64>::call(x, T(0x00000000FFFFFFFFull), static_cast<T>(32));
-		return x;
+		return detail::compute_bitfieldReverse_vec<T, P, vecType>::call(v);
 	}
 
 	// bitCount
@@ -343,14 +566,7 @@ namespace detail
 	template <typename T, glm::precision P, template <typename, glm::precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<int, P> bitCount(vecType<T, P> const & v)
 	{
-		vecType<typename detail::make_unsigned<T>::type, P> x(*reinterpret_cast<vecType<typename detail::make_unsigned<T>::type, P> const *>(&v));
-		x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >=  2>::call(x, typename detail::make_unsigned<T>::type(0x5555555555555555ull), typename detail::make_unsigned<T>::type( 1));
-		x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >=  4>::call(x, typename detail::make_unsigned<T>::type(0x3333333333333333ull), typename detail::make_unsigned<T>::type( 2));
-		x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >=  8>::call(x, typename detail::make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename detail::make_unsigned<T>::type( 4));
-		x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >= 16>::call(x, typename detail::make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename detail::make_unsigned<T>::type( 8));
-		x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >= 32>::call(x, typename detail::make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename detail::make_unsigned<T>::type(16));
-		x = detail::compute_bitfieldBitCountStep<sizeof(T) * 8 >= 64>::call(x, typename detail::make_unsigned<T>::type(0x00000000FFFFFFFFull), typename detail::make_unsigned<T>::type(32));
-		return vecType<int, P>(x);
+		return detail::compute_bitCount_vec<T, P, vecType, sizeof(T) * 8>::call(v);
 	}
 
 	// findLSB
@@ -367,7 +583,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'findLSB' only accept integer values");
 
-		return detail::functor1<int, T, P, vecType>::call(findLSB, x);
+		return detail::compute_findLSB_vec<T, P, vecType>::call(x);
 	}
 
 	// findMSB
@@ -71,6 +71,9 @@ namespace detail
 
 	__m128 sse_mix_ps(__m128 v1, __m128 v2, __m128 a);
 
+	//a * b + c, fused when GLM_HAS_FMA is set
+	__m128 sse_fma_ps(__m128 a, __m128 b, __m128 c);
+
 	__m128 sse_stp_ps(__m128 edge, __m128 x);
 
 	__m128 sse_ssp_ps(__m128 edge0, __m128 edge1, __m128 x);
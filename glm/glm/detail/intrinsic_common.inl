@@ -256,11 +256,19 @@ GLM_FUNC_QUALIFIER __m128 sse_mix_ps(__m128 v1, __m128 v2, __m128 a)
 {
 	__m128 sub0 = _mm_sub_ps(glm::detail::one, a);
 	__m128 mul0 = _mm_mul_ps(v1, sub0);
-	__m128 mul1 = _mm_mul_ps(v2, a);
-	__m128 add0 = _mm_add_ps(mul0, mul1);
+	__m128 add0 = sse_fma_ps(v2, a, mul0);
 	return add0;
 }
 
+GLM_FUNC_QUALIFIER __m128 sse_fma_ps(__m128 a, __m128 b, __m128 c)
+{
+#	if GLM_HAS_FMA
+		return _mm_fmadd_ps(a, b, c);
+#	else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#	endif
+}
+
 GLM_FUNC_QUALIFIER __m128 sse_stp_ps(__m128 edge, __m128 x)
 {
 	__m128 cmp = _mm_cmple_ps(x, edge);
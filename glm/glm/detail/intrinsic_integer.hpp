@@ -28,7 +28,7 @@
 
 #pragma once
 
-#include "glm/glm.hpp"
+#include "setup.hpp"
 
 #if(!(GLM_ARCH & GLM_ARCH_SSE2))
 #	error "SSE2 instructions not supported or enabled"
@@ -40,6 +40,18 @@ namespace detail
 	__m128i _mm_bit_interleave_si128(__m128i x);
 	__m128i _mm_bit_interleave_si128(__m128i x, __m128i y);
 
+	//bitCount, the number of bits set in each 32-bit lane
+	__m128i sse_bitcount_epi32(__m128i x);
+
+	//bitfieldReverse
+	__m128i sse_bitreverse_epi32(__m128i x);
+
+	//findLSB, -1 for the lanes equal to 0
+	__m128i sse_findlsb_epi32(__m128i x);
+
+	//findMSB, -1 for the lanes equal to 0
+	__m128i sse_findmsb_epi32(__m128i x);
+
 }//namespace detail
 }//namespace glm
 
@@ -135,5 +135,80 @@ namespace detail
 	
 		return Reg1;
 	}
+
+	inline __m128i sse_bitcount_epi32(__m128i x)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE4
+			// The number of bits set in each nibble, then the sums of the bytes of each lane
+			__m128i const Table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+			__m128i const Mask = _mm_set1_epi8(0x0F);
+
+			__m128i const Lo = _mm_shuffle_epi8(Table, _mm_and_si128(x, Mask));
+			__m128i const Hi = _mm_shuffle_epi8(Table, _mm_and_si128(_mm_srli_epi16(x, 4), Mask));
+			return _mm_madd_epi16(_mm_maddubs_epi16(_mm_add_epi8(Lo, Hi), _mm_set1_epi8(1)), _mm_set1_epi16(1));
+#		else
+			__m128i const Mask1 = _mm_set1_epi32(0x55555555);
+			__m128i const Mask2 = _mm_set1_epi32(0x33333333);
+			__m128i const Mask4 = _mm_set1_epi32(0x0F0F0F0F);
+
+			x = _mm_sub_epi32(x, _mm_and_si128(_mm_srli_epi32(x, 1), Mask1));
+			x = _mm_add_epi32(_mm_and_si128(x, Mask2), _mm_and_si128(_mm_srli_epi32(x, 2), Mask2));
+			x = _mm_and_si128(_mm_add_epi32(x, _mm_srli_epi32(x, 4)), Mask4);
+			x = _mm_add_epi32(x, _mm_srli_epi32(x, 8));
+			x = _mm_add_epi32(x, _mm_srli_epi32(x, 16));
+			return _mm_and_si128(x, _mm_set1_epi32(0x3F));
+#		endif
+	}
+
+	inline __m128i sse_bitreverse_epi32(__m128i x)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE4
+			// The reversed nibbles are swapped in each byte, then the bytes of each lane
+			__m128i const TableLo = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F);
+			__m128i const TableHi = _mm_slli_epi16(TableLo, 4);
+			__m128i const Mask = _mm_set1_epi8(0x0F);
+
+			__m128i const Lo = _mm_shuffle_epi8(TableHi, _mm_and_si128(x, Mask));
+			__m128i const Hi = _mm_shuffle_epi8(TableLo, _mm_and_si128(_mm_srli_epi16(x, 4), Mask));
+			return _mm_shuffle_epi8(_mm_or_si128(Lo, Hi), _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+#		else
+			__m128i const Mask1 = _mm_set1_epi32(0x55555555);
+			__m128i const Mask2 = _mm_set1_epi32(0x33333333);
+			__m128i const Mask4 = _mm_set1_epi32(0x0F0F0F0F);
+			__m128i const Mask8 = _mm_set1_epi32(0x00FF00FF);
+
+			x = _mm_or_si128(_mm_slli_epi32(x, 16), _mm_srli_epi32(x, 16));
+			x = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(x, Mask8), 8), _mm_and_si128(_mm_srli_epi32(x, 8), Mask8));
+			x = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(x, Mask4), 4), _mm_and_si128(_mm_srli_epi32(x, 4), Mask4));
+			x = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(x, Mask2), 2), _mm_and_si128(_mm_srli_epi32(x, 2), Mask2));
+			x = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(x, Mask1), 1), _mm_and_si128(_mm_srli_epi32(x, 1), Mask1));
+			return x;
+#		endif
+	}
+
+	// The index of a power of two is the exponent of its exact conversion to float, 2^31 converts to -2^31
+	inline __m128i sse_log2_pow2_epi32(__m128i Pow2)
+	{
+		__m128i const Exponent = _mm_and_si128(_mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(Pow2)), 23), _mm_set1_epi32(0xFF));
+		__m128i const Index = _mm_sub_epi32(Exponent, _mm_set1_epi32(127));
+		return _mm_or_si128(Index, _mm_cmpeq_epi32(Pow2, _mm_setzero_si128()));
+	}
+
+	inline __m128i sse_findlsb_epi32(__m128i x)
+	{
+		// x & -x keeps the lowest bit set
+		return sse_log2_pow2_epi32(_mm_and_si128(x, _mm_sub_epi32(_mm_setzero_si128(), x)));
+	}
+
+	inline __m128i sse_findmsb_epi32(__m128i x)
+	{
+		// Sets the bits below the highest bit set, then keeps the highest one
+		x = _mm_or_si128(x, _mm_srli_epi32(x, 1));
+		x = _mm_or_si128(x, _mm_srli_epi32(x, 2));
+		x = _mm_or_si128(x, _mm_srli_epi32(x, 4));
+		x = _mm_or_si128(x, _mm_srli_epi32(x, 8));
+		x = _mm_or_si128(x, _mm_srli_epi32(x, 16));
+		return sse_log2_pow2_epi32(_mm_andnot_si128(_mm_srli_epi32(x, 1), x));
+	}
 }//namespace detail
 }//namespace glms
@@ -74,12 +74,10 @@ GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 const m[4], __m128 v)
 	__m128 v3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
 
 	__m128 m0 = _mm_mul_ps(m[0], v0);
-	__m128 m1 = _mm_mul_ps(m[1], v1);
 	__m128 m2 = _mm_mul_ps(m[2], v2);
-	__m128 m3 = _mm_mul_ps(m[3], v3);
 
-	__m128 a0 = _mm_add_ps(m0, m1);
-	__m128 a1 = _mm_add_ps(m2, m3);
+	__m128 a0 = sse_fma_ps(m[1], v1, m0);
+	__m128 a1 = sse_fma_ps(m[3], v3, m2);
 	__m128 a2 = _mm_add_ps(a0, a1);
 
 	return a2;
@@ -121,12 +119,10 @@ GLM_FUNC_QUALIFIER void sse_mul_ps(__m128 const in1[4], __m128 const in2[4], __m
 		__m128 e3 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
 		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = sse_fma_ps(in1[1], e1, m0);
+		__m128 a1 = sse_fma_ps(in1[3], e3, m2);
 		__m128 a2 = _mm_add_ps(a0, a1);
 
 		out[0] = a2;
@@ -139,12 +135,10 @@ GLM_FUNC_QUALIFIER void sse_mul_ps(__m128 const in1[4], __m128 const in2[4], __m
 		__m128 e3 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
 		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = sse_fma_ps(in1[1], e1, m0);
+		__m128 a1 = sse_fma_ps(in1[3], e3, m2);
 		__m128 a2 = _mm_add_ps(a0, a1);
 
 		out[1] = a2;
@@ -157,12 +151,10 @@ GLM_FUNC_QUALIFIER void sse_mul_ps(__m128 const in1[4], __m128 const in2[4], __m
 		__m128 e3 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
 		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = sse_fma_ps(in1[1], e1, m0);
+		__m128 a1 = sse_fma_ps(in1[3], e3, m2);
 		__m128 a2 = _mm_add_ps(a0, a1);
 
 		out[2] = a2;
@@ -176,12 +168,10 @@ GLM_FUNC_QUALIFIER void sse_mul_ps(__m128 const in1[4], __m128 const in2[4], __m
 		__m128 e3 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
 		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
 
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a0 = sse_fma_ps(in1[1], e1, m0);
+		__m128 a1 = sse_fma_ps(in1[3], e3, m2);
 		__m128 a2 = _mm_add_ps(a0, a1);
 
 		out[3] = a2;
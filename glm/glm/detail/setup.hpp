@@ -590,6 +590,15 @@
 #	define GLM_HAS_CONSTEXPR_PARTIAL GLM_HAS_CONSTEXPR || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC2015))
 #endif
 
+// N3652 Relaxing constraints on constexpr functions
+#if GLM_COMPILER & (GLM_COMPILER_LLVM | GLM_COMPILER_APPLE_CLANG)
+#	define GLM_HAS_CONSTEXPR_CXX14 __has_feature(cxx_relaxed_constexpr)
+#elif GLM_LANG & GLM_LANG_CXX14_FLAG
+#	define GLM_HAS_CONSTEXPR_CXX14 GLM_HAS_CONSTEXPR
+#else
+#	define GLM_HAS_CONSTEXPR_CXX14 0
+#endif
+
 // N2672
 #if GLM_COMPILER & (GLM_COMPILER_LLVM | GLM_COMPILER_APPLE_CLANG)
 #	define GLM_HAS_INITIALIZER_LISTS __has_feature(cxx_generalized_initializers)
@@ -697,6 +706,13 @@
 		(GLM_COMPILER & (GLM_COMPILER_VC | GLM_COMPILER_LLVM | GLM_COMPILER_INTEL))
 #endif
 
+// Bit scan and population count builtins of GCC and Clang
+#if GLM_HAS_BITSCAN_WINDOWS
+#	define GLM_HAS_BITSCAN_BUILTIN 0
+#else
+#	define GLM_HAS_BITSCAN_BUILTIN (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_LLVM | GLM_COMPILER_APPLE_CLANG))
+#endif
+
 // OpenMP
 #ifdef _OPENMP
 #	if GLM_COMPILER & GLM_COMPILER_GCC
@@ -817,6 +833,29 @@
 #	endif
 #endif//GLM_ARCH
 
+// Fused multiply-add, provided by AVX2 processors. With GCC and Clang, -mavx2 doesn't imply -mfma.
+#if (GLM_ARCH & GLM_ARCH_AVX2) && (defined(__FMA__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_FMA 1
+#else
+#	define GLM_HAS_FMA 0
+#endif
+
+// Parallel bits deposit and extract, provided by AVX2 processors. With GCC and Clang, -mavx2 doesn't imply -mbmi2.
+#if (GLM_ARCH & GLM_ARCH_AVX2) && (defined(__BMI2__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_BMI2 1
+#else
+#	define GLM_HAS_BMI2 0
+#endif
+
+// Population count instruction, provided by SSE4.2 processors. With GCC and Clang, -msse4.1 doesn't imply -mpopcnt.
+#if GLM_HAS_BITSCAN_BUILTIN && defined(__POPCNT__)
+#	define GLM_HAS_POPCNT 1
+#elif GLM_HAS_BITSCAN_WINDOWS && (GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX)
+#	define GLM_HAS_POPCNT 1
+#else
+#	define GLM_HAS_POPCNT 0
+#endif
+
 #if defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_ARCH_DISPLAYED)
 #	define GLM_MESSAGE_ARCH_DISPLAYED
 #	if(GLM_ARCH == GLM_ARCH_PURE)
@@ -944,6 +983,33 @@
 #	define GLM_RELAXED_CONSTEXPR const
 #endif
 
+// Constant evaluation of the vector, matrix and quaternion types, not available with the anonymous union storage
+#if GLM_HAS_CONSTEXPR && !GLM_HAS_ANONYMOUS_UNION
+#	define GLM_CONSTEXPR_CTOR constexpr
+#else
+#	define GLM_CONSTEXPR_CTOR
+#endif
+
+#if GLM_HAS_CONSTEXPR_CXX14 && !GLM_HAS_ANONYMOUS_UNION
+#	define GLM_CONSTEXPR_CXX14 constexpr
+#else
+#	define GLM_CONSTEXPR_CXX14
+#endif
+
+// Condition selecting the runtime code path of the functions which need another implementation for constant evaluation
+#if GLM_HAS_CONSTEXPR_CXX14 && !GLM_HAS_ANONYMOUS_UNION
+#	if defined(__has_builtin)
+#		if __has_builtin(__builtin_is_constant_evaluated)
+#			define GLM_NOT_CONSTANT_EVALUATED !__builtin_is_constant_evaluated()
+#		endif
+#	endif
+#	ifndef GLM_NOT_CONSTANT_EVALUATED
+#		define GLM_NOT_CONSTANT_EVALUATED false
+#	endif
+#else
+#	define GLM_NOT_CONSTANT_EVALUATED true
+#endif
+
 #ifdef GLM_FORCE_EXPLICIT_CTOR
 #	define GLM_EXPLICIT explicit
 #else
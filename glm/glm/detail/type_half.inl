@@ -273,5 +273,60 @@ namespace detail
 		}
 	}
 
+#	if GLM_ARCH & GLM_ARCH_SSE2
+	// Four toFloat32 conversions, the halves are read from the low 16 bits of the 32-bit lanes.
+	GLM_FUNC_QUALIFIER __m128 sse_toFloat32_ps(__m128i h)
+	{
+		__m128i const Sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+		__m128i const Abs = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+		__m128i const Exponent = _mm_and_si128(h, _mm_set1_epi32(0x7c00));
+
+		// Normalized numbers: adjust the exponent bias, twice for infinities and NANs which
+		// then reach the float maximum exponent with their significand preserved.
+		__m128i const Special = _mm_cmpeq_epi32(Exponent, _mm_set1_epi32(0x7c00));
+		__m128i Normal = _mm_add_epi32(_mm_slli_epi32(Abs, 13), _mm_set1_epi32(0x38000000));
+		Normal = _mm_add_epi32(Normal, _mm_and_si128(Special, _mm_set1_epi32(0x38000000)));
+
+		// Zeros and denormalized numbers: the significand scaled by 2^-24, exact.
+		__m128i const Denorm = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(Abs), _mm_set1_ps(5.9604644775390625e-8f)));
+		__m128i const IsDenorm = _mm_cmpeq_epi32(Exponent, _mm_setzero_si128());
+
+		__m128i const Result = _mm_or_si128(_mm_and_si128(IsDenorm, Denorm), _mm_andnot_si128(IsDenorm, Normal));
+		return _mm_castsi128_ps(_mm_or_si128(Result, Sign));
+	}
+
+	// Four toFloat16 conversions, the halves are returned in the low 16 bits of the 32-bit lanes.
+	// Each lane is rounded the same way as toFloat16, to nearest with "0.5" rounded up.
+	GLM_FUNC_QUALIFIER __m128i sse_toFloat16_ps(__m128 v)
+	{
+		__m128i const i = _mm_castps_si128(v);
+		__m128i const Sign = _mm_and_si128(_mm_srli_epi32(i, 16), _mm_set1_epi32(0x8000));
+		__m128i const Abs = _mm_and_si128(i, _mm_set1_epi32(0x7fffffff));
+
+		// Normalized numbers: adjust the exponent bias and round, a carry out of the
+		// significand increments the exponent. Overflows saturate to infinity.
+		__m128i Normal = _mm_srli_epi32(_mm_add_epi32(Abs, _mm_set1_epi32(0x1000 - 0x38000000)), 13);
+		__m128i const Overflow = _mm_cmpgt_epi32(Normal, _mm_set1_epi32(0x7c00));
+		Normal = _mm_or_si128(_mm_andnot_si128(Overflow, Normal), _mm_and_si128(Overflow, _mm_set1_epi32(0x7c00)));
+
+		// Denormalized halves: |f| * 2^24 is exact, its integer part is the significand.
+		__m128 const Scaled = _mm_mul_ps(_mm_castsi128_ps(Abs), _mm_set1_ps(16777216.0f));
+		__m128i const Truncated = _mm_cvttps_epi32(Scaled);
+		__m128 const Fraction = _mm_sub_ps(Scaled, _mm_cvtepi32_ps(Truncated));
+		__m128i const Denorm = _mm_sub_epi32(Truncated, _mm_castps_si128(_mm_cmpge_ps(Fraction, _mm_set1_ps(0.5f))));
+		__m128i const IsDenorm = _mm_cmplt_epi32(Abs, _mm_set1_epi32(0x38800000));
+
+		// NANs: keep the 10 leftmost bits of the significand, at least one of them set.
+		__m128i const Significand = _mm_srli_epi32(_mm_and_si128(i, _mm_set1_epi32(0x007fffff)), 13);
+		__m128i const NaNBit = _mm_and_si128(_mm_cmpeq_epi32(Significand, _mm_setzero_si128()), _mm_set1_epi32(1));
+		__m128i const NaN = _mm_or_si128(_mm_or_si128(Significand, NaNBit), _mm_set1_epi32(0x7c00));
+		__m128i const IsNaN = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(0x7f800000));
+
+		__m128i Result = _mm_or_si128(_mm_and_si128(IsNaN, NaN), _mm_andnot_si128(IsNaN, Normal));
+		Result = _mm_or_si128(_mm_and_si128(IsDenorm, Denorm), _mm_andnot_si128(IsDenorm, Result));
+		return _mm_or_si128(Result, Sign);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2
+
 }//namespace detail
 }//namespace glm
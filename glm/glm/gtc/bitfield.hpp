@@ -230,6 +230,48 @@ namespace glm
 	/// @see gtc_bitfield
 	GLM_FUNC_DECL uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w);
 
+	/// Deinterleaves the bits of v, the inverse of bitfieldInterleave(uint8 x, uint8 y).
+	/// When GLM_HAS_BMI2 is set, bitfieldInterleave and bitfieldDeinterleave use the pdep and pext instructions.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint16 v, uint8 & x, uint8 & y);
+
+	/// Deinterleaves the bits of v, the inverse of bitfieldInterleave(uint16 x, uint16 y).
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint32 v, uint16 & x, uint16 & y);
+
+	/// Deinterleaves the bits of v, the inverse of bitfieldInterleave(uint32 x, uint32 y).
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint64 v, uint32 & x, uint32 & y);
+
+	/// Deinterleaves the bits of v, the inverse of bitfieldInterleave(uint8 x, uint8 y, uint8 z).
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint32 v, uint8 & x, uint8 & y, uint8 & z);
+
+	/// Deinterleaves the bits of v, the inverse of bitfieldInterleave(uint16 x, uint16 y, uint16 z).
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint64 v, uint16 & x, uint16 & y, uint16 & z);
+
+	/// Deinterleaves the bits of v, the inverse of bitfieldInterleave(uint32 x, uint32 y, uint32 z).
+	/// Only the 22 lowest bits of x and the 21 lowest bits of y and z are stored by bitfieldInterleave.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint64 v, uint32 & x, uint32 & y, uint32 & z);
+
+	/// Deinterleaves the bits of v, the inverse of bitfieldInterleave(uint8 x, uint8 y, uint8 z, uint8 w).
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint32 v, uint8 & x, uint8 & y, uint8 & z, uint8 & w);
+
+	/// Deinterleaves the bits of v, the inverse of bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w).
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint64 v, uint16 & x, uint16 & y, uint16 & z, uint16 & w);
+
 	/// @}
 } //namespace glm
 
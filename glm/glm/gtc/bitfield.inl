@@ -45,207 +45,285 @@ namespace detail
 	template <>
 	GLM_FUNC_QUALIFIER glm::uint16 bitfieldInterleave(glm::uint8 x, glm::uint8 y)
 	{
-		glm::uint16 REG1(x);
-		glm::uint16 REG2(y);
+#		if GLM_HAS_BMI2
+			return static_cast<glm::uint16>(_pdep_u32(x, 0x5555) | _pdep_u32(y, 0xAAAA));
+#		else
+			glm::uint16 REG1(x);
+			glm::uint16 REG2(y);
 
-		REG1 = ((REG1 <<  4) | REG1) & glm::uint16(0x0F0F);
-		REG2 = ((REG2 <<  4) | REG2) & glm::uint16(0x0F0F);
+			REG1 = ((REG1 <<  4) | REG1) & glm::uint16(0x0F0F);
+			REG2 = ((REG2 <<  4) | REG2) & glm::uint16(0x0F0F);
 
-		REG1 = ((REG1 <<  2) | REG1) & glm::uint16(0x3333);
-		REG2 = ((REG2 <<  2) | REG2) & glm::uint16(0x3333);
+			REG1 = ((REG1 <<  2) | REG1) & glm::uint16(0x3333);
+			REG2 = ((REG2 <<  2) | REG2) & glm::uint16(0x3333);
 
-		REG1 = ((REG1 <<  1) | REG1) & glm::uint16(0x5555);
-		REG2 = ((REG2 <<  1) | REG2) & glm::uint16(0x5555);
+			REG1 = ((REG1 <<  1) | REG1) & glm::uint16(0x5555);
+			REG2 = ((REG2 <<  1) | REG2) & glm::uint16(0x5555);
 
-		return REG1 | (REG2 << 1);
+			return REG1 | (REG2 << 1);
+#		endif
 	}
 
 	template <>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint16 x, glm::uint16 y)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x55555555) | _pdep_u32(y, 0xAAAAAAAA);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
 
-		REG1 = ((REG1 <<  8) | REG1) & glm::uint32(0x00FF00FF);
-		REG2 = ((REG2 <<  8) | REG2) & glm::uint32(0x00FF00FF);
+			REG1 = ((REG1 <<  8) | REG1) & glm::uint32(0x00FF00FF);
+			REG2 = ((REG2 <<  8) | REG2) & glm::uint32(0x00FF00FF);
 
-		REG1 = ((REG1 <<  4) | REG1) & glm::uint32(0x0F0F0F0F);
-		REG2 = ((REG2 <<  4) | REG2) & glm::uint32(0x0F0F0F0F);
+			REG1 = ((REG1 <<  4) | REG1) & glm::uint32(0x0F0F0F0F);
+			REG2 = ((REG2 <<  4) | REG2) & glm::uint32(0x0F0F0F0F);
 
-		REG1 = ((REG1 <<  2) | REG1) & glm::uint32(0x33333333);
-		REG2 = ((REG2 <<  2) | REG2) & glm::uint32(0x33333333);
+			REG1 = ((REG1 <<  2) | REG1) & glm::uint32(0x33333333);
+			REG2 = ((REG2 <<  2) | REG2) & glm::uint32(0x33333333);
 
-		REG1 = ((REG1 <<  1) | REG1) & glm::uint32(0x55555555);
-		REG2 = ((REG2 <<  1) | REG2) & glm::uint32(0x55555555);
+			REG1 = ((REG1 <<  1) | REG1) & glm::uint32(0x55555555);
+			REG2 = ((REG2 <<  1) | REG2) & glm::uint32(0x55555555);
 
-		return REG1 | (REG2 << 1);
+			return REG1 | (REG2 << 1);
+#		endif
 	}
 
 	template <>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
 
-		REG1 = ((REG1 << 16) | REG1) & glm::uint64(0x0000FFFF0000FFFF);
-		REG2 = ((REG2 << 16) | REG2) & glm::uint64(0x0000FFFF0000FFFF);
+			REG1 = ((REG1 << 16) | REG1) & glm::uint64(0x0000FFFF0000FFFF);
+			REG2 = ((REG2 << 16) | REG2) & glm::uint64(0x0000FFFF0000FFFF);
 
-		REG1 = ((REG1 <<  8) | REG1) & glm::uint64(0x00FF00FF00FF00FF);
-		REG2 = ((REG2 <<  8) | REG2) & glm::uint64(0x00FF00FF00FF00FF);
+			REG1 = ((REG1 <<  8) | REG1) & glm::uint64(0x00FF00FF00FF00FF);
+			REG2 = ((REG2 <<  8) | REG2) & glm::uint64(0x00FF00FF00FF00FF);
 
-		REG1 = ((REG1 <<  4) | REG1) & glm::uint64(0x0F0F0F0F0F0F0F0F);
-		REG2 = ((REG2 <<  4) | REG2) & glm::uint64(0x0F0F0F0F0F0F0F0F);
+			REG1 = ((REG1 <<  4) | REG1) & glm::uint64(0x0F0F0F0F0F0F0F0F);
+			REG2 = ((REG2 <<  4) | REG2) & glm::uint64(0x0F0F0F0F0F0F0F0F);
 
-		REG1 = ((REG1 <<  2) | REG1) & glm::uint64(0x3333333333333333);
-		REG2 = ((REG2 <<  2) | REG2) & glm::uint64(0x3333333333333333);
+			REG1 = ((REG1 <<  2) | REG1) & glm::uint64(0x3333333333333333);
+			REG2 = ((REG2 <<  2) | REG2) & glm::uint64(0x3333333333333333);
 
-		REG1 = ((REG1 <<  1) | REG1) & glm::uint64(0x5555555555555555);
-		REG2 = ((REG2 <<  1) | REG2) & glm::uint64(0x5555555555555555);
+			REG1 = ((REG1 <<  1) | REG1) & glm::uint64(0x5555555555555555);
+			REG2 = ((REG2 <<  1) | REG2) & glm::uint64(0x5555555555555555);
 
-		return REG1 | (REG2 << 1);
+			return REG1 | (REG2 << 1);
+#		endif
 	}
 
 	template <>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
-		glm::uint32 REG3(z);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x00249249) | _pdep_u32(y, 0x00492492) | _pdep_u32(z, 0x00924924);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
+			glm::uint32 REG3(z);
 
-		REG1 = ((REG1 << 16) | REG1) & glm::uint32(0x00FF0000FF0000FF);
-		REG2 = ((REG2 << 16) | REG2) & glm::uint32(0x00FF0000FF0000FF);
-		REG3 = ((REG3 << 16) | REG3) & glm::uint32(0x00FF0000FF0000FF);
+			REG1 = ((REG1 << 16) | REG1) & glm::uint32(0x00FF0000FF0000FF);
+			REG2 = ((REG2 << 16) | REG2) & glm::uint32(0x00FF0000FF0000FF);
+			REG3 = ((REG3 << 16) | REG3) & glm::uint32(0x00FF0000FF0000FF);
 
-		REG1 = ((REG1 <<  8) | REG1) & glm::uint32(0xF00F00F00F00F00F);
-		REG2 = ((REG2 <<  8) | REG2) & glm::uint32(0xF00F00F00F00F00F);
-		REG3 = ((REG3 <<  8) | REG3) & glm::uint32(0xF00F00F00F00F00F);
+			REG1 = ((REG1 <<  8) | REG1) & glm::uint32(0xF00F00F00F00F00F);
+			REG2 = ((REG2 <<  8) | REG2) & glm::uint32(0xF00F00F00F00F00F);
+			REG3 = ((REG3 <<  8) | REG3) & glm::uint32(0xF00F00F00F00F00F);
 
-		REG1 = ((REG1 <<  4) | REG1) & glm::uint32(0x30C30C30C30C30C3);
-		REG2 = ((REG2 <<  4) | REG2) & glm::uint32(0x30C30C30C30C30C3);
-		REG3 = ((REG3 <<  4) | REG3) & glm::uint32(0x30C30C30C30C30C3);
+			REG1 = ((REG1 <<  4) | REG1) & glm::uint32(0x30C30C30C30C30C3);
+			REG2 = ((REG2 <<  4) | REG2) & glm::uint32(0x30C30C30C30C30C3);
+			REG3 = ((REG3 <<  4) | REG3) & glm::uint32(0x30C30C30C30C30C3);
 
-		REG1 = ((REG1 <<  2) | REG1) & glm::uint32(0x9249249249249249);
-		REG2 = ((REG2 <<  2) | REG2) & glm::uint32(0x9249249249249249);
-		REG3 = ((REG3 <<  2) | REG3) & glm::uint32(0x9249249249249249);
+			REG1 = ((REG1 <<  2) | REG1) & glm::uint32(0x9249249249249249);
+			REG2 = ((REG2 <<  2) | REG2) & glm::uint32(0x9249249249249249);
+			REG3 = ((REG3 <<  2) | REG3) & glm::uint32(0x9249249249249249);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 		
 	template <>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
+			glm::uint64 REG3(z);
 
-		REG1 = ((REG1 << 32) | REG1) & glm::uint64(0xFFFF00000000FFFF);
-		REG2 = ((REG2 << 32) | REG2) & glm::uint64(0xFFFF00000000FFFF);
-		REG3 = ((REG3 << 32) | REG3) & glm::uint64(0xFFFF00000000FFFF);
+			REG1 = ((REG1 << 32) | REG1) & glm::uint64(0xFFFF00000000FFFF);
+			REG2 = ((REG2 << 32) | REG2) & glm::uint64(0xFFFF00000000FFFF);
+			REG3 = ((REG3 << 32) | REG3) & glm::uint64(0xFFFF00000000FFFF);
 
-		REG1 = ((REG1 << 16) | REG1) & glm::uint64(0x00FF0000FF0000FF);
-		REG2 = ((REG2 << 16) | REG2) & glm::uint64(0x00FF0000FF0000FF);
-		REG3 = ((REG3 << 16) | REG3) & glm::uint64(0x00FF0000FF0000FF);
+			REG1 = ((REG1 << 16) | REG1) & glm::uint64(0x00FF0000FF0000FF);
+			REG2 = ((REG2 << 16) | REG2) & glm::uint64(0x00FF0000FF0000FF);
+			REG3 = ((REG3 << 16) | REG3) & glm::uint64(0x00FF0000FF0000FF);
 
-		REG1 = ((REG1 <<  8) | REG1) & glm::uint64(0xF00F00F00F00F00F);
-		REG2 = ((REG2 <<  8) | REG2) & glm::uint64(0xF00F00F00F00F00F);
-		REG3 = ((REG3 <<  8) | REG3) & glm::uint64(0xF00F00F00F00F00F);
+			REG1 = ((REG1 <<  8) | REG1) & glm::uint64(0xF00F00F00F00F00F);
+			REG2 = ((REG2 <<  8) | REG2) & glm::uint64(0xF00F00F00F00F00F);
+			REG3 = ((REG3 <<  8) | REG3) & glm::uint64(0xF00F00F00F00F00F);
 
-		REG1 = ((REG1 <<  4) | REG1) & glm::uint64(0x30C30C30C30C30C3);
-		REG2 = ((REG2 <<  4) | REG2) & glm::uint64(0x30C30C30C30C30C3);
-		REG3 = ((REG3 <<  4) | REG3) & glm::uint64(0x30C30C30C30C30C3);
+			REG1 = ((REG1 <<  4) | REG1) & glm::uint64(0x30C30C30C30C30C3);
+			REG2 = ((REG2 <<  4) | REG2) & glm::uint64(0x30C30C30C30C30C3);
+			REG3 = ((REG3 <<  4) | REG3) & glm::uint64(0x30C30C30C30C30C3);
 
-		REG1 = ((REG1 <<  2) | REG1) & glm::uint64(0x9249249249249249);
-		REG2 = ((REG2 <<  2) | REG2) & glm::uint64(0x9249249249249249);
-		REG3 = ((REG3 <<  2) | REG3) & glm::uint64(0x9249249249249249);
+			REG1 = ((REG1 <<  2) | REG1) & glm::uint64(0x9249249249249249);
+			REG2 = ((REG2 <<  2) | REG2) & glm::uint64(0x9249249249249249);
+			REG3 = ((REG3 <<  2) | REG3) & glm::uint64(0x9249249249249249);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 
 	template <>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y, glm::uint32 z)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
+			glm::uint64 REG3(z);
 
-		REG1 = ((REG1 << 32) | REG1) & glm::uint64(0xFFFF00000000FFFF);
-		REG2 = ((REG2 << 32) | REG2) & glm::uint64(0xFFFF00000000FFFF);
-		REG3 = ((REG3 << 32) | REG3) & glm::uint64(0xFFFF00000000FFFF);
+			REG1 = ((REG1 << 32) | REG1) & glm::uint64(0xFFFF00000000FFFF);
+			REG2 = ((REG2 << 32) | REG2) & glm::uint64(0xFFFF00000000FFFF);
+			REG3 = ((REG3 << 32) | REG3) & glm::uint64(0xFFFF00000000FFFF);
 
-		REG1 = ((REG1 << 16) | REG1) & glm::uint64(0x00FF0000FF0000FF);
-		REG2 = ((REG2 << 16) | REG2) & glm::uint64(0x00FF0000FF0000FF);
-		REG3 = ((REG3 << 16) | REG3) & glm::uint64(0x00FF0000FF0000FF);
+			REG1 = ((REG1 << 16) | REG1) & glm::uint64(0x00FF0000FF0000FF);
+			REG2 = ((REG2 << 16) | REG2) & glm::uint64(0x00FF0000FF0000FF);
+			REG3 = ((REG3 << 16) | REG3) & glm::uint64(0x00FF0000FF0000FF);
 
-		REG1 = ((REG1 <<  8) | REG1) & glm::uint64(0xF00F00F00F00F00F);
-		REG2 = ((REG2 <<  8) | REG2) & glm::uint64(0xF00F00F00F00F00F);
-		REG3 = ((REG3 <<  8) | REG3) & glm::uint64(0xF00F00F00F00F00F);
+			REG1 = ((REG1 <<  8) | REG1) & glm::uint64(0xF00F00F00F00F00F);
+			REG2 = ((REG2 <<  8) | REG2) & glm::uint64(0xF00F00F00F00F00F);
+			REG3 = ((REG3 <<  8) | REG3) & glm::uint64(0xF00F00F00F00F00F);
 
-		REG1 = ((REG1 <<  4) | REG1) & glm::uint64(0x30C30C30C30C30C3);
-		REG2 = ((REG2 <<  4) | REG2) & glm::uint64(0x30C30C30C30C30C3);
-		REG3 = ((REG3 <<  4) | REG3) & glm::uint64(0x30C30C30C30C30C3);
+			REG1 = ((REG1 <<  4) | REG1) & glm::uint64(0x30C30C30C30C30C3);
+			REG2 = ((REG2 <<  4) | REG2) & glm::uint64(0x30C30C30C30C30C3);
+			REG3 = ((REG3 <<  4) | REG3) & glm::uint64(0x30C30C30C30C30C3);
 
-		REG1 = ((REG1 <<  2) | REG1) & glm::uint64(0x9249249249249249);
-		REG2 = ((REG2 <<  2) | REG2) & glm::uint64(0x9249249249249249);
-		REG3 = ((REG3 <<  2) | REG3) & glm::uint64(0x9249249249249249);
+			REG1 = ((REG1 <<  2) | REG1) & glm::uint64(0x9249249249249249);
+			REG2 = ((REG2 <<  2) | REG2) & glm::uint64(0x9249249249249249);
+			REG3 = ((REG3 <<  2) | REG3) & glm::uint64(0x9249249249249249);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2);
+			return REG1 | (REG2 << 1) | (REG3 << 2);
+#		endif
 	}
 
 	template <>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z, glm::uint8 w)
 	{
-		glm::uint32 REG1(x);
-		glm::uint32 REG2(y);
-		glm::uint32 REG3(z);
-		glm::uint32 REG4(w);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x11111111) | _pdep_u32(y, 0x22222222) | _pdep_u32(z, 0x44444444) | _pdep_u32(w, 0x88888888);
+#		else
+			glm::uint32 REG1(x);
+			glm::uint32 REG2(y);
+			glm::uint32 REG3(z);
+			glm::uint32 REG4(w);
 
-		REG1 = ((REG1 << 12) | REG1) & glm::uint32(0x000F000F000F000F);
-		REG2 = ((REG2 << 12) | REG2) & glm::uint32(0x000F000F000F000F);
-		REG3 = ((REG3 << 12) | REG3) & glm::uint32(0x000F000F000F000F);
-		REG4 = ((REG4 << 12) | REG4) & glm::uint32(0x000F000F000F000F);
+			REG1 = ((REG1 << 12) | REG1) & glm::uint32(0x000F000F000F000F);
+			REG2 = ((REG2 << 12) | REG2) & glm::uint32(0x000F000F000F000F);
+			REG3 = ((REG3 << 12) | REG3) & glm::uint32(0x000F000F000F000F);
+			REG4 = ((REG4 << 12) | REG4) & glm::uint32(0x000F000F000F000F);
 
-		REG1 = ((REG1 <<  6) | REG1) & glm::uint32(0x0303030303030303);
-		REG2 = ((REG2 <<  6) | REG2) & glm::uint32(0x0303030303030303);
-		REG3 = ((REG3 <<  6) | REG3) & glm::uint32(0x0303030303030303);
-		REG4 = ((REG4 <<  6) | REG4) & glm::uint32(0x0303030303030303);
+			REG1 = ((REG1 <<  6) | REG1) & glm::uint32(0x0303030303030303);
+			REG2 = ((REG2 <<  6) | REG2) & glm::uint32(0x0303030303030303);
+			REG3 = ((REG3 <<  6) | REG3) & glm::uint32(0x0303030303030303);
+			REG4 = ((REG4 <<  6) | REG4) & glm::uint32(0x0303030303030303);
 
-		REG1 = ((REG1 <<  3) | REG1) & glm::uint32(0x1111111111111111);
-		REG2 = ((REG2 <<  3) | REG2) & glm::uint32(0x1111111111111111);
-		REG3 = ((REG3 <<  3) | REG3) & glm::uint32(0x1111111111111111);
-		REG4 = ((REG4 <<  3) | REG4) & glm::uint32(0x1111111111111111);
+			REG1 = ((REG1 <<  3) | REG1) & glm::uint32(0x1111111111111111);
+			REG2 = ((REG2 <<  3) | REG2) & glm::uint32(0x1111111111111111);
+			REG3 = ((REG3 <<  3) | REG3) & glm::uint32(0x1111111111111111);
+			REG4 = ((REG4 <<  3) | REG4) & glm::uint32(0x1111111111111111);
 
-		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+			return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#		endif
 	}
 
 	template <>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z, glm::uint16 w)
 	{
-		glm::uint64 REG1(x);
-		glm::uint64 REG2(y);
-		glm::uint64 REG3(z);
-		glm::uint64 REG4(w);
-
-		REG1 = ((REG1 << 24) | REG1) & glm::uint64(0x000000FF000000FF);
-		REG2 = ((REG2 << 24) | REG2) & glm::uint64(0x000000FF000000FF);
-		REG3 = ((REG3 << 24) | REG3) & glm::uint64(0x000000FF000000FF);
-		REG4 = ((REG4 << 24) | REG4) & glm::uint64(0x000000FF000000FF);
-
-		REG1 = ((REG1 << 12) | REG1) & glm::uint64(0x000F000F000F000F);
-		REG2 = ((REG2 << 12) | REG2) & glm::uint64(0x000F000F000F000F);
-		REG3 = ((REG3 << 12) | REG3) & glm::uint64(0x000F000F000F000F);
-		REG4 = ((REG4 << 12) | REG4) & glm::uint64(0x000F000F000F000F);
-
-		REG1 = ((REG1 <<  6) | REG1) & glm::uint64(0x0303030303030303);
-		REG2 = ((REG2 <<  6) | REG2) & glm::uint64(0x0303030303030303);
-		REG3 = ((REG3 <<  6) | REG3) & glm::uint64(0x0303030303030303);
-		REG4 = ((REG4 <<  6) | REG4) & glm::uint64(0x0303030303030303);
-
-		REG1 = ((REG1 <<  3) | REG1) & glm::uint64(0x1111111111111111);
-		REG2 = ((REG2 <<  3) | REG2) & glm::uint64(0x1111111111111111);
-		REG3 = ((REG3 <<  3) | REG3) & glm::uint64(0x1111111111111111);
-		REG4 = ((REG4 <<  3) | REG4) & glm::uint64(0x1111111111111111);
-
-		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x1111111111111111ull) | _pdep_u64(y, 0x2222222222222222ull) | _pdep_u64(z, 0x4444444444444444ull) | _pdep_u64(w, 0x8888888888888888ull);
+#		else
+			glm::uint64 REG1(x);
+			glm::uint64 REG2(y);
+			glm::uint64 REG3(z);
+			glm::uint64 REG4(w);
+
+			REG1 = ((REG1 << 24) | REG1) & glm::uint64(0x000000FF000000FF);
+			REG2 = ((REG2 << 24) | REG2) & glm::uint64(0x000000FF000000FF);
+			REG3 = ((REG3 << 24) | REG3) & glm::uint64(0x000000FF000000FF);
+			REG4 = ((REG4 << 24) | REG4) & glm::uint64(0x000000FF000000FF);
+
+			REG1 = ((REG1 << 12) | REG1) & glm::uint64(0x000F000F000F000F);
+			REG2 = ((REG2 << 12) | REG2) & glm::uint64(0x000F000F000F000F);
+			REG3 = ((REG3 << 12) | REG3) & glm::uint64(0x000F000F000F000F);
+			REG4 = ((REG4 << 12) | REG4) & glm::uint64(0x000F000F000F000F);
+
+			REG1 = ((REG1 <<  6) | REG1) & glm::uint64(0x0303030303030303);
+			REG2 = ((REG2 <<  6) | REG2) & glm::uint64(0x0303030303030303);
+			REG3 = ((REG3 <<  6) | REG3) & glm::uint64(0x0303030303030303);
+			REG4 = ((REG4 <<  6) | REG4) & glm::uint64(0x0303030303030303);
+
+			REG1 = ((REG1 <<  3) | REG1) & glm::uint64(0x1111111111111111);
+			REG2 = ((REG2 <<  3) | REG2) & glm::uint64(0x1111111111111111);
+			REG3 = ((REG3 <<  3) | REG3) & glm::uint64(0x1111111111111111);
+			REG4 = ((REG4 <<  3) | REG4) & glm::uint64(0x1111111111111111);
+
+			return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#		endif
+	}
+	// Gathers the bits 0, 2, 4... of v in the low bits, the inverse of the spreading of bitfieldInterleave(x, y)
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldCompact2(glm::uint64 v)
+	{
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pext_u64(v, 0x5555555555555555ull);
+#		else
+			v &= glm::uint64(0x5555555555555555);
+			v = ((v >>  1) | v) & glm::uint64(0x3333333333333333);
+			v = ((v >>  2) | v) & glm::uint64(0x0F0F0F0F0F0F0F0F);
+			v = ((v >>  4) | v) & glm::uint64(0x00FF00FF00FF00FF);
+			v = ((v >>  8) | v) & glm::uint64(0x0000FFFF0000FFFF);
+			v = ((v >> 16) | v) & glm::uint64(0x00000000FFFFFFFF);
+			return v;
+#		endif
+	}
+
+	// Gathers the bits 0, 3, 6... of v in the low bits, the inverse of the spreading of bitfieldInterleave(x, y, z)
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldCompact3(glm::uint64 v)
+	{
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pext_u64(v, 0x9249249249249249ull);
+#		else
+			v &= glm::uint64(0x9249249249249249);
+			v = ((v >>  2) | v) & glm::uint64(0x30C30C30C30C30C3);
+			v = ((v >>  4) | v) & glm::uint64(0xF00F00F00F00F00F);
+			v = ((v >>  8) | v) & glm::uint64(0x00FF0000FF0000FF);
+			v = ((v >> 16) | v) & glm::uint64(0xFFFF00000000FFFF);
+			v = ((v >> 32) | v) & glm::uint64(0x00000000003FFFFF);
+			return v;
+#		endif
+	}
+
+	// Gathers the bits 0, 4, 8... of v in the low bits, the inverse of the spreading of bitfieldInterleave(x, y, z, w)
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldCompact4(glm::uint64 v)
+	{
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pext_u64(v, 0x1111111111111111ull);
+#		else
+			v &= glm::uint64(0x1111111111111111);
+			v = ((v >>  3) | v) & glm::uint64(0x0303030303030303);
+			v = ((v >>  6) | v) & glm::uint64(0x000F000F000F000F);
+			v = ((v >> 12) | v) & glm::uint64(0x000000FF000000FF);
+			v = ((v >> 24) | v) & glm::uint64(0x000000000000FFFF);
+			return v;
+#		endif
 	}
 }//namespace detail
 
@@ -539,4 +617,59 @@ namespace detail
 	{
 		return detail::bitfieldInterleave<uint16, uint64>(x, y, z, w);
 	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint16 v, uint8 & x, uint8 & y)
+	{
+		x = static_cast<uint8>(detail::bitfieldCompact2(v));
+		y = static_cast<uint8>(detail::bitfieldCompact2(v >> 1));
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint32 v, uint16 & x, uint16 & y)
+	{
+		x = static_cast<uint16>(detail::bitfieldCompact2(v));
+		y = static_cast<uint16>(detail::bitfieldCompact2(v >> 1));
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 v, uint32 & x, uint32 & y)
+	{
+		x = static_cast<uint32>(detail::bitfieldCompact2(v));
+		y = static_cast<uint32>(detail::bitfieldCompact2(v >> 1));
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint32 v, uint8 & x, uint8 & y, uint8 & z)
+	{
+		x = static_cast<uint8>(detail::bitfieldCompact3(v));
+		y = static_cast<uint8>(detail::bitfieldCompact3(v >> 1));
+		z = static_cast<uint8>(detail::bitfieldCompact3(v >> 2));
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 v, uint16 & x, uint16 & y, uint16 & z)
+	{
+		x = static_cast<uint16>(detail::bitfieldCompact3(v));
+		y = static_cast<uint16>(detail::bitfieldCompact3(v >> 1));
+		z = static_cast<uint16>(detail::bitfieldCompact3(v >> 2));
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 v, uint32 & x, uint32 & y, uint32 & z)
+	{
+		x = static_cast<uint32>(detail::bitfieldCompact3(v));
+		y = static_cast<uint32>(detail::bitfieldCompact3(v >> 1));
+		z = static_cast<uint32>(detail::bitfieldCompact3(v >> 2));
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint32 v, uint8 & x, uint8 & y, uint8 & z, uint8 & w)
+	{
+		x = static_cast<uint8>(detail::bitfieldCompact4(v));
+		y = static_cast<uint8>(detail::bitfieldCompact4(v >> 1));
+		z = static_cast<uint8>(detail::bitfieldCompact4(v >> 2));
+		w = static_cast<uint8>(detail::bitfieldCompact4(v >> 3));
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 v, uint16 & x, uint16 & y, uint16 & z, uint16 & w)
+	{
+		x = static_cast<uint16>(detail::bitfieldCompact4(v));
+		y = static_cast<uint16>(detail::bitfieldCompact4(v >> 1));
+		z = static_cast<uint16>(detail::bitfieldCompact4(v >> 2));
+		w = static_cast<uint16>(detail::bitfieldCompact4(v >> 3));
+	}
 }//namespace glm
@@ -35,7 +35,7 @@
 namespace glm
 {
 	template <typename genType>
-	GLM_FUNC_QUALIFIER genType epsilon()
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType epsilon()
 	{
 		return std::numeric_limits<genType>::epsilon();
 	}
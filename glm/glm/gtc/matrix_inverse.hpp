@@ -46,6 +46,9 @@
 #include "../mat2x2.hpp"
 #include "../mat3x3.hpp"
 #include "../mat4x4.hpp"
+#if GLM_ARCH & GLM_ARCH_SSE2
+#	include "../detail/intrinsic_geometric.hpp"
+#endif
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTC_matrix_inverse extension included")
@@ -57,6 +60,7 @@ namespace glm
 	/// @{
 
 	/// Fast matrix inverse for affine matrix.
+	/// The last row is assumed to be (0, ..., 0, 1), GLM_FORCE_CHECK_MATRIX_CLASS asserts it.
 	/// 
 	/// @param m Input matrix to invert.
 	/// @tparam genType Squared floating-point matrix: half, float or double. Inverse of matrix based of half-precision floating point value is highly innacurate.
@@ -64,6 +68,15 @@ namespace glm
 	template <typename genType> 
 	GLM_FUNC_DECL genType affineInverse(genType const & m);
 
+	/// Fast matrix inverse for rigid transformation matrix: a rotation followed by a translation.
+	/// The rotation is inverted by transposition. GLM_FORCE_CHECK_MATRIX_CLASS asserts that the matrix is affine and its rotation orthonormal.
+	/// 
+	/// @param m Input matrix to invert.
+	/// @tparam genType Squared floating-point matrix: half, float or double.
+	/// @see gtc_matrix_inverse
+	template <typename genType> 
+	GLM_FUNC_DECL genType rigidInverse(genType const & m);
+
 	/// Compute the inverse transpose of a matrix.
 	/// 
 	/// @param m Input matrix to invert transpose.
@@ -72,6 +85,13 @@ namespace glm
 	template <typename genType>
 	GLM_FUNC_DECL genType inverseTranspose(genType const & m);
 
+	/// Compute the inverse transpose of the upper-left 3x3 part of a matrix, the normal matrix of an affine transformation.
+	/// 
+	/// @param m Input matrix, only the upper-left 3x3 part is used.
+	/// @see gtc_matrix_inverse
+	template <typename T, precision P>
+	GLM_FUNC_DECL tmat3x3<T, P> inverseTranspose3x3(tmat4x4<T, P> const & m);
+
 	/// @}
 }//namespace glm
 
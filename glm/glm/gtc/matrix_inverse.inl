@@ -30,28 +30,205 @@
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool is_affine(tmat3x3<T, P> const & m)
+	{
+		return m[0][2] == static_cast<T>(0) && m[1][2] == static_cast<T>(0) && m[2][2] == static_cast<T>(1);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool is_affine(tmat4x4<T, P> const & m)
+	{
+		return m[0][3] == static_cast<T>(0) && m[1][3] == static_cast<T>(0) && m[2][3] == static_cast<T>(0) && m[3][3] == static_cast<T>(1);
+	}
+
+	template <typename T, precision P, template <typename, precision> class matType>
+	GLM_FUNC_QUALIFIER bool is_orthonormal(matType<T, P> const & m)
+	{
+		matType<T, P> const Identity = transpose(m) * m;
+		for(length_t i = 0; i < m.length(); ++i)
+		for(length_t j = 0; j < m.length(); ++j)
+			if(abs(Identity[i][j] - (i == j ? static_cast<T>(1) : static_cast<T>(0))) > static_cast<T>(0.001))
+				return false;
+		return true;
+	}
+
+	template <typename T, precision P>
+	struct compute_affine_inverse
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m)
+		{
+			tmat3x3<T, P> const Inverse(inverse(tmat3x3<T, P>(m)));
+			return tmat4x4<T, P>(
+				tvec4<T, P>(Inverse[0], static_cast<T>(0)),
+				tvec4<T, P>(Inverse[1], static_cast<T>(0)),
+				tvec4<T, P>(Inverse[2], static_cast<T>(0)),
+				tvec4<T, P>(-(Inverse * tvec3<T, P>(m[3])), static_cast<T>(1)));
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_rigid_inverse
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m)
+		{
+			tmat3x3<T, P> const Inverse(transpose(tmat3x3<T, P>(m)));
+			return tmat4x4<T, P>(
+				tvec4<T, P>(Inverse[0], static_cast<T>(0)),
+				tvec4<T, P>(Inverse[1], static_cast<T>(0)),
+				tvec4<T, P>(Inverse[2], static_cast<T>(0)),
+				tvec4<T, P>(-(Inverse * tvec3<T, P>(m[3])), static_cast<T>(1)));
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_inverse_transpose3x3
+	{
+		GLM_FUNC_QUALIFIER static tmat3x3<T, P> call(tmat4x4<T, P> const & m)
+		{
+			return inverseTranspose(tmat3x3<T, P>(m));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2
+		// Loads the upper-left 3x3 part, the w components are cleared
+		template <precision P>
+		GLM_FUNC_QUALIFIER void sse_load_mat3_ps(tmat4x4<float, P> const & m, __m128 c[3])
+		{
+			__m128 const Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+			c[0] = _mm_and_ps(_mm_loadu_ps(&m[0][0]), Mask);
+			c[1] = _mm_and_ps(_mm_loadu_ps(&m[1][0]), Mask);
+			c[2] = _mm_and_ps(_mm_loadu_ps(&m[2][0]), Mask);
+		}
+
+		// Rows of the inverse of a 3x3 matrix: the cross products of its columns divided by the determinant
+		GLM_FUNC_QUALIFIER void sse_inverse3_rows_ps(__m128 const c[3], __m128 r[3])
+		{
+			__m128 const Cross0 = sse_xpd_ps(c[1], c[2]);
+			__m128 const Cross1 = sse_xpd_ps(c[2], c[0]);
+			__m128 const Cross2 = sse_xpd_ps(c[0], c[1]);
+			__m128 const Rcp = _mm_div_ps(_mm_set1_ps(1.0f), sse_dot_ps(c[0], Cross0));
+			r[0] = _mm_mul_ps(Cross0, Rcp);
+			r[1] = _mm_mul_ps(Cross1, Rcp);
+			r[2] = _mm_mul_ps(Cross2, Rcp);
+		}
+
+		// Builds the inverse affine matrix from the rows of the inverse of the upper-left 3x3 part
+		template <precision P>
+		GLM_FUNC_QUALIFIER tmat4x4<float, P> sse_affine_from_rows_ps(__m128 r0, __m128 r1, __m128 r2, __m128 Translation)
+		{
+			__m128 r3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			__m128 const x = _mm_mul_ps(r0, _mm_shuffle_ps(Translation, Translation, _MM_SHUFFLE(0, 0, 0, 0)));
+			__m128 const y = _mm_mul_ps(r1, _mm_shuffle_ps(Translation, Translation, _MM_SHUFFLE(1, 1, 1, 1)));
+			__m128 const z = _mm_mul_ps(r2, _mm_shuffle_ps(Translation, Translation, _MM_SHUFFLE(2, 2, 2, 2)));
+
+			tmat4x4<float, P> Result(uninitialize);
+			_mm_storeu_ps(&Result[0][0], r0);
+			_mm_storeu_ps(&Result[1][0], r1);
+			_mm_storeu_ps(&Result[2][0], r2);
+			_mm_storeu_ps(&Result[3][0], _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), _mm_add_ps(_mm_add_ps(x, y), z)));
+			return Result;
+		}
+
+		template <precision P>
+		struct compute_affine_inverse<float, P>
+		{
+			GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m)
+			{
+				__m128 c[3];
+				__m128 r[3];
+				sse_load_mat3_ps(m, c);
+				sse_inverse3_rows_ps(c, r);
+				return sse_affine_from_rows_ps<P>(r[0], r[1], r[2], _mm_loadu_ps(&m[3][0]));
+			}
+		};
+
+		template <precision P>
+		struct compute_rigid_inverse<float, P>
+		{
+			GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m)
+			{
+				__m128 c[3];
+				sse_load_mat3_ps(m, c);
+				return sse_affine_from_rows_ps<P>(c[0], c[1], c[2], _mm_loadu_ps(&m[3][0]));
+			}
+		};
+
+		template <precision P>
+		struct compute_inverse_transpose3x3<float, P>
+		{
+			GLM_FUNC_QUALIFIER static tmat3x3<float, P> call(tmat4x4<float, P> const & m)
+			{
+				__m128 c[3];
+				__m128 r[3];
+				sse_load_mat3_ps(m, c);
+				sse_inverse3_rows_ps(c, r);
+
+				// The rows of the inverse are the columns of the inverse transpose
+				float Rows[3][4];
+				_mm_storeu_ps(Rows[0], r[0]);
+				_mm_storeu_ps(Rows[1], r[1]);
+				_mm_storeu_ps(Rows[2], r[2]);
+				return tmat3x3<float, P>(
+					Rows[0][0], Rows[0][1], Rows[0][2],
+					Rows[1][0], Rows[1][1], Rows[1][2],
+					Rows[2][0], Rows[2][1], Rows[2][2]);
+			}
+		};
+#	endif
+}//namespace detail
+
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat3x3<T, P> affineInverse(tmat3x3<T, P> const & m)
 	{
-		tmat3x3<T, P> Result(m);
-		Result[2] = tvec3<T, P>(0, 0, 1);
-		Result = transpose(Result);
-		tvec3<T, P> Translation = Result * tvec3<T, P>(-tvec2<T, P>(m[2]), m[2][2]);
-		Result[2] = Translation;
-		return Result;
+#		ifdef GLM_FORCE_CHECK_MATRIX_CLASS
+			assert(detail::is_affine(m));
+#		endif
+
+		tmat2x2<T, P> const Inverse(inverse(tmat2x2<T, P>(m)));
+		return tmat3x3<T, P>(
+			tvec3<T, P>(Inverse[0], static_cast<T>(0)),
+			tvec3<T, P>(Inverse[1], static_cast<T>(0)),
+			tvec3<T, P>(-(Inverse * tvec2<T, P>(m[2])), static_cast<T>(1)));
 	}
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> affineInverse(tmat4x4<T, P> const & m)
 	{
-		tmat4x4<T, P> Result(m);
-		Result[3] = tvec4<T, P>(0, 0, 0, 1);
-		Result = transpose(Result);
-		tvec4<T, P> Translation = Result * tvec4<T, P>(-tvec3<T, P>(m[3]), m[3][3]);
-		Result[3] = Translation;
-		return Result;
+#		ifdef GLM_FORCE_CHECK_MATRIX_CLASS
+			assert(detail::is_affine(m));
+#		endif
+
+		return detail::compute_affine_inverse<T, P>::call(m);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tmat3x3<T, P> rigidInverse(tmat3x3<T, P> const & m)
+	{
+#		ifdef GLM_FORCE_CHECK_MATRIX_CLASS
+			assert(detail::is_affine(m) && detail::is_orthonormal(tmat2x2<T, P>(m)));
+#		endif
+
+		tmat2x2<T, P> const Inverse(transpose(tmat2x2<T, P>(m)));
+		return tmat3x3<T, P>(
+			tvec3<T, P>(Inverse[0], static_cast<T>(0)),
+			tvec3<T, P>(Inverse[1], static_cast<T>(0)),
+			tvec3<T, P>(-(Inverse * tvec2<T, P>(m[2])), static_cast<T>(1)));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tmat4x4<T, P> rigidInverse(tmat4x4<T, P> const & m)
+	{
+#		ifdef GLM_FORCE_CHECK_MATRIX_CLASS
+			assert(detail::is_affine(m) && detail::is_orthonormal(tmat3x3<T, P>(m)));
+#		endif
+
+		return detail::compute_rigid_inverse<T, P>::call(m);
 	}
 
 	template <typename T, precision P>
@@ -145,4 +322,10 @@ namespace glm
 
 		return Inverse;
 	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tmat3x3<T, P> inverseTranspose3x3(tmat4x4<T, P> const & m)
+	{
+		return detail::compute_inverse_transpose3x3<T, P>::call(m);
+	}
 }//namespace glm
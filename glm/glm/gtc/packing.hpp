@@ -30,6 +30,7 @@
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
+/// @see gtc_quaternion (dependence)
 ///
 /// @defgroup gtc_packing GLM_GTC_packing
 /// @ingroup gtc
@@ -44,6 +45,7 @@
 
 // Dependency:
 #include "type_precision.hpp"
+#include "quaternion.hpp"
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -472,6 +474,78 @@ namespace glm
 	/// @see uint32 packF2x11_1x10(vec3 const & v)
 	GLM_FUNC_DECL vec3 unpackF2x11_1x10(uint32 p);
 
+	/// Maps the direction v on the octahedron then unfolds it on a square, stored as two 8-bit signed normalized values.
+	/// v doesn't need to be normalized but must not be null.
+	/// The maximum angular error of unpackOctahedral2x8(packOctahedral2x8(v)) is 1 degree.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x8(uint16 p)
+	GLM_FUNC_DECL uint16 packOctahedral2x8(vec3 const & v);
+
+	/// Returns the normalized direction stored by packOctahedral2x8.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packOctahedral2x8(vec3 const & v)
+	GLM_FUNC_DECL vec3 unpackOctahedral2x8(uint16 p);
+
+	/// Maps the direction v on the octahedron then unfolds it on a square, stored as two 16-bit signed normalized values.
+	/// v doesn't need to be normalized but must not be null.
+	/// The maximum angular error of unpackOctahedral2x16(packOctahedral2x16(v)) is 0.004 degrees.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x16(uint32 p)
+	GLM_FUNC_DECL uint32 packOctahedral2x16(vec3 const & v);
+
+	/// Returns the normalized direction stored by packOctahedral2x16.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral2x16(vec3 const & v)
+	GLM_FUNC_DECL vec3 unpackOctahedral2x16(uint32 p);
+
+	/// Packs the unit quaternion q with the smallest three method: the index of the largest component
+	/// in the 2 most significant bits and the three other components, in [-1/sqrt(2), 1/sqrt(2)] once q is
+	/// negated to make the largest component positive, as 10-bit fixed point values storing 0 exactly.
+	/// The maximum angle between the rotations of q and unpackQuat3x10_1x2(packQuat3x10_1x2(q)) is 0.26 degrees.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuat3x10_1x2(uint32 p)
+	GLM_FUNC_DECL uint32 packQuat3x10_1x2(quat const & q);
+
+	/// Returns the unit quaternion stored by packQuat3x10_1x2, its largest component is positive.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packQuat3x10_1x2(quat const & q)
+	GLM_FUNC_DECL quat unpackQuat3x10_1x2(uint32 p);
+
+	/// Packs the unit quaternion q with the smallest three method, the three smallest components as
+	/// 20-bit fixed point values and the index of the largest component in the bits 60 and 61.
+	/// The maximum angle between the rotations of q and unpackQuat3x20_1x2(packQuat3x20_1x2(q)) is 0.0003 degrees.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuat3x20_1x2(uint64 p)
+	GLM_FUNC_DECL uint64 packQuat3x20_1x2(quat const & q);
+
+	/// Returns the unit quaternion stored by packQuat3x20_1x2, its largest component is positive.
+	///
+	/// @see gtc_packing
+	/// @see uint64 packQuat3x20_1x2(quat const & q)
+	GLM_FUNC_DECL quat unpackQuat3x20_1x2(uint64 p);
+
+	/// Returns the index of the point of the spherical Fibonacci point set of Count points the closest
+	/// to the direction v, following Keinert et al., Spherical Fibonacci Mapping, 2015.
+	/// v must be normalized. The search is performed in double precision.
+	/// The maximum angular error is about 0.75 * sqrt(4 * pi / Count) radians, 0.14 degrees for 2^20 points.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackSphericalFibonacci(uint32 Index, uint32 Count)
+	GLM_FUNC_DECL uint32 packSphericalFibonacci(vec3 const & v, uint32 Count);
+
+	/// Returns the direction of the point Index of the spherical Fibonacci point set of Count points.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packSphericalFibonacci(vec3 const & v, uint32 Count)
+	GLM_FUNC_DECL vec3 unpackSphericalFibonacci(uint32 Index, uint32 Count);
+
 	/// @}
 }// namespace glm
 
@@ -34,8 +34,12 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include "../geometric.hpp"
+#include "../trigonometric.hpp"
+#include "../exponential.hpp"
 #include "../detail/type_half.hpp"
 #include <cstring>
+#include <limits>
 
 namespace glm{
 namespace detail
@@ -165,9 +169,9 @@ namespace detail
 		if(x == 0)
 			return 0.0f;
 		else if(x == ((1 << 11) - 1))
-			return ~0;//NaN
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 6))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed11ToFloat(x);
 
@@ -204,9 +208,9 @@ namespace detail
 		if(x == 0)
 			return 0.0f;
 		else if(x == ((1 << 10) - 1))
-			return ~0;//NaN
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 5))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed10ToFloat(x);
 
@@ -224,6 +228,85 @@ namespace detail
 //		return ((floatTo11bit(x) & ((1 << 11) - 1)) << 0) |  ((floatTo11bit(y) & ((1 << 11) - 1)) << 11) | ((floatTo10bit(z) & ((1 << 10) - 1)) << 22);
 //	}
 
+	// Octahedral mapping of the direction v, in [-1, 1]^2, the lower hemisphere folded on the corners
+	GLM_FUNC_QUALIFIER vec2 octahedral_encode(vec3 const & v)
+	{
+		vec2 const p = vec2(v.x, v.y) / (abs(v.x) + abs(v.y) + abs(v.z));
+		if(v.z >= 0.0f)
+			return p;
+		return vec2(
+			(1.0f - abs(p.y)) * (p.x >= 0.0f ? 1.0f : -1.0f),
+			(1.0f - abs(p.x)) * (p.y >= 0.0f ? 1.0f : -1.0f));
+	}
+
+	GLM_FUNC_QUALIFIER vec3 octahedral_decode(vec2 const & p)
+	{
+		vec3 v(p.x, p.y, 1.0f - abs(p.x) - abs(p.y));
+		float const t = max(-v.z, 0.0f);
+		v.x += v.x >= 0.0f ? -t : t;
+		v.y += v.y >= 0.0f ? -t : t;
+		return normalize(v);
+	}
+
+	template <typename uintType, int Bits>
+	GLM_FUNC_QUALIFIER uintType quat_smallest_three_encode(quat const & q)
+	{
+		length_t Largest = 0;
+		for(length_t i = 1; i < 4; ++i)
+			if(abs(q[i]) > abs(q[Largest]))
+				Largest = i;
+
+		// q and -q are the same rotation, the largest component is made positive
+		float const Sign = q[Largest] < 0.0f ? -1.0f : 1.0f;
+		// Even so that the null components are stored exactly
+		float const Scale = static_cast<float>((1 << Bits) - 2);
+
+		uintType Result = static_cast<uintType>(Largest) << (Bits * 3);
+		int Shift = 0;
+		for(length_t i = 0; i < 4; ++i)
+		{
+			if(i == Largest)
+				continue;
+			float const Unorm = clamp(fma(q[i] * Sign, 0.70710678118654752440f, 0.5f), 0.0f, 1.0f);
+			Result |= static_cast<uintType>(round(Unorm * Scale)) << Shift;
+			Shift += Bits;
+		}
+		return Result;
+	}
+
+	template <typename uintType, int Bits>
+	GLM_FUNC_QUALIFIER quat quat_smallest_three_decode(uintType p)
+	{
+		uintType const Mask = (static_cast<uintType>(1) << Bits) - 1;
+		float const Scale = static_cast<float>((1 << Bits) - 2);
+
+		vec3 c;
+		for(length_t i = 0; i < 3; ++i)
+			c[i] = (static_cast<float>((p >> (Bits * i)) & Mask) / Scale * 2.0f - 1.0f) * 0.70710678118654752440f;
+		float const Largest = sqrt(max(1.0f - dot(c, c), 0.0f));
+
+		length_t const Index = static_cast<length_t>(p >> (Bits * 3)) & 3;
+		quat Result;
+		for(length_t i = 0, j = 0; i < 4; ++i)
+			Result[i] = i == Index ? Largest : c[j++];
+		return Result;
+	}
+
+	// Fraction of i * (golden ratio - 1), in double so that large indices keep their precision
+	GLM_FUNC_QUALIFIER double spherical_fibonacci_turn(double i)
+	{
+		double const Turn = i * 0.61803398874989484820;
+		return Turn - floor(Turn);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 spherical_fibonacci_point(double i, double n)
+	{
+		double const Phi = 6.28318530717958647692 * spherical_fibonacci_turn(i);
+		double const CosTheta = 1.0 - (2.0 * i + 1.0) / n;
+		double const SinTheta = sqrt(max(1.0 - CosTheta * CosTheta, 0.0));
+		return vec3(cos(Phi) * SinTheta, sin(Phi) * SinTheta, CosTheta);
+	}
+
 	union u10u10u10u2
 	{
 		struct
@@ -365,24 +448,41 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packHalf4x16(glm::vec4 const & v)
 	{
-		i16vec4 Unpack(
-			detail::toFloat16(v.x),
-			detail::toFloat16(v.y),
-			detail::toFloat16(v.z),
-			detail::toFloat16(v.w));
-
-		return reinterpret_cast<uint64 const &>(Unpack);
+#		if GLM_ARCH & GLM_ARCH_SSE2
+			__m128i const Half = detail::sse_toFloat16_ps(_mm_loadu_ps(&v.x));
+			__m128i const Signed = _mm_srai_epi32(_mm_slli_epi32(Half, 16), 16);
+
+			uint64 Result;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Result), _mm_packs_epi32(Signed, Signed));
+			return Result;
+#		else
+			i16vec4 Unpack(
+				detail::toFloat16(v.x),
+				detail::toFloat16(v.y),
+				detail::toFloat16(v.z),
+				detail::toFloat16(v.w));
+
+			return reinterpret_cast<uint64 const &>(Unpack);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER glm::vec4 unpackHalf4x16(uint64 v)
 	{
-		i16vec4 Unpack(reinterpret_cast<i16vec4 const &>(v));
+#		if GLM_ARCH & GLM_ARCH_SSE2
+			__m128i const Half = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(&v));
+
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, detail::sse_toFloat32_ps(_mm_unpacklo_epi16(Half, _mm_setzero_si128())));
+			return Result;
+#		else
+			i16vec4 Unpack(reinterpret_cast<i16vec4 const &>(v));
 	
-		return vec4(
-			detail::toFloat32(Unpack.x),
-			detail::toFloat32(Unpack.y),
-			detail::toFloat32(Unpack.z),
-			detail::toFloat32(Unpack.w));
+			return vec4(
+				detail::toFloat32(Unpack.x),
+				detail::toFloat32(Unpack.y),
+				detail::toFloat32(Unpack.z),
+				detail::toFloat32(Unpack.w));
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packI3x10_1x2(ivec4 const & v)
@@ -451,17 +551,17 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint32 packUnorm3x10_1x2(vec4 const & v)
 	{
-		detail::i10i10i10i2 Result;
-		Result.data.x = int(round(clamp(v.x, 0.0f, 1.0f) * 1023.f));
-		Result.data.y = int(round(clamp(v.y, 0.0f, 1.0f) * 1023.f));
-		Result.data.z = int(round(clamp(v.z, 0.0f, 1.0f) * 1023.f));
-		Result.data.w = int(round(clamp(v.w, 0.0f, 1.0f) *    3.f));
+		detail::u10u10u10u2 Result;
+		Result.data.x = uint(round(clamp(v.x, 0.0f, 1.0f) * 1023.f));
+		Result.data.y = uint(round(clamp(v.y, 0.0f, 1.0f) * 1023.f));
+		Result.data.z = uint(round(clamp(v.z, 0.0f, 1.0f) * 1023.f));
+		Result.data.w = uint(round(clamp(v.w, 0.0f, 1.0f) *    3.f));
 		return Result.pack;
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm3x10_1x2(uint32 v)
 	{
-		detail::i10i10i10i2 Unpack;
+		detail::u10u10u10u2 Unpack;
 		Unpack.pack = v;
 		vec4 Result;
 		Result.x = float(Unpack.data.x) / 1023.f;
@@ -482,9 +582,96 @@ namespace detail
 	GLM_FUNC_QUALIFIER vec3 unpackF2x11_1x10(uint32 v)
 	{
 		return vec3(
-			detail::packed11bitToFloat(v >> 0),
-			detail::packed11bitToFloat(v >> 11),
-			detail::packed10bitToFloat(v >> 22));
+			detail::packed11bitToFloat((v >>  0) & ((1 << 11) - 1)),
+			detail::packed11bitToFloat((v >> 11) & ((1 << 11) - 1)),
+			detail::packed10bitToFloat((v >> 22) & ((1 << 10) - 1)));
 	}
 
+	GLM_FUNC_QUALIFIER uint16 packOctahedral2x8(vec3 const & v)
+	{
+		return packSnorm2x8(detail::octahedral_encode(v));
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral2x8(uint16 p)
+	{
+		return detail::octahedral_decode(unpackSnorm2x8(p));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packOctahedral2x16(vec3 const & v)
+	{
+		return packSnorm2x16(detail::octahedral_encode(v));
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral2x16(uint32 p)
+	{
+		return detail::octahedral_decode(unpackSnorm2x16(p));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packQuat3x10_1x2(quat const & q)
+	{
+		return detail::quat_smallest_three_encode<uint32, 10>(q);
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuat3x10_1x2(uint32 p)
+	{
+		return detail::quat_smallest_three_decode<uint32, 10>(p);
+	}
+
+	GLM_FUNC_QUALIFIER uint64 packQuat3x20_1x2(quat const & q)
+	{
+		return detail::quat_smallest_three_encode<uint64, 20>(q);
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuat3x20_1x2(uint64 p)
+	{
+		return detail::quat_smallest_three_decode<uint64, 20>(p);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packSphericalFibonacci(vec3 const & v, uint32 Count)
+	{
+		double const Pi = 3.14159265358979323846;
+		double const GoldenRatio = 1.61803398874989484820;
+		double const n = static_cast<double>(Count);
+		double const Phi = min(static_cast<double>(atan(v.y, v.x)), Pi);
+		double const CosTheta = clamp(static_cast<double>(v.z), -1.0, 1.0);
+
+		// Consecutive Fibonacci numbers F0 and F1 whose points are the closest to the point 0 around
+		// the latitude of v, they generate the local lattice of the points in (phi, cos(theta)).
+		double const k = max(2.0, floor(log(n * Pi * sqrt(5.0) * (1.0 - CosTheta * CosTheta)) / log(GoldenRatio * GoldenRatio)));
+		double const Fk = pow(GoldenRatio, k) / sqrt(5.0);
+		double const F0 = round(Fk);
+		double const F1 = round(Fk * GoldenRatio);
+
+		// Phi steps taken in (-pi, pi]
+		double const B00 = 2.0 * Pi * (detail::spherical_fibonacci_turn(F0 + 1.0) - (GoldenRatio - 1.0));
+		double const B01 = 2.0 * Pi * (detail::spherical_fibonacci_turn(F1 + 1.0) - (GoldenRatio - 1.0));
+		double const B10 = -2.0 * F0 / n;
+		double const B11 = -2.0 * F1 / n;
+		double const Determinant = B00 * B11 - B01 * B10;
+
+		double const z = CosTheta - (1.0 - 1.0 / n);
+		double const c0 = floor((B11 * Phi - B01 * z) / Determinant);
+		double const c1 = floor((B00 * z - B10 * Phi) / Determinant);
+
+		// The closest point is one of the 4 corners of the lattice cell
+		double Distance = std::numeric_limits<double>::max();
+		double Result = 0.0;
+		for(int i = 0; i < 4; ++i)
+		{
+			double const Index = clamp(F0 * (c0 + static_cast<double>(i & 1)) + F1 * (c1 + static_cast<double>(i >> 1)), 0.0, n - 1.0);
+			vec3 const Point = detail::spherical_fibonacci_point(Index, n);
+			double const Candidate = static_cast<double>(dot(Point - v, Point - v));
+			if(Candidate < Distance)
+			{
+				Distance = Candidate;
+				Result = Index;
+			}
+		}
+		return static_cast<uint32>(Result);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackSphericalFibonacci(uint32 Index, uint32 Count)
+	{
+		return detail::spherical_fibonacci_point(static_cast<double>(Index), static_cast<double>(Count));
+	}
 }//namespace glm
@@ -83,34 +83,34 @@ namespace glm
 			/// Return the count of components of a quaternion
 			GLM_FUNC_DECL GLM_CONSTEXPR size_type size() const;
 
-			GLM_FUNC_DECL T & operator[](size_type i);
-			GLM_FUNC_DECL T const & operator[](size_type i) const;
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T & operator[](size_type i);
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T const & operator[](size_type i) const;
 #		else
 			typedef length_t length_type;
 			/// Return the count of components of a quaternion
 			GLM_FUNC_DECL GLM_CONSTEXPR length_type length() const;
 
-			GLM_FUNC_DECL T & operator[](length_type i);
-			GLM_FUNC_DECL T const & operator[](length_type i) const;
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T & operator[](length_type i);
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T const & operator[](length_type i) const;
 #		endif//GLM_FORCE_SIZE_FUNC
 
 		// -- Implicit basic constructors --
 
-		GLM_FUNC_DECL tquat() GLM_DEFAULT_CTOR;
-		GLM_FUNC_DECL tquat(tquat<T, P> const & q) GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CTOR tquat() GLM_DEFAULT_CTOR;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CTOR tquat(tquat<T, P> const & q) GLM_DEFAULT;
 		template <precision Q>
-		GLM_FUNC_DECL tquat(tquat<T, Q> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CTOR tquat(tquat<T, Q> const & q);
 
 		// -- Explicit basic constructors --
 
 		GLM_FUNC_DECL explicit tquat(ctor);
-		GLM_FUNC_DECL explicit tquat(T const & s, tvec3<T, P> const & v);
-		GLM_FUNC_DECL tquat(T const & w, T const & x, T const & y, T const & z);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CTOR explicit tquat(T const & s, tvec3<T, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CTOR tquat(T const & w, T const & x, T const & y, T const & z);
 
 		// -- Conversion constructors --
 
 		template <typename U, precision Q>
-		GLM_FUNC_DECL GLM_EXPLICIT tquat(tquat<U, Q> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CTOR GLM_EXPLICIT tquat(tquat<U, Q> const & q);
 
 		/// Explicit conversion operators
 #		if GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
@@ -133,53 +133,53 @@ namespace glm
 
 		// -- Unary arithmetic operators --
 
-		GLM_FUNC_DECL tquat<T, P> & operator=(tquat<T, P> const & m) GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator=(tquat<T, P> const & m) GLM_DEFAULT;
 
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator=(tquat<U, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator=(tquat<U, P> const & m);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator+=(tquat<U, P> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator+=(tquat<U, P> const & q);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator*=(tquat<U, P> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator*=(tquat<U, P> const & q);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator*=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator*=(U s);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator/=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator/=(U s);
 	};
 
 	// -- Unary bit operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator-(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator-(tquat<T, P> const & q);
 
 	// -- Binary operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator+(tquat<T, P> const & q, tquat<T, P> const & p);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator+(tquat<T, P> const & q, tquat<T, P> const & p);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(tquat<T, P> const & q, tquat<T, P> const & p);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(tquat<T, P> const & q, tquat<T, P> const & p);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> operator*(tquat<T, P> const & q, tvec3<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tquat<T, P> const & q, tvec3<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> operator*(tvec3<T, P> const & v, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tvec3<T, P> const & v, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec4<T, P> operator*(tquat<T, P> const & q, tvec4<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec4<T, P> operator*(tquat<T, P> const & q, tvec4<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec4<T, P> operator*(tvec4<T, P> const & v, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec4<T, P> operator*(tvec4<T, P> const & v, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(tquat<T, P> const & q, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(tquat<T, P> const & q, T const & s);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(T const & s, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(T const & s, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator/(tquat<T, P> const & q, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator/(tquat<T, P> const & q, T const & s);
 
 	/// Returns the length of the quaternion.
 	/// 
@@ -197,7 +197,7 @@ namespace glm
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P, template <typename, precision> class quatType>
-	GLM_FUNC_DECL T dot(quatType<T, P> const & x, quatType<T, P> const & y);
+	GLM_FUNC_DECL GLM_CONSTEXPR T dot(quatType<T, P> const & x, quatType<T, P> const & y);
 
 	/// Spherical linear interpolation of two quaternions.
 	/// The interpolation is oriented and the rotation is performed at constant speed.
@@ -238,7 +238,7 @@ namespace glm
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> conjugate(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> conjugate(tquat<T, P> const & q);
 
 	/// Returns the q inverse.
 	/// 
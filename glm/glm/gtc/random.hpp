@@ -38,6 +38,13 @@
 /// 
 /// @brief Generate random number from various distribution methods.
 /// 
+/// The functions without an engine parameter draw their random bits from std::rand,
+/// seeded with std::srand. Its state is global, hidden and slow to access from several
+/// threads. The overloads taking an engine use explicit state generators instead:
+/// xoshiro128, pcg32 or philox4x32, or any type providing a uint32 operator()().
+/// Use one engine per thread, constructed with the thread index as stream, to
+/// generate independent sequences in parallel.
+/// 
 /// <glm/gtc/random.hpp> need to be included to use these functionalities.
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -46,6 +53,8 @@
 // Dependency:
 #include "../vec2.hpp"
 #include "../vec3.hpp"
+#include "../vec4.hpp"
+#include <cstddef>
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -113,7 +122,158 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL tvec3<T, defaultp> ballRand(
 		T Radius);
-	
+
+	/// xoshiro128** generator by David Blackman and Sebastiano Vigna.
+	/// 128 bits of state, a period of 2^128 - 1 and 32 bits outputs, the fastest of the engines.
+	/// @see gtc_random
+	struct xoshiro128
+	{
+		typedef uint32 result_type;
+
+		/// Seeds the state with splitmix64 then jumps Stream times ahead by 2^64 outputs,
+		/// so that the streams don't overlap. Stream is intended to be small, a thread index for example.
+		GLM_FUNC_DECL explicit xoshiro128(uint64 Seed = 0, uint64 Stream = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed, uint64 Stream = 0);
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Advances the state by 2^64 outputs.
+		GLM_FUNC_DECL void jump();
+
+		static result_type (min)(){return 0;}
+		static result_type (max)(){return 0xFFFFFFFF;}
+
+		uint32 State[4];
+	};
+
+	/// PCG32 generator by Melissa O'Neill, XSH RR output of a 64 bits linear congruential generator.
+	/// 2^63 streams selected by an odd increment, each with a period of 2^64.
+	/// @see gtc_random
+	struct pcg32
+	{
+		typedef uint32 result_type;
+
+		GLM_FUNC_DECL explicit pcg32(uint64 Seed = 0, uint64 Stream = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed, uint64 Stream = 0);
+		GLM_FUNC_DECL result_type operator()();
+
+		static result_type (min)(){return 0;}
+		static result_type (max)(){return 0xFFFFFFFF;}
+
+		uint64 State;
+		uint64 Increment;
+	};
+
+	/// Philox4x32-10 counter based generator by John Salmon et al.
+	/// Each output is a function of the key, the stream and the position only, so that
+	/// discard is constant time and 2^64 streams of 2^66 outputs are available.
+	/// @see gtc_random
+	struct philox4x32
+	{
+		typedef uint32 result_type;
+
+		GLM_FUNC_DECL explicit philox4x32(uint64 Seed = 0, uint64 Stream = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed, uint64 Stream = 0);
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Skips Count outputs.
+		GLM_FUNC_DECL void discard(uint64 Count);
+
+		static result_type (min)(){return 0;}
+		static result_type (max)(){return 0xFFFFFFFF;}
+
+		uint32 Key[2];
+		uint32 Counter[4];
+		uint32 Block[4];
+		uint32 Index;
+	};
+
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution, using Engine.
+	/// @see gtc_random
+	template <typename genType, typename engineType>
+	GLM_FUNC_DECL genType linearRand(
+		genType Min,
+		genType Max,
+		engineType & Engine);
+
+	/// Generate random vectors in the interval [Min, Max], according a linear distribution, using Engine.
+	/// @see gtc_random
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_DECL vecType<T, P> linearRand(
+		vecType<T, P> const & Min,
+		vecType<T, P> const & Max,
+		engineType & Engine);
+
+	/// Generate random numbers according a gaussian distribution of mean Mean and standard deviation Deviation, using Engine.
+	/// Box-Muller transform of two uniform numbers in (0, 1].
+	/// @see gtc_random
+	template <typename genType, typename engineType>
+	GLM_FUNC_DECL genType gaussRand(
+		genType Mean,
+		genType Deviation,
+		engineType & Engine);
+
+	/// Generate a random 2D vector regulary distributed on a circle of a given radius, using Engine.
+	/// @see gtc_random
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL tvec2<T, defaultp> circularRand(
+		T Radius,
+		engineType & Engine);
+
+	/// Generate a random 3D vector regulary distributed on a sphere of a given radius, using Engine.
+	/// @see gtc_random
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL tvec3<T, defaultp> sphericalRand(
+		T Radius,
+		engineType & Engine);
+
+	/// Generate a random 2D vector regulary distributed within a disk of a given radius, using Engine.
+	/// @see gtc_random
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL tvec2<T, defaultp> diskRand(
+		T Radius,
+		engineType & Engine);
+
+	/// Generate a random 3D vector regulary distributed within a ball of a given radius, using Engine.
+	/// @see gtc_random
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL tvec3<T, defaultp> ballRand(
+		T Radius,
+		engineType & Engine);
+
+	/// Fill Results with Count random numbers in the interval [Min, Max), according a linear distribution.
+	/// The batch functions seed four interleaved xoshiro128 generators from Engine and run them with SSE2 when available.
+	/// @see gtc_random
+	template <typename engineType>
+	GLM_FUNC_DECL void linearRandBatch(float * Results, std::size_t Count, float Min, float Max, engineType & Engine);
+
+	/// Fill Results with Count random vectors in the interval [Min, Max), according a linear distribution.
+	/// @see gtc_random
+	template <typename engineType>
+	GLM_FUNC_DECL void linearRandBatch(vec2 * Results, std::size_t Count, vec2 const & Min, vec2 const & Max, engineType & Engine);
+
+	/// Fill Results with Count random vectors in the interval [Min, Max), according a linear distribution.
+	/// @see gtc_random
+	template <typename engineType>
+	GLM_FUNC_DECL void linearRandBatch(vec3 * Results, std::size_t Count, vec3 const & Min, vec3 const & Max, engineType & Engine);
+
+	/// Fill Results with Count random vectors in the interval [Min, Max), according a linear distribution.
+	/// @see gtc_random
+	template <typename engineType>
+	GLM_FUNC_DECL void linearRandBatch(vec4 * Results, std::size_t Count, vec4 const & Min, vec4 const & Max, engineType & Engine);
+
+	/// Fill Results with Count random 2D vectors regulary distributed on a circle of a given radius.
+	/// @see gtc_random
+	template <typename engineType>
+	GLM_FUNC_DECL void circularRandBatch(vec2 * Results, std::size_t Count, float Radius, engineType & Engine);
+
+	/// Fill Results with Count random 3D vectors regulary distributed on a sphere of a given radius.
+	/// @see gtc_random
+	template <typename engineType>
+	GLM_FUNC_DECL void sphericalRandBatch(vec3 * Results, std::size_t Count, float Radius, engineType & Engine);
+
 	/// @}
 }//namespace glm
 
@@ -35,283 +35,741 @@
 #include <cstdlib>
 #include <ctime>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 namespace glm{
 namespace detail
 {
-	template <typename T, precision P, template <class, precision> class vecType>
-	struct compute_rand
+	// Engine of the functions without an engine parameter, std::rand keeps the std::srand seeding
+	struct std_rand_engine{};
+
+	// Draws the bits of one T from Engine
+	template <typename T, typename engineType>
+	struct compute_rand_bits
 	{
-		GLM_FUNC_QUALIFIER static vecType<T, P> call();
+		GLM_FUNC_QUALIFIER static T call(engineType & Engine)
+		{
+			return static_cast<T>(Engine());
+		}
 	};
 
-	template <precision P>
-	struct compute_rand<uint8, P, tvec1>
+	template <typename engineType>
+	struct compute_rand_bits<uint64, engineType>
 	{
-		GLM_FUNC_QUALIFIER static tvec1<uint8, P> call()
+		GLM_FUNC_QUALIFIER static uint64 call(engineType & Engine)
 		{
-			return tvec1<uint8, P>(
-				std::rand()) % std::numeric_limits<uint8>::max();
+			uint64 const High = static_cast<uint64>(Engine());
+			uint64 const Low = static_cast<uint64>(Engine());
+			return (High << static_cast<uint64>(32)) | Low;
 		}
 	};
 
-	template <precision P>
-	struct compute_rand<uint8, P, tvec2>
+	// std::rand only guarantees 15 bits, the random values are built 8 bits at a time
+	template <>
+	struct compute_rand_bits<uint8, std_rand_engine>
 	{
-		GLM_FUNC_QUALIFIER static tvec2<uint8, P> call()
+		GLM_FUNC_QUALIFIER static uint8 call(std_rand_engine &)
 		{
-			return tvec2<uint8, P>(
-				std::rand(),
-				std::rand()) % std::numeric_limits<uint8>::max();
+			return static_cast<uint8>(static_cast<uint8>(std::rand()) % std::numeric_limits<uint8>::max());
 		}
 	};
 
-	template <precision P>
-	struct compute_rand<uint8, P, tvec3>
+	template <>
+	struct compute_rand_bits<uint16, std_rand_engine>
 	{
-		GLM_FUNC_QUALIFIER static tvec3<uint8, P> call()
+		GLM_FUNC_QUALIFIER static uint16 call(std_rand_engine & Engine)
 		{
-			return tvec3<uint8, P>(
-				std::rand(),
-				std::rand(),
-				std::rand()) % std::numeric_limits<uint8>::max();
+			uint16 const High = compute_rand_bits<uint8, std_rand_engine>::call(Engine);
+			uint16 const Low = compute_rand_bits<uint8, std_rand_engine>::call(Engine);
+			return static_cast<uint16>((High << 8) | Low);
 		}
 	};
 
-	template <precision P>
-	struct compute_rand<uint8, P, tvec4>
+	template <>
+	struct compute_rand_bits<uint32, std_rand_engine>
 	{
-		GLM_FUNC_QUALIFIER static tvec4<uint8, P> call()
+		GLM_FUNC_QUALIFIER static uint32 call(std_rand_engine & Engine)
 		{
-			return tvec4<uint8, P>(
-				std::rand(),
-				std::rand(),
-				std::rand(),
-				std::rand()) % std::numeric_limits<uint8>::max();
+			uint32 const High = compute_rand_bits<uint16, std_rand_engine>::call(Engine);
+			uint32 const Low = compute_rand_bits<uint16, std_rand_engine>::call(Engine);
+			return (High << static_cast<uint32>(16)) | Low;
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_rand<uint16, P, vecType>
+	template <>
+	struct compute_rand_bits<uint64, std_rand_engine>
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint16, P> call()
+		GLM_FUNC_QUALIFIER static uint64 call(std_rand_engine & Engine)
 		{
-			return
-				(vecType<uint16, P>(compute_rand<uint8, P, vecType>::call()) << static_cast<uint16>(8)) |
-				(vecType<uint16, P>(compute_rand<uint8, P, vecType>::call()) << static_cast<uint16>(0));
+			uint64 const High = compute_rand_bits<uint32, std_rand_engine>::call(Engine);
+			uint64 const Low = compute_rand_bits<uint32, std_rand_engine>::call(Engine);
+			return (High << static_cast<uint64>(32)) | Low;
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_rand<uint32, P, vecType>
+	template <typename T, precision P, template <class, precision> class vecType>
+	struct compute_rand
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint32, P> call()
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(engineType & Engine)
 		{
-			return
-				(vecType<uint32, P>(compute_rand<uint16, P, vecType>::call()) << static_cast<uint32>(16)) |
-				(vecType<uint32, P>(compute_rand<uint16, P, vecType>::call()) << static_cast<uint32>(0));
+			vecType<T, P> Result(uninitialize);
+			for(component_count_t i = 0; i < component_count(Result); ++i)
+				Result[i] = compute_rand_bits<T, engineType>::call(Engine);
+			return Result;
 		}
 	};
 
-	template <precision P, template <class, precision> class vecType>
-	struct compute_rand<uint64, P, vecType>
+	// Uniform numbers in (0, 1], never 0 so that their logarithm is finite
+	template <typename genType>
+	struct compute_rand_unit
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint64, P> call()
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static genType call(engineType & Engine)
 		{
-			return
-				(vecType<uint64, P>(compute_rand<uint32, P, vecType>::call()) << static_cast<uint64>(32)) |
-				(vecType<uint64, P>(compute_rand<uint32, P, vecType>::call()) << static_cast<uint64>(0));
+			uint64 const Bits = compute_rand_bits<uint64, engineType>::call(Engine) >> static_cast<uint64>(11);
+			return static_cast<genType>(Bits + static_cast<uint64>(1)) * static_cast<genType>(1.1102230246251565404236316680908203125e-16); // 2^-53
+		}
+	};
+
+	template <>
+	struct compute_rand_unit<float>
+	{
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static float call(engineType & Engine)
+		{
+			uint32 const Bits = compute_rand_bits<uint32, engineType>::call(Engine) >> static_cast<uint32>(8);
+			return static_cast<float>(Bits + static_cast<uint32>(1)) * 5.9604644775390625e-8f; // 2^-24
 		}
 	};
 
 	template <typename T, precision P, template <class, precision> class vecType>
 	struct compute_linearRand
 	{
-		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & Min, vecType<T, P> const & Max);
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & Min, vecType<T, P> const & Max, engineType & Engine);
 	};
 
 	template <precision P, template <class, precision> class vecType>
 	struct compute_linearRand<int8, P, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<int8, P> call(vecType<int8, P> const & Min, vecType<int8, P> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<int8, P> call(vecType<int8, P> const & Min, vecType<int8, P> const & Max, engineType & Engine)
 		{
-			return (vecType<int8, P>(compute_rand<uint8, P, vecType>::call() % vecType<uint8, P>(Max + static_cast<int8>(1) - Min))) + Min;
+			return (vecType<int8, P>(compute_rand<uint8, P, vecType>::call(Engine) % vecType<uint8, P>(Max + static_cast<int8>(1) - Min))) + Min;
 		}
 	};
 
 	template <precision P, template <class, precision> class vecType>
 	struct compute_linearRand<uint8, P, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint8, P> call(vecType<uint8, P> const & Min, vecType<uint8, P> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<uint8, P> call(vecType<uint8, P> const & Min, vecType<uint8, P> const & Max, engineType & Engine)
 		{
-			return (compute_rand<uint8, P, vecType>::call() % (Max + static_cast<uint8>(1) - Min)) + Min;
+			return (compute_rand<uint8, P, vecType>::call(Engine) % (Max + static_cast<uint8>(1) - Min)) + Min;
 		}
 	};
 
 	template <precision P, template <class, precision> class vecType>
 	struct compute_linearRand<int16, P, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<int16, P> call(vecType<int16, P> const & Min, vecType<int16, P> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<int16, P> call(vecType<int16, P> const & Min, vecType<int16, P> const & Max, engineType & Engine)
 		{
-			return (vecType<int16, P>(compute_rand<uint16, P, vecType>::call() % vecType<uint16, P>(Max + static_cast<int16>(1) - Min))) + Min;
+			return (vecType<int16, P>(compute_rand<uint16, P, vecType>::call(Engine) % vecType<uint16, P>(Max + static_cast<int16>(1) - Min))) + Min;
 		}
 	};
 
 	template <precision P, template <class, precision> class vecType>
 	struct compute_linearRand<uint16, P, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint16, P> call(vecType<uint16, P> const & Min, vecType<uint16, P> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<uint16, P> call(vecType<uint16, P> const & Min, vecType<uint16, P> const & Max, engineType & Engine)
 		{
-			return (compute_rand<uint16, P, vecType>::call() % (Max + static_cast<uint16>(1) - Min)) + Min;
+			return (compute_rand<uint16, P, vecType>::call(Engine) % (Max + static_cast<uint16>(1) - Min)) + Min;
 		}
 	};
 
 	template <precision P, template <class, precision> class vecType>
 	struct compute_linearRand<int32, P, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<int32, P> call(vecType<int32, P> const & Min, vecType<int32, P> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<int32, P> call(vecType<int32, P> const & Min, vecType<int32, P> const & Max, engineType & Engine)
 		{
-			return (vecType<int32, P>(compute_rand<uint32, P, vecType>::call() % vecType<uint32, P>(Max + static_cast<int32>(1) - Min))) + Min;
+			return (vecType<int32, P>(compute_rand<uint32, P, vecType>::call(Engine) % vecType<uint32, P>(Max + static_cast<int32>(1) - Min))) + Min;
 		}
 	};
 
 	template <precision P, template <class, precision> class vecType>
 	struct compute_linearRand<uint32, P, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint32, P> call(vecType<uint32, P> const & Min, vecType<uint32, P> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<uint32, P> call(vecType<uint32, P> const & Min, vecType<uint32, P> const & Max, engineType & Engine)
 		{
-			return (compute_rand<uint32, P, vecType>::call() % (Max + static_cast<uint32>(1) - Min)) + Min;
+			return (compute_rand<uint32, P, vecType>::call(Engine) % (Max + static_cast<uint32>(1) - Min)) + Min;
 		}
 	};
 
 	template <precision P, template <class, precision> class vecType>
 	struct compute_linearRand<int64, P, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<int64, P> call(vecType<int64, P> const & Min, vecType<int64, P> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<int64, P> call(vecType<int64, P> const & Min, vecType<int64, P> const & Max, engineType & Engine)
 		{
-			return (vecType<int64, P>(compute_rand<uint64, P, vecType>::call() % vecType<uint64, P>(Max + static_cast<int64>(1) - Min))) + Min;
+			return (vecType<int64, P>(compute_rand<uint64, P, vecType>::call(Engine) % vecType<uint64, P>(Max + static_cast<int64>(1) - Min))) + Min;
 		}
 	};
 
 	template <precision P, template <class, precision> class vecType>
 	struct compute_linearRand<uint64, P, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<uint64, P> call(vecType<uint64, P> const & Min, vecType<uint64, P> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<uint64, P> call(vecType<uint64, P> const & Min, vecType<uint64, P> const & Max, engineType & Engine)
 		{
-			return (compute_rand<uint64, P, vecType>::call() % (Max + static_cast<uint64>(1) - Min)) + Min;
+			return (compute_rand<uint64, P, vecType>::call(Engine) % (Max + static_cast<uint64>(1) - Min)) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<float, lowp, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<float, lowp> call(vecType<float, lowp> const & Min, vecType<float, lowp> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<float, lowp> call(vecType<float, lowp> const & Min, vecType<float, lowp> const & Max, engineType & Engine)
 		{
-			return vecType<float, lowp>(compute_rand<uint8, lowp, vecType>::call()) / static_cast<float>(std::numeric_limits<uint8>::max()) * (Max - Min) + Min;
+			return vecType<float, lowp>(compute_rand<uint8, lowp, vecType>::call(Engine)) / static_cast<float>(std::numeric_limits<uint8>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<float, mediump, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<float, mediump> call(vecType<float, mediump> const & Min, vecType<float, mediump> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<float, mediump> call(vecType<float, mediump> const & Min, vecType<float, mediump> const & Max, engineType & Engine)
 		{
-			return vecType<float, mediump>(compute_rand<uint16, mediump, vecType>::call()) / static_cast<float>(std::numeric_limits<uint16>::max()) * (Max - Min) + Min;
+			return vecType<float, mediump>(compute_rand<uint16, mediump, vecType>::call(Engine)) / static_cast<float>(std::numeric_limits<uint16>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<float, highp, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<float, highp> call(vecType<float, highp> const & Min, vecType<float, highp> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<float, highp> call(vecType<float, highp> const & Min, vecType<float, highp> const & Max, engineType & Engine)
 		{
-			return vecType<float, highp>(compute_rand<uint32, highp, vecType>::call()) / static_cast<float>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
+			return vecType<float, highp>(compute_rand<uint32, highp, vecType>::call(Engine)) / static_cast<float>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<double, lowp, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<double, lowp> call(vecType<double, lowp> const & Min, vecType<double, lowp> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<double, lowp> call(vecType<double, lowp> const & Min, vecType<double, lowp> const & Max, engineType & Engine)
 		{
-			return vecType<double, lowp>(compute_rand<uint16, lowp, vecType>::call()) / static_cast<double>(std::numeric_limits<uint16>::max()) * (Max - Min) + Min;
+			return vecType<double, lowp>(compute_rand<uint16, lowp, vecType>::call(Engine)) / static_cast<double>(std::numeric_limits<uint16>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<double, mediump, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<double, mediump> call(vecType<double, mediump> const & Min, vecType<double, mediump> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<double, mediump> call(vecType<double, mediump> const & Min, vecType<double, mediump> const & Max, engineType & Engine)
 		{
-			return vecType<double, mediump>(compute_rand<uint32, mediump, vecType>::call()) / static_cast<double>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
+			return vecType<double, mediump>(compute_rand<uint32, mediump, vecType>::call(Engine)) / static_cast<double>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<double, highp, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<double, highp> call(vecType<double, highp> const & Min, vecType<double, highp> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<double, highp> call(vecType<double, highp> const & Min, vecType<double, highp> const & Max, engineType & Engine)
 		{
-			return vecType<double, highp>(compute_rand<uint64, highp, vecType>::call()) / static_cast<double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			return vecType<double, highp>(compute_rand<uint64, highp, vecType>::call(Engine)) / static_cast<double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<long double, lowp, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<long double, lowp> call(vecType<long double, lowp> const & Min, vecType<long double, lowp> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<long double, lowp> call(vecType<long double, lowp> const & Min, vecType<long double, lowp> const & Max, engineType & Engine)
 		{
-			return vecType<long double, lowp>(compute_rand<uint32, lowp, vecType>::call()) / static_cast<long double>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
+			return vecType<long double, lowp>(compute_rand<uint32, lowp, vecType>::call(Engine)) / static_cast<long double>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<long double, mediump, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<long double, mediump> call(vecType<long double, mediump> const & Min, vecType<long double, mediump> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<long double, mediump> call(vecType<long double, mediump> const & Min, vecType<long double, mediump> const & Max, engineType & Engine)
 		{
-			return vecType<long double, mediump>(compute_rand<uint64, mediump, vecType>::call()) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			return vecType<long double, mediump>(compute_rand<uint64, mediump, vecType>::call(Engine)) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template <template <class, precision> class vecType>
 	struct compute_linearRand<long double, highp, vecType>
 	{
-		GLM_FUNC_QUALIFIER static vecType<long double, highp> call(vecType<long double, highp> const & Min, vecType<long double, highp> const & Max)
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static vecType<long double, highp> call(vecType<long double, highp> const & Min, vecType<long double, highp> const & Max, engineType & Engine)
+		{
+			return vecType<long double, highp>(compute_rand<uint64, highp, vecType>::call(Engine)) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+		}
+	};
+
+	//////////////////////////////////////
+	// Engines
+
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64 & State)
+	{
+		uint64 z = (State += static_cast<uint64>(0x9E3779B97F4A7C15ull));
+		z = (z ^ (z >> 30)) * static_cast<uint64>(0xBF58476D1CE4E5B9ull);
+		z = (z ^ (z >> 27)) * static_cast<uint64>(0x94D049BB133111EBull);
+		return z ^ (z >> 31);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 rotl32(uint32 x, int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	GLM_FUNC_QUALIFIER void philox_round(uint32 Counter[4], uint32 const Key[2])
+	{
+		uint64 const Product0 = static_cast<uint64>(0xD2511F53u) * static_cast<uint64>(Counter[0]);
+		uint64 const Product1 = static_cast<uint64>(0xCD9E8D57u) * static_cast<uint64>(Counter[2]);
+		uint32 const Hi0 = static_cast<uint32>(Product0 >> 32);
+		uint32 const Hi1 = static_cast<uint32>(Product1 >> 32);
+		uint32 const Lo0 = static_cast<uint32>(Product0);
+		uint32 const Lo1 = static_cast<uint32>(Product1);
+
+		Counter[0] = Hi1 ^ Counter[1] ^ Key[0];
+		Counter[1] = Lo1;
+		Counter[2] = Hi0 ^ Counter[3] ^ Key[1];
+		Counter[3] = Lo0;
+	}
+
+	//////////////////////////////////////
+	// Batch generation
+
+	// Four interleaved xoshiro128** generators, one per SIMD lane, seeded from another engine.
+	struct xoshiro128x4
+	{
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER explicit xoshiro128x4(engineType & Engine)
 		{
-			return vecType<long double, highp>(compute_rand<uint64, highp, vecType>::call()) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			uint32 Seed[4][4];
+			for(int Lane = 0; Lane < 4; ++Lane)
+			{
+				for(int i = 0; i < 4; ++i)
+					Seed[i][Lane] = static_cast<uint32>(Engine());
+				// The all zero state is a fixed point
+				if((Seed[0][Lane] | Seed[1][Lane] | Seed[2][Lane] | Seed[3][Lane]) == 0)
+					Seed[0][Lane] = 1;
+			}
+
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				for(int i = 0; i < 4; ++i)
+					this->State[i] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Seed[i]));
+#			else
+				for(int i = 0; i < 4; ++i)
+				for(int Lane = 0; Lane < 4; ++Lane)
+					this->State[i][Lane] = Seed[i][Lane];
+#			endif
 		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2
+			// Random floats in [0, 1)
+			GLM_FUNC_QUALIFIER __m128 next()
+			{
+				__m128i const s1x5 = _mm_add_epi32(_mm_slli_epi32(this->State[1], 2), this->State[1]);
+				__m128i const Rot = _mm_or_si128(_mm_slli_epi32(s1x5, 7), _mm_srli_epi32(s1x5, 25));
+				__m128i const Result = _mm_add_epi32(_mm_slli_epi32(Rot, 3), Rot);
+
+				__m128i const t = _mm_slli_epi32(this->State[1], 9);
+				this->State[2] = _mm_xor_si128(this->State[2], this->State[0]);
+				this->State[3] = _mm_xor_si128(this->State[3], this->State[1]);
+				this->State[1] = _mm_xor_si128(this->State[1], this->State[2]);
+				this->State[0] = _mm_xor_si128(this->State[0], this->State[3]);
+				this->State[2] = _mm_xor_si128(this->State[2], t);
+				this->State[3] = _mm_or_si128(_mm_slli_epi32(this->State[3], 11), _mm_srli_epi32(this->State[3], 21));
+
+				// The 24 upper bits are exactly representable
+				return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Result, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+			}
+
+			__m128i State[4];
+#		else
+			// Random floats in [0, 1)
+			GLM_FUNC_QUALIFIER void next(float Result[4])
+			{
+				for(int Lane = 0; Lane < 4; ++Lane)
+				{
+					uint32 * s0 = &this->State[0][Lane];
+					uint32 * s1 = &this->State[1][Lane];
+					uint32 * s2 = &this->State[2][Lane];
+					uint32 * s3 = &this->State[3][Lane];
+
+					uint32 const Bits = rotl32(*s1 * 5, 7) * 9;
+					uint32 const t = *s1 << 9;
+					*s2 ^= *s0;
+					*s3 ^= *s1;
+					*s1 ^= *s2;
+					*s0 ^= *s3;
+					*s2 ^= t;
+					*s3 = rotl32(*s3, 11);
+
+					Result[Lane] = static_cast<float>(Bits >> 8) * (1.0f / 16777216.0f);
+				}
+			}
+
+			uint32 State[4][4];
+#		endif
 	};
+
+	// Fills Count floats, Min and Range hold 12 values repeating the pattern of the components, 12 being a multiple of 1, 2, 3 and 4.
+	GLM_FUNC_QUALIFIER void rand_linear_batch(xoshiro128x4 & Generator, float * Results, std::size_t Count, float const Min[12], float const Range[12])
+	{
+		float Tail[12];
+		for(std::size_t i = 0; i < Count; i += 12)
+		{
+			float * Dst = i + 12 <= Count ? Results + i : Tail;
+
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				for(int j = 0; j < 12; j += 4)
+					_mm_storeu_ps(Dst + j, _mm_add_ps(_mm_loadu_ps(Min + j), _mm_mul_ps(Generator.next(), _mm_loadu_ps(Range + j))));
+#			else
+				for(int j = 0; j < 12; j += 4)
+				{
+					float Rand[4];
+					Generator.next(Rand);
+					for(int k = 0; k < 4; ++k)
+						Dst[j + k] = Min[j + k] + Rand[k] * Range[j + k];
+				}
+#			endif
+
+			if(Dst == Tail)
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Results[i + j] = Tail[j];
+		}
+	}
+
+	template <typename engineType>
+	GLM_FUNC_QUALIFIER void rand_linear_batch(float * Results, std::size_t Count, float const * Min, float const * Max, int Components, engineType & Engine)
+	{
+		float PatternMin[12];
+		float PatternRange[12];
+		for(int i = 0; i < 12; ++i)
+		{
+			PatternMin[i] = Min[i % Components];
+			PatternRange[i] = Max[i % Components] - Min[i % Components];
+		}
+
+		xoshiro128x4 Generator(Engine);
+		rand_linear_batch(Generator, Results, Count * static_cast<std::size_t>(Components), PatternMin, PatternRange);
+	}
+
+	// Sine and cosine of 2 * pi * Turn for Turn in [0, 1): reduction to a quadrant then Taylor polynomials, exact to 1e-7
+	GLM_FUNC_QUALIFIER void rand_sincos_turn(float Turn, float & Sin, float & Cos)
+	{
+		float const Quarter = Turn * 4.0f;
+		float const Quadrant = static_cast<float>(static_cast<int>(Quarter));
+		float const a = (Quarter - Quadrant) * 1.57079632679489661923f;
+		float const a2 = a * a;
+		float const s = a * (1.0f + a2 * (-1.0f / 6.0f + a2 * (1.0f / 120.0f + a2 * (-1.0f / 5040.0f + a2 * (1.0f / 362880.0f + a2 * (-1.0f / 39916800.0f))))));
+		float const c = 1.0f + a2 * (-0.5f + a2 * (1.0f / 24.0f + a2 * (-1.0f / 720.0f + a2 * (1.0f / 40320.0f + a2 * (-1.0f / 3628800.0f + a2 * (1.0f / 479001600.0f))))));
+
+		switch(static_cast<int>(Quadrant))
+		{
+		default:
+		case 0: Cos = c; Sin = s; break;
+		case 1: Cos = -s; Sin = c; break;
+		case 2: Cos = -c; Sin = -s; break;
+		case 3: Cos = s; Sin = -c; break;
+		}
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2
+		GLM_FUNC_QUALIFIER void rand_sincos_turn(__m128 Turn, __m128 & Sin, __m128 & Cos)
+		{
+			__m128 const Quarter = _mm_mul_ps(Turn, _mm_set1_ps(4.0f));
+			__m128i const Quadrant = _mm_cvttps_epi32(Quarter);
+			__m128 const a = _mm_mul_ps(_mm_sub_ps(Quarter, _mm_cvtepi32_ps(Quadrant)), _mm_set1_ps(1.57079632679489661923f));
+			__m128 const a2 = _mm_mul_ps(a, a);
+
+			__m128 s = _mm_add_ps(_mm_set1_ps(1.0f / 362880.0f), _mm_mul_ps(a2, _mm_set1_ps(-1.0f / 39916800.0f)));
+			s = _mm_add_ps(_mm_set1_ps(-1.0f / 5040.0f), _mm_mul_ps(a2, s));
+			s = _mm_add_ps(_mm_set1_ps(1.0f / 120.0f), _mm_mul_ps(a2, s));
+			s = _mm_add_ps(_mm_set1_ps(-1.0f / 6.0f), _mm_mul_ps(a2, s));
+			s = _mm_mul_ps(a, _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(a2, s)));
+
+			__m128 c = _mm_add_ps(_mm_set1_ps(-1.0f / 3628800.0f), _mm_mul_ps(a2, _mm_set1_ps(1.0f / 479001600.0f)));
+			c = _mm_add_ps(_mm_set1_ps(1.0f / 40320.0f), _mm_mul_ps(a2, c));
+			c = _mm_add_ps(_mm_set1_ps(-1.0f / 720.0f), _mm_mul_ps(a2, c));
+			c = _mm_add_ps(_mm_set1_ps(1.0f / 24.0f), _mm_mul_ps(a2, c));
+			c = _mm_add_ps(_mm_set1_ps(-0.5f), _mm_mul_ps(a2, c));
+			c = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(a2, c));
+
+			// Odd quadrants swap sine and cosine, quadrants 1 and 2 negate the cosine, quadrants 2 and 3 negate the sine
+			__m128 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(Quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+			__m128 const NegCos = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(Quadrant, _mm_set1_epi32(1)), 30));
+			__m128 const NegSin = _mm_castsi128_ps(_mm_slli_epi32(Quadrant, 30));
+			__m128 const SignMask = _mm_set1_ps(-0.0f);
+
+			Cos = _mm_or_ps(_mm_and_ps(Swap, s), _mm_andnot_ps(Swap, c));
+			Sin = _mm_or_ps(_mm_and_ps(Swap, c), _mm_andnot_ps(Swap, s));
+			Cos = _mm_xor_ps(Cos, _mm_and_ps(NegCos, SignMask));
+			Sin = _mm_xor_ps(Sin, _mm_and_ps(NegSin, SignMask));
+		}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2
+
+	// Fills X, Y and Z with 4 points on the sphere, or on the circle of the XY plane when Z is null
+	GLM_FUNC_QUALIFIER void rand_unit4(xoshiro128x4 & Generator, float Radius, float X[4], float Y[4], float Z[4])
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2
+			__m128 const r = _mm_set1_ps(Radius);
+			__m128 Sin, Cos;
+			rand_sincos_turn(Generator.next(), Sin, Cos);
+			if(Z)
+			{
+				// z in (-1, 1]
+				__m128 const z = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(Generator.next(), _mm_set1_ps(2.0f)));
+				__m128 const Planar = _mm_mul_ps(r, _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, z)), _mm_setzero_ps())));
+				_mm_storeu_ps(X, _mm_mul_ps(Cos, Planar));
+				_mm_storeu_ps(Y, _mm_mul_ps(Sin, Planar));
+				_mm_storeu_ps(Z, _mm_mul_ps(z, r));
+			}
+			else
+			{
+				_mm_storeu_ps(X, _mm_mul_ps(Cos, r));
+				_mm_storeu_ps(Y, _mm_mul_ps(Sin, r));
+			}
+#		else
+			float Turn[4];
+			Generator.next(Turn);
+			float Height[4];
+			if(Z)
+				Generator.next(Height);
+			for(int i = 0; i < 4; ++i)
+			{
+				float Sin, Cos;
+				rand_sincos_turn(Turn[i], Sin, Cos);
+				if(Z)
+				{
+					float const z = 1.0f - Height[i] * 2.0f;
+					float const Planar = Radius * std::sqrt(max(1.0f - z * z, 0.0f));
+					X[i] = Cos * Planar;
+					Y[i] = Sin * Planar;
+					Z[i] = z * Radius;
+				}
+				else
+				{
+					X[i] = Cos * Radius;
+					Y[i] = Sin * Radius;
+				}
+			}
+#		endif
+	}
 }//namespace detail
 
-	template <typename genType>
-	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max)
+	//////////////////////////////////////
+	// Engines
+
+	GLM_FUNC_QUALIFIER xoshiro128::xoshiro128(uint64 Seed, uint64 Stream)
+	{
+		this->seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128::seed(uint64 Seed, uint64 Stream)
+	{
+		uint64 SplitMix = Seed;
+		uint64 const a = detail::splitmix64(SplitMix);
+		uint64 const b = detail::splitmix64(SplitMix);
+		this->State[0] = static_cast<uint32>(a);
+		this->State[1] = static_cast<uint32>(a >> 32);
+		this->State[2] = static_cast<uint32>(b);
+		this->State[3] = static_cast<uint32>(b >> 32);
+
+		// The all zero state is a fixed point
+		if((this->State[0] | this->State[1] | this->State[2] | this->State[3]) == 0)
+			this->State[0] = 1;
+
+		for(uint64 i = 0; i < Stream; ++i)
+			this->jump();
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128::result_type xoshiro128::operator()()
+	{
+		uint32 const Result = detail::rotl32(this->State[1] * 5, 7) * 9;
+		uint32 const t = this->State[1] << 9;
+
+		this->State[2] ^= this->State[0];
+		this->State[3] ^= this->State[1];
+		this->State[1] ^= this->State[2];
+		this->State[0] ^= this->State[3];
+		this->State[2] ^= t;
+		this->State[3] = detail::rotl32(this->State[3], 11);
+
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128::jump()
+	{
+		static uint32 const Jump[] = {0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b};
+
+		uint32 s[4] = {0, 0, 0, 0};
+		for(int i = 0; i < 4; ++i)
+		for(int b = 0; b < 32; ++b)
+		{
+			if(Jump[i] & (static_cast<uint32>(1) << b))
+			{
+				s[0] ^= this->State[0];
+				s[1] ^= this->State[1];
+				s[2] ^= this->State[2];
+				s[3] ^= this->State[3];
+			}
+			(*this)();
+		}
+
+		for(int i = 0; i < 4; ++i)
+			this->State[i] = s[i];
+	}
+
+	GLM_FUNC_QUALIFIER pcg32::pcg32(uint64 Seed, uint64 Stream)
+	{
+		this->seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void pcg32::seed(uint64 Seed, uint64 Stream)
+	{
+		this->State = 0;
+		this->Increment = (Stream << 1) | static_cast<uint64>(1);
+		(*this)();
+		this->State += Seed;
+		(*this)();
+	}
+
+	GLM_FUNC_QUALIFIER pcg32::result_type pcg32::operator()()
+	{
+		uint64 const Old = this->State;
+		this->State = Old * static_cast<uint64>(6364136223846793005ull) + this->Increment;
+		uint32 const XorShifted = static_cast<uint32>(((Old >> 18) ^ Old) >> 27);
+		uint32 const Rot = static_cast<uint32>(Old >> 59);
+		return (XorShifted >> Rot) | (XorShifted << ((32 - Rot) & 31));
+	}
+
+	GLM_FUNC_QUALIFIER philox4x32::philox4x32(uint64 Seed, uint64 Stream)
+	{
+		this->seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void philox4x32::seed(uint64 Seed, uint64 Stream)
+	{
+		this->Key[0] = static_cast<uint32>(Seed);
+		this->Key[1] = static_cast<uint32>(Seed >> 32);
+		this->Counter[0] = 0;
+		this->Counter[1] = 0;
+		this->Counter[2] = static_cast<uint32>(Stream);
+		this->Counter[3] = static_cast<uint32>(Stream >> 32);
+		this->Index = 4;
+	}
+
+	GLM_FUNC_QUALIFIER philox4x32::result_type philox4x32::operator()()
+	{
+		if(this->Index == 4)
+		{
+			uint32 Key[2] = {this->Key[0], this->Key[1]};
+			for(int i = 0; i < 4; ++i)
+				this->Block[i] = this->Counter[i];
+
+			detail::philox_round(this->Block, Key);
+			for(int Round = 1; Round < 10; ++Round)
+			{
+				Key[0] += 0x9E3779B9;
+				Key[1] += 0xBB67AE85;
+				detail::philox_round(this->Block, Key);
+			}
+
+			// 64 bits block counter, the upper words hold the stream
+			if(++this->Counter[0] == 0)
+				++this->Counter[1];
+			this->Index = 0;
+		}
+
+		return this->Block[this->Index++];
+	}
+
+	GLM_FUNC_QUALIFIER void philox4x32::discard(uint64 Count)
+	{
+		uint64 const Position = static_cast<uint64>(this->Index) + Count;
+		if(Position < 4)
+		{
+			this->Index = static_cast<uint32>(Position);
+			return;
+		}
+
+		// The current block was already generated, the counter designates the next one
+		uint64 const Counter = ((static_cast<uint64>(this->Counter[1]) << 32) | this->Counter[0]) + (Position - 4) / 4;
+		this->Counter[0] = static_cast<uint32>(Counter);
+		this->Counter[1] = static_cast<uint32>(Counter >> 32);
+		this->Index = 4;
+
+		uint32 const Skip = static_cast<uint32>((Position - 4) % 4);
+		for(uint32 i = 0; i < Skip; ++i)
+			(*this)();
+	}
+
+	//////////////////////////////////////
+	// Distributions
+
+	template <typename genType, typename engineType>
+	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max, engineType & Engine)
 	{
 		return detail::compute_linearRand<genType, highp, tvec1>::call(
 			tvec1<genType, highp>(Min),
-			tvec1<genType, highp>(Max)).x;
+			tvec1<genType, highp>(Max), Engine).x;
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_QUALIFIER vecType<T, P> linearRand(vecType<T, P> const & Min, vecType<T, P> const & Max, engineType & Engine)
+	{
+		return detail::compute_linearRand<T, P, vecType>::call(Min, Max, Engine);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max)
+	{
+		detail::std_rand_engine Engine;
+		return linearRand(Min, Max, Engine);
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> linearRand(vecType<T, P> const & Min, vecType<T, P> const & Max)
 	{
-		return detail::compute_linearRand<T, P, vecType>::call(Min, Max);
+		detail::std_rand_engine Engine;
+		return linearRand(Min, Max, Engine);
+	}
+
+	template <typename genType, typename engineType>
+	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation, engineType & Engine)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'gaussRand' only accept floating-point inputs");
+
+		// Box-Muller transform, without the rejection loop of its polar form
+		genType const Radius = sqrt(genType(-2) * log(detail::compute_rand_unit<genType>::call(Engine)));
+		genType const Angle = genType(6.283185307179586476925286766559) * detail::compute_rand_unit<genType>::call(Engine);
+
+		return Mean + Deviation * Radius * cos(Angle);
 	}
 
 	template <typename genType>
 	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation)
 	{
-		genType w, x1, x2;
-	
-		do
-		{
-			x1 = linearRand(genType(-1), genType(1));
-			x2 = linearRand(genType(-1), genType(1));
-		
-			w = x1 * x1 + x2 * x2;
-		} while(w > genType(1));
-	
-		return x2 * Deviation * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean;
+		detail::std_rand_engine Engine;
+		return gaussRand(Mean, Deviation, Engine);
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
@@ -320,60 +778,119 @@ namespace detail
 		return detail::functor2<T, P, vecType>::call(gaussRand, Mean, Deviation);
 	}
 
+	template <typename T, typename engineType>
+	GLM_FUNC_QUALIFIER tvec2<T, defaultp> circularRand(T Radius, engineType & Engine)
+	{
+		T a = linearRand(T(0), T(6.283185307179586476925286766559f), Engine);
+		return tvec2<T, defaultp>(cos(a), sin(a)) * Radius;
+	}
+
+	template <typename T, typename engineType>
+	GLM_FUNC_QUALIFIER tvec3<T, defaultp> sphericalRand(T Radius, engineType & Engine)
+	{
+		T z = linearRand(T(-1), T(1), Engine);
+		T a = linearRand(T(0), T(6.283185307179586476925286766559f), Engine);
+	
+		T r = sqrt(T(1) - z * z);
+	
+		T x = r * cos(a);
+		T y = r * sin(a);
+	
+		return tvec3<T, defaultp>(x, y, z) * Radius;
+	}
+
+	// A direction and a distance to the center following the distribution of the area of
+	// the disk or of the volume of the ball, instead of rejecting the points of the square
+	template <typename T, typename engineType>
+	GLM_FUNC_QUALIFIER tvec2<T, defaultp> diskRand(T Radius, engineType & Engine)
+	{
+		return circularRand(Radius, Engine) * sqrt(linearRand(T(0), T(1), Engine));
+	}
+
+	template <typename T, typename engineType>
+	GLM_FUNC_QUALIFIER tvec3<T, defaultp> ballRand(T Radius, engineType & Engine)
+	{
+		return sphericalRand(Radius, Engine) * pow(linearRand(T(0), T(1), Engine), static_cast<T>(1) / static_cast<T>(3));
+	}
+
 	template <typename T>
 	GLM_FUNC_QUALIFIER tvec2<T, defaultp> diskRand(T Radius)
-	{		
-		tvec2<T, defaultp> Result(T(0));
-		T LenRadius(T(0));
-		
-		do
-		{
-			Result = linearRand(
-				tvec2<T, defaultp>(-Radius),
-				tvec2<T, defaultp>(Radius));
-			LenRadius = length(Result);
-		}
-		while(LenRadius > Radius);
-		
-		return Result;
+	{
+		detail::std_rand_engine Engine;
+		return diskRand(Radius, Engine);
 	}
-	
+
 	template <typename T>
 	GLM_FUNC_QUALIFIER tvec3<T, defaultp> ballRand(T Radius)
-	{		
-		tvec3<T, defaultp> Result(T(0));
-		T LenRadius(T(0));
-		
-		do
-		{
-			Result = linearRand(
-				tvec3<T, defaultp>(-Radius),
-				tvec3<T, defaultp>(Radius));
-			LenRadius = length(Result);
-		}
-		while(LenRadius > Radius);
-		
-		return Result;
+	{
+		detail::std_rand_engine Engine;
+		return ballRand(Radius, Engine);
 	}
-	
+
 	template <typename T>
 	GLM_FUNC_QUALIFIER tvec2<T, defaultp> circularRand(T Radius)
 	{
-		T a = linearRand(T(0), T(6.283185307179586476925286766559f));
-		return tvec2<T, defaultp>(cos(a), sin(a)) * Radius;		
+		detail::std_rand_engine Engine;
+		return circularRand(Radius, Engine);
 	}
-	
+
 	template <typename T>
 	GLM_FUNC_QUALIFIER tvec3<T, defaultp> sphericalRand(T Radius)
 	{
-		T z = linearRand(T(-1), T(1));
-		T a = linearRand(T(0), T(6.283185307179586476925286766559f));
-	
-		T r = sqrt(T(1) - z * z);
-	
-		T x = r * cos(a);
-		T y = r * sin(a);
-	
-		return tvec3<T, defaultp>(x, y, z) * Radius;	
+		detail::std_rand_engine Engine;
+		return sphericalRand(Radius, Engine);
+	}
+
+	//////////////////////////////////////
+	// Batch generation
+
+	template <typename engineType>
+	GLM_FUNC_QUALIFIER void linearRandBatch(float * Results, std::size_t Count, float Min, float Max, engineType & Engine)
+	{
+		detail::rand_linear_batch(Results, Count, &Min, &Max, 1, Engine);
+	}
+
+	template <typename engineType>
+	GLM_FUNC_QUALIFIER void linearRandBatch(vec2 * Results, std::size_t Count, vec2 const & Min, vec2 const & Max, engineType & Engine)
+	{
+		detail::rand_linear_batch(reinterpret_cast<float *>(Results), Count, &Min[0], &Max[0], 2, Engine);
+	}
+
+	template <typename engineType>
+	GLM_FUNC_QUALIFIER void linearRandBatch(vec3 * Results, std::size_t Count, vec3 const & Min, vec3 const & Max, engineType & Engine)
+	{
+		detail::rand_linear_batch(reinterpret_cast<float *>(Results), Count, &Min[0], &Max[0], 3, Engine);
+	}
+
+	template <typename engineType>
+	GLM_FUNC_QUALIFIER void linearRandBatch(vec4 * Results, std::size_t Count, vec4 const & Min, vec4 const & Max, engineType & Engine)
+	{
+		detail::rand_linear_batch(reinterpret_cast<float *>(Results), Count, &Min[0], &Max[0], 4, Engine);
+	}
+
+	template <typename engineType>
+	GLM_FUNC_QUALIFIER void circularRandBatch(vec2 * Results, std::size_t Count, float Radius, engineType & Engine)
+	{
+		detail::xoshiro128x4 Generator(Engine);
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			float X[4], Y[4];
+			detail::rand_unit4(Generator, Radius, X, Y, 0);
+			for(std::size_t j = 0; j < 4 && i + j < Count; ++j)
+				Results[i + j] = vec2(X[j], Y[j]);
+		}
+	}
+
+	template <typename engineType>
+	GLM_FUNC_QUALIFIER void sphericalRandBatch(vec3 * Results, std::size_t Count, float Radius, engineType & Engine)
+	{
+		detail::xoshiro128x4 Generator(Engine);
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			float X[4], Y[4], Z[4];
+			detail::rand_unit4(Generator, Radius, X, Y, Z);
+			for(std::size_t j = 0; j < 4 && i + j < Count; ++j)
+				Results[i + j] = vec3(X[j], Y[j], Z[j]);
+		}
 	}
 }//namespace glm
@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_approx_math
+/// @file glm/gtx/approx_math.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_approx_math GLM_GTX_approx_math
+/// @ingroup gtx
+///
+/// @brief Approximations of exponential, logarithm, trigonometric and inverse square root functions with selectable accuracy.
+///
+/// The Bits template argument of each function is the number of correct bits
+/// requested: the result is computed by the cheapest of three accuracy tiers,
+/// 2, 12 and 22 bits, that reaches it. Each tier is a minimax polynomial on a
+/// reduced range, so that its error bound is known: for Bits <= 22 the error
+/// relative to the exact result is below 2^-Bits, absolute for approxSin and
+/// approxCos.
+///
+/// The functions on vec4 use SSE2 when available and the batch functions
+/// process arrays with SSE2 or AVX2 + FMA depending on the running CPU, see
+/// GLM_GTX_simd_dispatch. The other configurations use the scalar kernels.
+///
+/// <glm/gtx/approx_math.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_approx_math extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_approx_math
+	/// @{
+
+	/// Approximation of 2^x, x is clamped to [-126, 127].
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxExp2(float x);
+
+	/// Approximation of 2^x, x is clamped to [-126, 127].
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxExp2(vecType<float, P> const & x);
+
+	/// Result[i] = approxExp2<Bits>(x[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxExp2Batch(float const * x, float * Result, std::size_t Count);
+
+	/// Approximation of e^x, x is clamped to [-87, 88].
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxExp(float x);
+
+	/// Approximation of e^x, x is clamped to [-87, 88].
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxExp(vecType<float, P> const & x);
+
+	/// Result[i] = approxExp<Bits>(x[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxExpBatch(float const * x, float * Result, std::size_t Count);
+
+	/// Approximation of log2(x), x must be a positive normalized float.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxLog2(float x);
+
+	/// Approximation of log2(x), x must be a positive normalized float.
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxLog2(vecType<float, P> const & x);
+
+	/// Result[i] = approxLog2<Bits>(x[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxLog2Batch(float const * x, float * Result, std::size_t Count);
+
+	/// Approximation of the natural logarithm of x, x must be a positive normalized float.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxLog(float x);
+
+	/// Approximation of the natural logarithm of x, x must be a positive normalized float.
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxLog(vecType<float, P> const & x);
+
+	/// Result[i] = approxLog<Bits>(x[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxLogBatch(float const * x, float * Result, std::size_t Count);
+
+	/// Approximation of x^y computed as 2^(y * log2(x)), x must be a positive normalized float.
+	/// The relative error is the error of the tier multiplied by |y * log2(x) * ln(2)|, plus the error of the tier.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxPow(float x, float y);
+
+	/// Approximation of x^y computed as 2^(y * log2(x)), x must be a positive normalized float.
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxPow(vecType<float, P> const & x, vecType<float, P> const & y);
+
+	/// Result[i] = approxPow<Bits>(x[i], y[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxPowBatch(float const * x, float const * y, float * Result, std::size_t Count);
+
+	/// Approximation of sin(x), the bound of the absolute error holds for |x| <= 8192.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxSin(float x);
+
+	/// Approximation of sin(x), the bound of the absolute error holds for |x| <= 8192.
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxSin(vecType<float, P> const & x);
+
+	/// Result[i] = approxSin<Bits>(x[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxSinBatch(float const * x, float * Result, std::size_t Count);
+
+	/// Approximation of cos(x), the bound of the absolute error holds for |x| <= 8192.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxCos(float x);
+
+	/// Approximation of cos(x), the bound of the absolute error holds for |x| <= 8192.
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxCos(vecType<float, P> const & x);
+
+	/// Result[i] = approxCos<Bits>(x[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxCosBatch(float const * x, float * Result, std::size_t Count);
+
+	/// Approximation of atan(x).
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxAtan(float x);
+
+	/// Approximation of atan(x).
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxAtan(vecType<float, P> const & x);
+
+	/// Result[i] = approxAtan<Bits>(x[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxAtanBatch(float const * x, float * Result, std::size_t Count);
+
+	/// Approximation of 1 / sqrt(x), x must be a positive normalized float.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL float approxInverseSqrt(float x);
+
+	/// Approximation of 1 / sqrt(x), x must be a positive normalized float.
+	/// @see gtx_approx_math
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<float, P> approxInverseSqrt(vecType<float, P> const & x);
+
+	/// Result[i] = approxInverseSqrt<Bits>(x[i]) for Count values.
+	/// @see gtx_approx_math
+	template <int Bits>
+	GLM_FUNC_DECL void approxInverseSqrtBatch(float const * x, float * Result, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "approx_math.inl"
@@ -0,0 +1,855 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_approx_math
+/// @file glm/gtx/approx_math.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Index of the cheapest tier giving at least Bits correct bits, undefined when Bits is out of [1, 22]
+	template <int Bits, bool Valid = (Bits > 0 && Bits <= 22)>
+	struct approx_tier;
+
+	template <int Bits>
+	struct approx_tier<Bits, true>
+	{
+		enum {value = Bits <= 2 ? 0 : (Bits <= 12 ? 1 : 2)};
+	};
+
+	// Minimax polynomials of the tiers, by increasing degree.
+	// 2^x on [-0.5, 0.5], relative error 3.0e-2, 7.5e-5 and 1.9e-9
+	static float const ApproxExp2Tier0[] = {1.02903001f, 0.686020004f};
+	static float const ApproxExp2Tier1[] = {0.999928074f, 0.693260986f, 0.242611122f, 0.0551716691f};
+	static float const ApproxExp2Tier2[] = {1.0f, 0.693147206f, 0.240226469f, 0.0555032878f, 0.00961848896f, 0.00133999312f, 0.000153458120f};
+
+	// e^x on [-ln(2) / 2, ln(2) / 2], relative error 3.0e-2, 7.5e-5 and 1.9e-9
+	static float const ApproxExpTier0[] = {1.02903001f, 0.989717658f};
+	static float const ApproxExpTier1[] = {0.999928074f, 1.00016419f, 0.504963264f, 0.165668424f};
+	static float const ApproxExpTier2[] = {1.0f, 1.00000004f, 0.499999921f, 0.166664202f, 0.0416682256f, 0.00837481580f, 0.00138368460f};
+
+	// log2(1 + x) / x and ln(1 + x) / x on [sqrt(0.5) - 1, sqrt(2) - 1], relative error 1.7e-1, 5.0e-5 and 2.6e-8
+	static float const ApproxLog2Tier0[] = {1.41421356f};
+	static float const ApproxLog2Tier1[] = {1.44264625f, -0.720554972f, 0.485306515f, -0.390892442f, 0.254751872f};
+	static float const ApproxLog2Tier2[] = {1.44269500f, -0.721347347f, 0.480910643f, -0.360703683f, 0.287916248f, -0.238944819f, 0.215715601f, -0.207269762f, 0.125837051f};
+	static float const ApproxLogTier0[] = {0.980258144f};
+	static float const ApproxLogTier1[] = {0.999966181f, -0.499450648f, 0.336388842f, -0.270945994f, 0.176580542f};
+	static float const ApproxLogTier2[] = {0.999999974f, -0.499999880f, 0.333341856f, -0.250020741f, 0.199568336f, -0.165623927f, 0.149522661f, -0.143668451f, 0.0872235972f};
+
+	// sin(x) / x and cos(x) of x^2 on [0, (pi / 4)^2], relative error 5.2e-2, 1.5e-6 and 3.2e-9, then 2.3e-3, 1.2e-5 and 5.6e-11
+	static float const ApproxSinTier0[] = {0.947543636f};
+	static float const ApproxSinTier1[] = {0.999998493f, -0.166623823f, 0.00815005656f};
+	static float const ApproxSinTier2[] = {0.999999997f, -0.166666502f, 0.00833201645f, -0.000195018220f};
+	static float const ApproxCosTier0[] = {0.997728892f, -0.473742233f};
+	static float const ApproxCosTier1[] = {0.999988217f, -0.499685485f, 0.0403622939f};
+	static float const ApproxCosTier2[] = {1.0f, -0.499999996f, 0.0416666132f, -0.00138865292f, 0.0000243726792f};
+
+	// atan(x) / x of x^2 on [0, tan(pi / 8)^2], relative error 2.7e-2, 1.8e-5 and 1.8e-8
+	static float const ApproxAtanTier0[] = {0.973337287f};
+	static float const ApproxAtanTier1[] = {0.999981978f, -0.331390679f, 0.168229315f};
+	static float const ApproxAtanTier2[] = {0.999999982f, -0.333327992f, 0.199744704f, -0.138520883f, 0.0798673672f};
+
+	// Cody and Waite reductions, the high parts have enough trailing zeros for their products by the quotient to be exact
+	static float const ApproxLn2Hi = 0.693359375f;
+	static float const ApproxLn2Lo = -2.12194440e-4f;
+	static float const ApproxHalfPiHi = 1.5703125f;
+	static float const ApproxHalfPiMid = 4.83751296997070312e-4f;
+	static float const ApproxHalfPiLo = 7.54978995489188216e-8f;
+
+	template <std::size_t N>
+	GLM_FUNC_QUALIFIER float approx_horner(float x, float const (&Coefficients)[N])
+	{
+		float Result = Coefficients[N - 1];
+		for(std::size_t i = N - 1; i > 0; --i)
+			Result = Result * x + Coefficients[i - 1];
+		return Result;
+	}
+
+	//////////////////////////////////////
+	// Scalar kernels
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER float approx_exp2(float x)
+	{
+		float const t = glm::clamp(x, -126.0f, 127.0f);
+		int const n = static_cast<int>(t + 126.5f) - 126;
+		float const f = t - static_cast<float>(n);
+		float const p = Tier == 0 ? approx_horner(f, ApproxExp2Tier0) : (Tier == 1 ? approx_horner(f, ApproxExp2Tier1) : approx_horner(f, ApproxExp2Tier2));
+		return intBitsToFloat(floatBitsToInt(p) + n * (1 << 23));
+	}
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER float approx_exp(float x)
+	{
+		float const t = glm::clamp(x, -87.0f, 88.0f);
+		int const n = static_cast<int>(t * 1.44269504f + 126.5f) - 126;
+		float const nf = static_cast<float>(n);
+		float const r = (t - nf * ApproxLn2Hi) - nf * ApproxLn2Lo;
+		float const p = Tier == 0 ? approx_horner(r, ApproxExpTier0) : (Tier == 1 ? approx_horner(r, ApproxExpTier1) : approx_horner(r, ApproxExpTier2));
+		return intBitsToFloat(floatBitsToInt(p) + n * (1 << 23));
+	}
+
+	// x = m * 2^e with m in [sqrt(0.5), sqrt(2)[ so that log(m) keeps its relative accuracy close to 1
+	template <int Tier, bool Natural>
+	GLM_FUNC_QUALIFIER float approx_log(float x)
+	{
+		int const i = floatBitsToInt(x) - 0x3f3504f3;
+		float const e = static_cast<float>(i >> 23);
+		float const f = intBitsToFloat((i & 0x007fffff) + 0x3f3504f3) - 1.0f;
+		float const q = Natural ?
+			(Tier == 0 ? approx_horner(f, ApproxLogTier0) : (Tier == 1 ? approx_horner(f, ApproxLogTier1) : approx_horner(f, ApproxLogTier2))) :
+			(Tier == 0 ? approx_horner(f, ApproxLog2Tier0) : (Tier == 1 ? approx_horner(f, ApproxLog2Tier1) : approx_horner(f, ApproxLog2Tier2)));
+		return e * (Natural ? 0.693147181f : 1.0f) + f * q;
+	}
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER float approx_pow(float x, float y)
+	{
+		return approx_exp2<Tier>(y * approx_log<Tier, false>(x));
+	}
+
+	// x = k * pi / 2 + r with r in [-pi / 4, pi / 4], the quadrant k selects sin(r) or cos(r) and the sign
+	template <int Tier, bool Cosine>
+	GLM_FUNC_QUALIFIER float approx_sincos(float x)
+	{
+		float const y = x * 0.636619772f;
+		int k = static_cast<int>(y + (y < 0.0f ? -0.5f : 0.5f));
+		float const kf = static_cast<float>(k);
+		float const r = ((x - kf * ApproxHalfPiHi) - kf * ApproxHalfPiMid) - kf * ApproxHalfPiLo;
+		float const s = r * r;
+		k += Cosine ? 1 : 0;
+
+		float const Result = k & 1 ?
+			(Tier == 0 ? approx_horner(s, ApproxCosTier0) : (Tier == 1 ? approx_horner(s, ApproxCosTier1) : approx_horner(s, ApproxCosTier2))) :
+			r * (Tier == 0 ? approx_horner(s, ApproxSinTier0) : (Tier == 1 ? approx_horner(s, ApproxSinTier1) : approx_horner(s, ApproxSinTier2)));
+		return k & 2 ? -Result : Result;
+	}
+
+	// atan(x) = pi / 2 + atan(-1 / x) above tan(3 pi / 8) and pi / 4 + atan((x - 1) / (x + 1)) above tan(pi / 8)
+	template <int Tier>
+	GLM_FUNC_QUALIFIER float approx_atan(float x)
+	{
+		float const a = glm::abs(x);
+		float z = a;
+		float Offset = 0.0f;
+		if(a > 2.41421356f)
+		{
+			z = -1.0f / a;
+			Offset = 1.57079633f;
+		}
+		else if(a > 0.414213562f)
+		{
+			z = (a - 1.0f) / (a + 1.0f);
+			Offset = 0.785398163f;
+		}
+
+		float const s = z * z;
+		float const q = Tier == 0 ? approx_horner(s, ApproxAtanTier0) : (Tier == 1 ? approx_horner(s, ApproxAtanTier1) : approx_horner(s, ApproxAtanTier2));
+		float const Result = Offset + z * q;
+		return x < 0.0f ? -Result : Result;
+	}
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER float approx_inversesqrt(float x)
+	{
+		if(Tier == 2)
+			return 1.0f / std::sqrt(x);
+
+		// Initial estimate of the exponent and of the mantissa from the bits of x, relative error 3.4e-2
+		float y = intBitsToFloat(static_cast<int>(0x5f37642f - (floatBitsToUint(x) >> 1)));
+		if(Tier == 1)
+		{
+			// Two Newton-Raphson iterations, relative error 4.7e-6
+			y = y * (1.5f - 0.5f * x * y * y);
+			y = y * (1.5f - 0.5f * x * y * y);
+		}
+		return y;
+	}
+
+	typedef void (*approx_func)(float const *, float *, std::size_t);
+	typedef void (*approx2_func)(float const *, float const *, float *, std::size_t);
+
+	template <float (*Kernel)(float)>
+	GLM_FUNC_QUALIFIER void approx_batch_pure(float const * x, float * Result, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = Kernel(x[i]);
+	}
+
+	template <float (*Kernel)(float, float)>
+	GLM_FUNC_QUALIFIER void approx_batch2_pure(float const * x, float const * y, float * Result, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = Kernel(x[i], y[i]);
+	}
+
+#	if GLM_DISPATCH_X86
+	//////////////////////////////////////
+	// SSE2 kernels, using FMA when available at compile time
+
+	template <std::size_t N>
+	GLM_FUNC_QUALIFIER __m128 approx_horner_sse2(__m128 x, float const (&Coefficients)[N])
+	{
+		__m128 Result = _mm_set1_ps(Coefficients[N - 1]);
+		for(std::size_t i = N - 1; i > 0; --i)
+			Result = sse_fma_ps(Result, x, _mm_set1_ps(Coefficients[i - 1]));
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER __m128 approx_select_sse2(__m128 Mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+	}
+
+	// 2^n * p for p in [sqrt(0.5), 2[ and n in [-126, 127]
+	GLM_FUNC_QUALIFIER __m128 approx_scale_sse2(__m128 p, __m128i n)
+	{
+		return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(p), _mm_slli_epi32(n, 23)));
+	}
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER __m128 approx_exp2_sse2(__m128 x)
+	{
+		__m128 const t = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-126.0f)), _mm_set1_ps(127.0f));
+		__m128i const n = _mm_cvtps_epi32(t);
+		__m128 const f = _mm_sub_ps(t, _mm_cvtepi32_ps(n));
+		__m128 const p = Tier == 0 ? approx_horner_sse2(f, ApproxExp2Tier0) : (Tier == 1 ? approx_horner_sse2(f, ApproxExp2Tier1) : approx_horner_sse2(f, ApproxExp2Tier2));
+		return approx_scale_sse2(p, n);
+	}
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER __m128 approx_exp_sse2(__m128 x)
+	{
+		__m128 const t = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-87.0f)), _mm_set1_ps(88.0f));
+		__m128i const n = _mm_cvtps_epi32(_mm_mul_ps(t, _mm_set1_ps(1.44269504f)));
+		__m128 const nf = _mm_cvtepi32_ps(n);
+		__m128 r = sse_fma_ps(nf, _mm_set1_ps(-ApproxLn2Hi), t);
+		r = sse_fma_ps(nf, _mm_set1_ps(-ApproxLn2Lo), r);
+		__m128 const p = Tier == 0 ? approx_horner_sse2(r, ApproxExpTier0) : (Tier == 1 ? approx_horner_sse2(r, ApproxExpTier1) : approx_horner_sse2(r, ApproxExpTier2));
+		return approx_scale_sse2(p, n);
+	}
+
+	template <int Tier, bool Natural>
+	GLM_FUNC_QUALIFIER __m128 approx_log_sse2(__m128 x)
+	{
+		__m128i const i = _mm_sub_epi32(_mm_castps_si128(x), _mm_set1_epi32(0x3f3504f3));
+		__m128 const e = _mm_cvtepi32_ps(_mm_srai_epi32(i, 23));
+		__m128i const m = _mm_add_epi32(_mm_and_si128(i, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f3504f3));
+		__m128 const f = _mm_sub_ps(_mm_castsi128_ps(m), _mm_set1_ps(1.0f));
+		__m128 const q = Natural ?
+			(Tier == 0 ? approx_horner_sse2(f, ApproxLogTier0) : (Tier == 1 ? approx_horner_sse2(f, ApproxLogTier1) : approx_horner_sse2(f, ApproxLogTier2))) :
+			(Tier == 0 ? approx_horner_sse2(f, ApproxLog2Tier0) : (Tier == 1 ? approx_horner_sse2(f, ApproxLog2Tier1) : approx_horner_sse2(f, ApproxLog2Tier2)));
+		return sse_fma_ps(f, q, Natural ? _mm_mul_ps(e, _mm_set1_ps(0.693147181f)) : e);
+	}
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER __m128 approx_pow_sse2(__m128 x, __m128 y)
+	{
+		return approx_exp2_sse2<Tier>(_mm_mul_ps(y, approx_log_sse2<Tier, false>(x)));
+	}
+
+	template <int Tier, bool Cosine>
+	GLM_FUNC_QUALIFIER __m128 approx_sincos_sse2(__m128 x)
+	{
+		__m128i k = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.636619772f)));
+		__m128 const kf = _mm_cvtepi32_ps(k);
+		__m128 r = sse_fma_ps(kf, _mm_set1_ps(-ApproxHalfPiHi), x);
+		r = sse_fma_ps(kf, _mm_set1_ps(-ApproxHalfPiMid), r);
+		r = sse_fma_ps(kf, _mm_set1_ps(-ApproxHalfPiLo), r);
+		__m128 const s = _mm_mul_ps(r, r);
+		if(Cosine)
+			k = _mm_add_epi32(k, _mm_set1_epi32(1));
+
+		__m128 const c = Tier == 0 ? approx_horner_sse2(s, ApproxCosTier0) : (Tier == 1 ? approx_horner_sse2(s, ApproxCosTier1) : approx_horner_sse2(s, ApproxCosTier2));
+		__m128 const q = Tier == 0 ? approx_horner_sse2(s, ApproxSinTier0) : (Tier == 1 ? approx_horner_sse2(s, ApproxSinTier1) : approx_horner_sse2(s, ApproxSinTier2));
+		__m128 const Odd = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(k, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		__m128 const Sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(k, _mm_set1_epi32(2)), 30));
+		return _mm_xor_ps(approx_select_sse2(Odd, c, _mm_mul_ps(r, q)), Sign);
+	}
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER __m128 approx_atan_sse2(__m128 x)
+	{
+		__m128 const SignMask = _mm_set1_ps(-0.0f);
+		__m128 const a = _mm_andnot_ps(SignMask, x);
+		__m128 const One = _mm_set1_ps(1.0f);
+		__m128 const Large = _mm_cmpgt_ps(a, _mm_set1_ps(2.41421356f));
+		__m128 const Medium = _mm_cmpgt_ps(a, _mm_set1_ps(0.414213562f));
+
+		__m128 const Num = approx_select_sse2(Large, _mm_set1_ps(-1.0f), approx_select_sse2(Medium, _mm_sub_ps(a, One), a));
+		__m128 const Den = approx_select_sse2(Large, a, approx_select_sse2(Medium, _mm_add_ps(a, One), One));
+		__m128 const Offset = approx_select_sse2(Large, _mm_set1_ps(1.57079633f), _mm_and_ps(Medium, _mm_set1_ps(0.785398163f)));
+		__m128 const z = _mm_div_ps(Num, Den);
+		__m128 const s = _mm_mul_ps(z, z);
+
+		__m128 const q = Tier == 0 ? approx_horner_sse2(s, ApproxAtanTier0) : (Tier == 1 ? approx_horner_sse2(s, ApproxAtanTier1) : approx_horner_sse2(s, ApproxAtanTier2));
+		return _mm_or_ps(sse_fma_ps(z, q, Offset), _mm_and_ps(x, SignMask));
+	}
+
+	template <int Tier>
+	GLM_FUNC_QUALIFIER __m128 approx_inversesqrt_sse2(__m128 x)
+	{
+		if(Tier == 0)
+			return _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32(0x5f37642f), _mm_srli_epi32(_mm_castps_si128(x), 1)));
+		if(Tier == 2)
+			return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(x));
+
+		// rsqrtps has a relative error up to 1.5 * 2^-12, one Newton-Raphson iteration
+		__m128 const y = _mm_rsqrt_ps(x);
+		__m128 const Square = _mm_mul_ps(_mm_mul_ps(x, y), y);
+		return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.0f), Square));
+	}
+
+	template <__m128 (*Kernel)(__m128), precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approx_vec4_sse2(tvec4<float, P> const & x)
+	{
+		tvec4<float, P> Result;
+		_mm_storeu_ps(&Result.x, Kernel(_mm_loadu_ps(&x.x)));
+		return Result;
+	}
+
+	template <__m128 (*Kernel)(__m128)>
+	GLM_FUNC_QUALIFIER void approx_batch_sse2(float const * x, float * Result, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			_mm_storeu_ps(Result + i, Kernel(_mm_loadu_ps(x + i)));
+		if(i == Count)
+			return;
+
+		// The last values are padded with ones, a valid argument of all the functions
+		float Tail[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+		for(std::size_t j = i; j < Count; ++j)
+			Tail[j - i] = x[j];
+		_mm_storeu_ps(Tail, Kernel(_mm_loadu_ps(Tail)));
+		for(std::size_t j = i; j < Count; ++j)
+			Result[j] = Tail[j - i];
+	}
+
+	template <__m128 (*Kernel)(__m128, __m128)>
+	GLM_FUNC_QUALIFIER void approx_batch2_sse2(float const * x, float const * y, float * Result, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			_mm_storeu_ps(Result + i, Kernel(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i)));
+		if(i == Count)
+			return;
+
+		float TailX[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+		float TailY[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+		for(std::size_t j = i; j < Count; ++j)
+		{
+			TailX[j - i] = x[j];
+			TailY[j - i] = y[j];
+		}
+		_mm_storeu_ps(TailX, Kernel(_mm_loadu_ps(TailX), _mm_loadu_ps(TailY)));
+		for(std::size_t j = i; j < Count; ++j)
+			Result[j] = TailX[j - i];
+	}
+
+	//////////////////////////////////////
+	// AVX2 + FMA kernels
+
+	template <std::size_t N>
+	GLM_TARGET_AVX2 inline __m256 approx_horner_avx2(__m256 x, float const (&Coefficients)[N])
+	{
+		__m256 Result = _mm256_set1_ps(Coefficients[N - 1]);
+		for(std::size_t i = N - 1; i > 0; --i)
+			Result = _mm256_fmadd_ps(Result, x, _mm256_set1_ps(Coefficients[i - 1]));
+		return Result;
+	}
+
+	GLM_TARGET_AVX2 inline __m256 approx_scale_avx2(__m256 p, __m256i n)
+	{
+		return _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(p), _mm256_slli_epi32(n, 23)));
+	}
+
+	template <int Tier>
+	GLM_TARGET_AVX2 inline __m256 approx_exp2_avx2(__m256 x)
+	{
+		__m256 const t = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-126.0f)), _mm256_set1_ps(127.0f));
+		__m256i const n = _mm256_cvtps_epi32(t);
+		__m256 const f = _mm256_sub_ps(t, _mm256_cvtepi32_ps(n));
+		__m256 const p = Tier == 0 ? approx_horner_avx2(f, ApproxExp2Tier0) : (Tier == 1 ? approx_horner_avx2(f, ApproxExp2Tier1) : approx_horner_avx2(f, ApproxExp2Tier2));
+		return approx_scale_avx2(p, n);
+	}
+
+	template <int Tier>
+	GLM_TARGET_AVX2 inline __m256 approx_exp_avx2(__m256 x)
+	{
+		__m256 const t = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-87.0f)), _mm256_set1_ps(88.0f));
+		__m256i const n = _mm256_cvtps_epi32(_mm256_mul_ps(t, _mm256_set1_ps(1.44269504f)));
+		__m256 const nf = _mm256_cvtepi32_ps(n);
+		__m256 r = _mm256_fmadd_ps(nf, _mm256_set1_ps(-ApproxLn2Hi), t);
+		r = _mm256_fmadd_ps(nf, _mm256_set1_ps(-ApproxLn2Lo), r);
+		__m256 const p = Tier == 0 ? approx_horner_avx2(r, ApproxExpTier0) : (Tier == 1 ? approx_horner_avx2(r, ApproxExpTier1) : approx_horner_avx2(r, ApproxExpTier2));
+		return approx_scale_avx2(p, n);
+	}
+
+	template <int Tier, bool Natural>
+	GLM_TARGET_AVX2 inline __m256 approx_log_avx2(__m256 x)
+	{
+		__m256i const i = _mm256_sub_epi32(_mm256_castps_si256(x), _mm256_set1_epi32(0x3f3504f3));
+		__m256 const e = _mm256_cvtepi32_ps(_mm256_srai_epi32(i, 23));
+		__m256i const m = _mm256_add_epi32(_mm256_and_si256(i, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f3504f3));
+		__m256 const f = _mm256_sub_ps(_mm256_castsi256_ps(m), _mm256_set1_ps(1.0f));
+		__m256 const q = Natural ?
+			(Tier == 0 ? approx_horner_avx2(f, ApproxLogTier0) : (Tier == 1 ? approx_horner_avx2(f, ApproxLogTier1) : approx_horner_avx2(f, ApproxLogTier2))) :
+			(Tier == 0 ? approx_horner_avx2(f, ApproxLog2Tier0) : (Tier == 1 ? approx_horner_avx2(f, ApproxLog2Tier1) : approx_horner_avx2(f, ApproxLog2Tier2)));
+		return _mm256_fmadd_ps(f, q, Natural ? _mm256_mul_ps(e, _mm256_set1_ps(0.693147181f)) : e);
+	}
+
+	template <int Tier>
+	GLM_TARGET_AVX2 inline __m256 approx_pow_avx2(__m256 x, __m256 y)
+	{
+		return approx_exp2_avx2<Tier>(_mm256_mul_ps(y, approx_log_avx2<Tier, false>(x)));
+	}
+
+	template <int Tier, bool Cosine>
+	GLM_TARGET_AVX2 inline __m256 approx_sincos_avx2(__m256 x)
+	{
+		__m256i k = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(0.636619772f)));
+		__m256 const kf = _mm256_cvtepi32_ps(k);
+		__m256 r = _mm256_fmadd_ps(kf, _mm256_set1_ps(-ApproxHalfPiHi), x);
+		r = _mm256_fmadd_ps(kf, _mm256_set1_ps(-ApproxHalfPiMid), r);
+		r = _mm256_fmadd_ps(kf, _mm256_set1_ps(-ApproxHalfPiLo), r);
+		__m256 const s = _mm256_mul_ps(r, r);
+		if(Cosine)
+			k = _mm256_add_epi32(k, _mm256_set1_epi32(1));
+
+		__m256 const c = Tier == 0 ? approx_horner_avx2(s, ApproxCosTier0) : (Tier == 1 ? approx_horner_avx2(s, ApproxCosTier1) : approx_horner_avx2(s, ApproxCosTier2));
+		__m256 const q = Tier == 0 ? approx_horner_avx2(s, ApproxSinTier0) : (Tier == 1 ? approx_horner_avx2(s, ApproxSinTier1) : approx_horner_avx2(s, ApproxSinTier2));
+		__m256 const Odd = _mm256_castsi256_ps(_mm256_slli_epi32(k, 31));
+		__m256 const Sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(k, _mm256_set1_epi32(2)), 30));
+		return _mm256_xor_ps(_mm256_blendv_ps(_mm256_mul_ps(r, q), c, Odd), Sign);
+	}
+
+	template <int Tier>
+	GLM_TARGET_AVX2 inline __m256 approx_atan_avx2(__m256 x)
+	{
+		__m256 const SignMask = _mm256_set1_ps(-0.0f);
+		__m256 const a = _mm256_andnot_ps(SignMask, x);
+		__m256 const One = _mm256_set1_ps(1.0f);
+		__m256 const Large = _mm256_cmp_ps(a, _mm256_set1_ps(2.41421356f), _CMP_GT_OQ);
+		__m256 const Medium = _mm256_cmp_ps(a, _mm256_set1_ps(0.414213562f), _CMP_GT_OQ);
+
+		__m256 const Num = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_sub_ps(a, One), Medium), _mm256_set1_ps(-1.0f), Large);
+		__m256 const Den = _mm256_blendv_ps(_mm256_blendv_ps(One, _mm256_add_ps(a, One), Medium), a, Large);
+		__m256 const Offset = _mm256_blendv_ps(_mm256_and_ps(Medium, _mm256_set1_ps(0.785398163f)), _mm256_set1_ps(1.57079633f), Large);
+		__m256 const z = _mm256_div_ps(Num, Den);
+		__m256 const s = _mm256_mul_ps(z, z);
+
+		__m256 const q = Tier == 0 ? approx_horner_avx2(s, ApproxAtanTier0) : (Tier == 1 ? approx_horner_avx2(s, ApproxAtanTier1) : approx_horner_avx2(s, ApproxAtanTier2));
+		return _mm256_or_ps(_mm256_fmadd_ps(z, q, Offset), _mm256_and_ps(x, SignMask));
+	}
+
+	template <int Tier>
+	GLM_TARGET_AVX2 inline __m256 approx_inversesqrt_avx2(__m256 x)
+	{
+		if(Tier == 0)
+			return _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32(0x5f37642f), _mm256_srli_epi32(_mm256_castps_si256(x), 1)));
+		if(Tier == 2)
+			return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(x));
+
+		__m256 const y = _mm256_rsqrt_ps(x);
+		__m256 const Square = _mm256_mul_ps(_mm256_mul_ps(x, y), y);
+		return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), y), _mm256_sub_ps(_mm256_set1_ps(3.0f), Square));
+	}
+
+	template <__m256 (*Kernel)(__m256), __m128 (*KernelSSE2)(__m128)>
+	GLM_TARGET_AVX2 inline void approx_batch_avx2(float const * x, float * Result, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+			_mm256_storeu_ps(Result + i, Kernel(_mm256_loadu_ps(x + i)));
+		approx_batch_sse2<KernelSSE2>(x + i, Result + i, Count - i);
+	}
+
+	template <__m256 (*Kernel)(__m256, __m256), __m128 (*KernelSSE2)(__m128, __m128)>
+	GLM_TARGET_AVX2 inline void approx_batch2_avx2(float const * x, float const * y, float * Result, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+			_mm256_storeu_ps(Result + i, Kernel(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+		approx_batch2_sse2<KernelSSE2>(x + i, y + i, Result + i, Count - i);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Tier>
+	struct approx_kernels
+	{
+		static approx_func const Exp2[SIMD_LEVEL_COUNT];
+		static approx_func const Exp[SIMD_LEVEL_COUNT];
+		static approx_func const Log2[SIMD_LEVEL_COUNT];
+		static approx_func const Log[SIMD_LEVEL_COUNT];
+		static approx2_func const Pow[SIMD_LEVEL_COUNT];
+		static approx_func const Sin[SIMD_LEVEL_COUNT];
+		static approx_func const Cos[SIMD_LEVEL_COUNT];
+		static approx_func const Atan[SIMD_LEVEL_COUNT];
+		static approx_func const InverseSqrt[SIMD_LEVEL_COUNT];
+	};
+
+#	if GLM_DISPATCH_X86
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Exp2[SIMD_LEVEL_COUNT] = {
+		approx_batch_pure<approx_exp2<Tier> >,
+		approx_batch_sse2<approx_exp2_sse2<Tier> >,
+		0,
+		0,
+		approx_batch_avx2<approx_exp2_avx2<Tier>, approx_exp2_sse2<Tier> >};
+
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Exp[SIMD_LEVEL_COUNT] = {
+		approx_batch_pure<approx_exp<Tier> >,
+		approx_batch_sse2<approx_exp_sse2<Tier> >,
+		0,
+		0,
+		approx_batch_avx2<approx_exp_avx2<Tier>, approx_exp_sse2<Tier> >};
+
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Log2[SIMD_LEVEL_COUNT] = {
+		approx_batch_pure<approx_log<Tier, false> >,
+		approx_batch_sse2<approx_log_sse2<Tier, false> >,
+		0,
+		0,
+		approx_batch_avx2<approx_log_avx2<Tier, false>, approx_log_sse2<Tier, false> >};
+
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Log[SIMD_LEVEL_COUNT] = {
+		approx_batch_pure<approx_log<Tier, true> >,
+		approx_batch_sse2<approx_log_sse2<Tier, true> >,
+		0,
+		0,
+		approx_batch_avx2<approx_log_avx2<Tier, true>, approx_log_sse2<Tier, true> >};
+
+	template <int Tier>
+	approx2_func const approx_kernels<Tier>::Pow[SIMD_LEVEL_COUNT] = {
+		approx_batch2_pure<approx_pow<Tier> >,
+		approx_batch2_sse2<approx_pow_sse2<Tier> >,
+		0,
+		0,
+		approx_batch2_avx2<approx_pow_avx2<Tier>, approx_pow_sse2<Tier> >};
+
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Sin[SIMD_LEVEL_COUNT] = {
+		approx_batch_pure<approx_sincos<Tier, false> >,
+		approx_batch_sse2<approx_sincos_sse2<Tier, false> >,
+		0,
+		0,
+		approx_batch_avx2<approx_sincos_avx2<Tier, false>, approx_sincos_sse2<Tier, false> >};
+
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Cos[SIMD_LEVEL_COUNT] = {
+		approx_batch_pure<approx_sincos<Tier, true> >,
+		approx_batch_sse2<approx_sincos_sse2<Tier, true> >,
+		0,
+		0,
+		approx_batch_avx2<approx_sincos_avx2<Tier, true>, approx_sincos_sse2<Tier, true> >};
+
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Atan[SIMD_LEVEL_COUNT] = {
+		approx_batch_pure<approx_atan<Tier> >,
+		approx_batch_sse2<approx_atan_sse2<Tier> >,
+		0,
+		0,
+		approx_batch_avx2<approx_atan_avx2<Tier>, approx_atan_sse2<Tier> >};
+
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::InverseSqrt[SIMD_LEVEL_COUNT] = {
+		approx_batch_pure<approx_inversesqrt<Tier> >,
+		approx_batch_sse2<approx_inversesqrt_sse2<Tier> >,
+		0,
+		0,
+		approx_batch_avx2<approx_inversesqrt_avx2<Tier>, approx_inversesqrt_sse2<Tier> >};
+#	else
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Exp2[SIMD_LEVEL_COUNT] = {approx_batch_pure<approx_exp2<Tier> >, 0, 0, 0, 0};
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Exp[SIMD_LEVEL_COUNT] = {approx_batch_pure<approx_exp<Tier> >, 0, 0, 0, 0};
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Log2[SIMD_LEVEL_COUNT] = {approx_batch_pure<approx_log<Tier, false> >, 0, 0, 0, 0};
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Log[SIMD_LEVEL_COUNT] = {approx_batch_pure<approx_log<Tier, true> >, 0, 0, 0, 0};
+	template <int Tier>
+	approx2_func const approx_kernels<Tier>::Pow[SIMD_LEVEL_COUNT] = {approx_batch2_pure<approx_pow<Tier> >, 0, 0, 0, 0};
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Sin[SIMD_LEVEL_COUNT] = {approx_batch_pure<approx_sincos<Tier, false> >, 0, 0, 0, 0};
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Cos[SIMD_LEVEL_COUNT] = {approx_batch_pure<approx_sincos<Tier, true> >, 0, 0, 0, 0};
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::Atan[SIMD_LEVEL_COUNT] = {approx_batch_pure<approx_atan<Tier> >, 0, 0, 0, 0};
+	template <int Tier>
+	approx_func const approx_kernels<Tier>::InverseSqrt[SIMD_LEVEL_COUNT] = {approx_batch_pure<approx_inversesqrt<Tier> >, 0, 0, 0, 0};
+#	endif//GLM_DISPATCH_X86
+}//namespace detail
+
+	// approxExp2
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxExp2(float x)
+	{
+		return detail::approx_exp2<detail::approx_tier<Bits>::value>(x);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxExp2(vecType<float, P> const & x)
+	{
+		return detail::functor1<float, float, P, vecType>::call(approxExp2<Bits>, x);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxExp2(tvec4<float, P> const & x)
+	{
+		return detail::approx_vec4_sse2<detail::approx_exp2_sse2<detail::approx_tier<Bits>::value> >(x);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxExp2Batch(float const * x, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::Exp2)(x, Result, Count);
+	}
+
+	// approxExp
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxExp(float x)
+	{
+		return detail::approx_exp<detail::approx_tier<Bits>::value>(x);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxExp(vecType<float, P> const & x)
+	{
+		return detail::functor1<float, float, P, vecType>::call(approxExp<Bits>, x);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxExp(tvec4<float, P> const & x)
+	{
+		return detail::approx_vec4_sse2<detail::approx_exp_sse2<detail::approx_tier<Bits>::value> >(x);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxExpBatch(float const * x, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::Exp)(x, Result, Count);
+	}
+
+	// approxLog2
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxLog2(float x)
+	{
+		return detail::approx_log<detail::approx_tier<Bits>::value, false>(x);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxLog2(vecType<float, P> const & x)
+	{
+		return detail::functor1<float, float, P, vecType>::call(approxLog2<Bits>, x);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxLog2(tvec4<float, P> const & x)
+	{
+		return detail::approx_vec4_sse2<detail::approx_log_sse2<detail::approx_tier<Bits>::value, false> >(x);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxLog2Batch(float const * x, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::Log2)(x, Result, Count);
+	}
+
+	// approxLog
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxLog(float x)
+	{
+		return detail::approx_log<detail::approx_tier<Bits>::value, true>(x);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxLog(vecType<float, P> const & x)
+	{
+		return detail::functor1<float, float, P, vecType>::call(approxLog<Bits>, x);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxLog(tvec4<float, P> const & x)
+	{
+		return detail::approx_vec4_sse2<detail::approx_log_sse2<detail::approx_tier<Bits>::value, true> >(x);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxLogBatch(float const * x, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::Log)(x, Result, Count);
+	}
+
+	// approxPow
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxPow(float x, float y)
+	{
+		return detail::approx_pow<detail::approx_tier<Bits>::value>(x, y);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxPow(vecType<float, P> const & x, vecType<float, P> const & y)
+	{
+		return detail::functor2<float, P, vecType>::call(approxPow<Bits>, x, y);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxPow(tvec4<float, P> const & x, tvec4<float, P> const & y)
+	{
+		tvec4<float, P> Result;
+		_mm_storeu_ps(&Result.x, detail::approx_pow_sse2<detail::approx_tier<Bits>::value>(_mm_loadu_ps(&x.x), _mm_loadu_ps(&y.x)));
+		return Result;
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxPowBatch(float const * x, float const * y, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::Pow)(x, y, Result, Count);
+	}
+
+	// approxSin
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxSin(float x)
+	{
+		return detail::approx_sincos<detail::approx_tier<Bits>::value, false>(x);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxSin(vecType<float, P> const & x)
+	{
+		return detail::functor1<float, float, P, vecType>::call(approxSin<Bits>, x);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxSin(tvec4<float, P> const & x)
+	{
+		return detail::approx_vec4_sse2<detail::approx_sincos_sse2<detail::approx_tier<Bits>::value, false> >(x);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxSinBatch(float const * x, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::Sin)(x, Result, Count);
+	}
+
+	// approxCos
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxCos(float x)
+	{
+		return detail::approx_sincos<detail::approx_tier<Bits>::value, true>(x);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxCos(vecType<float, P> const & x)
+	{
+		return detail::functor1<float, float, P, vecType>::call(approxCos<Bits>, x);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxCos(tvec4<float, P> const & x)
+	{
+		return detail::approx_vec4_sse2<detail::approx_sincos_sse2<detail::approx_tier<Bits>::value, true> >(x);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxCosBatch(float const * x, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::Cos)(x, Result, Count);
+	}
+
+	// approxAtan
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxAtan(float x)
+	{
+		return detail::approx_atan<detail::approx_tier<Bits>::value>(x);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxAtan(vecType<float, P> const & x)
+	{
+		return detail::functor1<float, float, P, vecType>::call(approxAtan<Bits>, x);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxAtan(tvec4<float, P> const & x)
+	{
+		return detail::approx_vec4_sse2<detail::approx_atan_sse2<detail::approx_tier<Bits>::value> >(x);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxAtanBatch(float const * x, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::Atan)(x, Result, Count);
+	}
+
+	// approxInverseSqrt
+	template <int Bits>
+	GLM_FUNC_QUALIFIER float approxInverseSqrt(float x)
+	{
+		return detail::approx_inversesqrt<detail::approx_tier<Bits>::value>(x);
+	}
+
+	template <int Bits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<float, P> approxInverseSqrt(vecType<float, P> const & x)
+	{
+		return detail::functor1<float, float, P, vecType>::call(approxInverseSqrt<Bits>, x);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <int Bits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> approxInverseSqrt(tvec4<float, P> const & x)
+	{
+		return detail::approx_vec4_sse2<detail::approx_inversesqrt_sse2<detail::approx_tier<Bits>::value> >(x);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void approxInverseSqrtBatch(float const * x, float * Result, std::size_t Count)
+	{
+		detail::simd_select(detail::approx_kernels<detail::approx_tier<Bits>::value>::InverseSqrt)(x, Result, Count);
+	}
+}//namespace glm
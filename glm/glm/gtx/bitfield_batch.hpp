@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_bitfield_batch
+/// @file glm/gtx/bitfield_batch.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_bitfield (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_bitfield_batch GLM_GTX_bitfield_batch
+/// @ingroup gtx
+///
+/// @brief Interleaving of arrays of coordinates into Morton codes, sorting of the codes and
+/// bit counts, scans and reversals of arrays of integers.
+///
+/// The results are the ones of bitfieldInterleave and bitfieldDeinterleave of GLM_GTC_bitfield,
+/// whichever kernel is selected at runtime by GLM_GTX_simd_dispatch: SSE2 or AVX2 shift and mask
+/// cascades on 64-bit lanes, or the pdep and pext instructions of the CPUs supporting BMI2.
+/// Likewise the results of the batch bit operations are the ones of bitCount, findLSB, findMSB
+/// and bitfieldReverse, computed with pshufb nibble tables with SSE4.1 and AVX2.
+///
+/// <glm/gtx/bitfield_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/bitfield.hpp"
+#include "../gtc/type_precision.hpp"
+#include "simd_dispatch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_bitfield_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bitfield_batch
+	/// @{
+
+	/// Dst[i] = bitfieldInterleave(Src[i].x, Src[i].y, Src[i].z) for Count coordinates.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void bitfieldInterleaveBatch(u16vec3 const * Src, uint64 * Dst, std::size_t Count);
+
+	/// Dst[i] = bitfieldInterleave(Src[i].x, Src[i].y) for Count coordinates.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void bitfieldInterleaveBatch(u32vec2 const * Src, uint64 * Dst, std::size_t Count);
+
+	/// bitfieldDeinterleave(Src[i], Dst[i].x, Dst[i].y, Dst[i].z) for Count codes.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void bitfieldDeinterleaveBatch(uint64 const * Src, u16vec3 * Dst, std::size_t Count);
+
+	/// bitfieldDeinterleave(Src[i], Dst[i].x, Dst[i].y) for Count codes.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void bitfieldDeinterleaveBatch(uint64 const * Src, u32vec2 * Dst, std::size_t Count);
+
+	/// Dst[i] = bitCount(Src[i]) for Count values.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void bitCountBatch(uint32 const * Src, int * Dst, std::size_t Count);
+
+	/// Dst[i] = findLSB(Src[i]) for Count values.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void findLSBBatch(uint32 const * Src, int * Dst, std::size_t Count);
+
+	/// Dst[i] = findMSB(Src[i]) for Count values.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void findMSBBatch(uint32 const * Src, int * Dst, std::size_t Count);
+
+	/// Dst[i] = bitfieldReverse(Src[i]) for Count values.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void bitfieldReverseBatch(uint32 const * Src, uint32 * Dst, std::size_t Count);
+
+	/// Sorts Count interleaved codes in increasing order, which is the Morton order of the coordinates.
+	/// Indices[i] is moved with Keys[i], initialized with 0 to Count - 1 it gives the permutation
+	/// to apply to the data the keys were computed from. Indices may be null.
+	/// The sort is a stable radix sort on bytes, the bytes shared by all the keys are skipped.
+	/// @see gtx_bitfield_batch
+	GLM_FUNC_DECL void sortInterleaved(uint64 * Keys, uint32 * Indices, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "bitfield_batch.inl"
@@ -0,0 +1,625 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_bitfield_batch
+/// @file glm/gtx/bitfield_batch.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER void interleave3_pure(u16vec3 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = glm::bitfieldInterleave(Src[i].x, Src[i].y, Src[i].z);
+	}
+
+	GLM_FUNC_QUALIFIER void interleave2_pure(u32vec2 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = glm::bitfieldInterleave(Src[i].x, Src[i].y);
+	}
+
+	GLM_FUNC_QUALIFIER void deinterleave3_pure(uint64 const * Src, u16vec3 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			glm::bitfieldDeinterleave(Src[i], Dst[i].x, Dst[i].y, Dst[i].z);
+	}
+
+	GLM_FUNC_QUALIFIER void deinterleave2_pure(uint64 const * Src, u32vec2 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			glm::bitfieldDeinterleave(Src[i], Dst[i].x, Dst[i].y);
+	}
+
+#	if GLM_DISPATCH_X86
+	//////////////////////////////////////
+	// SSE2 kernels, the cascades of bitfieldInterleave and bitfieldCompact on two 64-bit lanes
+
+	GLM_FUNC_QUALIFIER __m128i bitfield_spread2_sse2(__m128i v)
+	{
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v, 16), v), _mm_set1_epi64x(0x0000FFFF0000FFFFll));
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v,  8), v), _mm_set1_epi64x(0x00FF00FF00FF00FFll));
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v,  4), v), _mm_set1_epi64x(0x0F0F0F0F0F0F0F0Fll));
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v,  2), v), _mm_set1_epi64x(0x3333333333333333ll));
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v,  1), v), _mm_set1_epi64x(0x5555555555555555ll));
+		return v;
+	}
+
+	GLM_FUNC_QUALIFIER __m128i bitfield_spread3_sse2(__m128i v)
+	{
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v, 32), v), _mm_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull)));
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v, 16), v), _mm_set1_epi64x(0x00FF0000FF0000FFll));
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v,  8), v), _mm_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full)));
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v,  4), v), _mm_set1_epi64x(0x30C30C30C30C30C3ll));
+		v = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(v,  2), v), _mm_set1_epi64x(static_cast<long long>(0x9249249249249249ull)));
+		return v;
+	}
+
+	GLM_FUNC_QUALIFIER __m128i bitfield_compact2_sse2(__m128i v)
+	{
+		v = _mm_and_si128(v, _mm_set1_epi64x(0x5555555555555555ll));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v,  1), v), _mm_set1_epi64x(0x3333333333333333ll));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v,  2), v), _mm_set1_epi64x(0x0F0F0F0F0F0F0F0Fll));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v,  4), v), _mm_set1_epi64x(0x00FF00FF00FF00FFll));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v,  8), v), _mm_set1_epi64x(0x0000FFFF0000FFFFll));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v, 16), v), _mm_set1_epi64x(0x00000000FFFFFFFFll));
+		return v;
+	}
+
+	GLM_FUNC_QUALIFIER __m128i bitfield_compact3_sse2(__m128i v)
+	{
+		v = _mm_and_si128(v, _mm_set1_epi64x(static_cast<long long>(0x9249249249249249ull)));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v,  2), v), _mm_set1_epi64x(0x30C30C30C30C30C3ll));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v,  4), v), _mm_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full)));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v,  8), v), _mm_set1_epi64x(0x00FF0000FF0000FFll));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v, 16), v), _mm_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull)));
+		v = _mm_and_si128(_mm_or_si128(_mm_srli_epi64(v, 32), v), _mm_set1_epi64x(0x00000000003FFFFFll));
+		return v;
+	}
+
+	GLM_FUNC_QUALIFIER void interleave3_sse2(u16vec3 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Packets; i += 2)
+		{
+			__m128i const x = bitfield_spread3_sse2(_mm_set_epi64x(Src[i + 1].x, Src[i].x));
+			__m128i const y = bitfield_spread3_sse2(_mm_set_epi64x(Src[i + 1].y, Src[i].y));
+			__m128i const z = bitfield_spread3_sse2(_mm_set_epi64x(Src[i + 1].z, Src[i].z));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_or_si128(x, _mm_or_si128(_mm_slli_epi64(y, 1), _mm_slli_epi64(z, 2))));
+		}
+		interleave3_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void interleave2_sse2(u32vec2 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Packets; i += 2)
+		{
+			__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			__m128i const x = bitfield_spread2_sse2(_mm_and_si128(v, _mm_set1_epi64x(0x00000000FFFFFFFFll)));
+			__m128i const y = bitfield_spread2_sse2(_mm_srli_epi64(v, 32));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_or_si128(x, _mm_slli_epi64(y, 1)));
+		}
+		interleave2_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void deinterleave3_sse2(uint64 const * Src, u16vec3 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Packets; i += 2)
+		{
+			__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+
+			// The 16-bit components of each lane are gathered in its low 64 bits, then stored
+			__m128i const xy = _mm_or_si128(bitfield_compact3_sse2(v), _mm_slli_epi64(bitfield_compact3_sse2(_mm_srli_epi64(v, 1)), 16));
+			__m128i const xyz = _mm_or_si128(xy, _mm_slli_epi64(bitfield_compact3_sse2(_mm_srli_epi64(v, 2)), 32));
+
+			uint64 Lanes[2];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Lanes), xyz);
+			for(std::size_t j = 0; j < 2; ++j)
+				Dst[i + j] = u16vec3(static_cast<uint16>(Lanes[j]), static_cast<uint16>(Lanes[j] >> 16), static_cast<uint16>(Lanes[j] >> 32));
+		}
+		deinterleave3_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void deinterleave2_sse2(uint64 const * Src, u32vec2 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Packets; i += 2)
+		{
+			__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			__m128i const x = bitfield_compact2_sse2(v);
+			__m128i const y = bitfield_compact2_sse2(_mm_srli_epi64(v, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_or_si128(x, _mm_slli_epi64(y, 32)));
+		}
+		deinterleave2_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	//////////////////////////////////////
+	// AVX2 kernels, the same cascades on four 64-bit lanes
+
+	GLM_TARGET_AVX2 inline __m256i bitfield_spread2_avx2(__m256i v)
+	{
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v, 16), v), _mm256_set1_epi64x(0x0000FFFF0000FFFFll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v,  8), v), _mm256_set1_epi64x(0x00FF00FF00FF00FFll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v,  4), v), _mm256_set1_epi64x(0x0F0F0F0F0F0F0F0Fll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v,  2), v), _mm256_set1_epi64x(0x3333333333333333ll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v,  1), v), _mm256_set1_epi64x(0x5555555555555555ll));
+		return v;
+	}
+
+	GLM_TARGET_AVX2 inline __m256i bitfield_spread3_avx2(__m256i v)
+	{
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v, 32), v), _mm256_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull)));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v, 16), v), _mm256_set1_epi64x(0x00FF0000FF0000FFll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v,  8), v), _mm256_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full)));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v,  4), v), _mm256_set1_epi64x(0x30C30C30C30C30C3ll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(v,  2), v), _mm256_set1_epi64x(static_cast<long long>(0x9249249249249249ull)));
+		return v;
+	}
+
+	GLM_TARGET_AVX2 inline __m256i bitfield_compact2_avx2(__m256i v)
+	{
+		v = _mm256_and_si256(v, _mm256_set1_epi64x(0x5555555555555555ll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v,  1), v), _mm256_set1_epi64x(0x3333333333333333ll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v,  2), v), _mm256_set1_epi64x(0x0F0F0F0F0F0F0F0Fll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v,  4), v), _mm256_set1_epi64x(0x00FF00FF00FF00FFll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v,  8), v), _mm256_set1_epi64x(0x0000FFFF0000FFFFll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v, 16), v), _mm256_set1_epi64x(0x00000000FFFFFFFFll));
+		return v;
+	}
+
+	GLM_TARGET_AVX2 inline __m256i bitfield_compact3_avx2(__m256i v)
+	{
+		v = _mm256_and_si256(v, _mm256_set1_epi64x(static_cast<long long>(0x9249249249249249ull)));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v,  2), v), _mm256_set1_epi64x(0x30C30C30C30C30C3ll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v,  4), v), _mm256_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full)));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v,  8), v), _mm256_set1_epi64x(0x00FF0000FF0000FFll));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v, 16), v), _mm256_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull)));
+		v = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(v, 32), v), _mm256_set1_epi64x(0x00000000003FFFFFll));
+		return v;
+	}
+
+	GLM_TARGET_AVX2 inline void interleave3_avx2(u16vec3 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256i const x = bitfield_spread3_avx2(_mm256_set_epi64x(Src[i + 3].x, Src[i + 2].x, Src[i + 1].x, Src[i].x));
+			__m256i const y = bitfield_spread3_avx2(_mm256_set_epi64x(Src[i + 3].y, Src[i + 2].y, Src[i + 1].y, Src[i].y));
+			__m256i const z = bitfield_spread3_avx2(_mm256_set_epi64x(Src[i + 3].z, Src[i + 2].z, Src[i + 1].z, Src[i].z));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + i), _mm256_or_si256(x, _mm256_or_si256(_mm256_slli_epi64(y, 1), _mm256_slli_epi64(z, 2))));
+		}
+		interleave3_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX2 inline void interleave2_avx2(u32vec2 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + i));
+			__m256i const x = bitfield_spread2_avx2(_mm256_and_si256(v, _mm256_set1_epi64x(0x00000000FFFFFFFFll)));
+			__m256i const y = bitfield_spread2_avx2(_mm256_srli_epi64(v, 32));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + i), _mm256_or_si256(x, _mm256_slli_epi64(y, 1)));
+		}
+		interleave2_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX2 inline void deinterleave3_avx2(uint64 const * Src, u16vec3 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + i));
+			__m256i const xy = _mm256_or_si256(bitfield_compact3_avx2(v), _mm256_slli_epi64(bitfield_compact3_avx2(_mm256_srli_epi64(v, 1)), 16));
+			__m256i const xyz = _mm256_or_si256(xy, _mm256_slli_epi64(bitfield_compact3_avx2(_mm256_srli_epi64(v, 2)), 32));
+
+			uint64 Lanes[4];
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Lanes), xyz);
+			for(std::size_t j = 0; j < 4; ++j)
+				Dst[i + j] = u16vec3(static_cast<uint16>(Lanes[j]), static_cast<uint16>(Lanes[j] >> 16), static_cast<uint16>(Lanes[j] >> 32));
+		}
+		deinterleave3_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX2 inline void deinterleave2_avx2(uint64 const * Src, u32vec2 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + i));
+			__m256i const x = bitfield_compact2_avx2(v);
+			__m256i const y = bitfield_compact2_avx2(_mm256_srli_epi64(v, 1));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + i), _mm256_or_si256(x, _mm256_slli_epi64(y, 32)));
+		}
+		deinterleave2_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+#	if GLM_MODEL == GLM_MODEL_64
+	//////////////////////////////////////
+	// BMI2 kernels, a pdep or pext per component
+
+	GLM_TARGET_BMI2 inline void interleave3_bmi2(u16vec3 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = _pdep_u64(Src[i].x, 0x9249249249249249ull) | _pdep_u64(Src[i].y, 0x2492492492492492ull) | _pdep_u64(Src[i].z, 0x4924924924924924ull);
+	}
+
+	GLM_TARGET_BMI2 inline void interleave2_bmi2(u32vec2 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = _pdep_u64(Src[i].x, 0x5555555555555555ull) | _pdep_u64(Src[i].y, 0xAAAAAAAAAAAAAAAAull);
+	}
+
+	GLM_TARGET_BMI2 inline void deinterleave3_bmi2(uint64 const * Src, u16vec3 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = u16vec3(
+				static_cast<uint16>(_pext_u64(Src[i], 0x9249249249249249ull)),
+				static_cast<uint16>(_pext_u64(Src[i], 0x2492492492492492ull)),
+				static_cast<uint16>(_pext_u64(Src[i], 0x4924924924924924ull)));
+	}
+
+	GLM_TARGET_BMI2 inline void deinterleave2_bmi2(uint64 const * Src, u32vec2 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = u32vec2(
+				static_cast<uint32>(_pext_u64(Src[i], 0x5555555555555555ull)),
+				static_cast<uint32>(_pext_u64(Src[i], 0xAAAAAAAAAAAAAAAAull)));
+	}
+#	endif//GLM_MODEL == GLM_MODEL_64
+#	endif//GLM_DISPATCH_X86
+
+	typedef void (*interleave3_func)(u16vec3 const *, uint64 *, std::size_t);
+	typedef void (*interleave2_func)(u32vec2 const *, uint64 *, std::size_t);
+	typedef void (*deinterleave3_func)(uint64 const *, u16vec3 *, std::size_t);
+	typedef void (*deinterleave2_func)(uint64 const *, u32vec2 *, std::size_t);
+
+	// The processors supporting AVX2 support BMI2 in practice, the pdep and pext kernels then replace the AVX2 ones
+	GLM_FUNC_QUALIFIER interleave3_func interleave3_select()
+	{
+#		if GLM_DISPATCH_X86 && (GLM_MODEL == GLM_MODEL_64)
+			static interleave3_func const Table[SIMD_LEVEL_COUNT] = {interleave3_pure, interleave3_sse2, 0, 0, simdFeatures().BMI2 ? interleave3_bmi2 : interleave3_avx2};
+#		elif GLM_DISPATCH_X86
+			static interleave3_func const Table[SIMD_LEVEL_COUNT] = {interleave3_pure, interleave3_sse2, 0, 0, interleave3_avx2};
+#		else
+			static interleave3_func const Table[SIMD_LEVEL_COUNT] = {interleave3_pure, 0, 0, 0, 0};
+#		endif
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER interleave2_func interleave2_select()
+	{
+#		if GLM_DISPATCH_X86 && (GLM_MODEL == GLM_MODEL_64)
+			static interleave2_func const Table[SIMD_LEVEL_COUNT] = {interleave2_pure, interleave2_sse2, 0, 0, simdFeatures().BMI2 ? interleave2_bmi2 : interleave2_avx2};
+#		elif GLM_DISPATCH_X86
+			static interleave2_func const Table[SIMD_LEVEL_COUNT] = {interleave2_pure, interleave2_sse2, 0, 0, interleave2_avx2};
+#		else
+			static interleave2_func const Table[SIMD_LEVEL_COUNT] = {interleave2_pure, 0, 0, 0, 0};
+#		endif
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER deinterleave3_func deinterleave3_select()
+	{
+#		if GLM_DISPATCH_X86 && (GLM_MODEL == GLM_MODEL_64)
+			static deinterleave3_func const Table[SIMD_LEVEL_COUNT] = {deinterleave3_pure, deinterleave3_sse2, 0, 0, simdFeatures().BMI2 ? deinterleave3_bmi2 : deinterleave3_avx2};
+#		elif GLM_DISPATCH_X86
+			static deinterleave3_func const Table[SIMD_LEVEL_COUNT] = {deinterleave3_pure, deinterleave3_sse2, 0, 0, deinterleave3_avx2};
+#		else
+			static deinterleave3_func const Table[SIMD_LEVEL_COUNT] = {deinterleave3_pure, 0, 0, 0, 0};
+#		endif
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER deinterleave2_func deinterleave2_select()
+	{
+#		if GLM_DISPATCH_X86 && (GLM_MODEL == GLM_MODEL_64)
+			static deinterleave2_func const Table[SIMD_LEVEL_COUNT] = {deinterleave2_pure, deinterleave2_sse2, 0, 0, simdFeatures().BMI2 ? deinterleave2_bmi2 : deinterleave2_avx2};
+#		elif GLM_DISPATCH_X86
+			static deinterleave2_func const Table[SIMD_LEVEL_COUNT] = {deinterleave2_pure, deinterleave2_sse2, 0, 0, deinterleave2_avx2};
+#		else
+			static deinterleave2_func const Table[SIMD_LEVEL_COUNT] = {deinterleave2_pure, 0, 0, 0, 0};
+#		endif
+		return simd_select(Table);
+	}
+
+	//////////////////////////////////////
+	// Bit operations kernels
+
+	template <typename dstType, dstType (*Scalar)(uint32)>
+	GLM_FUNC_QUALIFIER void bit_op_pure(uint32 const * Src, dstType * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = Scalar(Src[i]);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <typename dstType, dstType (*Scalar)(uint32), __m128i (*Op)(__m128i)>
+	GLM_FUNC_QUALIFIER void bit_op_sse2(uint32 const * Src, dstType * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Op(_mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i))));
+		bit_op_pure<dstType, Scalar>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	// The number of bits set in each nibble
+	GLM_TARGET_SSE4 inline __m128i bitcount_ssse3(__m128i x)
+	{
+		__m128i const Table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		__m128i const Mask = _mm_set1_epi8(0x0F);
+
+		__m128i const Lo = _mm_shuffle_epi8(Table, _mm_and_si128(x, Mask));
+		__m128i const Hi = _mm_shuffle_epi8(Table, _mm_and_si128(_mm_srli_epi16(x, 4), Mask));
+
+		// Sums of the byte counts of each 32-bit lane
+		return _mm_madd_epi16(_mm_maddubs_epi16(_mm_add_epi8(Lo, Hi), _mm_set1_epi8(1)), _mm_set1_epi16(1));
+	}
+
+	// The reversed nibbles are swapped in each byte, then the bytes in each 32-bit lane
+	GLM_TARGET_SSE4 inline __m128i bitreverse_ssse3(__m128i x)
+	{
+		__m128i const TableLo = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F);
+		__m128i const TableHi = _mm_slli_epi16(TableLo, 4);
+		__m128i const Mask = _mm_set1_epi8(0x0F);
+
+		__m128i const Lo = _mm_shuffle_epi8(TableHi, _mm_and_si128(x, Mask));
+		__m128i const Hi = _mm_shuffle_epi8(TableLo, _mm_and_si128(_mm_srli_epi16(x, 4), Mask));
+		return _mm_shuffle_epi8(_mm_or_si128(Lo, Hi), _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+	}
+
+	template <typename dstType, dstType (*Scalar)(uint32), __m128i (*Op)(__m128i)>
+	GLM_TARGET_SSE4 inline void bit_op_sse4(uint32 const * Src, dstType * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Op(_mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i))));
+		bit_op_pure<dstType, Scalar>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX2 inline __m256i bitcount_avx2(__m256i x)
+	{
+		__m256i const Table = _mm256_setr_epi8(
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		__m256i const Mask = _mm256_set1_epi8(0x0F);
+
+		__m256i const Lo = _mm256_shuffle_epi8(Table, _mm256_and_si256(x, Mask));
+		__m256i const Hi = _mm256_shuffle_epi8(Table, _mm256_and_si256(_mm256_srli_epi16(x, 4), Mask));
+		return _mm256_madd_epi16(_mm256_maddubs_epi16(_mm256_add_epi8(Lo, Hi), _mm256_set1_epi8(1)), _mm256_set1_epi16(1));
+	}
+
+	GLM_TARGET_AVX2 inline __m256i bitreverse_avx2(__m256i x)
+	{
+		__m256i const TableLo = _mm256_setr_epi8(
+			0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F,
+			0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F);
+		__m256i const TableHi = _mm256_slli_epi16(TableLo, 4);
+		__m256i const Mask = _mm256_set1_epi8(0x0F);
+
+		__m256i const Lo = _mm256_shuffle_epi8(TableHi, _mm256_and_si256(x, Mask));
+		__m256i const Hi = _mm256_shuffle_epi8(TableLo, _mm256_and_si256(_mm256_srli_epi16(x, 4), Mask));
+		return _mm256_shuffle_epi8(_mm256_or_si256(Lo, Hi), _mm256_setr_epi8(
+			3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+			3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+	}
+
+	// The index of a power of two is the exponent of its exact conversion to float, -1 for 0
+	GLM_TARGET_AVX2 inline __m256i log2_pow2_avx2(__m256i Pow2)
+	{
+		__m256i const Exponent = _mm256_and_si256(_mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(Pow2)), 23), _mm256_set1_epi32(0xFF));
+		__m256i const Index = _mm256_sub_epi32(Exponent, _mm256_set1_epi32(127));
+		return _mm256_or_si256(Index, _mm256_cmpeq_epi32(Pow2, _mm256_setzero_si256()));
+	}
+
+	GLM_TARGET_AVX2 inline __m256i findlsb_avx2(__m256i x)
+	{
+		return log2_pow2_avx2(_mm256_and_si256(x, _mm256_sub_epi32(_mm256_setzero_si256(), x)));
+	}
+
+	GLM_TARGET_AVX2 inline __m256i findmsb_avx2(__m256i x)
+	{
+		x = _mm256_or_si256(x, _mm256_srli_epi32(x, 1));
+		x = _mm256_or_si256(x, _mm256_srli_epi32(x, 2));
+		x = _mm256_or_si256(x, _mm256_srli_epi32(x, 4));
+		x = _mm256_or_si256(x, _mm256_srli_epi32(x, 8));
+		x = _mm256_or_si256(x, _mm256_srli_epi32(x, 16));
+		return log2_pow2_avx2(_mm256_andnot_si256(_mm256_srli_epi32(x, 1), x));
+	}
+
+	template <typename dstType, dstType (*Scalar)(uint32), __m256i (*Op)(__m256i)>
+	GLM_TARGET_AVX2 inline void bit_op_avx2(uint32 const * Src, dstType * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + i), Op(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + i))));
+		bit_op_pure<dstType, Scalar>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	typedef void (*bit_count_func)(uint32 const *, int *, std::size_t);
+	typedef void (*bit_reverse_func)(uint32 const *, uint32 *, std::size_t);
+
+	GLM_FUNC_QUALIFIER bit_count_func bit_count_select()
+	{
+#		if GLM_DISPATCH_X86
+			static bit_count_func const Table[SIMD_LEVEL_COUNT] = {
+				bit_op_pure<int, bitCount<uint32> >,
+				bit_op_sse2<int, bitCount<uint32>, sse_bitcount_epi32>,
+				bit_op_sse4<int, bitCount<uint32>, bitcount_ssse3>,
+				0,
+				bit_op_avx2<int, bitCount<uint32>, bitcount_avx2>};
+#		else
+			static bit_count_func const Table[SIMD_LEVEL_COUNT] = {bit_op_pure<int, bitCount<uint32> >, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER bit_count_func find_lsb_select()
+	{
+#		if GLM_DISPATCH_X86
+			static bit_count_func const Table[SIMD_LEVEL_COUNT] = {
+				bit_op_pure<int, findLSB<uint32> >,
+				bit_op_sse2<int, findLSB<uint32>, sse_findlsb_epi32>,
+				0,
+				0,
+				bit_op_avx2<int, findLSB<uint32>, findlsb_avx2>};
+#		else
+			static bit_count_func const Table[SIMD_LEVEL_COUNT] = {bit_op_pure<int, findLSB<uint32> >, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER bit_count_func find_msb_select()
+	{
+#		if GLM_DISPATCH_X86
+			static bit_count_func const Table[SIMD_LEVEL_COUNT] = {
+				bit_op_pure<int, findMSB<uint32> >,
+				bit_op_sse2<int, findMSB<uint32>, sse_findmsb_epi32>,
+				0,
+				0,
+				bit_op_avx2<int, findMSB<uint32>, findmsb_avx2>};
+#		else
+			static bit_count_func const Table[SIMD_LEVEL_COUNT] = {bit_op_pure<int, findMSB<uint32> >, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER bit_reverse_func bit_reverse_select()
+	{
+#		if GLM_DISPATCH_X86
+			static bit_reverse_func const Table[SIMD_LEVEL_COUNT] = {
+				bit_op_pure<uint32, bitfieldReverse<uint32> >,
+				bit_op_sse2<uint32, bitfieldReverse<uint32>, sse_bitreverse_epi32>,
+				bit_op_sse4<uint32, bitfieldReverse<uint32>, bitreverse_ssse3>,
+				0,
+				bit_op_avx2<uint32, bitfieldReverse<uint32>, bitreverse_avx2>};
+#		else
+			static bit_reverse_func const Table[SIMD_LEVEL_COUNT] = {bit_op_pure<uint32, bitfieldReverse<uint32> >, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveBatch(u16vec3 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		detail::interleave3_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveBatch(u32vec2 const * Src, uint64 * Dst, std::size_t Count)
+	{
+		detail::interleave2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveBatch(uint64 const * Src, u16vec3 * Dst, std::size_t Count)
+	{
+		detail::deinterleave3_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveBatch(uint64 const * Src, u32vec2 * Dst, std::size_t Count)
+	{
+		detail::deinterleave2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitCountBatch(uint32 const * Src, int * Dst, std::size_t Count)
+	{
+		detail::bit_count_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void findLSBBatch(uint32 const * Src, int * Dst, std::size_t Count)
+	{
+		detail::find_lsb_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void findMSBBatch(uint32 const * Src, int * Dst, std::size_t Count)
+	{
+		detail::find_msb_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldReverseBatch(uint32 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		detail::bit_reverse_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void sortInterleaved(uint64 * Keys, uint32 * Indices, std::size_t Count)
+	{
+		if(Count < 2)
+			return;
+
+		// The histograms of the 8 bytes, computed in a single pass
+		std::vector<std::size_t> Histograms(8 * 256, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+		for(std::size_t Byte = 0; Byte < 8; ++Byte)
+			++Histograms[Byte * 256 + ((Keys[i] >> (Byte * 8)) & 0xFF)];
+
+		std::vector<uint64> KeyBuffer(Count);
+		std::vector<uint32> IndexBuffer(Indices ? Count : 0);
+		uint64 * SrcKeys = Keys;
+		uint64 * DstKeys = &KeyBuffer[0];
+		uint32 * SrcIndices = Indices;
+		uint32 * DstIndices = Indices ? &IndexBuffer[0] : 0;
+
+		for(std::size_t Byte = 0; Byte < 8; ++Byte)
+		{
+			std::size_t * Offsets = &Histograms[Byte * 256];
+			std::size_t const Shift = Byte * 8;
+
+			// All the keys share this byte
+			if(Offsets[(SrcKeys[0] >> Shift) & 0xFF] == Count)
+				continue;
+
+			std::size_t Sum = 0;
+			for(std::size_t i = 0; i < 256; ++i)
+			{
+				std::size_t const Size = Offsets[i];
+				Offsets[i] = Sum;
+				Sum += Size;
+			}
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				std::size_t const Dst = Offsets[(SrcKeys[i] >> Shift) & 0xFF]++;
+				DstKeys[Dst] = SrcKeys[i];
+				if(Indices)
+					DstIndices[Dst] = SrcIndices[i];
+			}
+
+			std::swap(SrcKeys, DstKeys);
+			std::swap(SrcIndices, DstIndices);
+		}
+
+		if(SrcKeys != Keys)
+		{
+			std::copy(SrcKeys, SrcKeys + Count, Keys);
+			if(Indices)
+				std::copy(SrcIndices, SrcIndices + Count, Indices);
+		}
+	}
+}//namespace glm
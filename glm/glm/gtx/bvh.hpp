@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_type_precision (dependence)
+/// @see gtx_simd_packet (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh
+/// @ingroup gtx
+///
+/// @brief Bounding volume hierarchy over triangle meshes for ray, segment, sphere and box queries.
+///
+/// The hierarchy is built with the surface area heuristic evaluated on 16 bins per
+/// axis, the subtrees being built by OpenMP tasks when OpenMP 3.0 is enabled.
+/// Nodes are stored in depth first order with the index of the node following
+/// their subtree, so that queries walk the tree without stack. Each leaf stores
+/// up to 4 triangles as a structure of arrays which ray queries test at once
+/// with SSE.
+///
+/// Ray and segment queries are two sided, unlike intersectRayTriangle.
+///
+/// <glm/gtx/bvh.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/type_precision.hpp"
+#include "simd_packet.hpp"
+#include <cstddef>
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_bvh extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	/// Node of a bounding volume hierarchy, stored in depth first order.
+	struct bvh_node
+	{
+		vec3 Min;
+		uint32 Skip;	///< Index of the node following the subtree of this node
+		vec3 Max;
+		uint32 Leaf;	///< Index of the triangles of a leaf node, bvh_node::inner for inner nodes
+
+		static GLM_RELAXED_CONSTEXPR uint32 inner = 0xFFFFFFFF;
+	};
+
+	/// Up to 4 triangles of a leaf node, stored as a structure of arrays.
+	struct bvh_leaf
+	{
+		float V0[3][4];
+		float E1[3][4];	///< V1 - V0
+		float E2[3][4];	///< V2 - V0
+		uint32 Triangles[4];	///< Indices of the triangles in the mesh, bvh_node::inner for unused lanes
+	};
+
+	/// Bounding volume hierarchy of a triangle mesh.
+	struct bvh
+	{
+		std::vector<bvh_node> Nodes;
+		std::vector<bvh_leaf> Leaves;
+	};
+
+	/// Closest intersection of a ray or a segment with a mesh.
+	struct bvh_hit
+	{
+		float Distance;		///< Position on the ray or the segment, in units of its direction
+		vec2 Barycentric;	///< Position in the triangle, V0 + (V1 - V0) * x + (V2 - V0) * y
+		uint32 Triangle;	///< Index of the triangle in the mesh, bvh_node::inner when missed
+	};
+
+	/// Builds the hierarchy of TriangleCount triangles stored as 3 consecutive vertices each.
+	/// @see gtx_bvh
+	GLM_FUNC_DECL void bvhBuild(vec3 const * Vertices, std::size_t TriangleCount, bvh & Bvh);
+
+	/// Builds the hierarchy of TriangleCount triangles stored as 3 consecutive indices each.
+	/// @see gtx_bvh
+	GLM_FUNC_DECL void bvhBuild(vec3 const * Vertices, uint32 const * Indices, std::size_t TriangleCount, bvh & Bvh);
+
+	/// Computes the closest intersection of the ray Origin + Direction * t, t >= 0, with the mesh.
+	/// Returns false if the ray misses the mesh.
+	/// @see gtx_bvh
+	GLM_FUNC_DECL bool bvhIntersectRay(bvh const & Bvh, vec3 const & Origin, vec3 const & Direction, bvh_hit & Hit);
+
+	/// Computes the closest intersection of the segment P0 + (P1 - P0) * t, 0 <= t <= 1, with the mesh.
+	/// Returns false if the segment misses the mesh.
+	/// @see gtx_bvh
+	GLM_FUNC_DECL bool bvhIntersectSegment(bvh const & Bvh, vec3 const & P0, vec3 const & P1, bvh_hit & Hit);
+
+	/// Computes the closest intersection of Count rays with the mesh, the rays being split among threads when OpenMP is enabled.
+	/// Returns the number of rays hitting the mesh, Hits[i].Triangle is bvh_node::inner for the others.
+	/// @see gtx_bvh
+	GLM_FUNC_DECL std::size_t bvhIntersectRayBatch(bvh const & Bvh, vec3 const * Origins, vec3 const * Directions, bvh_hit * Hits, std::size_t Count);
+
+	/// Appends to Triangles the indices of the triangles overlapping the sphere.
+	/// Returns the number of indices appended.
+	/// @see gtx_bvh
+	GLM_FUNC_DECL std::size_t bvhIntersectSphere(bvh const & Bvh, vec3 const & Center, float Radius, std::vector<uint32> & Triangles);
+
+	/// Appends to Triangles the indices of the triangles overlapping the axis aligned box.
+	/// Returns the number of indices appended.
+	/// @see gtx_bvh
+	GLM_FUNC_DECL std::size_t bvhIntersectAABB(bvh const & Bvh, vec3 const & Min, vec3 const & Max, std::vector<uint32> & Triangles);
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
@@ -0,0 +1,709 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	enum
+	{
+		BVH_BIN_COUNT = 16,
+		BVH_LEAF_SIZE = 4,
+		BVH_TASK_SIZE = 4096,
+		BVH_SAH_DEPTH = 48	// Deeper nodes are split at their median so that the depth of the tree stays bounded
+	};
+
+	struct bvh_build_node
+	{
+		vec3 Min;
+		vec3 Max;
+		uint32 Left;	// Slot of the left child, 0 for leaves
+		uint32 Right;
+		uint32 Begin;
+		uint32 End;
+	};
+
+	struct bvh_builder
+	{
+		std::vector<vec3> Min;
+		std::vector<vec3> Max;
+		std::vector<vec3> Centroid;
+		std::vector<uint32> Triangles;
+		std::vector<bvh_build_node> Nodes;
+	};
+
+	struct bvh_soup
+	{
+		vec3 const * Vertices;
+
+		GLM_FUNC_QUALIFIER void operator()(uint32 Triangle, vec3 & V0, vec3 & V1, vec3 & V2) const
+		{
+			V0 = Vertices[Triangle * 3 + 0];
+			V1 = Vertices[Triangle * 3 + 1];
+			V2 = Vertices[Triangle * 3 + 2];
+		}
+	};
+
+	struct bvh_indexed
+	{
+		vec3 const * Vertices;
+		uint32 const * Indices;
+
+		GLM_FUNC_QUALIFIER void operator()(uint32 Triangle, vec3 & V0, vec3 & V1, vec3 & V2) const
+		{
+			V0 = Vertices[Indices[Triangle * 3 + 0]];
+			V1 = Vertices[Indices[Triangle * 3 + 1]];
+			V2 = Vertices[Indices[Triangle * 3 + 2]];
+		}
+	};
+
+	GLM_FUNC_QUALIFIER float bvh_area(vec3 const & Min, vec3 const & Max)
+	{
+		vec3 const d(Max - Min);
+		return d.x * d.y + d.y * d.z + d.z * d.x;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 bvh_bin(float Centroid, float Origin, float Scale)
+	{
+		uint32 const Bin = static_cast<uint32>((Centroid - Origin) * Scale);
+		return Bin < BVH_BIN_COUNT ? Bin : BVH_BIN_COUNT - 1;
+	}
+
+	struct bvh_bin_less_equal
+	{
+		bvh_builder const * Builder;
+		length_t Axis;
+		float Origin;
+		float Scale;
+		uint32 Bin;
+
+		GLM_FUNC_QUALIFIER bool operator()(uint32 Triangle) const
+		{
+			return bvh_bin(Builder->Centroid[Triangle][Axis], Origin, Scale) <= Bin;
+		}
+	};
+
+	struct bvh_centroid_less
+	{
+		bvh_builder const * Builder;
+		length_t Axis;
+
+		GLM_FUNC_QUALIFIER bool operator()(uint32 a, uint32 b) const
+		{
+			return Builder->Centroid[a][Axis] < Builder->Centroid[b][Axis];
+		}
+	};
+
+	// Builds the subtree of the triangles [Begin, End) in Slot, at Depth. A subtree of n triangles uses at most
+	// 2n - 1 slots so that the children are placed without synchronization between the tasks.
+	GLM_FUNC_QUALIFIER void bvh_build_subtree(bvh_builder * Builder, uint32 Slot, uint32 Begin, uint32 End, uint32 Depth)
+	{
+		uint32 const * Triangles = &Builder->Triangles[0];
+
+		vec3 BoundMin(Builder->Min[Triangles[Begin]]);
+		vec3 BoundMax(Builder->Max[Triangles[Begin]]);
+		vec3 CentroidMin(Builder->Centroid[Triangles[Begin]]);
+		vec3 CentroidMax(CentroidMin);
+		for(uint32 i = Begin + 1; i < End; ++i)
+		{
+			BoundMin = min(BoundMin, Builder->Min[Triangles[i]]);
+			BoundMax = max(BoundMax, Builder->Max[Triangles[i]]);
+			CentroidMin = min(CentroidMin, Builder->Centroid[Triangles[i]]);
+			CentroidMax = max(CentroidMax, Builder->Centroid[Triangles[i]]);
+		}
+
+		bvh_build_node & Node = Builder->Nodes[Slot];
+		Node.Min = BoundMin;
+		Node.Max = BoundMax;
+		Node.Left = 0;
+		Node.Right = 0;
+		Node.Begin = Begin;
+		Node.End = End;
+
+		uint32 const Count = End - Begin;
+		if(Count <= BVH_LEAF_SIZE)
+			return;
+
+		// Surface area heuristic evaluated between the bins of the centroids along each axis
+		float BestCost = std::numeric_limits<float>::max();
+		length_t BestAxis = 0;
+		uint32 BestBin = BVH_BIN_COUNT;
+		float BestScale = 0.0f;
+
+		for(length_t Axis = 0; Axis < 3 && Depth < BVH_SAH_DEPTH; ++Axis)
+		{
+			float const Extent = CentroidMax[Axis] - CentroidMin[Axis];
+			if(Extent <= 0.0f)
+				continue;
+			float const Scale = static_cast<float>(BVH_BIN_COUNT) / Extent;
+			if(Scale > std::numeric_limits<float>::max())
+				continue;
+
+			uint32 BinCount[BVH_BIN_COUNT];
+			vec3 BinMin[BVH_BIN_COUNT];
+			vec3 BinMax[BVH_BIN_COUNT];
+			for(uint32 Bin = 0; Bin < BVH_BIN_COUNT; ++Bin)
+			{
+				BinCount[Bin] = 0;
+				BinMin[Bin] = vec3(std::numeric_limits<float>::max());
+				BinMax[Bin] = vec3(-std::numeric_limits<float>::max());
+			}
+
+			for(uint32 i = Begin; i < End; ++i)
+			{
+				uint32 const Bin = bvh_bin(Builder->Centroid[Triangles[i]][Axis], CentroidMin[Axis], Scale);
+				++BinCount[Bin];
+				BinMin[Bin] = min(BinMin[Bin], Builder->Min[Triangles[i]]);
+				BinMax[Bin] = max(BinMax[Bin], Builder->Max[Triangles[i]]);
+			}
+
+			float LeftArea[BVH_BIN_COUNT - 1];
+			uint32 LeftCount[BVH_BIN_COUNT - 1];
+			vec3 SweepMin(BinMin[0]);
+			vec3 SweepMax(BinMax[0]);
+			uint32 SweepCount = 0;
+			for(uint32 Bin = 0; Bin < BVH_BIN_COUNT - 1; ++Bin)
+			{
+				SweepMin = min(SweepMin, BinMin[Bin]);
+				SweepMax = max(SweepMax, BinMax[Bin]);
+				SweepCount += BinCount[Bin];
+				LeftArea[Bin] = SweepCount ? bvh_area(SweepMin, SweepMax) : 0.0f;
+				LeftCount[Bin] = SweepCount;
+			}
+
+			SweepMin = BinMin[BVH_BIN_COUNT - 1];
+			SweepMax = BinMax[BVH_BIN_COUNT - 1];
+			SweepCount = 0;
+			for(uint32 Bin = BVH_BIN_COUNT - 1; Bin > 0; --Bin)
+			{
+				SweepMin = min(SweepMin, BinMin[Bin]);
+				SweepMax = max(SweepMax, BinMax[Bin]);
+				SweepCount += BinCount[Bin];
+				if(SweepCount == 0 || LeftCount[Bin - 1] == 0)
+					continue;
+
+				float const Cost = LeftArea[Bin - 1] * static_cast<float>(LeftCount[Bin - 1]) + bvh_area(SweepMin, SweepMax) * static_cast<float>(SweepCount);
+				if(Cost < BestCost)
+				{
+					BestCost = Cost;
+					BestAxis = Axis;
+					BestBin = Bin - 1;
+					BestScale = Scale;
+				}
+			}
+		}
+
+		uint32 * Partition = &Builder->Triangles[0];
+		uint32 Mid = Begin;
+		if(BestBin < BVH_BIN_COUNT)
+		{
+			bvh_bin_less_equal const Predicate = {Builder, BestAxis, CentroidMin[BestAxis], BestScale, BestBin};
+			Mid = static_cast<uint32>(std::partition(Partition + Begin, Partition + End, Predicate) - Partition);
+		}
+
+		// Median split along the widest axis when the centroids are equal, when a side would be empty or past BVH_SAH_DEPTH
+		if(Mid == Begin || Mid == End)
+		{
+			vec3 const Extent(CentroidMax - CentroidMin);
+			bvh_centroid_less const Less = {Builder, static_cast<length_t>(Extent.x >= Extent.y && Extent.x >= Extent.z ? 0 : Extent.y >= Extent.z ? 1 : 2)};
+			Mid = Begin + Count / 2;
+			std::nth_element(Partition + Begin, Partition + Mid, Partition + End, Less);
+		}
+
+		uint32 const Left = Slot + 1;
+		uint32 const Right = Slot + 2 * (Mid - Begin);
+		Node.Left = Left;
+		Node.Right = Right;
+
+#		if GLM_HAS_OPENMP >= 30
+			if(Count > BVH_TASK_SIZE)
+			{
+#				pragma omp task
+				bvh_build_subtree(Builder, Left, Begin, Mid, Depth + 1);
+				bvh_build_subtree(Builder, Right, Mid, End, Depth + 1);
+#				pragma omp taskwait
+				return;
+			}
+#		endif//GLM_HAS_OPENMP >= 30
+
+		bvh_build_subtree(Builder, Left, Begin, Mid, Depth + 1);
+		bvh_build_subtree(Builder, Right, Mid, End, Depth + 1);
+	}
+
+	// Stores the subtree of Slot in depth first order, the skip index of a node being written once its subtree is stored.
+	// The recursion is bounded by the depth of the tree, at most BVH_SAH_DEPTH + log2 of the triangle count.
+	template <typename meshType>
+	GLM_FUNC_QUALIFIER void bvh_flatten(bvh_builder const & Builder, meshType const & Mesh, uint32 Slot, bvh & Bvh)
+	{
+		bvh_build_node const & Node = Builder.Nodes[Slot];
+		uint32 const Index = static_cast<uint32>(Bvh.Nodes.size());
+
+		bvh_node Flat;
+		Flat.Min = Node.Min;
+		Flat.Skip = 0;
+		Flat.Max = Node.Max;
+		Flat.Leaf = bvh_node::inner;
+		Bvh.Nodes.push_back(Flat);
+
+		if(Node.Left == 0)
+		{
+			bvh_leaf Leaf;
+			for(uint32 Lane = 0; Lane < BVH_LEAF_SIZE; ++Lane)
+			{
+				vec3 V0(0.0f), V1(0.0f), V2(0.0f);
+				uint32 Triangle = bvh_node::inner;
+				if(Node.Begin + Lane < Node.End)
+				{
+					Triangle = Builder.Triangles[Node.Begin + Lane];
+					Mesh(Triangle, V0, V1, V2);
+				}
+
+				vec3 const E1(V1 - V0);
+				vec3 const E2(V2 - V0);
+				for(length_t i = 0; i < 3; ++i)
+				{
+					Leaf.V0[i][Lane] = V0[i];
+					Leaf.E1[i][Lane] = E1[i];
+					Leaf.E2[i][Lane] = E2[i];
+				}
+				Leaf.Triangles[Lane] = Triangle;
+			}
+
+			Bvh.Nodes[Index].Leaf = static_cast<uint32>(Bvh.Leaves.size());
+			Bvh.Leaves.push_back(Leaf);
+		}
+		else
+		{
+			bvh_flatten(Builder, Mesh, Node.Left, Bvh);
+			bvh_flatten(Builder, Mesh, Node.Right, Bvh);
+		}
+
+		Bvh.Nodes[Index].Skip = static_cast<uint32>(Bvh.Nodes.size());
+	}
+
+	template <typename meshType>
+	GLM_FUNC_QUALIFIER void bvh_build(meshType const & Mesh, std::size_t TriangleCount, bvh & Bvh)
+	{
+		Bvh.Nodes.clear();
+		Bvh.Leaves.clear();
+		if(TriangleCount == 0)
+			return;
+
+		bvh_builder Builder;
+		Builder.Min.resize(TriangleCount);
+		Builder.Max.resize(TriangleCount);
+		Builder.Centroid.resize(TriangleCount);
+		Builder.Triangles.resize(TriangleCount);
+		Builder.Nodes.resize(TriangleCount * 2 - 1);
+
+		int const Count = static_cast<int>(TriangleCount);
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for
+#		endif//GLM_HAS_OPENMP
+		for(int i = 0; i < Count; ++i)
+		{
+			vec3 V0, V1, V2;
+			Mesh(static_cast<uint32>(i), V0, V1, V2);
+			Builder.Min[i] = min(min(V0, V1), V2);
+			Builder.Max[i] = max(max(V0, V1), V2);
+			Builder.Centroid[i] = (Builder.Min[i] + Builder.Max[i]) * 0.5f;
+			Builder.Triangles[i] = static_cast<uint32>(i);
+		}
+
+#		if GLM_HAS_OPENMP >= 30
+#			pragma omp parallel
+#			pragma omp single
+#		endif//GLM_HAS_OPENMP >= 30
+		bvh_build_subtree(&Builder, 0, 0, static_cast<uint32>(TriangleCount), 0);
+
+		Bvh.Nodes.reserve(TriangleCount * 2 - 1);
+		Bvh.Leaves.reserve(TriangleCount);
+		bvh_flatten(Builder, Mesh, 0, Bvh);
+	}
+
+	GLM_FUNC_QUALIFIER void bvh_leaf_triangle(bvh_leaf const & Leaf, uint32 Lane, vec3 & V0, vec3 & V1, vec3 & V2)
+	{
+		V0 = vec3(Leaf.V0[0][Lane], Leaf.V0[1][Lane], Leaf.V0[2][Lane]);
+		V1 = V0 + vec3(Leaf.E1[0][Lane], Leaf.E1[1][Lane], Leaf.E1[2][Lane]);
+		V2 = V0 + vec3(Leaf.E2[0][Lane], Leaf.E2[1][Lane], Leaf.E2[2][Lane]);
+	}
+
+	// Closest point of the triangle ABC to P, from Real-Time Collision Detection, Christer Ericson, 5.1.5
+	GLM_FUNC_QUALIFIER vec3 bvh_closest_point(vec3 const & P, vec3 const & A, vec3 const & B, vec3 const & C)
+	{
+		vec3 const AB(B - A);
+		vec3 const AC(C - A);
+		vec3 const AP(P - A);
+		float const d1 = dot(AB, AP);
+		float const d2 = dot(AC, AP);
+		if(d1 <= 0.0f && d2 <= 0.0f)
+			return A;
+
+		vec3 const BP(P - B);
+		float const d3 = dot(AB, BP);
+		float const d4 = dot(AC, BP);
+		if(d3 >= 0.0f && d4 <= d3)
+			return B;
+
+		float const vc = d1 * d4 - d3 * d2;
+		if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+			return A + AB * (d1 / (d1 - d3));
+
+		vec3 const CP(P - C);
+		float const d5 = dot(AB, CP);
+		float const d6 = dot(AC, CP);
+		if(d6 >= 0.0f && d5 <= d6)
+			return C;
+
+		float const vb = d5 * d2 - d1 * d6;
+		if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+			return A + AC * (d2 / (d2 - d6));
+
+		float const va = d3 * d6 - d5 * d4;
+		if(va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+			return B + (C - B) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+		float const Denom = 1.0f / (va + vb + vc);
+		return A + AB * (vb * Denom) + AC * (vc * Denom);
+	}
+
+	// Separating axis test of the triangle ABC and the box Center +/- Extent, from Tomas Akenine-Moller
+	GLM_FUNC_QUALIFIER bool bvh_triangle_box(vec3 const & Center, vec3 const & Extent, vec3 const & A, vec3 const & B, vec3 const & C)
+	{
+		vec3 const V0(A - Center);
+		vec3 const V1(B - Center);
+		vec3 const V2(C - Center);
+
+		// Axes of the box
+		if(any(greaterThan(min(min(V0, V1), V2), Extent)) || any(lessThan(max(max(V0, V1), V2), -Extent)))
+			return false;
+
+		// Normal of the triangle
+		vec3 const Edges[] = {V1 - V0, V2 - V1, V0 - V2};
+		vec3 const Normal(cross(Edges[0], Edges[1]));
+		if(glm::abs(dot(Normal, V0)) > dot(Extent, glm::abs(Normal)))
+			return false;
+
+		// Cross products of the edges of the triangle and the axes of the box
+		for(length_t i = 0; i < 3; ++i)
+		for(length_t j = 0; j < 3; ++j)
+		{
+			vec3 Axis(0.0f);
+			Axis[j] = 1.0f;
+			Axis = cross(Axis, Edges[i]);
+
+			float const P0 = dot(V0, Axis);
+			float const P1 = dot(V1, Axis);
+			float const P2 = dot(V2, Axis);
+			float const Radius = dot(Extent, glm::abs(Axis));
+			if(glm::max(P0, glm::max(P1, P2)) < -Radius || glm::min(P0, glm::min(P1, P2)) > Radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	GLM_FUNC_QUALIFIER bool bvh_slab(bvh_node const & Node, vec3 const & Origin, vec3 const & InvDirection, float MaxDistance)
+	{
+		vec3 const t0((Node.Min - Origin) * InvDirection);
+		vec3 const t1((Node.Max - Origin) * InvDirection);
+		vec3 const Near(glm::min(t0, t1));
+		vec3 const Far(glm::max(t0, t1));
+		float const Enter = glm::max(glm::max(Near.x, Near.y), glm::max(Near.z, 0.0f));
+		float const Exit = glm::min(glm::min(Far.x, Far.y), glm::min(Far.z, MaxDistance));
+		return Enter <= Exit;
+	}
+
+	GLM_FUNC_QUALIFIER void bvh_intersect_leaf(bvh_leaf const & Leaf, vec3 const & Origin, vec3 const & Direction, bvh_hit & Hit)
+	{
+		for(uint32 Lane = 0; Lane < BVH_LEAF_SIZE; ++Lane)
+		{
+			if(Leaf.Triangles[Lane] == bvh_node::inner)
+				continue;
+
+			vec3 const V0(Leaf.V0[0][Lane], Leaf.V0[1][Lane], Leaf.V0[2][Lane]);
+			vec3 const E1(Leaf.E1[0][Lane], Leaf.E1[1][Lane], Leaf.E1[2][Lane]);
+			vec3 const E2(Leaf.E2[0][Lane], Leaf.E2[1][Lane], Leaf.E2[2][Lane]);
+
+			vec3 const P(cross(Direction, E2));
+			float const Det = dot(E1, P);
+			if(glm::abs(Det) < std::numeric_limits<float>::epsilon())
+				continue;
+
+			float const InvDet = 1.0f / Det;
+			vec3 const S(Origin - V0);
+			float const U = dot(S, P) * InvDet;
+			if(U < 0.0f || U > 1.0f)
+				continue;
+
+			vec3 const Q(cross(S, E1));
+			float const V = dot(Direction, Q) * InvDet;
+			if(V < 0.0f || U + V > 1.0f)
+				continue;
+
+			float const T = dot(E2, Q) * InvDet;
+			if(T < 0.0f || T >= Hit.Distance)
+				continue;
+
+			Hit.Distance = T;
+			Hit.Barycentric = vec2(U, V);
+			Hit.Triangle = Leaf.Triangles[Lane];
+		}
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2
+	// Slab test of a node, the w lanes of Min and Max holding Skip and Leaf are replaced by the range of the ray
+	GLM_FUNC_QUALIFIER bool bvh_slab_sse2(bvh_node const & Node, __m128 Origin, __m128 InvDirection, __m128 MaskXYZ, __m128 MaxDistance)
+	{
+		__m128 const t0 = _mm_mul_ps(_mm_sub_ps(_mm_and_ps(_mm_loadu_ps(&Node.Min.x), MaskXYZ), Origin), InvDirection);
+		__m128 const t1 = _mm_mul_ps(_mm_sub_ps(_mm_and_ps(_mm_loadu_ps(&Node.Max.x), MaskXYZ), Origin), InvDirection);
+		__m128 const Near = _mm_min_ps(t0, t1);
+		__m128 const Far = _mm_or_ps(_mm_max_ps(t0, t1), _mm_andnot_ps(MaskXYZ, MaxDistance));
+
+		__m128 Enter = _mm_max_ps(Near, _mm_shuffle_ps(Near, Near, _MM_SHUFFLE(2, 3, 0, 1)));
+		Enter = _mm_max_ss(Enter, _mm_movehl_ps(Enter, Enter));
+		__m128 Exit = _mm_min_ps(Far, _mm_shuffle_ps(Far, Far, _MM_SHUFFLE(2, 3, 0, 1)));
+		Exit = _mm_min_ss(Exit, _mm_movehl_ps(Exit, Exit));
+		return _mm_comile_ss(Enter, Exit) != 0;
+	}
+
+	// Moller-Trumbore test of the 4 triangles of a leaf at once
+	GLM_FUNC_QUALIFIER void bvh_intersect_leaf_sse2(bvh_leaf const & Leaf, vec3x4 const & Origin, vec3x4 const & Direction, bvh_hit & Hit)
+	{
+		typedef fpacket4SIMD pack;
+
+		vec3x4 const V0(pack::load(Leaf.V0[0]), pack::load(Leaf.V0[1]), pack::load(Leaf.V0[2]));
+		vec3x4 const E1(pack::load(Leaf.E1[0]), pack::load(Leaf.E1[1]), pack::load(Leaf.E1[2]));
+		vec3x4 const E2(pack::load(Leaf.E2[0]), pack::load(Leaf.E2[1]), pack::load(Leaf.E2[2]));
+
+		vec3x4 const P(glm::cross(Direction, E2));
+		pack const Det(glm::dot(E1, P));
+		pack const InvDet(pack(1.0f) / Det);
+		vec3x4 const S(Origin - V0);
+		pack const U(glm::dot(S, P) * InvDet);
+		vec3x4 const Q(glm::cross(S, E1));
+		pack const V(glm::dot(Direction, Q) * InvDet);
+		pack const T(glm::dot(E2, Q) * InvDet);
+
+		pack const Zero(0.0f);
+		pack const Mask(
+			(glm::abs(Det) >= pack(std::numeric_limits<float>::epsilon())) &
+			(U >= Zero) & (V >= Zero) & (U + V <= pack(1.0f)) &
+			(T >= Zero) & (T < pack(Hit.Distance)));
+
+		for(int Lanes = movemask(Mask); Lanes; Lanes &= Lanes - 1)
+		{
+			length_t const Lane = static_cast<length_t>(findLSB(Lanes));
+			if(T[Lane] >= Hit.Distance)
+				continue;
+
+			Hit.Distance = T[Lane];
+			Hit.Barycentric = vec2(U[Lane], V[Lane]);
+			Hit.Triangle = Leaf.Triangles[Lane];
+		}
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2
+
+	GLM_FUNC_QUALIFIER bool bvh_intersect(bvh const & Bvh, vec3 const & Origin, vec3 const & Direction, float MaxDistance, bvh_hit & Hit)
+	{
+		Hit.Distance = MaxDistance;
+		Hit.Barycentric = vec2(0.0f);
+		Hit.Triangle = bvh_node::inner;
+
+		uint32 const NodeCount = static_cast<uint32>(Bvh.Nodes.size());
+		vec3 const InvDirection(1.0f / Direction);
+
+#		if GLM_ARCH & GLM_ARCH_SSE2
+			__m128 const SIMDOrigin = _mm_setr_ps(Origin.x, Origin.y, Origin.z, 0.0f);
+			__m128 const SIMDInvDirection = _mm_setr_ps(InvDirection.x, InvDirection.y, InvDirection.z, 0.0f);
+			__m128 const MaskXYZ = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			vec3x4 const PacketOrigin(Origin);
+			vec3x4 const PacketDirection(Direction);
+#		endif
+
+		for(uint32 i = 0; i < NodeCount;)
+		{
+			bvh_node const & Node = Bvh.Nodes[i];
+
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				bool const Overlap = bvh_slab_sse2(Node, SIMDOrigin, SIMDInvDirection, MaskXYZ, _mm_set1_ps(Hit.Distance));
+#			else
+				bool const Overlap = bvh_slab(Node, Origin, InvDirection, Hit.Distance);
+#			endif
+
+			if(!Overlap)
+			{
+				i = Node.Skip;
+				continue;
+			}
+
+			if(Node.Leaf == bvh_node::inner)
+			{
+				++i;
+				continue;
+			}
+
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				bvh_intersect_leaf_sse2(Bvh.Leaves[Node.Leaf], PacketOrigin, PacketDirection, Hit);
+#			else
+				bvh_intersect_leaf(Bvh.Leaves[Node.Leaf], Origin, Direction, Hit);
+#			endif
+			i = Node.Skip;
+		}
+
+		return Hit.Triangle != bvh_node::inner;
+	}
+
+	// Collects the triangles for which Overlap is true, in the leaves of the nodes for which Overlap is true
+	template <typename overlapType>
+	GLM_FUNC_QUALIFIER std::size_t bvh_collect(bvh const & Bvh, overlapType const & Overlap, std::vector<uint32> & Triangles)
+	{
+		std::size_t const First = Triangles.size();
+		uint32 const NodeCount = static_cast<uint32>(Bvh.Nodes.size());
+
+		for(uint32 i = 0; i < NodeCount;)
+		{
+			bvh_node const & Node = Bvh.Nodes[i];
+			if(!Overlap(Node.Min, Node.Max))
+			{
+				i = Node.Skip;
+				continue;
+			}
+
+			if(Node.Leaf == bvh_node::inner)
+			{
+				++i;
+				continue;
+			}
+
+			bvh_leaf const & Leaf = Bvh.Leaves[Node.Leaf];
+			for(uint32 Lane = 0; Lane < BVH_LEAF_SIZE; ++Lane)
+			{
+				if(Leaf.Triangles[Lane] == bvh_node::inner)
+					continue;
+
+				vec3 V0, V1, V2;
+				bvh_leaf_triangle(Leaf, Lane, V0, V1, V2);
+				if(Overlap(V0, V1, V2))
+					Triangles.push_back(Leaf.Triangles[Lane]);
+			}
+			i = Node.Skip;
+		}
+
+		return Triangles.size() - First;
+	}
+
+	struct bvh_sphere_overlap
+	{
+		vec3 Center;
+		float Radius2;
+
+		GLM_FUNC_QUALIFIER bool operator()(vec3 const & Min, vec3 const & Max) const
+		{
+			vec3 const d(clamp(Center, Min, Max) - Center);
+			return dot(d, d) <= Radius2;
+		}
+
+		GLM_FUNC_QUALIFIER bool operator()(vec3 const & V0, vec3 const & V1, vec3 const & V2) const
+		{
+			vec3 const d(bvh_closest_point(Center, V0, V1, V2) - Center);
+			return dot(d, d) <= Radius2;
+		}
+	};
+
+	struct bvh_box_overlap
+	{
+		vec3 Min;
+		vec3 Max;
+
+		GLM_FUNC_QUALIFIER bool operator()(vec3 const & NodeMin, vec3 const & NodeMax) const
+		{
+			return all(lessThanEqual(NodeMin, Max)) && all(lessThanEqual(Min, NodeMax));
+		}
+
+		GLM_FUNC_QUALIFIER bool operator()(vec3 const & V0, vec3 const & V1, vec3 const & V2) const
+		{
+			return bvh_triangle_box((Min + Max) * 0.5f, (Max - Min) * 0.5f, V0, V1, V2);
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void bvhBuild(vec3 const * Vertices, std::size_t TriangleCount, bvh & Bvh)
+	{
+		detail::bvh_soup const Mesh = {Vertices};
+		detail::bvh_build(Mesh, TriangleCount, Bvh);
+	}
+
+	GLM_FUNC_QUALIFIER void bvhBuild(vec3 const * Vertices, uint32 const * Indices, std::size_t TriangleCount, bvh & Bvh)
+	{
+		detail::bvh_indexed const Mesh = {Vertices, Indices};
+		detail::bvh_build(Mesh, TriangleCount, Bvh);
+	}
+
+	GLM_FUNC_QUALIFIER bool bvhIntersectRay(bvh const & Bvh, vec3 const & Origin, vec3 const & Direction, bvh_hit & Hit)
+	{
+		return detail::bvh_intersect(Bvh, Origin, Direction, std::numeric_limits<float>::max(), Hit);
+	}
+
+	GLM_FUNC_QUALIFIER bool bvhIntersectSegment(bvh const & Bvh, vec3 const & P0, vec3 const & P1, bvh_hit & Hit)
+	{
+		return detail::bvh_intersect(Bvh, P0, P1 - P0, 1.0f, Hit);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t bvhIntersectRayBatch(bvh const & Bvh, vec3 const * Origins, vec3 const * Directions, bvh_hit * Hits, std::size_t Count)
+	{
+		int const RayCount = static_cast<int>(Count);
+		int HitCount = 0;
+
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for reduction(+:HitCount) schedule(dynamic, 64)
+#		endif//GLM_HAS_OPENMP
+		for(int i = 0; i < RayCount; ++i)
+			HitCount += detail::bvh_intersect(Bvh, Origins[i], Directions[i], std::numeric_limits<float>::max(), Hits[i]) ? 1 : 0;
+
+		return static_cast<std::size_t>(HitCount);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t bvhIntersectSphere(bvh const & Bvh, vec3 const & Center, float Radius, std::vector<uint32> & Triangles)
+	{
+		detail::bvh_sphere_overlap const Overlap = {Center, Radius * Radius};
+		return detail::bvh_collect(Bvh, Overlap, Triangles);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t bvhIntersectAABB(bvh const & Bvh, vec3 const & Min, vec3 const & Max, std::vector<uint32> & Triangles)
+	{
+		detail::bvh_box_overlap const Overlap = {Min, Max};
+		return detail::bvh_collect(Bvh, Overlap, Triangles);
+	}
+}//namespace glm
@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_color_space_batch
+/// @file glm/gtx/color_space_batch.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_color_space (dependence)
+/// @see gtx_approx_math (dependence)
+/// @see gtx_color_space (dependence)
+/// @see gtx_color_space_YCoCg (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_color_space_batch GLM_GTX_color_space_batch
+/// @ingroup gtx
+///
+/// @brief Color space conversion of arrays of pixels, for texture processing.
+///
+/// The 8 bit sRGB conversions are table driven and give exactly the results of the
+/// scalar functions: a table of the 256 linear values for decoding, and for encoding
+/// a table of codes indexed by the exponent and the 7 first bits of the mantissa,
+/// corrected by a comparison with the linear value where the next code starts.
+/// The tables are built from convertSRGBToLinear and convertLinearToSRGB on first use.
+/// The AVX2 kernels look up 2 pixels at once with gather instructions.
+///
+/// The float sRGB conversions replace pow by the 22 bits approximation of
+/// GLM_GTX_approx_math. The YCoCg, YCoCg-R and HSV conversions follow the operations
+/// of the scalar functions, one pixel per SIMD lane, with selects instead of branches.
+/// The kernels are selected at runtime with GLM_GTX_simd_dispatch.
+///
+/// <glm/gtx/color_space_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/color_space.hpp"
+#include "../gtc/type_precision.hpp"
+#include "color_space.hpp"
+#include "color_space_YCoCg.hpp"
+#include "approx_math.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_color_space_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_color_space_batch
+	/// @{
+
+	/// Dst[i] = convertSRGBToLinear(vec4(Src[i]) / 255.0f) for Count 8 bit sRGB colors, the alpha being linear.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void convertSRGBToLinearBatch(u8vec4 const * Src, vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = u8vec4(round(clamp(convertLinearToSRGB(Src[i]), 0.0f, 1.0f) * 255.0f)) for Count linear colors,
+	/// the bytes of packUnorm4x8(convertLinearToSRGB(Src[i])).
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void convertLinearToSRGBBatch(vec4 const * Src, u8vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = convertSRGBToLinear(Src[i]) for Count sRGB colors, within 1e-6 from 0 to 1.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void convertSRGBToLinearBatch(vec4 const * Src, vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = convertLinearToSRGB(Src[i]) for Count linear colors, within 1e-6.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void convertLinearToSRGBBatch(vec4 const * Src, vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = rgb2YCoCg(Src[i]) for Count colors.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void rgb2YCoCgBatch(vec3 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = YCoCg2rgb(Src[i]) for Count colors.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void YCoCg2rgbBatch(vec3 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = rgb2YCoCgR(Src[i]) for Count colors.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void rgb2YCoCgRBatch(vec3 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = YCoCgR2rgb(Src[i]) for Count colors.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void YCoCgR2rgbBatch(vec3 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = hsvColor(Src[i]) for Count RGB colors.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void hsvColorBatch(vec3 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = rgbColor(Src[i]) for Count HSV colors.
+	/// @see gtx_color_space_batch
+	GLM_FUNC_DECL void rgbColorBatch(vec3 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "color_space_batch.inl"
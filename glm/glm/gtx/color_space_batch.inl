@@ -0,0 +1,578 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_color_space_batch
+/// @file glm/gtx/color_space_batch.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	//////////////////////////////////////
+	// 8 bit sRGB tables
+
+	// The encoding buckets split each octave from 2^-13 to 1 in 128, the code steps up
+	// at most once in a bucket. Below 2^-13 the code is 0.
+	static unsigned int const SrgbBucketBase = 0x39000000;
+	static int const SrgbBucketShift = 16;
+	static std::size_t const SrgbBucketCount = 13 * 128;
+	static float const SrgbEncodeMin = 1.220703125e-4f;
+	static float const SrgbEncodeMax = 0.99999994f;
+
+	struct srgb_tables
+	{
+		// Linear values of the 256 sRGB codes, followed by the 256 alpha values
+		float Decode[512];
+		// Code at the start of each bucket
+		int Codes[SrgbBucketCount];
+		// Smallest linear value encoded to the code + 1
+		float Thresholds[256];
+	};
+
+	GLM_FUNC_QUALIFIER int srgb_encode_reference(float x)
+	{
+		return static_cast<int>(glm::round(glm::clamp(convertLinearToSRGB(vec3(x)).x, 0.0f, 1.0f) * 255.0f));
+	}
+
+	GLM_FUNC_QUALIFIER srgb_tables srgb_build_tables()
+	{
+		srgb_tables Tables;
+
+		for(int i = 0; i < 256; ++i)
+		{
+			float const x = static_cast<float>(i) / 255.0f;
+			Tables.Decode[i] = convertSRGBToLinear(vec3(x)).x;
+			Tables.Decode[256 + i] = x;
+		}
+
+		// The conversion is monotonic, the thresholds are found by bisection of the bit patterns
+		for(int Code = 0; Code < 255; ++Code)
+		{
+			uint Low = floatBitsToUint(0.0f);
+			uint High = floatBitsToUint(1.0f);
+			while(High - Low > 1)
+			{
+				uint const Mid = Low + (High - Low) / 2;
+				if(srgb_encode_reference(uintBitsToFloat(Mid)) > Code)
+					High = Mid;
+				else
+					Low = Mid;
+			}
+			Tables.Thresholds[Code] = uintBitsToFloat(High);
+		}
+		Tables.Thresholds[255] = 2.0f;
+
+		for(std::size_t i = 0; i < SrgbBucketCount; ++i)
+			Tables.Codes[i] = srgb_encode_reference(uintBitsToFloat(SrgbBucketBase + static_cast<uint>(i << SrgbBucketShift)));
+
+		return Tables;
+	}
+
+	GLM_FUNC_QUALIFIER srgb_tables const & srgb_get_tables()
+	{
+		static srgb_tables const Tables = srgb_build_tables();
+		return Tables;
+	}
+
+	GLM_FUNC_QUALIFIER u8 srgb_encode(srgb_tables const & Tables, float x)
+	{
+		// Written so that NaN gives the code 0
+		float const c = x > SrgbEncodeMin ? (x < SrgbEncodeMax ? x : SrgbEncodeMax) : SrgbEncodeMin;
+		int const Code = Tables.Codes[(floatBitsToUint(c) - SrgbBucketBase) >> SrgbBucketShift];
+		return static_cast<u8>(c >= Tables.Thresholds[Code] ? Code + 1 : Code);
+	}
+
+	//////////////////////////////////////
+	// Platform independent kernels
+
+	GLM_FUNC_QUALIFIER void srgb_decode_u8_pure(u8vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		srgb_tables const & Tables = srgb_get_tables();
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = vec4(Tables.Decode[Src[i].x], Tables.Decode[Src[i].y], Tables.Decode[Src[i].z], Tables.Decode[256 + Src[i].w]);
+	}
+
+	GLM_FUNC_QUALIFIER void srgb_encode_u8_pure(vec4 const * Src, u8vec4 * Dst, std::size_t Count)
+	{
+		srgb_tables const & Tables = srgb_get_tables();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Dst[i] = u8vec4(
+				srgb_encode(Tables, Src[i].x),
+				srgb_encode(Tables, Src[i].y),
+				srgb_encode(Tables, Src[i].z),
+				static_cast<u8>(glm::round(glm::clamp(Src[i].w, 0.0f, 1.0f) * 255.0f)));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void srgb_decode_pure(vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = convertSRGBToLinear(Src[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void srgb_encode_pure(vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = convertLinearToSRGB(Src[i]);
+	}
+
+	template <typename convertType>
+	GLM_FUNC_QUALIFIER void color_convert_pure(vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = convertType::call(Src[i]);
+	}
+
+#	if GLM_DISPATCH_X86
+	//////////////////////////////////////
+	// SSE2 kernels, one pixel per register
+
+	GLM_FUNC_QUALIFIER __m128 srgb_decode_sse2(__m128 x)
+	{
+		__m128 const Power = approx_pow_sse2<2>(_mm_mul_ps(_mm_add_ps(x, _mm_set1_ps(0.055f)), _mm_set1_ps(0.94786729857819905213270142180095f)), _mm_set1_ps(2.4f));
+		__m128 const Linear = _mm_mul_ps(x, _mm_set1_ps(0.07739938080495356037151702786378f));
+		return approx_select_sse2(_mm_cmple_ps(x, _mm_set1_ps(0.04045f)), Linear, Power);
+	}
+
+	GLM_FUNC_QUALIFIER __m128 srgb_encode_sse2(__m128 x)
+	{
+		__m128 const c = _mm_min_ps(_mm_max_ps(x, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+		__m128 const Power = _mm_sub_ps(_mm_mul_ps(approx_pow_sse2<2>(c, _mm_set1_ps(0.41666f)), _mm_set1_ps(1.055f)), _mm_set1_ps(0.055f));
+		__m128 const Linear = _mm_mul_ps(c, _mm_set1_ps(12.92f));
+		return approx_select_sse2(_mm_cmplt_ps(c, _mm_set1_ps(0.0031308f)), Linear, Power);
+	}
+
+	// The alpha is kept as is
+	template <__m128 (*Kernel)(__m128)>
+	GLM_FUNC_QUALIFIER void srgb_convert_sse2(vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		__m128 const Alpha = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			__m128 const x = _mm_loadu_ps(&Src[i].x);
+			_mm_storeu_ps(&Dst[i].x, approx_select_sse2(Alpha, x, Kernel(x)));
+		}
+	}
+
+	//////////////////////////////////////
+	// AVX2 kernels, two pixels per register
+
+	GLM_TARGET_AVX2 inline __m256 srgb_decode_avx2(__m256 x)
+	{
+		__m256 const Power = approx_pow_avx2<2>(_mm256_mul_ps(_mm256_add_ps(x, _mm256_set1_ps(0.055f)), _mm256_set1_ps(0.94786729857819905213270142180095f)), _mm256_set1_ps(2.4f));
+		__m256 const Linear = _mm256_mul_ps(x, _mm256_set1_ps(0.07739938080495356037151702786378f));
+		return _mm256_blendv_ps(Power, Linear, _mm256_cmp_ps(x, _mm256_set1_ps(0.04045f), _CMP_LE_OQ));
+	}
+
+	GLM_TARGET_AVX2 inline __m256 srgb_encode_avx2(__m256 x)
+	{
+		__m256 const c = _mm256_min_ps(_mm256_max_ps(x, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+		__m256 const Power = _mm256_sub_ps(_mm256_mul_ps(approx_pow_avx2<2>(c, _mm256_set1_ps(0.41666f)), _mm256_set1_ps(1.055f)), _mm256_set1_ps(0.055f));
+		__m256 const Linear = _mm256_mul_ps(c, _mm256_set1_ps(12.92f));
+		return _mm256_blendv_ps(Power, Linear, _mm256_cmp_ps(c, _mm256_set1_ps(0.0031308f), _CMP_LT_OQ));
+	}
+
+	template <__m256 (*Kernel)(__m256), __m128 (*KernelSSE2)(__m128)>
+	GLM_TARGET_AVX2 inline void srgb_convert_avx2(vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+		{
+			__m256 const x = _mm256_loadu_ps(&Src[i].x);
+			_mm256_storeu_ps(&Dst[i].x, _mm256_blend_ps(Kernel(x), x, 0x88));
+		}
+		srgb_convert_sse2<KernelSSE2>(Src + i, Dst + i, Count - i);
+	}
+
+	GLM_TARGET_AVX2 inline void srgb_decode_u8_avx2(u8vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		srgb_tables const & Tables = srgb_get_tables();
+
+		// The alpha lanes read the second half of the table
+		__m256i const Offset = _mm256_setr_epi32(0, 0, 0, 256, 0, 0, 0, 256);
+
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+		{
+			__m256i const Index = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(&Src[i]))), Offset);
+			_mm256_storeu_ps(&Dst[i].x, _mm256_i32gather_ps(Tables.Decode, Index, 4));
+		}
+		srgb_decode_u8_pure(Src + i, Dst + i, Count - i);
+	}
+
+	GLM_TARGET_AVX2 inline void srgb_encode_u8_avx2(vec4 const * Src, u8vec4 * Dst, std::size_t Count)
+	{
+		srgb_tables const & Tables = srgb_get_tables();
+
+		__m256 const Min = _mm256_set1_ps(SrgbEncodeMin);
+		__m256 const Max = _mm256_set1_ps(SrgbEncodeMax);
+		__m256i const Base = _mm256_set1_epi32(static_cast<int>(SrgbBucketBase));
+		__m256 const One = _mm256_set1_ps(1.0f);
+		__m256 const Half = _mm256_set1_ps(0.5f);
+
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+		{
+			__m256 const x = _mm256_loadu_ps(&Src[i].x);
+
+			// Code of the bucket, plus one from the threshold of the next code
+			__m256 const c = _mm256_min_ps(_mm256_max_ps(x, Min), Max);
+			__m256i const Bucket = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(c), Base), SrgbBucketShift);
+			__m256i const Code = _mm256_i32gather_epi32(Tables.Codes, Bucket, 4);
+			__m256 const Threshold = _mm256_i32gather_ps(Tables.Thresholds, Code, 4);
+			__m256i const Color = _mm256_sub_epi32(Code, _mm256_castps_si256(_mm256_cmp_ps(c, Threshold, _CMP_GE_OQ)));
+
+			// Alpha rounded half away from zero, like round
+			__m256 const a = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(x, _mm256_setzero_ps()), One), _mm256_set1_ps(255.0f));
+			__m256i const Trunc = _mm256_cvttps_epi32(a);
+			__m256i const Alpha = _mm256_sub_epi32(Trunc, _mm256_castps_si256(_mm256_cmp_ps(_mm256_sub_ps(a, _mm256_cvtepi32_ps(Trunc)), Half, _CMP_GE_OQ)));
+
+			__m256i const Codes = _mm256_blend_epi32(Color, Alpha, 0x88);
+			__m128i const Words = _mm_packus_epi32(_mm256_castsi256_si128(Codes), _mm256_extracti128_si256(Codes, 1));
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(&Dst[i]), _mm_packus_epi16(Words, Words));
+		}
+		srgb_encode_u8_pure(Src + i, Dst + i, Count - i);
+	}
+
+	//////////////////////////////////////
+	// Packet kernels, one pixel per lane
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void color_batch_load(vec3 const * Src, std::size_t Count, tvec3packet<packType> & Dst)
+	{
+		if(Count >= static_cast<std::size_t>(packType::lanes))
+			gather(Src, Dst);
+		else
+		{
+			vec3 Tail[packType::lanes];
+			for(length_t j = 0; j < packType::lanes; ++j)
+				Tail[j] = Src[static_cast<std::size_t>(j) < Count ? j : Count - 1];
+			gather(Tail, Dst);
+		}
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void color_batch_store(tvec3packet<packType> const & Src, std::size_t Count, vec3 * Dst)
+	{
+		if(Count >= static_cast<std::size_t>(packType::lanes))
+			scatter(Src, Dst);
+		else
+		{
+			vec3 Tail[packType::lanes];
+			scatter(Src, Tail);
+			for(std::size_t j = 0; j < Count; ++j)
+				Dst[j] = Tail[j];
+		}
+	}
+
+	template <typename convertType, typename packType>
+	GLM_FUNC_QUALIFIER void color_convert_packet(vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; i += static_cast<std::size_t>(packType::lanes))
+		{
+			std::size_t const Remain = Count - i;
+
+			tvec3packet<packType> c;
+			color_batch_load(Src + i, Remain, c);
+			color_batch_store(convertType::call_packet(c), Remain, Dst + i);
+		}
+	}
+#	endif//GLM_DISPATCH_X86
+
+	//////////////////////////////////////
+	// Conversion selection, scalar reference and packet implementation
+
+	struct color_rgb2YCoCg_func
+	{
+		GLM_FUNC_QUALIFIER static vec3 call(vec3 const & c)
+		{
+			return rgb2YCoCg(c);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec3packet<packType> call_packet(tvec3packet<packType> const & c)
+		{
+			packType const Quarter(0.25f);
+			packType const Half(0.5f);
+			return tvec3packet<packType>(
+				c.x * Quarter + c.y * Half + c.z * Quarter,
+				c.x * Half - c.z * Half,
+				-(c.x * Quarter) + c.y * Half - c.z * Quarter);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct color_YCoCg2rgb_func
+	{
+		GLM_FUNC_QUALIFIER static vec3 call(vec3 const & c)
+		{
+			return YCoCg2rgb(c);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec3packet<packType> call_packet(tvec3packet<packType> const & c)
+		{
+			return tvec3packet<packType>(
+				c.x + c.y - c.z,
+				c.x + c.z,
+				c.x - c.y - c.z);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct color_rgb2YCoCgR_func
+	{
+		GLM_FUNC_QUALIFIER static vec3 call(vec3 const & c)
+		{
+			return rgb2YCoCgR(c);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec3packet<packType> call_packet(tvec3packet<packType> const & c)
+		{
+			packType const Quarter(0.25f);
+			packType const Half(0.5f);
+			packType const rb(c.x + c.z);
+			return tvec3packet<packType>(
+				c.y * Half + rb * Quarter,
+				c.x - c.z,
+				c.y - rb * Half);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct color_YCoCgR2rgb_func
+	{
+		GLM_FUNC_QUALIFIER static vec3 call(vec3 const & c)
+		{
+			return YCoCgR2rgb(c);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec3packet<packType> call_packet(tvec3packet<packType> const & c)
+		{
+			packType const Half(0.5f);
+			packType const Tmp(c.x - c.z * Half);
+			packType const b(Tmp - c.y * Half);
+			return tvec3packet<packType>(b + c.y, c.z + Tmp, b);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct color_hsvColor_func
+	{
+		GLM_FUNC_QUALIFIER static vec3 call(vec3 const & c)
+		{
+			return hsvColor(c);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec3packet<packType> call_packet(tvec3packet<packType> const & c)
+		{
+			packType const Zero(0.0f);
+			packType const Sixty(60.0f);
+
+			packType const Min = min(min(c.x, c.y), c.z);
+			packType const Max = max(max(c.x, c.y), c.z);
+			packType const Delta = Max - Min;
+
+			packType h = select(c.x == Max, Sixty * (c.y - c.z) / Delta,
+				select(c.y == Max, packType(120.0f) + Sixty * (c.z - c.x) / Delta, packType(240.0f) + Sixty * (c.x - c.y) / Delta));
+			h = select(h < Zero, h + packType(360.0f), h);
+
+			// If r = g = b = 0 then s = 0, h is undefined
+			packType const Black = Max == Zero;
+			return tvec3packet<packType>(select(Black, Zero, h), select(Black, Zero, Delta / Max), Max);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct color_rgbColor_func
+	{
+		GLM_FUNC_QUALIFIER static vec3 call(vec3 const & c)
+		{
+			return rgbColor(c);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec3packet<packType> call_packet(tvec3packet<packType> const & c)
+		{
+			packType const One(1.0f);
+			packType const Sixty(60.0f);
+			packType const s(c.y);
+			packType const v(c.z);
+
+			packType const Sector = floor(c.x / Sixty);
+			packType const Frac = c.x / Sixty - Sector;
+			packType const o = v * (One - s);
+			packType const p = v * (One - s * Frac);
+			packType const q = v * (One - s * (One - Frac));
+
+			// The sectors out of [1, 5] take the colors of the sector 0, like the switch of rgbColor
+			tvec3packet<packType> Result(v, q, o);
+			Result = select(Sector == packType(1.0f), tvec3packet<packType>(p, v, o), Result);
+			Result = select(Sector == packType(2.0f), tvec3packet<packType>(o, v, q), Result);
+			Result = select(Sector == packType(3.0f), tvec3packet<packType>(o, p, v), Result);
+			Result = select(Sector == packType(4.0f), tvec3packet<packType>(q, o, v), Result);
+			Result = select(Sector == packType(5.0f), tvec3packet<packType>(v, o, p), Result);
+
+			// Achromatic, whatever the hue
+			return select(s == packType(0.0f), tvec3packet<packType>(v, v, v), Result);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	template <typename convertType>
+	struct color_convert_kernels
+	{
+		typedef void (*batch_func)(vec3 const *, vec3 *, std::size_t);
+
+		static batch_func select()
+		{
+#			if GLM_DISPATCH_X86
+				static batch_func const Table[SIMD_LEVEL_COUNT] = {
+					color_convert_pure<convertType>,
+					color_convert_packet<convertType, fpacket4SIMD>,
+					0,
+#					if GLM_ARCH & GLM_ARCH_AVX
+						color_convert_packet<convertType, fpacket8SIMD>,
+#					else
+						0,
+#					endif
+					0};
+#			else
+				static batch_func const Table[SIMD_LEVEL_COUNT] = {color_convert_pure<convertType>, 0, 0, 0, 0};
+#			endif//GLM_DISPATCH_X86
+			return simd_select(Table);
+		}
+	};
+
+	typedef void (*srgb_decode_u8_func)(u8vec4 const *, vec4 *, std::size_t);
+	typedef void (*srgb_encode_u8_func)(vec4 const *, u8vec4 *, std::size_t);
+	typedef void (*srgb_convert_func)(vec4 const *, vec4 *, std::size_t);
+
+	GLM_FUNC_QUALIFIER srgb_decode_u8_func srgb_decode_u8_select()
+	{
+#		if GLM_DISPATCH_X86
+			// Without gather instructions the table lookups of the 8 bit conversions stay scalar below AVX2
+			static srgb_decode_u8_func const Table[SIMD_LEVEL_COUNT] = {srgb_decode_u8_pure, 0, 0, 0, srgb_decode_u8_avx2};
+#		else
+			static srgb_decode_u8_func const Table[SIMD_LEVEL_COUNT] = {srgb_decode_u8_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER srgb_encode_u8_func srgb_encode_u8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static srgb_encode_u8_func const Table[SIMD_LEVEL_COUNT] = {srgb_encode_u8_pure, 0, 0, 0, srgb_encode_u8_avx2};
+#		else
+			static srgb_encode_u8_func const Table[SIMD_LEVEL_COUNT] = {srgb_encode_u8_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER srgb_convert_func srgb_decode_select()
+	{
+#		if GLM_DISPATCH_X86
+			static srgb_convert_func const Table[SIMD_LEVEL_COUNT] = {
+				srgb_decode_pure, srgb_convert_sse2<srgb_decode_sse2>, 0, 0, srgb_convert_avx2<srgb_decode_avx2, srgb_decode_sse2>};
+#		else
+			static srgb_convert_func const Table[SIMD_LEVEL_COUNT] = {srgb_decode_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER srgb_convert_func srgb_encode_select()
+	{
+#		if GLM_DISPATCH_X86
+			static srgb_convert_func const Table[SIMD_LEVEL_COUNT] = {
+				srgb_encode_pure, srgb_convert_sse2<srgb_encode_sse2>, 0, 0, srgb_convert_avx2<srgb_encode_avx2, srgb_encode_sse2>};
+#		else
+			static srgb_convert_func const Table[SIMD_LEVEL_COUNT] = {srgb_encode_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void convertSRGBToLinearBatch(u8vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		detail::srgb_decode_u8_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void convertLinearToSRGBBatch(vec4 const * Src, u8vec4 * Dst, std::size_t Count)
+	{
+		detail::srgb_encode_u8_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void convertSRGBToLinearBatch(vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		detail::srgb_decode_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void convertLinearToSRGBBatch(vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		detail::srgb_encode_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void rgb2YCoCgBatch(vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::color_convert_kernels<detail::color_rgb2YCoCg_func>::select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void YCoCg2rgbBatch(vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::color_convert_kernels<detail::color_YCoCg2rgb_func>::select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void rgb2YCoCgRBatch(vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::color_convert_kernels<detail::color_rgb2YCoCgR_func>::select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void YCoCgR2rgbBatch(vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::color_convert_kernels<detail::color_YCoCgR2rgb_func>::select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void hsvColorBatch(vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::color_convert_kernels<detail::color_hsvColor_func>::select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void rgbColorBatch(vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::color_convert_kernels<detail::color_rgbColor_func>::select()(Src, Dst, Count);
+	}
+}//namespace glm
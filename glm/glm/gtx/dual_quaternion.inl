@@ -47,14 +47,14 @@ namespace glm
 		template <typename T, precision P>
 		GLM_FUNC_QUALIFIER typename tdualquat<T, P>::part_type & tdualquat<T, P>::operator[](typename tdualquat<T, P>::size_type i)
 		{
-			assert(i >= 0 && static_cast<detail::component_count_t>(i) < detail::component_count(*this));
+			assert(static_cast<detail::component_count_t>(i) < detail::component_count(*this));
 			return (&real)[i];
 		}
 
 		template <typename T, precision P>
 		GLM_FUNC_QUALIFIER typename tdualquat<T, P>::part_type const & tdualquat<T, P>::operator[](typename tdualquat<T, P>::size_type i) const
 		{
-			assert(i >= 0 && static_cast<detail::component_count_t>(i) < detail::component_count(*this));
+			assert(static_cast<detail::component_count_t>(i) < detail::component_count(*this));
 			return (&real)[i];
 		}
 #	else
@@ -68,13 +68,18 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_QUALIFIER T fastExp(T x)
 	{
-		// This has a better looking and same performance in release mode than the following code. However, in debug mode it's slower.
-		// return 1.0f + x * (1.0f + x * 0.5f * (1.0f + x * 0.3333333333f * (1.0f + x * 0.25 * (1.0f + x * 0.2f))));
-		T x2 = x * x;
-		T x3 = x2 * x;
-		T x4 = x3 * x;
-		T x5 = x4 * x;
-		return T(1) + x + (x2 * T(0.5)) + (x3 * T(0.1666666667)) + (x4 * T(0.041666667)) + (x5 * T(0.008333333333));
+#		if GLM_HAS_FMA
+			// Horner scheme, each step is a fused multiply-add
+			return fma(x, fma(x, fma(x, fma(x, fma(x, T(0.008333333333), T(0.041666667)), T(0.1666666667)), T(0.5)), T(1)), T(1));
+#		else
+			// This has a better looking and same performance in release mode than the following code. However, in debug mode it's slower.
+			// return 1.0f + x * (1.0f + x * 0.5f * (1.0f + x * 0.3333333333f * (1.0f + x * 0.25 * (1.0f + x * 0.2f))));
+			T x2 = x * x;
+			T x3 = x2 * x;
+			T x4 = x3 * x;
+			T x5 = x4 * x;
+			return T(1) + x + (x2 * T(0.5)) + (x3 * T(0.1666666667)) + (x4 * T(0.041666667)) + (x5 * T(0.008333333333));
+#		endif
 	}
 	/*  // Try to handle all values of float... but often shower than std::exp, glm::floor and the loop kill the performance
 	GLM_FUNC_QUALIFIER float fastExp(float x)
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_fast_hash
+/// @file glm/gtx/fast_hash.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_fast_hash GLM_GTX_fast_hash
+/// @ingroup gtx
+///
+/// @brief 64 bits hashing of vectors, matrices and quaternions for large hash tables.
+///
+/// The components are hashed as raw bytes, 8 bytes per round with multiplications
+/// and rotations, followed by a finalizer so that every bit of the key changes half
+/// of the bits of the hash. The low bits are therefore usable directly as indices of
+/// power of two tables, which std::hash<float> of libstdc++, the identity on the bits,
+/// combined with GLM_GTX_hash does not allow for lattice keys.
+/// Floating point components are canonicalized first: -0 hashes as +0 and all the
+/// NaNs hash the same, consistently with the keys comparing equal with ==, NaNs aside.
+///
+/// The quantized hashes hash the cell of a grid of spacing Epsilon containing a
+/// vector, for vertex welding: vectors in the same cell are merged. Vectors closer than
+/// Epsilon on both sides of a cell boundary are not, exact welding looks up the
+/// neighboring cells obtained with quantizeCell.
+///
+/// The batch functions of arrays of vectors of 3 or 4 components of 32 bits hash
+/// 4 vectors at once with AVX2, selected at runtime with GLM_GTX_simd_dispatch.
+/// The hashes don't depend on the instruction set but on the byte order of the platform.
+///
+/// <glm/gtx/fast_hash.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_fast_hash extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_fast_hash
+	/// @{
+
+	/// Returns the 64 bits hash of a vector, a matrix or a quaternion.
+	/// @see gtx_fast_hash
+	template <typename genType>
+	GLM_FUNC_DECL uint64 fastHash(genType const & x, uint64 Seed = 0);
+
+	/// Returns the cell of the grid of spacing Epsilon containing v, floor(v / Epsilon) clamped to the range of int.
+	/// Epsilon must be positive and the components of v must not be NaN.
+	/// @see gtx_fast_hash
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<int, P> quantizeCell(vecType<T, P> const & v, T Epsilon);
+
+	/// Returns fastHash(quantizeCell(v, Epsilon), Seed).
+	/// @see gtx_fast_hash
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL uint64 quantizedHash(vecType<T, P> const & v, T Epsilon, uint64 Seed = 0);
+
+	/// Hashes[i] = fastHash(Src[i], Seed) for Count values.
+	/// @see gtx_fast_hash
+	template <typename genType>
+	GLM_FUNC_DECL void fastHashBatch(genType const * Src, uint64 * Hashes, std::size_t Count, uint64 Seed = 0);
+
+	/// Hashes[i] = quantizedHash(Src[i], Epsilon, Seed) for Count vectors.
+	/// @see gtx_fast_hash
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL void quantizedHashBatch(vecType<T, P> const * Src, T Epsilon, uint64 * Hashes, std::size_t Count, uint64 Seed = 0);
+
+	/// Hash function object using fastHash, for std::unordered_map and std::unordered_set.
+	/// @see gtx_fast_hash
+	template <typename genType>
+	struct fast_hash
+	{
+		GLM_FUNC_DECL std::size_t operator()(genType const & x) const;
+	};
+
+	/// Hash function object using quantizedHash, to be used with quantized_equal of the same Epsilon.
+	/// @see gtx_fast_hash
+	template <typename genType>
+	struct quantized_hash
+	{
+		typedef typename genType::value_type value_type;
+
+		GLM_FUNC_DECL explicit quantized_hash(value_type Epsilon);
+		GLM_FUNC_DECL std::size_t operator()(genType const & v) const;
+
+		value_type Epsilon;
+	};
+
+	/// Equality function object comparing the quantizeCell of two vectors.
+	/// @see gtx_fast_hash
+	template <typename genType>
+	struct quantized_equal
+	{
+		typedef typename genType::value_type value_type;
+
+		GLM_FUNC_DECL explicit quantized_equal(value_type Epsilon);
+		GLM_FUNC_DECL bool operator()(genType const & a, genType const & b) const;
+
+		value_type Epsilon;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "fast_hash.inl"
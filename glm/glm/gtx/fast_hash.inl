@@ -0,0 +1,415 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_fast_hash
+/// @file glm/gtx/fast_hash.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Constants of the 128 bits MurmurHash3 rounds and of the moremur finalizer
+	static uint64 const HashSizeMult = 0x9E3779B97F4A7C15ull;
+	static uint64 const HashRoundMult1 = 0x87C37B91114253D5ull;
+	static uint64 const HashRoundMult2 = 0x4CF5AD432745937Full;
+	static uint64 const HashRoundAdd = 0x52DCE729ull;
+	static uint64 const HashFinalMult1 = 0x3C79AC492BA7B653ull;
+	static uint64 const HashFinalMult2 = 0x1C69B3F74AC4AE35ull;
+
+	GLM_FUNC_QUALIFIER uint64 hash_round(uint64 h, uint64 k)
+	{
+		// The word is mixed before being combined so that words don't cancel each other
+		k *= HashRoundMult1;
+		k = (k << 31) | (k >> 33);
+		k *= HashRoundMult2;
+		h ^= k;
+		h = (h << 27) | (h >> 37);
+		return h * 5 + HashRoundAdd;
+	}
+
+	GLM_FUNC_QUALIFIER uint64 hash_finalize(uint64 h)
+	{
+		h ^= h >> 27;
+		h *= HashFinalMult1;
+		h ^= h >> 33;
+		h *= HashFinalMult2;
+		h ^= h >> 27;
+		return h;
+	}
+
+	template <std::size_t Size>
+	GLM_FUNC_QUALIFIER uint64 hash_bytes(void const * Data, uint64 Seed)
+	{
+		unsigned char const * Bytes = static_cast<unsigned char const *>(Data);
+
+		uint64 h = Seed ^ (Size * HashSizeMult);
+		for(std::size_t i = 0; i + 8 <= Size; i += 8)
+		{
+			uint64 k;
+			std::memcpy(&k, Bytes + i, 8);
+			h = hash_round(h, k);
+		}
+		if(Size % 8)
+		{
+			uint64 k = 0;
+			std::memcpy(&k, Bytes + Size / 8 * 8, Size % 8);
+			h = hash_round(h, k);
+		}
+		return hash_finalize(h);
+	}
+
+	template <std::size_t Size>
+	struct hash_uint
+	{};
+
+	template <>
+	struct hash_uint<4>
+	{
+		typedef uint32 type;
+	};
+
+	template <>
+	struct hash_uint<8>
+	{
+		typedef uint64 type;
+	};
+
+	template <typename T, bool IsFloat = std::numeric_limits<T>::is_iec559>
+	struct hash_canonical
+	{
+		typedef T type;
+
+		GLM_FUNC_QUALIFIER static type call(T x)
+		{
+			return x;
+		}
+	};
+
+	// -0 becomes +0 and the NaNs the quiet NaN. Done on the bits so that it survives fast math options.
+	template <typename T>
+	struct hash_canonical<T, true>
+	{
+		typedef typename hash_uint<sizeof(T)>::type type;
+
+		GLM_FUNC_QUALIFIER static type call(T x)
+		{
+			T const Infinity = std::numeric_limits<T>::infinity();
+			T const NaN = std::numeric_limits<T>::quiet_NaN();
+
+			type Bits, InfinityBits, NaNBits;
+			std::memcpy(&Bits, &x, sizeof(T));
+			std::memcpy(&InfinityBits, &Infinity, sizeof(T));
+			std::memcpy(&NaNBits, &NaN, sizeof(T));
+
+			type const Abs = Bits & (~type(0) >> 1);
+			return Abs == 0 ? type(0) : (Abs > InfinityBits ? NaNBits : Bits);
+		}
+	};
+
+	template <typename T, std::size_t N>
+	GLM_FUNC_QUALIFIER uint64 hash_components(T const * Data, uint64 Seed)
+	{
+		typename hash_canonical<T>::type Canonical[N];
+		for(std::size_t i = 0; i < N; ++i)
+			Canonical[i] = hash_canonical<T>::call(Data[i]);
+		return hash_bytes<sizeof(Canonical)>(Canonical, Seed);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER int quantize_component(T x, T Epsilon)
+	{
+		// The largest float below 2^31 is 2^31 - 128
+		return static_cast<int>(clamp(floor(x / Epsilon), static_cast<T>(-2147483648.0), static_cast<T>(2147483520.0)));
+	}
+
+	//////////////////////////////////////
+	// Batch kernels of 3 or 4 components of 32 bits
+
+	enum hash32_mode
+	{
+		HASH32_RAW,			// Integers
+		HASH32_CANONICAL,	// Floats
+		HASH32_QUANTIZED	// Cells of floats
+	};
+
+	template <std::size_t N, hash32_mode Mode>
+	inline void hash32_pure(void const * Src, uint64 * Hashes, std::size_t Count, uint64 Seed, float Epsilon)
+	{
+		unsigned char const * Bytes = static_cast<unsigned char const *>(Src);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			uint32 Words[N];
+			if(Mode == HASH32_RAW)
+				std::memcpy(Words, Bytes + i * N * 4, N * 4);
+			else
+			{
+				float Components[N];
+				std::memcpy(Components, Bytes + i * N * 4, N * 4);
+				for(std::size_t j = 0; j < N; ++j)
+				{
+					if(Mode == HASH32_CANONICAL)
+						Words[j] = hash_canonical<float>::call(Components[j]);
+					else
+						Words[j] = static_cast<uint32>(quantize_component(Components[j], Epsilon));
+				}
+			}
+			Hashes[i] = hash_bytes<N * 4>(Words, Seed);
+		}
+	}
+
+#	if GLM_DISPATCH_X86
+	// 64 bits multiplication from three 32 x 32 bits ones, AVX2 doesn't have a 64 bits one
+	GLM_TARGET_AVX2 inline __m256i hash_mul_avx2(__m256i a, uint64 b)
+	{
+		__m256i const Low = _mm256_set1_epi64x(static_cast<long long>(b & 0xFFFFFFFFull));
+		__m256i const High = _mm256_set1_epi64x(static_cast<long long>(b >> 32));
+		__m256i const Cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), Low), _mm256_mul_epu32(a, High));
+		return _mm256_add_epi64(_mm256_mul_epu32(a, Low), _mm256_slli_epi64(Cross, 32));
+	}
+
+	GLM_TARGET_AVX2 inline __m256i hash_round_avx2(__m256i h, __m256i k)
+	{
+		k = hash_mul_avx2(k, HashRoundMult1);
+		k = _mm256_or_si256(_mm256_slli_epi64(k, 31), _mm256_srli_epi64(k, 33));
+		k = hash_mul_avx2(k, HashRoundMult2);
+		h = _mm256_xor_si256(h, k);
+		h = _mm256_or_si256(_mm256_slli_epi64(h, 27), _mm256_srli_epi64(h, 37));
+		h = _mm256_add_epi64(h, _mm256_slli_epi64(h, 2));
+		return _mm256_add_epi64(h, _mm256_set1_epi64x(static_cast<long long>(HashRoundAdd)));
+	}
+
+	GLM_TARGET_AVX2 inline __m256i hash_finalize_avx2(__m256i h)
+	{
+		h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 27));
+		h = hash_mul_avx2(h, HashFinalMult1);
+		h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 33));
+		h = hash_mul_avx2(h, HashFinalMult2);
+		return _mm256_xor_si256(h, _mm256_srli_epi64(h, 27));
+	}
+
+	template <hash32_mode Mode>
+	GLM_TARGET_AVX2 inline __m256i hash32_words_avx2(__m256i x, __m256 Epsilon)
+	{
+		if(Mode == HASH32_CANONICAL)
+		{
+			__m256i const Abs = _mm256_and_si256(x, _mm256_set1_epi32(0x7FFFFFFF));
+			__m256i const IsZero = _mm256_cmpeq_epi32(Abs, _mm256_setzero_si256());
+			__m256i const IsNaN = _mm256_cmpgt_epi32(Abs, _mm256_set1_epi32(static_cast<int>(hash_canonical<float>::call(std::numeric_limits<float>::infinity()))));
+			x = _mm256_andnot_si256(IsZero, x);
+			return _mm256_blendv_epi8(x, _mm256_set1_epi32(static_cast<int>(hash_canonical<float>::call(std::numeric_limits<float>::quiet_NaN()))), IsNaN);
+		}
+		else if(Mode == HASH32_QUANTIZED)
+		{
+			__m256 const Cell = _mm256_floor_ps(_mm256_div_ps(_mm256_castsi256_ps(x), Epsilon));
+			__m256 const Clamped = _mm256_min_ps(_mm256_max_ps(Cell, _mm256_set1_ps(-2147483648.0f)), _mm256_set1_ps(2147483520.0f));
+			return _mm256_cvttps_epi32(Clamped);
+		}
+		return x;
+	}
+
+	// 4 keys per iteration, the two 64 bits words of each key in the lanes of two registers
+	template <std::size_t N, hash32_mode Mode>
+	GLM_TARGET_AVX2 inline void hash32_avx2(void const * Src, uint64 * Hashes, std::size_t Count, uint64 Seed, float Epsilon)
+	{
+		int const * Words = static_cast<int const *>(Src);
+		__m256 const Eps = _mm256_set1_ps(Epsilon);
+		__m256i const Init = _mm256_set1_epi64x(static_cast<long long>(Seed ^ (N * 4 * HashSizeMult)));
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			__m256i Word0, Word1;
+			if(N == 3)
+			{
+				// a: keys 0 to 2 and x of 3, b: y of 1 to key 3
+				__m256i const a = hash32_words_avx2<Mode>(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(Words + i * 3)), Eps);
+				__m256i const b = hash32_words_avx2<Mode>(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(Words + i * 3 + 4)), Eps);
+				Word0 = _mm256_blend_epi32(
+					_mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(0, 1, 3, 4, 6, 7, 0, 0)),
+					_mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 5, 6)), 0xC0);
+				Word1 = _mm256_blend_epi32(
+					_mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(2, 0, 5, 0, 0, 0, 0, 0)),
+					_mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(0, 0, 0, 0, 4, 0, 7, 0)), 0xF0);
+				Word1 = _mm256_and_si256(Word1, _mm256_set1_epi64x(0xFFFFFFFFll));
+			}
+			else
+			{
+				__m256i const a = hash32_words_avx2<Mode>(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(Words + i * 4)), Eps);
+				__m256i const b = hash32_words_avx2<Mode>(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(Words + i * 4 + 8)), Eps);
+				Word0 = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xD8);
+				Word1 = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), 0xD8);
+			}
+
+			__m256i h = hash_round_avx2(Init, Word0);
+			h = hash_round_avx2(h, Word1);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(Hashes + i), hash_finalize_avx2(h));
+		}
+
+		hash32_pure<N, Mode>(Words + i * N, Hashes + i, Count - i, Seed, Epsilon);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <std::size_t N, hash32_mode Mode>
+	struct hash32_kernels
+	{
+		typedef void (*batch_func)(void const *, uint64 *, std::size_t, uint64, float);
+
+		static batch_func select()
+		{
+#			if GLM_DISPATCH_X86
+				// Without 64 bits multiplications, SSE2 isn't faster than the scalar code
+				static batch_func const Table[SIMD_LEVEL_COUNT] = {hash32_pure<N, Mode>, 0, 0, 0, hash32_avx2<N, Mode>};
+#			else
+				static batch_func const Table[SIMD_LEVEL_COUNT] = {hash32_pure<N, Mode>, 0, 0, 0, 0};
+#			endif//GLM_DISPATCH_X86
+			return simd_select(Table);
+		}
+	};
+
+	template <typename genType, std::size_t ComponentSize = sizeof(typename genType::value_type), std::size_t Size = sizeof(genType)>
+	struct compute_fastHashBatch
+	{
+		GLM_FUNC_QUALIFIER static void call(genType const * Src, uint64 * Hashes, std::size_t Count, uint64 Seed)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Hashes[i] = fastHash(Src[i], Seed);
+		}
+	};
+
+	template <typename genType, std::size_t Size>
+	struct compute_fastHashBatch32
+	{
+		GLM_FUNC_QUALIFIER static void call(genType const * Src, uint64 * Hashes, std::size_t Count, uint64 Seed)
+		{
+			static hash32_mode const Mode = std::numeric_limits<typename genType::value_type>::is_iec559 ? HASH32_CANONICAL : HASH32_RAW;
+			hash32_kernels<Size / 4, Mode>::select()(Src, Hashes, Count, Seed, 0.0f);
+		}
+	};
+
+	template <typename genType>
+	struct compute_fastHashBatch<genType, 4, 12> : public compute_fastHashBatch32<genType, 12>
+	{};
+
+	template <typename genType>
+	struct compute_fastHashBatch<genType, 4, 16> : public compute_fastHashBatch32<genType, 16>
+	{};
+
+	template <typename T, precision P, template <typename, precision> class vecType, typename floatType = T, std::size_t Size = sizeof(vecType<T, P>)>
+	struct compute_quantizedHashBatch
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<T, P> const * Src, T Epsilon, uint64 * Hashes, std::size_t Count, uint64 Seed)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Hashes[i] = quantizedHash(Src[i], Epsilon, Seed);
+		}
+	};
+
+	template <precision P, template <typename, precision> class vecType>
+	struct compute_quantizedHashBatch<float, P, vecType, float, 12>
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<float, P> const * Src, float Epsilon, uint64 * Hashes, std::size_t Count, uint64 Seed)
+		{
+			hash32_kernels<3, HASH32_QUANTIZED>::select()(Src, Hashes, Count, Seed, Epsilon);
+		}
+	};
+
+	template <precision P, template <typename, precision> class vecType>
+	struct compute_quantizedHashBatch<float, P, vecType, float, 16>
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<float, P> const * Src, float Epsilon, uint64 * Hashes, std::size_t Count, uint64 Seed)
+		{
+			hash32_kernels<4, HASH32_QUANTIZED>::select()(Src, Hashes, Count, Seed, Epsilon);
+		}
+	};
+}//namespace detail
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER uint64 fastHash(genType const & x, uint64 Seed)
+	{
+		typedef typename genType::value_type T;
+		return detail::hash_components<T, sizeof(genType) / sizeof(T)>(reinterpret_cast<T const *>(&x), Seed);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<int, P> quantizeCell(vecType<T, P> const & v, T Epsilon)
+	{
+		vecType<int, P> Result;
+		for(detail::component_count_t i = 0; i < detail::component_count(v); ++i)
+			Result[i] = detail::quantize_component(v[i], Epsilon);
+		return Result;
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER uint64 quantizedHash(vecType<T, P> const & v, T Epsilon, uint64 Seed)
+	{
+		return fastHash(quantizeCell(v, Epsilon), Seed);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void fastHashBatch(genType const * Src, uint64 * Hashes, std::size_t Count, uint64 Seed)
+	{
+		detail::compute_fastHashBatch<genType>::call(Src, Hashes, Count, Seed);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void quantizedHashBatch(vecType<T, P> const * Src, T Epsilon, uint64 * Hashes, std::size_t Count, uint64 Seed)
+	{
+		detail::compute_quantizedHashBatch<T, P, vecType>::call(Src, Epsilon, Hashes, Count, Seed);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER std::size_t fast_hash<genType>::operator()(genType const & x) const
+	{
+		return static_cast<std::size_t>(fastHash(x));
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER quantized_hash<genType>::quantized_hash(value_type e)
+		: Epsilon(e)
+	{}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER std::size_t quantized_hash<genType>::operator()(genType const & v) const
+	{
+		return static_cast<std::size_t>(quantizedHash(v, Epsilon));
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER quantized_equal<genType>::quantized_equal(value_type e)
+		: Epsilon(e)
+	{}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool quantized_equal<genType>::operator()(genType const & a, genType const & b) const
+	{
+		return quantizeCell(a, Epsilon) == quantizeCell(b, Epsilon);
+	}
+}//namespace glm
@@ -47,7 +47,7 @@ namespace detail
 	GLM_FUNC_QUALIFIER T cos_52s(T x)
 	{
 		T const xx(x * x);
-		return (T(0.9999932946) + xx * (T(-0.4999124376) + xx * (T(0.0414877472) + xx * T(-0.0012712095))));
+		return fma(xx, fma(xx, fma(xx, T(-0.0012712095), T(0.0414877472)), T(-0.4999124376)), T(0.9999932946));
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
@@ -109,7 +109,12 @@ namespace detail
 	template <typename T> 
 	GLM_FUNC_QUALIFIER T fastTan(T x)
 	{
-		return x + (x * x * x * T(0.3333333333)) + (x * x * x * x * x * T(0.1333333333333)) + (x * x * x * x * x * x * x * T(0.0539682539));
+#		if GLM_HAS_FMA
+			T const xx(x * x);
+			return x * fma(xx, fma(xx, fma(xx, T(0.0539682539), T(0.1333333333333)), T(0.3333333333)), T(1));
+#		else
+			return x + (x * x * x * T(0.3333333333)) + (x * x * x * x * x * T(0.1333333333333)) + (x * x * x * x * x * x * x * T(0.0539682539));
+#		endif
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
@@ -122,7 +127,12 @@ namespace detail
 	template <typename T> 
 	GLM_FUNC_QUALIFIER T fastAsin(T x)
 	{
-		return x + (x * x * x * T(0.166666667)) + (x * x * x * x * x * T(0.075)) + (x * x * x * x * x * x * x * T(0.0446428571)) + (x * x * x * x * x * x * x * x * x * T(0.0303819444));// + (x * x * x * x * x * x * x * x * x * x * x * T(0.022372159));
+#		if GLM_HAS_FMA
+			T const xx(x * x);
+			return x * fma(xx, fma(xx, fma(xx, fma(xx, T(0.0303819444), T(0.0446428571)), T(0.075)), T(0.166666667)), T(1));
+#		else
+			return x + (x * x * x * T(0.166666667)) + (x * x * x * x * x * T(0.075)) + (x * x * x * x * x * x * x * T(0.0446428571)) + (x * x * x * x * x * x * x * x * x * T(0.0303819444));// + (x * x * x * x * x * x * x * x * x * x * x * T(0.022372159));
+#		endif
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
@@ -161,7 +171,12 @@ namespace detail
 	template <typename T> 
 	GLM_FUNC_QUALIFIER T fastAtan(T x)
 	{
-		return x - (x * x * x * T(0.333333333333)) + (x * x * x * x * x * T(0.2)) - (x * x * x * x * x * x * x * T(0.1428571429)) + (x * x * x * x * x * x * x * x * x * T(0.111111111111)) - (x * x * x * x * x * x * x * x * x * x * x * T(0.0909090909));
+#		if GLM_HAS_FMA
+			T const xx(x * x);
+			return x * fma(xx, fma(xx, fma(xx, fma(xx, fma(xx, T(-0.0909090909), T(0.111111111111)), T(-0.1428571429)), T(0.2)), T(-0.333333333333)), T(1));
+#		else
+			return x - (x * x * x * T(0.333333333333)) + (x * x * x * x * x * T(0.2)) - (x * x * x * x * x * x * x * T(0.1428571429)) + (x * x * x * x * x * x * x * x * x * T(0.111111111111)) - (x * x * x * x * x * x * x * x * x * x * x * T(0.0909090909));
+#		endif
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
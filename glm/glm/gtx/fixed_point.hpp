@@ -0,0 +1,360 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_fixed_point
+/// @file glm/gtx/fixed_point.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_fixed_point GLM_GTX_fixed_point
+/// @ingroup gtx
+///
+/// @brief Q16.16 and Q8.8 fixed-point scalar, vector and matrix types with SIMD batch kernels.
+///
+/// tfixed stores a number multiplied by 2^FracBits in a signed integer, so that
+/// every operation is exact integer arithmetic, reproducible across compilers and
+/// platforms without a floating-point unit. Conversions and products round to
+/// nearest, ties up, quotients round to nearest, ties away from zero, and every
+/// operation saturates to the range of the storage instead of wrapping.
+///
+/// tvec2, tvec3, tvec4 and the square matrices are instantiated over fixed16_16
+/// and fixed8_8. dot, cross, length and the matrix products accumulate the exact
+/// products in a wider integer and round once. sqrt and reciprocal are correctly
+/// rounded, fastSqrt and fastReciprocal replace the bit by bit square root and the
+/// division by Newton-Raphson iterations, at most 1 unit of the last place away.
+///
+/// The saturating arithmetic of fixed16_16vec4 and fixed8_8vec4 and the fixed16_16mat4
+/// transforms have SSE2, SSE4.1 and AVX2 kernels selected at runtime with
+/// GLM_GTX_simd_dispatch, bit exact with the scalar operators. The vector and
+/// matrix types need unrestricted unions (C++11).
+///
+/// <glm/gtx/fixed_point.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/simd_dispatch.hpp"
+#include <cstddef>
+#include <limits>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_fixed_point extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	template <typename genIType>
+	struct fixed_wide
+	{};
+
+	template <>
+	struct fixed_wide<int16>
+	{
+		typedef int32 type;
+	};
+
+	template <>
+	struct fixed_wide<int32>
+	{
+		typedef int64 type;
+	};
+}//namespace detail
+
+	/// @addtogroup gtx_fixed_point
+	/// @{
+
+	/// Signed fixed-point number, value * 2^FracBits stored in genIType (int16 or int32).
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	struct tfixed
+	{
+		typedef genIType storage_type;
+		typedef typename detail::fixed_wide<genIType>::type wide_type;
+
+		/// The number multiplied by 2^FracBits
+		genIType value;
+
+		// -- Constructors --
+
+		GLM_FUNC_DECL tfixed();
+		GLM_FUNC_DECL explicit tfixed(int s);
+		GLM_FUNC_DECL explicit tfixed(float s);
+		GLM_FUNC_DECL explicit tfixed(double s);
+		template <typename U, int G>
+		GLM_FUNC_DECL explicit tfixed(tfixed<U, G> const & x);
+
+		/// Builds a number from its raw value.
+		GLM_FUNC_DECL static tfixed<genIType, FracBits> fromRaw(genIType Raw);
+
+		// -- Conversions --
+
+#		if GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+			GLM_FUNC_DECL explicit operator float() const;
+			GLM_FUNC_DECL explicit operator double() const;
+#		endif//GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+
+		// -- Arithmetic operators --
+
+		GLM_FUNC_DECL tfixed<genIType, FracBits> & operator+=(tfixed<genIType, FracBits> const & x);
+		GLM_FUNC_DECL tfixed<genIType, FracBits> & operator-=(tfixed<genIType, FracBits> const & x);
+		GLM_FUNC_DECL tfixed<genIType, FracBits> & operator*=(tfixed<genIType, FracBits> const & x);
+		GLM_FUNC_DECL tfixed<genIType, FracBits> & operator/=(tfixed<genIType, FracBits> const & x);
+	};
+
+	typedef tfixed<int32, 16>					fixed16_16;
+	typedef tfixed<int16, 8>					fixed8_8;
+
+	typedef tvec2<fixed16_16, defaultp>			fixed16_16vec2;
+	typedef tvec3<fixed16_16, defaultp>			fixed16_16vec3;
+	typedef tvec4<fixed16_16, defaultp>			fixed16_16vec4;
+	typedef tmat2x2<fixed16_16, defaultp>		fixed16_16mat2;
+	typedef tmat3x3<fixed16_16, defaultp>		fixed16_16mat3;
+	typedef tmat4x4<fixed16_16, defaultp>		fixed16_16mat4;
+
+	typedef tvec2<fixed8_8, defaultp>			fixed8_8vec2;
+	typedef tvec3<fixed8_8, defaultp>			fixed8_8vec3;
+	typedef tvec4<fixed8_8, defaultp>			fixed8_8vec4;
+	typedef tmat2x2<fixed8_8, defaultp>			fixed8_8mat2;
+	typedef tmat3x3<fixed8_8, defaultp>			fixed8_8mat3;
+	typedef tmat4x4<fixed8_8, defaultp>			fixed8_8mat4;
+
+	// -- Unary and binary operators --
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> operator-(tfixed<genIType, FracBits> const & x);
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> operator+(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> operator-(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	/// Product rounded to nearest, ties up.
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> operator*(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	/// Quotient rounded to nearest, ties away from zero. A division by zero saturates with the sign of x.
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> operator/(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL bool operator==(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL bool operator!=(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL bool operator<(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL bool operator<=(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL bool operator>(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL bool operator>=(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y);
+
+	// -- Common functions --
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> abs(tfixed<genIType, FracBits> x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> abs(vecType<tfixed<genIType, FracBits>, P> const & x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> floor(tfixed<genIType, FracBits> x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> floor(vecType<tfixed<genIType, FracBits>, P> const & x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> ceil(tfixed<genIType, FracBits> x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> ceil(vecType<tfixed<genIType, FracBits>, P> const & x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> min(tfixed<genIType, FracBits> x, tfixed<genIType, FracBits> y);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> min(vecType<tfixed<genIType, FracBits>, P> const & x, vecType<tfixed<genIType, FracBits>, P> const & y);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> max(tfixed<genIType, FracBits> x, tfixed<genIType, FracBits> y);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> max(vecType<tfixed<genIType, FracBits>, P> const & x, vecType<tfixed<genIType, FracBits>, P> const & y);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> clamp(tfixed<genIType, FracBits> x, tfixed<genIType, FracBits> minVal, tfixed<genIType, FracBits> maxVal);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> clamp(vecType<tfixed<genIType, FracBits>, P> const & x, vecType<tfixed<genIType, FracBits>, P> const & minVal, vecType<tfixed<genIType, FracBits>, P> const & maxVal);
+
+	// -- Square root and reciprocal --
+
+	/// Square root rounded to nearest, 0 for negative numbers.
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> sqrt(tfixed<genIType, FracBits> x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> sqrt(vecType<tfixed<genIType, FracBits>, P> const & x);
+
+	/// Square root without the bit by bit loop, at most 1 unit of the last place away from sqrt.
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> fastSqrt(tfixed<genIType, FracBits> x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> fastSqrt(vecType<tfixed<genIType, FracBits>, P> const & x);
+
+	/// 1 / x rounded to nearest, saturated for 0.
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> reciprocal(tfixed<genIType, FracBits> x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> reciprocal(vecType<tfixed<genIType, FracBits>, P> const & x);
+
+	/// 1 / x without division, at most 1 unit of the last place away from reciprocal.
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> fastReciprocal(tfixed<genIType, FracBits> x);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<tfixed<genIType, FracBits>, P> fastReciprocal(vecType<tfixed<genIType, FracBits>, P> const & x);
+
+	// -- Geometric functions --
+
+	/// Sum of the products accumulated in the wide integer, rounded once.
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> dot(tvec2<tfixed<genIType, FracBits>, P> const & x, tvec2<tfixed<genIType, FracBits>, P> const & y);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> dot(tvec3<tfixed<genIType, FracBits>, P> const & x, tvec3<tfixed<genIType, FracBits>, P> const & y);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> dot(tvec4<tfixed<genIType, FracBits>, P> const & x, tvec4<tfixed<genIType, FracBits>, P> const & y);
+
+	/// Each component is rounded once.
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tvec3<tfixed<genIType, FracBits>, P> cross(tvec3<tfixed<genIType, FracBits>, P> const & x, tvec3<tfixed<genIType, FracBits>, P> const & y);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL tfixed<genIType, FracBits> length(vecType<tfixed<genIType, FracBits>, P> const & x);
+
+	// -- Matrix products --
+
+	/// Each component is a dot product, rounded once.
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tvec2<tfixed<genIType, FracBits>, P> operator*(tmat2x2<tfixed<genIType, FracBits>, P> const & m, tvec2<tfixed<genIType, FracBits>, P> const & v);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tvec3<tfixed<genIType, FracBits>, P> operator*(tmat3x3<tfixed<genIType, FracBits>, P> const & m, tvec3<tfixed<genIType, FracBits>, P> const & v);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tvec4<tfixed<genIType, FracBits>, P> operator*(tmat4x4<tfixed<genIType, FracBits>, P> const & m, tvec4<tfixed<genIType, FracBits>, P> const & v);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tmat2x2<tfixed<genIType, FracBits>, P> operator*(tmat2x2<tfixed<genIType, FracBits>, P> const & m1, tmat2x2<tfixed<genIType, FracBits>, P> const & m2);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tmat3x3<tfixed<genIType, FracBits>, P> operator*(tmat3x3<tfixed<genIType, FracBits>, P> const & m1, tmat3x3<tfixed<genIType, FracBits>, P> const & m2);
+
+	/// @see gtx_fixed_point
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_DECL tmat4x4<tfixed<genIType, FracBits>, P> operator*(tmat4x4<tfixed<genIType, FracBits>, P> const & m1, tmat4x4<tfixed<genIType, FracBits>, P> const & m2);
+
+#	if GLM_HAS_UNRESTRICTED_UNIONS
+	// -- Batch kernels --
+
+	/// Dst[i] = A[i] + B[i], saturated, for Count vectors.
+	/// @see gtx_fixed_point
+	GLM_FUNC_DECL void addBatch(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] - B[i], saturated, for Count vectors.
+	/// @see gtx_fixed_point
+	GLM_FUNC_DECL void subBatch(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] * B[i], component-wise, for Count vectors.
+	/// @see gtx_fixed_point
+	GLM_FUNC_DECL void mulBatch(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = m * Src[i] for Count vectors.
+	/// @see gtx_fixed_point
+	GLM_FUNC_DECL void transformBatch(fixed16_16mat4 const & m, fixed16_16vec4 const * Src, fixed16_16vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] + B[i], saturated, for Count vectors.
+	/// @see gtx_fixed_point
+	GLM_FUNC_DECL void addBatch(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] - B[i], saturated, for Count vectors.
+	/// @see gtx_fixed_point
+	GLM_FUNC_DECL void subBatch(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] * B[i], component-wise, for Count vectors.
+	/// @see gtx_fixed_point
+	GLM_FUNC_DECL void mulBatch(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count);
+#	endif//GLM_HAS_UNRESTRICTED_UNIONS
+
+	/// @}
+}//namespace glm
+
+#include "fixed_point.inl"
@@ -0,0 +1,974 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_fixed_point
+/// @file glm/gtx/fixed_point.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	template <typename genIType, typename wideType>
+	GLM_FUNC_QUALIFIER genIType fixed_saturate(wideType x)
+	{
+		return x > static_cast<wideType>(std::numeric_limits<genIType>::max()) ? std::numeric_limits<genIType>::max() :
+			x < static_cast<wideType>(std::numeric_limits<genIType>::min()) ? std::numeric_limits<genIType>::min() :
+			static_cast<genIType>(x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> fixed_from_raw(typename tfixed<genIType, FracBits>::wide_type x)
+	{
+		return tfixed<genIType, FracBits>::fromRaw(fixed_saturate<genIType>(x));
+	}
+
+	// Rounds to nearest, ties up: Value >> Shift with Value = x * 2^Shift
+	template <typename wideType>
+	GLM_FUNC_QUALIFIER wideType fixed_round_shift(wideType x, int Shift)
+	{
+		return (x + (static_cast<wideType>(1) << (Shift - 1))) >> Shift;
+	}
+
+	// Sum of the products of the components, each product is divided by 4 so that 4 of them fit in the wide type.
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> fixed_dot_round(typename tfixed<genIType, FracBits>::wide_type Sum)
+	{
+		return fixed_from_raw<genIType, FracBits>(fixed_round_shift(Sum, FracBits - 2));
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER typename tfixed<genIType, FracBits>::wide_type fixed_dot_term(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		typedef typename tfixed<genIType, FracBits>::wide_type wide_type;
+		return (static_cast<wide_type>(x.value) * static_cast<wide_type>(y.value)) >> 2;
+	}
+
+	// Integer square root of x, rounded to nearest
+	GLM_FUNC_QUALIFIER uint64 fixed_isqrt(uint64 x)
+	{
+		uint64 Result = 0;
+		uint64 Bit = static_cast<uint64>(1) << (findMSB(x) & ~1);
+		while(Bit)
+		{
+			if(x >= Result + Bit)
+			{
+				x -= Result + Bit;
+				Result = (Result >> 1) + Bit;
+			}
+			else
+				Result >>= 1;
+			Bit >>= 2;
+		}
+		return x > Result ? Result + 1 : Result;
+	}
+}//namespace detail
+
+	// -- Constructors --
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits>::tfixed()
+		: value(0)
+	{}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits>::tfixed(int s)
+		: value(detail::fixed_saturate<genIType>(static_cast<int64>(s) * (static_cast<int64>(1) << FracBits)))
+	{}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits>::tfixed(float s)
+	{
+		*this = tfixed<genIType, FracBits>(static_cast<double>(s));
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits>::tfixed(double s)
+	{
+		double const Scaled = std::floor(s * static_cast<double>(static_cast<int64>(1) << FracBits) + 0.5);
+		if(Scaled >= static_cast<double>(std::numeric_limits<genIType>::max()))
+			this->value = std::numeric_limits<genIType>::max();
+		else if(Scaled <= static_cast<double>(std::numeric_limits<genIType>::min()))
+			this->value = std::numeric_limits<genIType>::min();
+		else if(Scaled != Scaled)
+			this->value = 0;
+		else
+			this->value = static_cast<genIType>(Scaled);
+	}
+
+	template <typename genIType, int FracBits>
+	template <typename U, int G>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits>::tfixed(tfixed<U, G> const & x)
+	{
+		int64 const Raw = static_cast<int64>(x.value);
+		this->value = G > FracBits ?
+			detail::fixed_saturate<genIType>(detail::fixed_round_shift(Raw, G > FracBits ? G - FracBits : 1)) :
+			detail::fixed_saturate<genIType>(Raw * (static_cast<int64>(1) << (G > FracBits ? 0 : FracBits - G)));
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> tfixed<genIType, FracBits>::fromRaw(genIType Raw)
+	{
+		tfixed<genIType, FracBits> Result;
+		Result.value = Raw;
+		return Result;
+	}
+
+	// -- Conversions --
+
+#	if GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+		template <typename genIType, int FracBits>
+		GLM_FUNC_QUALIFIER tfixed<genIType, FracBits>::operator float() const
+		{
+			return static_cast<float>(this->value) * (1.0f / static_cast<float>(static_cast<int64>(1) << FracBits));
+		}
+
+		template <typename genIType, int FracBits>
+		GLM_FUNC_QUALIFIER tfixed<genIType, FracBits>::operator double() const
+		{
+			return static_cast<double>(this->value) * (1.0 / static_cast<double>(static_cast<int64>(1) << FracBits));
+		}
+#	endif//GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+
+	// -- Arithmetic operators --
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> & tfixed<genIType, FracBits>::operator+=(tfixed<genIType, FracBits> const & x)
+	{
+		return (*this = *this + x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> & tfixed<genIType, FracBits>::operator-=(tfixed<genIType, FracBits> const & x)
+	{
+		return (*this = *this - x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> & tfixed<genIType, FracBits>::operator*=(tfixed<genIType, FracBits> const & x)
+	{
+		return (*this = *this * x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> & tfixed<genIType, FracBits>::operator/=(tfixed<genIType, FracBits> const & x)
+	{
+		return (*this = *this / x);
+	}
+
+	// -- Unary and binary operators --
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> operator-(tfixed<genIType, FracBits> const & x)
+	{
+		typedef typename tfixed<genIType, FracBits>::wide_type wide_type;
+		return detail::fixed_from_raw<genIType, FracBits>(-static_cast<wide_type>(x.value));
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> operator+(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		typedef typename tfixed<genIType, FracBits>::wide_type wide_type;
+		return detail::fixed_from_raw<genIType, FracBits>(static_cast<wide_type>(x.value) + static_cast<wide_type>(y.value));
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> operator-(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		typedef typename tfixed<genIType, FracBits>::wide_type wide_type;
+		return detail::fixed_from_raw<genIType, FracBits>(static_cast<wide_type>(x.value) - static_cast<wide_type>(y.value));
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> operator*(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		typedef typename tfixed<genIType, FracBits>::wide_type wide_type;
+		return detail::fixed_from_raw<genIType, FracBits>(detail::fixed_round_shift(static_cast<wide_type>(x.value) * static_cast<wide_type>(y.value), FracBits));
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> operator/(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		typedef typename tfixed<genIType, FracBits>::wide_type wide_type;
+
+		if(y.value == 0)
+			return tfixed<genIType, FracBits>::fromRaw(x.value < 0 ? std::numeric_limits<genIType>::min() : std::numeric_limits<genIType>::max());
+
+		wide_type const Num = static_cast<wide_type>(x.value) * (static_cast<wide_type>(1) << FracBits);
+		wide_type const Den = static_cast<wide_type>(y.value);
+		wide_type Quot = Num / Den;
+		wide_type const Rem = Num % Den;
+		if(2 * (Rem < 0 ? -Rem : Rem) >= (Den < 0 ? -Den : Den))
+			Quot += (Num < 0) == (Den < 0) ? 1 : -1;
+		return detail::fixed_from_raw<genIType, FracBits>(Quot);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER bool operator==(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		return x.value == y.value;
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER bool operator!=(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		return x.value != y.value;
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER bool operator<(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		return x.value < y.value;
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER bool operator<=(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		return x.value <= y.value;
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER bool operator>(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		return x.value > y.value;
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER bool operator>=(tfixed<genIType, FracBits> const & x, tfixed<genIType, FracBits> const & y)
+	{
+		return x.value >= y.value;
+	}
+
+	// -- Common functions --
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> abs(tfixed<genIType, FracBits> x)
+	{
+		return x.value < 0 ? -x : x;
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> abs(vecType<tfixed<genIType, FracBits>, P> const & x)
+	{
+		return detail::functor1<tfixed<genIType, FracBits>, tfixed<genIType, FracBits>, P, vecType>::call(abs<genIType, FracBits>, x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> floor(tfixed<genIType, FracBits> x)
+	{
+		typedef typename tfixed<genIType, FracBits>::wide_type wide_type;
+		wide_type const Mask = (static_cast<wide_type>(1) << FracBits) - 1;
+		return tfixed<genIType, FracBits>::fromRaw(static_cast<genIType>(static_cast<wide_type>(x.value) & ~Mask));
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> floor(vecType<tfixed<genIType, FracBits>, P> const & x)
+	{
+		return detail::functor1<tfixed<genIType, FracBits>, tfixed<genIType, FracBits>, P, vecType>::call(floor<genIType, FracBits>, x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> ceil(tfixed<genIType, FracBits> x)
+	{
+		typedef typename tfixed<genIType, FracBits>::wide_type wide_type;
+		wide_type const Mask = (static_cast<wide_type>(1) << FracBits) - 1;
+		return detail::fixed_from_raw<genIType, FracBits>((static_cast<wide_type>(x.value) + Mask) & ~Mask);
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> ceil(vecType<tfixed<genIType, FracBits>, P> const & x)
+	{
+		return detail::functor1<tfixed<genIType, FracBits>, tfixed<genIType, FracBits>, P, vecType>::call(ceil<genIType, FracBits>, x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> min(tfixed<genIType, FracBits> x, tfixed<genIType, FracBits> y)
+	{
+		return y < x ? y : x;
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> min(vecType<tfixed<genIType, FracBits>, P> const & x, vecType<tfixed<genIType, FracBits>, P> const & y)
+	{
+		return detail::functor2<tfixed<genIType, FracBits>, P, vecType>::call(min<genIType, FracBits>, x, y);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> max(tfixed<genIType, FracBits> x, tfixed<genIType, FracBits> y)
+	{
+		return x < y ? y : x;
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> max(vecType<tfixed<genIType, FracBits>, P> const & x, vecType<tfixed<genIType, FracBits>, P> const & y)
+	{
+		return detail::functor2<tfixed<genIType, FracBits>, P, vecType>::call(max<genIType, FracBits>, x, y);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> clamp(tfixed<genIType, FracBits> x, tfixed<genIType, FracBits> minVal, tfixed<genIType, FracBits> maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> clamp(vecType<tfixed<genIType, FracBits>, P> const & x, vecType<tfixed<genIType, FracBits>, P> const & minVal, vecType<tfixed<genIType, FracBits>, P> const & maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	// -- Square root and reciprocal --
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> sqrt(tfixed<genIType, FracBits> x)
+	{
+		if(x.value <= 0)
+			return tfixed<genIType, FracBits>();
+		return tfixed<genIType, FracBits>::fromRaw(static_cast<genIType>(detail::fixed_isqrt(static_cast<uint64>(x.value) << FracBits)));
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> sqrt(vecType<tfixed<genIType, FracBits>, P> const & x)
+	{
+		return detail::functor1<tfixed<genIType, FracBits>, tfixed<genIType, FracBits>, P, vecType>::call(sqrt<genIType, FracBits>, x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> fastSqrt(tfixed<genIType, FracBits> x)
+	{
+		if(x.value <= 0)
+			return tfixed<genIType, FracBits>();
+
+		// x * 2^FracBits = m * 2^(2 * e), m in [2^30, 2^32)
+		uint64 const n = static_cast<uint64>(x.value) << FracBits;
+		int const MSB = findMSB(n);
+		uint64 m;
+		int e;
+		if(MSB >= 30)
+		{
+			int const j = (MSB - 30) & ~1;
+			m = n >> j;
+			e = j / 2;
+		}
+		else
+		{
+			int const j = (31 - MSB) & ~1;
+			m = n << j;
+			e = -j / 2;
+		}
+
+		// Newton-Raphson iterations on y = 1 / sqrt(m / 2^32), y in [1, 2] * 2^30, from a linear guess on each octave
+		uint64 y = m < (static_cast<uint64>(1) << 31) ?
+			static_cast<uint64>(2735864235u) - ((static_cast<uint64>(2515933592u) * m) >> 32) :
+			static_cast<uint64>(1934548153u) - ((static_cast<uint64>(889516852u) * m) >> 32);
+		for(int i = 0; i < 3; ++i)
+		{
+			uint64 const y2 = (y * y) >> 30;
+			uint64 const t = (m * y2) >> 32;
+			y = (y * (static_cast<uint64>(3) * (static_cast<uint64>(1) << 30) - t)) >> 31;
+		}
+
+		// sqrt(m / 2^32) * 2^30
+		int64 const s = static_cast<int64>((m * y) >> 32);
+		int const Shift = 14 - e;
+		return detail::fixed_from_raw<genIType, FracBits>(static_cast<typename tfixed<genIType, FracBits>::wide_type>(detail::fixed_round_shift(s, Shift)));
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> fastSqrt(vecType<tfixed<genIType, FracBits>, P> const & x)
+	{
+		return detail::functor1<tfixed<genIType, FracBits>, tfixed<genIType, FracBits>, P, vecType>::call(fastSqrt<genIType, FracBits>, x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> reciprocal(tfixed<genIType, FracBits> x)
+	{
+		return tfixed<genIType, FracBits>(1) / x;
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> reciprocal(vecType<tfixed<genIType, FracBits>, P> const & x)
+	{
+		return detail::functor1<tfixed<genIType, FracBits>, tfixed<genIType, FracBits>, P, vecType>::call(reciprocal<genIType, FracBits>, x);
+	}
+
+	template <typename genIType, int FracBits>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> fastReciprocal(tfixed<genIType, FracBits> x)
+	{
+		if(x.value == 0)
+			return tfixed<genIType, FracBits>::fromRaw(std::numeric_limits<genIType>::max());
+
+		// |x| * 2^FracBits = m * 2^(MSB - 31), m in [2^31, 2^32)
+		int64 const Raw = static_cast<int64>(x.value);
+		uint64 const u = static_cast<uint64>(Raw < 0 ? -Raw : Raw);
+		int const MSB = findMSB(u);
+		int64 const m = static_cast<int64>(u << (31 - MSB));
+
+		// Newton-Raphson iterations on y = 1 / (m / 2^32), y in [1, 2] * 2^30, from the linear guess 48/17 - 32/17 * m
+		int64 y = static_cast<int64>(3031741621u) - static_cast<int64>((static_cast<uint64>(2021161080u) * static_cast<uint64>(m)) >> 32);
+		for(int i = 0; i < 3; ++i)
+		{
+			int64 const e = (static_cast<int64>(1) << 30) - static_cast<int64>((static_cast<uint64>(m) * static_cast<uint64>(y)) >> 32);
+			y += (y * e) >> 30;
+		}
+
+		int const Shift = 2 * FracBits - MSB - 31;
+		int64 Result;
+		if(Shift >= 0)
+			Result = Shift >= 32 ? static_cast<int64>(std::numeric_limits<genIType>::max()) : y << Shift;
+		else
+			Result = detail::fixed_round_shift(y, -Shift);
+		Result = Result > static_cast<int64>(std::numeric_limits<genIType>::max()) ? static_cast<int64>(std::numeric_limits<genIType>::max()) : Result;
+		return tfixed<genIType, FracBits>::fromRaw(static_cast<genIType>(Raw < 0 ? -Result : Result));
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<tfixed<genIType, FracBits>, P> fastReciprocal(vecType<tfixed<genIType, FracBits>, P> const & x)
+	{
+		return detail::functor1<tfixed<genIType, FracBits>, tfixed<genIType, FracBits>, P, vecType>::call(fastReciprocal<genIType, FracBits>, x);
+	}
+
+	// -- Geometric functions --
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> dot(tvec2<tfixed<genIType, FracBits>, P> const & x, tvec2<tfixed<genIType, FracBits>, P> const & y)
+	{
+		return detail::fixed_dot_round<genIType, FracBits>(
+			detail::fixed_dot_term(x.x, y.x) + detail::fixed_dot_term(x.y, y.y));
+	}
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> dot(tvec3<tfixed<genIType, FracBits>, P> const & x, tvec3<tfixed<genIType, FracBits>, P> const & y)
+	{
+		return detail::fixed_dot_round<genIType, FracBits>(
+			detail::fixed_dot_term(x.x, y.x) + detail::fixed_dot_term(x.y, y.y) + detail::fixed_dot_term(x.z, y.z));
+	}
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> dot(tvec4<tfixed<genIType, FracBits>, P> const & x, tvec4<tfixed<genIType, FracBits>, P> const & y)
+	{
+		return detail::fixed_dot_round<genIType, FracBits>(
+			detail::fixed_dot_term(x.x, y.x) + detail::fixed_dot_term(x.y, y.y) + detail::fixed_dot_term(x.z, y.z) + detail::fixed_dot_term(x.w, y.w));
+	}
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tvec3<tfixed<genIType, FracBits>, P> cross(tvec3<tfixed<genIType, FracBits>, P> const & x, tvec3<tfixed<genIType, FracBits>, P> const & y)
+	{
+		return tvec3<tfixed<genIType, FracBits>, P>(
+			detail::fixed_dot_round<genIType, FracBits>(detail::fixed_dot_term(x.y, y.z) - detail::fixed_dot_term(y.y, x.z)),
+			detail::fixed_dot_round<genIType, FracBits>(detail::fixed_dot_term(x.z, y.x) - detail::fixed_dot_term(y.z, x.x)),
+			detail::fixed_dot_round<genIType, FracBits>(detail::fixed_dot_term(x.x, y.y) - detail::fixed_dot_term(y.x, x.y)));
+	}
+
+	template <typename genIType, int FracBits, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER tfixed<genIType, FracBits> length(vecType<tfixed<genIType, FracBits>, P> const & x)
+	{
+		return sqrt(dot(x, x));
+	}
+
+	// -- Matrix products --
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tvec2<tfixed<genIType, FracBits>, P> operator*(tmat2x2<tfixed<genIType, FracBits>, P> const & m, tvec2<tfixed<genIType, FracBits>, P> const & v)
+	{
+		tvec2<tfixed<genIType, FracBits>, P> Result;
+		for(length_t i = 0; i < 2; ++i)
+			Result[i] = detail::fixed_dot_round<genIType, FracBits>(
+				detail::fixed_dot_term(m[0][i], v.x) + detail::fixed_dot_term(m[1][i], v.y));
+		return Result;
+	}
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tvec3<tfixed<genIType, FracBits>, P> operator*(tmat3x3<tfixed<genIType, FracBits>, P> const & m, tvec3<tfixed<genIType, FracBits>, P> const & v)
+	{
+		tvec3<tfixed<genIType, FracBits>, P> Result;
+		for(length_t i = 0; i < 3; ++i)
+			Result[i] = detail::fixed_dot_round<genIType, FracBits>(
+				detail::fixed_dot_term(m[0][i], v.x) + detail::fixed_dot_term(m[1][i], v.y) + detail::fixed_dot_term(m[2][i], v.z));
+		return Result;
+	}
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tvec4<tfixed<genIType, FracBits>, P> operator*(tmat4x4<tfixed<genIType, FracBits>, P> const & m, tvec4<tfixed<genIType, FracBits>, P> const & v)
+	{
+		tvec4<tfixed<genIType, FracBits>, P> Result;
+		for(length_t i = 0; i < 4; ++i)
+			Result[i] = detail::fixed_dot_round<genIType, FracBits>(
+				detail::fixed_dot_term(m[0][i], v.x) + detail::fixed_dot_term(m[1][i], v.y) + detail::fixed_dot_term(m[2][i], v.z) + detail::fixed_dot_term(m[3][i], v.w));
+		return Result;
+	}
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tmat2x2<tfixed<genIType, FracBits>, P> operator*(tmat2x2<tfixed<genIType, FracBits>, P> const & m1, tmat2x2<tfixed<genIType, FracBits>, P> const & m2)
+	{
+		return tmat2x2<tfixed<genIType, FracBits>, P>(m1 * m2[0], m1 * m2[1]);
+	}
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tmat3x3<tfixed<genIType, FracBits>, P> operator*(tmat3x3<tfixed<genIType, FracBits>, P> const & m1, tmat3x3<tfixed<genIType, FracBits>, P> const & m2)
+	{
+		return tmat3x3<tfixed<genIType, FracBits>, P>(m1 * m2[0], m1 * m2[1], m1 * m2[2]);
+	}
+
+	template <typename genIType, int FracBits, precision P>
+	GLM_FUNC_QUALIFIER tmat4x4<tfixed<genIType, FracBits>, P> operator*(tmat4x4<tfixed<genIType, FracBits>, P> const & m1, tmat4x4<tfixed<genIType, FracBits>, P> const & m2)
+	{
+		return tmat4x4<tfixed<genIType, FracBits>, P>(m1 * m2[0], m1 * m2[1], m1 * m2[2], m1 * m2[3]);
+	}
+
+#if GLM_HAS_UNRESTRICTED_UNIONS
+namespace detail
+{
+	//////////////////////////////////////
+	// Platform independent kernels
+
+	template <typename vecType>
+	GLM_FUNC_QUALIFIER void add_fixed_pure(vecType const * A, vecType const * B, vecType * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = A[i] + B[i];
+	}
+
+	template <typename vecType>
+	GLM_FUNC_QUALIFIER void sub_fixed_pure(vecType const * A, vecType const * B, vecType * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = A[i] - B[i];
+	}
+
+	template <typename vecType>
+	GLM_FUNC_QUALIFIER void mul_fixed_pure(vecType const * A, vecType const * B, vecType * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = A[i] * B[i];
+	}
+
+	GLM_FUNC_QUALIFIER void transform_fixed16_16_pure(fixed16_16mat4 const & m, fixed16_16vec4 const * Src, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = m * Src[i];
+	}
+
+#	if GLM_DISPATCH_X86
+	//////////////////////////////////////
+	// Q16.16 kernels
+
+	// Saturated to INT32_MAX or INT32_MIN with the sign of Sign where Overflow is negative
+	inline __m128i fixed16_16_saturate_sse2(__m128i Value, __m128i Sign, __m128i Overflow)
+	{
+		__m128i const Mask = _mm_srai_epi32(Overflow, 31);
+		__m128i const Sat = _mm_xor_si128(_mm_srai_epi32(Sign, 31), _mm_set1_epi32(0x7fffffff));
+		return _mm_or_si128(_mm_andnot_si128(Mask, Value), _mm_and_si128(Mask, Sat));
+	}
+
+	inline __m128i add_fixed16_16_sse2(__m128i a, __m128i b)
+	{
+		__m128i const s = _mm_add_epi32(a, b);
+		return fixed16_16_saturate_sse2(s, a, _mm_and_si128(_mm_xor_si128(a, s), _mm_xor_si128(b, s)));
+	}
+
+	inline __m128i sub_fixed16_16_sse2(__m128i a, __m128i b)
+	{
+		__m128i const s = _mm_sub_epi32(a, b);
+		return fixed16_16_saturate_sse2(s, a, _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, s)));
+	}
+
+	inline void add_fixed16_16_sse2(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&Dst[i]), add_fixed16_16_sse2(
+				_mm_loadu_si128(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadu_si128(reinterpret_cast<__m128i const*>(&B[i]))));
+	}
+
+	inline void sub_fixed16_16_sse2(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&Dst[i]), sub_fixed16_16_sse2(
+				_mm_loadu_si128(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadu_si128(reinterpret_cast<__m128i const*>(&B[i]))));
+	}
+
+	// Rounded and saturated (Even >> Shift, Odd >> Shift), the 64 bit numbers of the even and odd lanes
+	template <int Shift>
+	GLM_TARGET_SSE4 inline __m128i fixed16_16_narrow_sse4(__m128i Even, __m128i Odd)
+	{
+		__m128i const Value = _mm_blend_epi16(_mm_srli_epi64(Even, Shift), _mm_slli_epi64(Odd, 32 - Shift), 0xCC);
+		__m128i const High = _mm_blend_epi16(_mm_shuffle_epi32(Even, _MM_SHUFFLE(3, 3, 1, 1)), Odd, 0xCC);
+		__m128i const Fit = _mm_cmpeq_epi32(_mm_srai_epi32(High, Shift - 1), _mm_srai_epi32(High, 31));
+		__m128i const Sat = _mm_xor_si128(_mm_srai_epi32(High, 31), _mm_set1_epi32(0x7fffffff));
+		return _mm_blendv_epi8(Sat, Value, Fit);
+	}
+
+	GLM_TARGET_SSE4 inline __m128i mul_fixed16_16_sse4(__m128i a, __m128i b)
+	{
+		__m128i const Round = _mm_set1_epi64x(static_cast<int64>(1) << 15);
+		__m128i const Even = _mm_add_epi64(_mm_mul_epi32(a, b), Round);
+		__m128i const Odd = _mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), Round);
+		return fixed16_16_narrow_sse4<16>(Even, Odd);
+	}
+
+	GLM_TARGET_SSE4 inline void mul_fixed16_16_sse4(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&Dst[i]), mul_fixed16_16_sse4(
+				_mm_loadu_si128(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadu_si128(reinterpret_cast<__m128i const*>(&B[i]))));
+	}
+
+	// Arithmetic shift of the 64 bit products by 2, biased by 2^63 to use the logical shift: (x ^ 2^63) >> 2 = (x >> 2) + 2^61
+	GLM_TARGET_SSE4 inline __m128i fixed16_16_dot_term_sse4(__m128i a, __m128i b)
+	{
+		return _mm_srli_epi64(_mm_xor_si128(_mm_mul_epi32(a, b), _mm_set1_epi64x(std::numeric_limits<int64>::min())), 2);
+	}
+
+	GLM_TARGET_SSE4 inline __m128i transform_fixed16_16_sse4(__m128i const Even[4], __m128i const Odd[4], __m128i v)
+	{
+		// 4 terms biased by 2^61 add up to 2^63, removed with the rounding constant
+		__m128i Sum0 = _mm_set1_epi64x(std::numeric_limits<int64>::min() + (static_cast<int64>(1) << 13));
+		__m128i Sum1 = Sum0;
+		__m128i const v0 = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 0, 0, 0));
+		__m128i const v1 = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1));
+		__m128i const v2 = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 2, 2));
+		__m128i const v3 = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+		Sum0 = _mm_add_epi64(Sum0, fixed16_16_dot_term_sse4(Even[0], v0));
+		Sum1 = _mm_add_epi64(Sum1, fixed16_16_dot_term_sse4(Odd[0], v0));
+		Sum0 = _mm_add_epi64(Sum0, fixed16_16_dot_term_sse4(Even[1], v1));
+		Sum1 = _mm_add_epi64(Sum1, fixed16_16_dot_term_sse4(Odd[1], v1));
+		Sum0 = _mm_add_epi64(Sum0, fixed16_16_dot_term_sse4(Even[2], v2));
+		Sum1 = _mm_add_epi64(Sum1, fixed16_16_dot_term_sse4(Odd[2], v2));
+		Sum0 = _mm_add_epi64(Sum0, fixed16_16_dot_term_sse4(Even[3], v3));
+		Sum1 = _mm_add_epi64(Sum1, fixed16_16_dot_term_sse4(Odd[3], v3));
+		return fixed16_16_narrow_sse4<14>(Sum0, Sum1);
+	}
+
+	GLM_TARGET_SSE4 inline void transform_fixed16_16_sse4(fixed16_16mat4 const & m, fixed16_16vec4 const * Src, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		__m128i Even[4], Odd[4];
+		for(length_t c = 0; c < 4; ++c)
+		{
+			Even[c] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&m[c]));
+			Odd[c] = _mm_srli_epi64(Even[c], 32);
+		}
+
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&Dst[i]), transform_fixed16_16_sse4(Even, Odd, _mm_loadu_si128(reinterpret_cast<__m128i const*>(&Src[i]))));
+	}
+
+	GLM_TARGET_AVX2 inline __m256i fixed16_16_saturate_avx2(__m256i Value, __m256i Sign, __m256i Overflow)
+	{
+		__m256i const Mask = _mm256_srai_epi32(Overflow, 31);
+		__m256i const Sat = _mm256_xor_si256(_mm256_srai_epi32(Sign, 31), _mm256_set1_epi32(0x7fffffff));
+		return _mm256_blendv_epi8(Value, Sat, Mask);
+	}
+
+	GLM_TARGET_AVX2 inline void add_fixed16_16_avx2(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+		{
+			__m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&A[i]));
+			__m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&B[i]));
+			__m256i const s = _mm256_add_epi32(a, b);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Dst[i]), fixed16_16_saturate_avx2(s, a, _mm256_and_si256(_mm256_xor_si256(a, s), _mm256_xor_si256(b, s))));
+		}
+		add_fixed16_16_sse2(A + i, B + i, Dst + i, Count - i);
+	}
+
+	GLM_TARGET_AVX2 inline void sub_fixed16_16_avx2(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+		{
+			__m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&A[i]));
+			__m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&B[i]));
+			__m256i const s = _mm256_sub_epi32(a, b);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Dst[i]), fixed16_16_saturate_avx2(s, a, _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, s))));
+		}
+		sub_fixed16_16_sse2(A + i, B + i, Dst + i, Count - i);
+	}
+
+	template <int Shift>
+	GLM_TARGET_AVX2 inline __m256i fixed16_16_narrow_avx2(__m256i Even, __m256i Odd)
+	{
+		__m256i const Value = _mm256_blend_epi16(_mm256_srli_epi64(Even, Shift), _mm256_slli_epi64(Odd, 32 - Shift), 0xCC);
+		__m256i const High = _mm256_blend_epi16(_mm256_shuffle_epi32(Even, _MM_SHUFFLE(3, 3, 1, 1)), Odd, 0xCC);
+		__m256i const Fit = _mm256_cmpeq_epi32(_mm256_srai_epi32(High, Shift - 1), _mm256_srai_epi32(High, 31));
+		__m256i const Sat = _mm256_xor_si256(_mm256_srai_epi32(High, 31), _mm256_set1_epi32(0x7fffffff));
+		return _mm256_blendv_epi8(Sat, Value, Fit);
+	}
+
+	GLM_TARGET_AVX2 inline void mul_fixed16_16_avx2(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		__m256i const Round = _mm256_set1_epi64x(static_cast<int64>(1) << 15);
+
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+		{
+			__m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&A[i]));
+			__m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&B[i]));
+			__m256i const Even = _mm256_add_epi64(_mm256_mul_epi32(a, b), Round);
+			__m256i const Odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)), Round);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Dst[i]), fixed16_16_narrow_avx2<16>(Even, Odd));
+		}
+		mul_fixed16_16_sse4(A + i, B + i, Dst + i, Count - i);
+	}
+
+	GLM_TARGET_AVX2 inline __m256i fixed16_16_dot_term_avx2(__m256i a, __m256i b)
+	{
+		return _mm256_srli_epi64(_mm256_xor_si256(_mm256_mul_epi32(a, b), _mm256_set1_epi64x(std::numeric_limits<int64>::min())), 2);
+	}
+
+	GLM_TARGET_AVX2 inline void transform_fixed16_16_avx2(fixed16_16mat4 const & m, fixed16_16vec4 const * Src, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		__m128i Even[4], Odd[4];
+		__m256i Even2[4], Odd2[4];
+		for(length_t c = 0; c < 4; ++c)
+		{
+			Even[c] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&m[c]));
+			Odd[c] = _mm_srli_epi64(Even[c], 32);
+			Even2[c] = _mm256_broadcastsi128_si256(Even[c]);
+			Odd2[c] = _mm256_broadcastsi128_si256(Odd[c]);
+		}
+
+		// Two vectors per iteration, one in each 128 bit lane
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+		{
+			__m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&Src[i]));
+			__m256i Sum0 = _mm256_set1_epi64x(std::numeric_limits<int64>::min() + (static_cast<int64>(1) << 13));
+			__m256i Sum1 = Sum0;
+			__m256i const v0 = _mm256_shuffle_epi32(v, _MM_SHUFFLE(0, 0, 0, 0));
+			__m256i const v1 = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1));
+			__m256i const v2 = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 2, 2));
+			__m256i const v3 = _mm256_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+			Sum0 = _mm256_add_epi64(Sum0, fixed16_16_dot_term_avx2(Even2[0], v0));
+			Sum1 = _mm256_add_epi64(Sum1, fixed16_16_dot_term_avx2(Odd2[0], v0));
+			Sum0 = _mm256_add_epi64(Sum0, fixed16_16_dot_term_avx2(Even2[1], v1));
+			Sum1 = _mm256_add_epi64(Sum1, fixed16_16_dot_term_avx2(Odd2[1], v1));
+			Sum0 = _mm256_add_epi64(Sum0, fixed16_16_dot_term_avx2(Even2[2], v2));
+			Sum1 = _mm256_add_epi64(Sum1, fixed16_16_dot_term_avx2(Odd2[2], v2));
+			Sum0 = _mm256_add_epi64(Sum0, fixed16_16_dot_term_avx2(Even2[3], v3));
+			Sum1 = _mm256_add_epi64(Sum1, fixed16_16_dot_term_avx2(Odd2[3], v3));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Dst[i]), fixed16_16_narrow_avx2<14>(Sum0, Sum1));
+		}
+		if(i < Count)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&Dst[i]), transform_fixed16_16_sse4(Even, Odd, _mm_loadu_si128(reinterpret_cast<__m128i const*>(&Src[i]))));
+	}
+
+	//////////////////////////////////////
+	// Q8.8 kernels, two vectors per 128 bit register
+
+	inline __m128i mul_fixed8_8_sse2(__m128i a, __m128i b)
+	{
+		__m128i const Low = _mm_mullo_epi16(a, b);
+		__m128i const High = _mm_mulhi_epi16(a, b);
+		__m128i const Round = _mm_set1_epi32(1 << 7);
+		__m128i const Prod0 = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(Low, High), Round), 8);
+		__m128i const Prod1 = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(Low, High), Round), 8);
+		return _mm_packs_epi32(Prod0, Prod1);
+	}
+
+	inline void add_fixed8_8_sse2(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&Dst[i]), _mm_adds_epi16(
+				_mm_loadu_si128(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadu_si128(reinterpret_cast<__m128i const*>(&B[i]))));
+		if(i < Count)
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Dst[i]), _mm_adds_epi16(
+				_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadl_epi64(reinterpret_cast<__m128i const*>(&B[i]))));
+	}
+
+	inline void sub_fixed8_8_sse2(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&Dst[i]), _mm_subs_epi16(
+				_mm_loadu_si128(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadu_si128(reinterpret_cast<__m128i const*>(&B[i]))));
+		if(i < Count)
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Dst[i]), _mm_subs_epi16(
+				_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadl_epi64(reinterpret_cast<__m128i const*>(&B[i]))));
+	}
+
+	inline void mul_fixed8_8_sse2(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&Dst[i]), mul_fixed8_8_sse2(
+				_mm_loadu_si128(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadu_si128(reinterpret_cast<__m128i const*>(&B[i]))));
+		if(i < Count)
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Dst[i]), mul_fixed8_8_sse2(
+				_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&A[i])), _mm_loadl_epi64(reinterpret_cast<__m128i const*>(&B[i]))));
+	}
+
+	GLM_TARGET_AVX2 inline void add_fixed8_8_avx2(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Dst[i]), _mm256_adds_epi16(
+				_mm256_loadu_si256(reinterpret_cast<__m256i const*>(&A[i])), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&B[i]))));
+		add_fixed8_8_sse2(A + i, B + i, Dst + i, Count - i);
+	}
+
+	GLM_TARGET_AVX2 inline void sub_fixed8_8_avx2(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Dst[i]), _mm256_subs_epi16(
+				_mm256_loadu_si256(reinterpret_cast<__m256i const*>(&A[i])), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&B[i]))));
+		sub_fixed8_8_sse2(A + i, B + i, Dst + i, Count - i);
+	}
+
+	GLM_TARGET_AVX2 inline void mul_fixed8_8_avx2(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		__m256i const Round = _mm256_set1_epi32(1 << 7);
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			__m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&A[i]));
+			__m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&B[i]));
+			__m256i const Low = _mm256_mullo_epi16(a, b);
+			__m256i const High = _mm256_mulhi_epi16(a, b);
+			__m256i const Prod0 = _mm256_srai_epi32(_mm256_add_epi32(_mm256_unpacklo_epi16(Low, High), Round), 8);
+			__m256i const Prod1 = _mm256_srai_epi32(_mm256_add_epi32(_mm256_unpackhi_epi16(Low, High), Round), 8);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&Dst[i]), _mm256_packs_epi32(Prod0, Prod1));
+		}
+		mul_fixed8_8_sse2(A + i, B + i, Dst + i, Count - i);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	typedef void (*fixed16_16vec4_binary_func)(fixed16_16vec4 const *, fixed16_16vec4 const *, fixed16_16vec4 *, std::size_t);
+	typedef void (*transform_fixed16_16vec4_func)(fixed16_16mat4 const &, fixed16_16vec4 const *, fixed16_16vec4 *, std::size_t);
+	typedef void (*fixed8_8vec4_binary_func)(fixed8_8vec4 const *, fixed8_8vec4 const *, fixed8_8vec4 *, std::size_t);
+
+	GLM_FUNC_QUALIFIER fixed16_16vec4_binary_func add_fixed16_16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static fixed16_16vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {add_fixed_pure<fixed16_16vec4>, add_fixed16_16_sse2, 0, 0, add_fixed16_16_avx2};
+#		else
+			static fixed16_16vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {add_fixed_pure<fixed16_16vec4>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER fixed16_16vec4_binary_func sub_fixed16_16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static fixed16_16vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {sub_fixed_pure<fixed16_16vec4>, sub_fixed16_16_sse2, 0, 0, sub_fixed16_16_avx2};
+#		else
+			static fixed16_16vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {sub_fixed_pure<fixed16_16vec4>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER fixed16_16vec4_binary_func mul_fixed16_16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static fixed16_16vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {mul_fixed_pure<fixed16_16vec4>, 0, mul_fixed16_16_sse4, 0, mul_fixed16_16_avx2};
+#		else
+			static fixed16_16vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {mul_fixed_pure<fixed16_16vec4>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER transform_fixed16_16vec4_func transform_fixed16_16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static transform_fixed16_16vec4_func const Table[SIMD_LEVEL_COUNT] = {transform_fixed16_16_pure, 0, transform_fixed16_16_sse4, 0, transform_fixed16_16_avx2};
+#		else
+			static transform_fixed16_16vec4_func const Table[SIMD_LEVEL_COUNT] = {transform_fixed16_16_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER fixed8_8vec4_binary_func add_fixed8_8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static fixed8_8vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {add_fixed_pure<fixed8_8vec4>, add_fixed8_8_sse2, 0, 0, add_fixed8_8_avx2};
+#		else
+			static fixed8_8vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {add_fixed_pure<fixed8_8vec4>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER fixed8_8vec4_binary_func sub_fixed8_8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static fixed8_8vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {sub_fixed_pure<fixed8_8vec4>, sub_fixed8_8_sse2, 0, 0, sub_fixed8_8_avx2};
+#		else
+			static fixed8_8vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {sub_fixed_pure<fixed8_8vec4>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER fixed8_8vec4_binary_func mul_fixed8_8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static fixed8_8vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {mul_fixed_pure<fixed8_8vec4>, mul_fixed8_8_sse2, 0, 0, mul_fixed8_8_avx2};
+#		else
+			static fixed8_8vec4_binary_func const Table[SIMD_LEVEL_COUNT] = {mul_fixed_pure<fixed8_8vec4>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void addBatch(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		detail::add_fixed16_16_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void subBatch(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		detail::sub_fixed16_16_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void mulBatch(fixed16_16vec4 const * A, fixed16_16vec4 const * B, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		detail::mul_fixed16_16_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void transformBatch(fixed16_16mat4 const & m, fixed16_16vec4 const * Src, fixed16_16vec4 * Dst, std::size_t Count)
+	{
+		detail::transform_fixed16_16_select()(m, Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void addBatch(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		detail::add_fixed8_8_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void subBatch(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		detail::sub_fixed8_8_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void mulBatch(fixed8_8vec4 const * A, fixed8_8vec4 const * B, fixed8_8vec4 * Dst, std::size_t Count)
+	{
+		detail::mul_fixed8_8_select()(A, B, Dst, Count);
+	}
+#endif//GLM_HAS_UNRESTRICTED_UNIONS
+}//namespace glm
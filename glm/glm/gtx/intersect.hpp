@@ -106,6 +106,47 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1, 
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the intersection of a ray and an axis aligned box with the slab method.
+	//! intersectionDistance is the distance along the ray where it enters the box, 0 if the ray starts inside.
+	//! From GLM_GTX_intersect extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectRayAABB(
+		tvec3<T, P> const & orig, tvec3<T, P> const & dir,
+		tvec3<T, P> const & boxMin, tvec3<T, P> const & boxMax,
+		T & intersectionDistance);
+
+	//! Test whether two axis aligned boxes overlap, touching boxes overlap.
+	//! From GLM_GTX_intersect extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectAABBAABB(
+		tvec3<T, P> const & minA, tvec3<T, P> const & maxA,
+		tvec3<T, P> const & minB, tvec3<T, P> const & maxB);
+
+	//! Test whether a sphere overlaps a frustum given by 6 planes dot(vec3(plane), p) + plane.w = 0,
+	//! with unit length normals pointing inside. Conservative, spheres close to the corners of the frustum may be accepted.
+	//! From GLM_GTX_intersect extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectSphereFrustum(
+		tvec3<T, P> const & sphereCenter, T sphereRadius,
+		tvec4<T, P> const * frustumPlanes);
+
+	//! Compute the intersection of a ray and an oriented box.
+	//! The columns of obbRotation are the unit length axes of the box, obbExtent its half size along them.
+	//! From GLM_GTX_intersect extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectRayOBB(
+		tvec3<T, P> const & orig, tvec3<T, P> const & dir,
+		tvec3<T, P> const & obbCenter, tvec3<T, P> const & obbExtent, tmat3x3<T, P> const & obbRotation,
+		T & intersectionDistance);
+
+	//! Test whether two oriented boxes overlap with the separating axis theorem.
+	//! The columns of the rotations are the unit length axes of the boxes, the extents their half sizes along them.
+	//! From GLM_GTX_intersect extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectOBBOBB(
+		tvec3<T, P> const & centerA, tvec3<T, P> const & extentA, tmat3x3<T, P> const & rotationA,
+		tvec3<T, P> const & centerB, tvec3<T, P> const & extentB, tmat3x3<T, P> const & rotationB);
+
 	/// @}
 }//namespace glm
 
@@ -214,4 +214,110 @@ namespace glm
 		intersectionNormal2 = (intersectionPoint2 - sphereCenter) / sphereRadius;
 		return true;
 	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectRayAABB
+	(
+		tvec3<T, P> const & orig, tvec3<T, P> const & dir,
+		tvec3<T, P> const & boxMin, tvec3<T, P> const & boxMax,
+		T & intersectionDistance
+	)
+	{
+		tvec3<T, P> const InvDir(static_cast<T>(1) / dir);
+		tvec3<T, P> const t0((boxMin - orig) * InvDir);
+		tvec3<T, P> const t1((boxMax - orig) * InvDir);
+		tvec3<T, P> const Near(min(t0, t1));
+		tvec3<T, P> const Far(max(t0, t1));
+
+		T const Enter = max(max(Near.x, Near.y), max(Near.z, static_cast<T>(0)));
+		T const Exit = min(min(Far.x, Far.y), Far.z);
+		if(Enter > Exit)
+			return false;
+
+		intersectionDistance = Enter;
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectAABBAABB
+	(
+		tvec3<T, P> const & minA, tvec3<T, P> const & maxA,
+		tvec3<T, P> const & minB, tvec3<T, P> const & maxB
+	)
+	{
+		return all(lessThanEqual(minA, maxB)) && all(lessThanEqual(minB, maxA));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectSphereFrustum
+	(
+		tvec3<T, P> const & sphereCenter, T sphereRadius,
+		tvec4<T, P> const * frustumPlanes
+	)
+	{
+		for(length_t i = 0; i < 6; ++i)
+			if(dot(tvec3<T, P>(frustumPlanes[i]), sphereCenter) + frustumPlanes[i].w < -sphereRadius)
+				return false;
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectRayOBB
+	(
+		tvec3<T, P> const & orig, tvec3<T, P> const & dir,
+		tvec3<T, P> const & obbCenter, tvec3<T, P> const & obbExtent, tmat3x3<T, P> const & obbRotation,
+		T & intersectionDistance
+	)
+	{
+		// The ray in the space of the box, the rotation preserves the distances
+		tvec3<T, P> const LocalOrig(transpose(obbRotation) * (orig - obbCenter));
+		tvec3<T, P> const LocalDir(transpose(obbRotation) * dir);
+		return intersectRayAABB(LocalOrig, LocalDir, -obbExtent, obbExtent, intersectionDistance);
+	}
+
+	// From Real-Time Collision Detection, Christer Ericson, 4.4.1
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectOBBOBB
+	(
+		tvec3<T, P> const & centerA, tvec3<T, P> const & extentA, tmat3x3<T, P> const & rotationA,
+		tvec3<T, P> const & centerB, tvec3<T, P> const & extentB, tmat3x3<T, P> const & rotationB
+	)
+	{
+		// Rotation and translation of B in the space of A, the epsilon avoids false separations along the null cross products of parallel edges
+		tmat3x3<T, P> const R(transpose(rotationA) * rotationB);
+		tmat3x3<T, P> AbsR;
+		for(length_t i = 0; i < 3; ++i)
+			AbsR[i] = abs(R[i]) + std::numeric_limits<T>::epsilon();
+		tvec3<T, P> const t(transpose(rotationA) * (centerB - centerA));
+
+		// Axes of A, R[j][i] is the cosine between the axis i of A and the axis j of B
+		for(length_t i = 0; i < 3; ++i)
+		{
+			T const rb = extentB[0] * AbsR[0][i] + extentB[1] * AbsR[1][i] + extentB[2] * AbsR[2][i];
+			if(abs(t[i]) > extentA[i] + rb)
+				return false;
+		}
+
+		// Axes of B
+		for(length_t j = 0; j < 3; ++j)
+		{
+			T const ra = dot(extentA, AbsR[j]);
+			if(abs(dot(t, R[j])) > ra + extentB[j])
+				return false;
+		}
+
+		// Cross products of the axes of A and B
+		for(length_t i = 0; i < 3; ++i)
+		for(length_t j = 0; j < 3; ++j)
+		{
+			length_t const i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+			length_t const j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+			T const ra = extentA[i1] * AbsR[j][i2] + extentA[i2] * AbsR[j][i1];
+			T const rb = extentB[j1] * AbsR[j2][i] + extentB[j2] * AbsR[j1][i];
+			if(abs(t[i2] * R[j][i1] - t[i1] * R[j][i2]) > ra + rb)
+				return false;
+		}
+
+		return true;
+	}
 }//namespace glm
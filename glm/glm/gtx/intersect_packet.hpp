@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_intersect_packet
+/// @file glm/gtx/intersect_packet.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+/// @see gtx_simd_packet (dependence)
+///
+/// @defgroup gtx_intersect_packet GLM_GTX_intersect_packet
+/// @ingroup gtx
+///
+/// @brief Intersection tests of 4 or 8 pairs of primitives at once.
+///
+/// Overloads of the functions of GLM_GTX_intersect and GLM_GTX_closest_point taking
+/// vec3x4 or vec3x8 packets. They evaluate all the lanes without branches and return
+/// a lane mask instead of a bool, the outputs of the lanes whose mask is false are
+/// undefined. Testing one ray against 4 or 8 primitives, or 4 or 8 rays against one
+/// primitive, is done by broadcasting the single operand with the tvec3packet(vec3)
+/// constructor.
+///
+/// <glm/gtx/intersect_packet.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "intersect.hpp"
+#include "simd_packet.hpp"
+
+#if(GLM_ARCH != GLM_ARCH_PURE)
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_intersect_packet extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_intersect_packet
+	/// @{
+
+	/// Computes the intersections of rays and planes, the mask of the lanes where the ray faces the plane.
+	/// @see gtx_intersect_packet
+	template <typename packType>
+	GLM_FUNC_DECL packType intersectRayPlane(
+		detail::tvec3packet<packType> const & orig, detail::tvec3packet<packType> const & dir,
+		detail::tvec3packet<packType> const & planeOrig, detail::tvec3packet<packType> const & planeNormal,
+		packType & intersectionDistance);
+
+	/// Computes the intersections of rays and triangles, front faces only.
+	/// @see gtx_intersect_packet
+	template <typename packType>
+	GLM_FUNC_DECL packType intersectRayTriangle(
+		detail::tvec3packet<packType> const & orig, detail::tvec3packet<packType> const & dir,
+		detail::tvec3packet<packType> const & vert0, detail::tvec3packet<packType> const & vert1, detail::tvec3packet<packType> const & vert2,
+		detail::tvec3packet<packType> & baryPosition);
+
+	/// Computes the intersection distances of rays and spheres, the ray directions are unit length.
+	/// @see gtx_intersect_packet
+	template <typename packType>
+	GLM_FUNC_DECL packType intersectRaySphere(
+		detail::tvec3packet<packType> const & rayStarting, detail::tvec3packet<packType> const & rayNormalizedDirection,
+		detail::tvec3packet<packType> const & sphereCenter, packType const & sphereRadiusSquared,
+		packType & intersectionDistance);
+
+	/// Computes the intersections of rays and axis aligned boxes with the slab method.
+	/// @see gtx_intersect_packet
+	template <typename packType>
+	GLM_FUNC_DECL packType intersectRayAABB(
+		detail::tvec3packet<packType> const & orig, detail::tvec3packet<packType> const & dir,
+		detail::tvec3packet<packType> const & boxMin, detail::tvec3packet<packType> const & boxMax,
+		packType & intersectionDistance);
+
+	/// Tests whether pairs of axis aligned boxes overlap.
+	/// @see gtx_intersect_packet
+	template <typename packType>
+	GLM_FUNC_DECL packType intersectAABBAABB(
+		detail::tvec3packet<packType> const & minA, detail::tvec3packet<packType> const & maxA,
+		detail::tvec3packet<packType> const & minB, detail::tvec3packet<packType> const & maxB);
+
+	/// Tests whether spheres overlap a frustum given by 6 planes with unit length normals pointing inside.
+	/// @see gtx_intersect_packet
+	template <typename packType, precision P>
+	GLM_FUNC_DECL packType intersectSphereFrustum(
+		detail::tvec3packet<packType> const & sphereCenter, packType const & sphereRadius,
+		tvec4<float, P> const * frustumPlanes);
+
+	/// Computes the intersections of rays and oriented boxes, obbAxes being the 3 unit length axes of the boxes.
+	/// @see gtx_intersect_packet
+	template <typename packType>
+	GLM_FUNC_DECL packType intersectRayOBB(
+		detail::tvec3packet<packType> const & orig, detail::tvec3packet<packType> const & dir,
+		detail::tvec3packet<packType> const & obbCenter, detail::tvec3packet<packType> const & obbExtent, detail::tvec3packet<packType> const * obbAxes,
+		packType & intersectionDistance);
+
+	/// Tests whether pairs of oriented boxes overlap, axesA and axesB being the 3 unit length axes of the boxes.
+	/// @see gtx_intersect_packet
+	template <typename packType>
+	GLM_FUNC_DECL packType intersectOBBOBB(
+		detail::tvec3packet<packType> const & centerA, detail::tvec3packet<packType> const & extentA, detail::tvec3packet<packType> const * axesA,
+		detail::tvec3packet<packType> const & centerB, detail::tvec3packet<packType> const & extentB, detail::tvec3packet<packType> const * axesB);
+
+	/// Computes the closest points to point on the segments [a, b].
+	/// @see gtx_intersect_packet
+	template <typename packType>
+	GLM_FUNC_DECL detail::tvec3packet<packType> closestPointOnLine(
+		detail::tvec3packet<packType> const & point,
+		detail::tvec3packet<packType> const & a,
+		detail::tvec3packet<packType> const & b);
+
+	/// @}
+}//namespace glm
+
+#include "intersect_packet.inl"
+
+#endif//(GLM_ARCH != GLM_ARCH_PURE)
@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_intersect_packet
+/// @file glm/gtx/intersect_packet.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <limits>
+
+namespace glm
+{
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType intersectRayPlane
+	(
+		detail::tvec3packet<packType> const & orig, detail::tvec3packet<packType> const & dir,
+		detail::tvec3packet<packType> const & planeOrig, detail::tvec3packet<packType> const & planeNormal,
+		packType & intersectionDistance
+	)
+	{
+		packType const d = dot(dir, planeNormal);
+		intersectionDistance = dot(planeOrig - orig, planeNormal) / d;
+		return d < packType(std::numeric_limits<float>::epsilon());
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType intersectRayTriangle
+	(
+		detail::tvec3packet<packType> const & orig, detail::tvec3packet<packType> const & dir,
+		detail::tvec3packet<packType> const & vert0, detail::tvec3packet<packType> const & vert1, detail::tvec3packet<packType> const & vert2,
+		detail::tvec3packet<packType> & baryPosition
+	)
+	{
+		detail::tvec3packet<packType> const e1(vert1 - vert0);
+		detail::tvec3packet<packType> const e2(vert2 - vert0);
+
+		detail::tvec3packet<packType> const p(cross(dir, e2));
+		packType const a = dot(e1, p);
+		packType const f = packType(1.0f) / a;
+
+		detail::tvec3packet<packType> const s(orig - vert0);
+		detail::tvec3packet<packType> const q(cross(s, e1));
+		baryPosition.x = f * dot(s, p);
+		baryPosition.y = f * dot(dir, q);
+		baryPosition.z = f * dot(e2, q);
+
+		packType const Zero(0.0f);
+		return
+			(a >= packType(std::numeric_limits<float>::epsilon())) &
+			(baryPosition.x >= Zero) & (baryPosition.y >= Zero) &
+			(baryPosition.x + baryPosition.y <= packType(1.0f)) &
+			(baryPosition.z >= Zero);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType intersectRaySphere
+	(
+		detail::tvec3packet<packType> const & rayStarting, detail::tvec3packet<packType> const & rayNormalizedDirection,
+		detail::tvec3packet<packType> const & sphereCenter, packType const & sphereRadiusSquared,
+		packType & intersectionDistance
+	)
+	{
+		packType const Epsilon(std::numeric_limits<float>::epsilon());
+		detail::tvec3packet<packType> const diff(sphereCenter - rayStarting);
+		packType const t0 = dot(diff, rayNormalizedDirection);
+		packType const dSquared = dot(diff, diff) - t0 * t0;
+		packType const t1 = sqrt(max(sphereRadiusSquared - dSquared, packType(0.0f)));
+		intersectionDistance = select(t0 > t1 + Epsilon, t0 - t1, t0 + t1);
+		return (dSquared <= sphereRadiusSquared) & (intersectionDistance > Epsilon);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType intersectRayAABB
+	(
+		detail::tvec3packet<packType> const & orig, detail::tvec3packet<packType> const & dir,
+		detail::tvec3packet<packType> const & boxMin, detail::tvec3packet<packType> const & boxMax,
+		packType & intersectionDistance
+	)
+	{
+		packType const One(1.0f);
+		detail::tvec3packet<packType> const InvDir(One / dir.x, One / dir.y, One / dir.z);
+		detail::tvec3packet<packType> const t0((boxMin - orig) * InvDir);
+		detail::tvec3packet<packType> const t1((boxMax - orig) * InvDir);
+
+		packType const Enter = max(max(min(t0.x, t1.x), min(t0.y, t1.y)), max(min(t0.z, t1.z), packType(0.0f)));
+		packType const Exit = min(min(max(t0.x, t1.x), max(t0.y, t1.y)), max(t0.z, t1.z));
+
+		intersectionDistance = Enter;
+		return Enter <= Exit;
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType intersectAABBAABB
+	(
+		detail::tvec3packet<packType> const & minA, detail::tvec3packet<packType> const & maxA,
+		detail::tvec3packet<packType> const & minB, detail::tvec3packet<packType> const & maxB
+	)
+	{
+		return
+			(minA.x <= maxB.x) & (minA.y <= maxB.y) & (minA.z <= maxB.z) &
+			(minB.x <= maxA.x) & (minB.y <= maxA.y) & (minB.z <= maxA.z);
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER packType intersectSphereFrustum
+	(
+		detail::tvec3packet<packType> const & sphereCenter, packType const & sphereRadius,
+		tvec4<float, P> const * frustumPlanes
+	)
+	{
+		packType const NegativeRadius(-sphereRadius);
+		packType Result(packType(0.0f) == packType(0.0f));
+		for(length_t i = 0; i < 6; ++i)
+		{
+			packType const Distance =
+				sphereCenter.x * packType(frustumPlanes[i].x) +
+				sphereCenter.y * packType(frustumPlanes[i].y) +
+				sphereCenter.z * packType(frustumPlanes[i].z) +
+				packType(frustumPlanes[i].w);
+			Result = Result & (Distance >= NegativeRadius);
+		}
+		return Result;
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType intersectRayOBB
+	(
+		detail::tvec3packet<packType> const & orig, detail::tvec3packet<packType> const & dir,
+		detail::tvec3packet<packType> const & obbCenter, detail::tvec3packet<packType> const & obbExtent, detail::tvec3packet<packType> const * obbAxes,
+		packType & intersectionDistance
+	)
+	{
+		// The rays in the space of the boxes, the rotations preserve the distances
+		detail::tvec3packet<packType> const Delta(orig - obbCenter);
+		detail::tvec3packet<packType> const LocalOrig(dot(Delta, obbAxes[0]), dot(Delta, obbAxes[1]), dot(Delta, obbAxes[2]));
+		detail::tvec3packet<packType> const LocalDir(dot(dir, obbAxes[0]), dot(dir, obbAxes[1]), dot(dir, obbAxes[2]));
+		return intersectRayAABB(LocalOrig, LocalDir, -obbExtent, obbExtent, intersectionDistance);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType intersectOBBOBB
+	(
+		detail::tvec3packet<packType> const & centerA, detail::tvec3packet<packType> const & extentA, detail::tvec3packet<packType> const * axesA,
+		detail::tvec3packet<packType> const & centerB, detail::tvec3packet<packType> const & extentB, detail::tvec3packet<packType> const * axesB
+	)
+	{
+		packType const Epsilon(std::numeric_limits<float>::epsilon());
+
+		// R[i][j] is the cosine between the axis i of A and the axis j of B
+		packType R[3][3];
+		packType AbsR[3][3];
+		for(length_t i = 0; i < 3; ++i)
+		for(length_t j = 0; j < 3; ++j)
+		{
+			R[i][j] = dot(axesA[i], axesB[j]);
+			AbsR[i][j] = abs(R[i][j]) + Epsilon;
+		}
+
+		detail::tvec3packet<packType> const Delta(centerB - centerA);
+		packType const t[3] = {dot(Delta, axesA[0]), dot(Delta, axesA[1]), dot(Delta, axesA[2])};
+		packType const ea[3] = {extentA.x, extentA.y, extentA.z};
+		packType const eb[3] = {extentB.x, extentB.y, extentB.z};
+
+		// Accumulates the separations along the 15 axes instead of branching
+		packType Separated(0.0f);
+
+		for(length_t i = 0; i < 3; ++i)
+		{
+			packType const rb = eb[0] * AbsR[i][0] + eb[1] * AbsR[i][1] + eb[2] * AbsR[i][2];
+			Separated = Separated | (abs(t[i]) > ea[i] + rb);
+		}
+
+		for(length_t j = 0; j < 3; ++j)
+		{
+			packType const ra = ea[0] * AbsR[0][j] + ea[1] * AbsR[1][j] + ea[2] * AbsR[2][j];
+			Separated = Separated | (abs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > ra + eb[j]);
+		}
+
+		for(length_t i = 0; i < 3; ++i)
+		for(length_t j = 0; j < 3; ++j)
+		{
+			length_t const i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+			length_t const j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+			packType const ra = ea[i1] * AbsR[i2][j] + ea[i2] * AbsR[i1][j];
+			packType const rb = eb[j1] * AbsR[i][j2] + eb[j2] * AbsR[i][j1];
+			Separated = Separated | (abs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb);
+		}
+
+		return ~Separated;
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> closestPointOnLine
+	(
+		detail::tvec3packet<packType> const & point,
+		detail::tvec3packet<packType> const & a,
+		detail::tvec3packet<packType> const & b
+	)
+	{
+		packType const LineLength = length(b - a);
+		detail::tvec3packet<packType> const Vector(point - a);
+		detail::tvec3packet<packType> const LineDirection((b - a) / LineLength);
+
+		// Project Vector to LineDirection to get the distance of point from a
+		packType const Distance = dot(Vector, LineDirection);
+
+		return select(Distance <= packType(0.0f), a, select(Distance >= LineLength, b, a + LineDirection * Distance));
+	}
+}//namespace glm
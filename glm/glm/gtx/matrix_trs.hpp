@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_matrix_trs
+/// @file glm/gtx/matrix_trs.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_quaternion_batch (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_matrix_trs GLM_GTX_matrix_trs
+/// @ingroup gtx
+///
+/// @brief Translation, rotation and scale decomposition and composition of affine matrices, for animation blending.
+///
+/// decomposeTRS is a reduced decompose for the matrices of skeletons: it assumes
+/// an affine matrix made of a translation, a rotation and a non-zero scale, so it
+/// ignores the last row and doesn't extract skew nor perspective. A negative
+/// determinant is reported as a negative scale along x. composeTRS is its inverse
+/// and mixTRS blends two poses, the rotations along the shortest path.
+///
+/// The batch functions process four matrices at once from SSE2, one per SIMD lane,
+/// the matrices and the transformations being transposed to structures of arrays
+/// with unaligned loads and stores. They are selected at runtime with GLM_GTX_simd_dispatch.
+///
+/// <glm/gtx/matrix_trs.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "quaternion_batch.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_matrix_trs extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_trs
+	/// @{
+
+	/// Translation, rotation and scale of an affine transformation, applied scale first.
+	/// @see gtx_matrix_trs
+	struct trs
+	{
+		vec3 Translation;
+		quat Rotation;
+		vec3 Scale;
+	};
+
+	/// Decomposes an affine matrix without skew nor perspective into translation, rotation and scale.
+	/// The scales must not be zero, a negative determinant gives a negative Scale.x.
+	/// @see gtx_matrix_trs
+	GLM_FUNC_DECL trs decomposeTRS(mat4 const & m);
+
+	/// Builds the matrix translate(Translation) * mat4_cast(Rotation) * scale(Scale).
+	/// @see gtx_matrix_trs
+	GLM_FUNC_DECL mat4 composeTRS(trs const & x);
+
+	/// Linear blend of the translations and scales, normalized linear interpolation
+	/// of the rotations along the shortest path.
+	/// @see gtx_matrix_trs
+	GLM_FUNC_DECL trs mixTRS(trs const & x, trs const & y, float a);
+
+	/// Results[i] = decomposeTRS(Src[i]) for Count matrices.
+	/// @see gtx_matrix_trs
+	GLM_FUNC_DECL void decomposeTRSBatch(mat4 const * Src, trs * Results, std::size_t Count);
+
+	/// Results[i] = composeTRS(Src[i]) for Count transformations.
+	/// @see gtx_matrix_trs
+	GLM_FUNC_DECL void composeTRSBatch(trs const * Src, mat4 * Results, std::size_t Count);
+
+	/// Results[i] = mixTRS(X[i], Y[i], a) for Count pairs of transformations, blending two poses.
+	/// @see gtx_matrix_trs
+	GLM_FUNC_DECL void mixTRSBatch(trs const * X, trs const * Y, float a, trs * Results, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_trs.inl"
@@ -0,0 +1,370 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_matrix_trs
+/// @file glm/gtx/matrix_trs.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+#	if GLM_DISPATCH_X86
+	//////////////////////////////////////
+	// Conversions between arrays of structures and packets
+
+	// Loads the first three components of the columns of the Count first matrices,
+	// the missing lanes being padded with the last matrix
+	GLM_FUNC_QUALIFIER void trs_batch_load(mat4 const * Src, std::size_t Count, tvec3packet<fpacket4SIMD> (&Columns)[4])
+	{
+		mat4 const & m0 = Src[0];
+		mat4 const & m1 = Src[Count > 1 ? 1 : Count - 1];
+		mat4 const & m2 = Src[Count > 2 ? 2 : Count - 1];
+		mat4 const & m3 = Src[Count > 3 ? 3 : Count - 1];
+
+		for(length_t c = 0; c < 4; ++c)
+		{
+			__m128 x = _mm_loadu_ps(&m0[c].x);
+			__m128 y = _mm_loadu_ps(&m1[c].x);
+			__m128 z = _mm_loadu_ps(&m2[c].x);
+			__m128 w = _mm_loadu_ps(&m3[c].x);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			Columns[c] = tvec3packet<fpacket4SIMD>(x, y, z);
+		}
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void trs_batch_store(tvec3packet<packType> const & Translation, tvec4packet<packType> const & Rotation, tvec3packet<packType> const & Scale, std::size_t Count, trs * Dst)
+	{
+		vec3 T[packType::lanes];
+		vec4 R[packType::lanes];
+		vec3 S[packType::lanes];
+		scatter(Translation, T);
+		scatter(Rotation, R);
+		scatter(Scale, S);
+
+		std::size_t const Lanes = Count < static_cast<std::size_t>(packType::lanes) ? Count : static_cast<std::size_t>(packType::lanes);
+		for(std::size_t j = 0; j < Lanes; ++j)
+		{
+			Dst[j].Translation = T[j];
+			Dst[j].Rotation = quat(R[j].w, R[j].x, R[j].y, R[j].z);
+			Dst[j].Scale = S[j];
+		}
+	}
+
+	// A trs is 10 consecutive floats: the translation, the quaternion from x to w and
+	// the scale. Four of them are transposed with three overlapping loads each.
+	GLM_FUNC_QUALIFIER void trs_batch_load(trs const * Src, std::size_t Count, tvec3packet<fpacket4SIMD> & Translation, tvec4packet<fpacket4SIMD> & Rotation, tvec3packet<fpacket4SIMD> & Scale)
+	{
+		float const * p0 = &Src[0].Translation.x;
+		float const * p1 = &Src[Count > 1 ? 1 : Count - 1].Translation.x;
+		float const * p2 = &Src[Count > 2 ? 2 : Count - 1].Translation.x;
+		float const * p3 = &Src[Count > 3 ? 3 : Count - 1].Translation.x;
+
+		__m128 a0 = _mm_loadu_ps(p0), a1 = _mm_loadu_ps(p1), a2 = _mm_loadu_ps(p2), a3 = _mm_loadu_ps(p3);
+		_MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+		__m128 b0 = _mm_loadu_ps(p0 + 4), b1 = _mm_loadu_ps(p1 + 4), b2 = _mm_loadu_ps(p2 + 4), b3 = _mm_loadu_ps(p3 + 4);
+		_MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+		__m128 c0 = _mm_loadu_ps(p0 + 6), c1 = _mm_loadu_ps(p1 + 6), c2 = _mm_loadu_ps(p2 + 6), c3 = _mm_loadu_ps(p3 + 6);
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+		Translation = tvec3packet<fpacket4SIMD>(a0, a1, a2);
+		Rotation = tvec4packet<fpacket4SIMD>(a3, b0, b1, b2);
+		Scale = tvec3packet<fpacket4SIMD>(b3, c2, c3);
+	}
+
+	GLM_FUNC_QUALIFIER void trs_batch_store(tvec3packet<fpacket4SIMD> const & Translation, tvec4packet<fpacket4SIMD> const & Rotation, tvec3packet<fpacket4SIMD> const & Scale, std::size_t Count, trs * Dst)
+	{
+		if(Count < 4)
+		{
+			trs_batch_store<fpacket4SIMD>(Translation, Rotation, Scale, Count, Dst);
+			return;
+		}
+
+		__m128 a0 = Translation.x.Data, a1 = Translation.y.Data, a2 = Translation.z.Data, a3 = Rotation.x.Data;
+		_MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+		__m128 b0 = Rotation.y.Data, b1 = Rotation.z.Data, b2 = Rotation.w.Data, b3 = Scale.x.Data;
+		_MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+		__m128 c0 = Rotation.w.Data, c1 = Scale.x.Data, c2 = Scale.y.Data, c3 = Scale.z.Data;
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+		float * p0 = &Dst[0].Translation.x;
+		float * p1 = &Dst[1].Translation.x;
+		float * p2 = &Dst[2].Translation.x;
+		float * p3 = &Dst[3].Translation.x;
+		_mm_storeu_ps(p0, a0); _mm_storeu_ps(p1, a1); _mm_storeu_ps(p2, a2); _mm_storeu_ps(p3, a3);
+		_mm_storeu_ps(p0 + 4, b0); _mm_storeu_ps(p1 + 4, b1); _mm_storeu_ps(p2 + 4, b2); _mm_storeu_ps(p3 + 4, b3);
+		_mm_storeu_ps(p0 + 6, c0); _mm_storeu_ps(p1 + 6, c1); _mm_storeu_ps(p2 + 6, c2); _mm_storeu_ps(p3 + 6, c3);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void trs_batch_store(tvec4packet<packType> const (&Columns)[4], std::size_t Count, mat4 * Dst)
+	{
+		vec4 Tail[4][packType::lanes];
+		for(length_t c = 0; c < 4; ++c)
+			scatter(Columns[c], Tail[c]);
+
+		std::size_t const Lanes = Count < static_cast<std::size_t>(packType::lanes) ? Count : static_cast<std::size_t>(packType::lanes);
+		for(std::size_t j = 0; j < Lanes; ++j)
+			Dst[j] = mat4(Tail[0][j], Tail[1][j], Tail[2][j], Tail[3][j]);
+	}
+
+	GLM_FUNC_QUALIFIER void trs_batch_store(tvec4packet<fpacket4SIMD> const (&Columns)[4], std::size_t Count, mat4 * Dst)
+	{
+		if(Count < 4)
+		{
+			trs_batch_store<fpacket4SIMD>(Columns, Count, Dst);
+			return;
+		}
+
+		for(length_t c = 0; c < 4; ++c)
+		{
+			__m128 x = Columns[c].x.Data, y = Columns[c].y.Data, z = Columns[c].z.Data, w = Columns[c].w.Data;
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(&Dst[0][c].x, x);
+			_mm_storeu_ps(&Dst[1][c].x, y);
+			_mm_storeu_ps(&Dst[2][c].x, z);
+			_mm_storeu_ps(&Dst[3][c].x, w);
+		}
+	}
+#	endif//GLM_DISPATCH_X86
+
+	//////////////////////////////////////
+	// Kernels
+
+	GLM_FUNC_QUALIFIER void trs_decompose_pure(mat4 const * Src, trs * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = decomposeTRS(Src[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void trs_compose_pure(trs const * Src, mat4 * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = composeTRS(Src[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void trs_mix_pure(trs const * X, trs const * Y, float a, trs * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = mixTRS(X[i], Y[i], a);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void trs_decompose_packet(mat4 const * Src, trs * Results, std::size_t Count)
+	{
+		packType const Zero(0.0f);
+		packType const One(1.0f);
+
+		for(std::size_t i = 0; i < Count; i += static_cast<std::size_t>(packType::lanes))
+		{
+			std::size_t const Remain = Count - i;
+
+			tvec3packet<packType> Columns[4];
+			trs_batch_load(Src + i, Remain, Columns);
+
+			tvec3packet<packType> Scale(length(Columns[0]), length(Columns[1]), length(Columns[2]));
+			Scale.x = select(dot(Columns[0], cross(Columns[1], Columns[2])) < Zero, -Scale.x, Scale.x);
+
+			tvec3packet<packType> const c0(Columns[0] * (One / Scale.x));
+			tvec3packet<packType> const c1(Columns[1] * (One / Scale.y));
+			tvec3packet<packType> const c2(Columns[2] * (One / Scale.z));
+
+			// Branchless quat_cast: the largest component is selected in the same order,
+			// its numerator being 4 * w^2 = FourBiggestSquaredMinus1 + 1
+			packType const FourW = c0.x + c1.y + c2.z;
+			packType const FourX = c0.x - c1.y - c2.z;
+			packType const FourY = c1.y - c0.x - c2.z;
+			packType const FourZ = c2.z - c0.x - c1.y;
+
+			packType Biggest = FourW;
+			packType const IsX = FourX > Biggest;
+			Biggest = select(IsX, FourX, Biggest);
+			packType const IsY = FourY > Biggest;
+			Biggest = select(IsY, FourY, Biggest);
+			packType const IsZ = FourZ > Biggest;
+			Biggest = select(IsZ, FourZ, Biggest);
+
+			packType const BiggestVal = sqrt(Biggest + One) * packType(0.5f);
+			packType const Mult = packType(0.25f) / BiggestVal;
+
+			packType const Dx = c1.z - c2.y;
+			packType const Dy = c2.x - c0.z;
+			packType const Dz = c0.y - c1.x;
+			packType const Sxy = c0.y + c1.x;
+			packType const Sxz = c2.x + c0.z;
+			packType const Syz = c1.z + c2.y;
+			packType const B = Biggest + One;
+
+			tvec4packet<packType> Rotation(Dx, Dy, Dz, B);
+			Rotation = select(IsX, tvec4packet<packType>(B, Sxy, Sxz, Dx), Rotation);
+			Rotation = select(IsY, tvec4packet<packType>(Sxy, B, Syz, Dy), Rotation);
+			Rotation = select(IsZ, tvec4packet<packType>(Sxz, Syz, B, Dz), Rotation);
+
+			trs_batch_store(Columns[3], Rotation * Mult, Scale, Remain, Results + i);
+		}
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void trs_compose_packet(trs const * Src, mat4 * Results, std::size_t Count)
+	{
+		packType const Zero(0.0f);
+		packType const One(1.0f);
+		packType const Two(2.0f);
+
+		for(std::size_t i = 0; i < Count; i += static_cast<std::size_t>(packType::lanes))
+		{
+			std::size_t const Remain = Count - i;
+
+			tvec3packet<packType> t, s;
+			tvec4packet<packType> q;
+			trs_batch_load(Src + i, Remain, t, q, s);
+
+			packType const qxx(q.x * q.x);
+			packType const qyy(q.y * q.y);
+			packType const qzz(q.z * q.z);
+			packType const qxz(q.x * q.z);
+			packType const qxy(q.x * q.y);
+			packType const qyz(q.y * q.z);
+			packType const qwx(q.w * q.x);
+			packType const qwy(q.w * q.y);
+			packType const qwz(q.w * q.z);
+
+			tvec4packet<packType> const Columns[4] = {
+				tvec4packet<packType>((One - Two * (qyy + qzz)) * s.x, Two * (qxy + qwz) * s.x, Two * (qxz - qwy) * s.x, Zero),
+				tvec4packet<packType>(Two * (qxy - qwz) * s.y, (One - Two * (qxx + qzz)) * s.y, Two * (qyz + qwx) * s.y, Zero),
+				tvec4packet<packType>(Two * (qxz + qwy) * s.z, Two * (qyz - qwx) * s.z, (One - Two * (qxx + qyy)) * s.z, Zero),
+				tvec4packet<packType>(t, One)};
+			trs_batch_store(Columns, Remain, Results + i);
+		}
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void trs_mix_packet(trs const * X, trs const * Y, float a, trs * Results, std::size_t Count)
+	{
+		packType const Weight(a);
+
+		for(std::size_t i = 0; i < Count; i += static_cast<std::size_t>(packType::lanes))
+		{
+			std::size_t const Remain = Count - i;
+
+			tvec3packet<packType> xt, xs, yt, ys;
+			tvec4packet<packType> xq, yq;
+			trs_batch_load(X + i, Remain, xt, xq, xs);
+			trs_batch_load(Y + i, Remain, yt, yq, ys);
+
+			trs_batch_store(mix(xt, yt, Weight), quat_nlerp(xq, yq, Weight), mix(xs, ys, Weight), Remain, Results + i);
+		}
+	}
+#	endif//GLM_DISPATCH_X86
+
+	// The transpositions between the structures and the packets dominate the cost
+	// of the kernels, 8 lanes aren't faster than 4 so the AVX levels use SSE2.
+	typedef void (*trs_decompose_func)(mat4 const *, trs *, std::size_t);
+	typedef void (*trs_compose_func)(trs const *, mat4 *, std::size_t);
+	typedef void (*trs_mix_func)(trs const *, trs const *, float, trs *, std::size_t);
+
+	GLM_FUNC_QUALIFIER trs_decompose_func trs_decompose_select()
+	{
+#		if GLM_DISPATCH_X86
+			static trs_decompose_func const Table[SIMD_LEVEL_COUNT] = {trs_decompose_pure, trs_decompose_packet<fpacket4SIMD>, 0, 0, 0};
+#		else
+			static trs_decompose_func const Table[SIMD_LEVEL_COUNT] = {trs_decompose_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER trs_compose_func trs_compose_select()
+	{
+#		if GLM_DISPATCH_X86
+			static trs_compose_func const Table[SIMD_LEVEL_COUNT] = {trs_compose_pure, trs_compose_packet<fpacket4SIMD>, 0, 0, 0};
+#		else
+			static trs_compose_func const Table[SIMD_LEVEL_COUNT] = {trs_compose_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER trs_mix_func trs_mix_select()
+	{
+#		if GLM_DISPATCH_X86
+			static trs_mix_func const Table[SIMD_LEVEL_COUNT] = {trs_mix_pure, trs_mix_packet<fpacket4SIMD>, 0, 0, 0};
+#		else
+			static trs_mix_func const Table[SIMD_LEVEL_COUNT] = {trs_mix_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER trs decomposeTRS(mat4 const & m)
+	{
+		vec3 const c0(m[0]);
+		vec3 const c1(m[1]);
+		vec3 const c2(m[2]);
+
+		trs Result;
+		Result.Translation = vec3(m[3]);
+		Result.Scale = vec3(length(c0), length(c1), length(c2));
+		if(dot(c0, cross(c1, c2)) < 0.0f)
+			Result.Scale.x = -Result.Scale.x;
+		Result.Rotation = quat_cast(mat3(c0 / Result.Scale.x, c1 / Result.Scale.y, c2 / Result.Scale.z));
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER mat4 composeTRS(trs const & x)
+	{
+		mat3 const Rotation(mat3_cast(x.Rotation));
+		return mat4(
+			vec4(Rotation[0] * x.Scale.x, 0.0f),
+			vec4(Rotation[1] * x.Scale.y, 0.0f),
+			vec4(Rotation[2] * x.Scale.z, 0.0f),
+			vec4(x.Translation, 1.0f));
+	}
+
+	GLM_FUNC_QUALIFIER trs mixTRS(trs const & x, trs const & y, float a)
+	{
+		trs Result;
+		Result.Translation = mix(x.Translation, y.Translation, a);
+		Result.Rotation = nlerp(x.Rotation, y.Rotation, a);
+		Result.Scale = mix(x.Scale, y.Scale, a);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void decomposeTRSBatch(mat4 const * Src, trs * Results, std::size_t Count)
+	{
+		detail::trs_decompose_select()(Src, Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void composeTRSBatch(trs const * Src, mat4 * Results, std::size_t Count)
+	{
+		detail::trs_compose_select()(Src, Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void mixTRSBatch(trs const * X, trs const * Y, float a, trs * Results, std::size_t Count)
+	{
+		detail::trs_mix_select()(X, Y, a, Results, Count);
+	}
+}//namespace glm
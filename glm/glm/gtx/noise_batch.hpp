@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_noise_batch
+/// @file glm/gtx/noise_batch.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_noise_batch GLM_GTX_noise_batch
+/// @ingroup gtx
+///
+/// @brief Evaluation of perlin and simplex noise over arrays of points and grids.
+///
+/// Each SIMD lane evaluates the noise of one point, following the same operations
+/// as the scalar functions of GLM_GTC_noise, so that the results match them up to
+/// rounding. The kernels are selected at runtime with GLM_GTX_simd_dispatch: 4 lanes
+/// from SSE2 and 8 lanes from AVX, including in builds where GLM_ARCH is lower.
+///
+/// The grid functions are evaluated in parallel over rows when OpenMP is enabled.
+///
+/// <glm/gtx/noise_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_noise_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_batch
+	/// @{
+
+	/// Results[i] = perlin(Positions[i]) for Count points.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinBatch(vec2 const * Positions, float * Results, std::size_t Count);
+
+	/// Results[i] = perlin(Positions[i]) for Count points.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinBatch(vec3 const * Positions, float * Results, std::size_t Count);
+
+	/// Results[i] = perlin(Positions[i], Rep) for Count points.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinBatch(vec2 const * Positions, vec2 const & Rep, float * Results, std::size_t Count);
+
+	/// Results[i] = perlin(Positions[i], Rep) for Count points.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinBatch(vec3 const * Positions, vec3 const & Rep, float * Results, std::size_t Count);
+
+	/// Results[i] = simplex(Positions[i]) for Count points.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void simplexBatch(vec2 const * Positions, float * Results, std::size_t Count);
+
+	/// Results[i] = simplex(Positions[i]) for Count points.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void simplexBatch(vec3 const * Positions, float * Results, std::size_t Count);
+
+	/// Results[y * Width + x] = perlin(Origin + AxisX * x + AxisY * y) for a Width x Height grid.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinGrid(vec2 const & Origin, vec2 const & AxisX, vec2 const & AxisY, std::size_t Width, std::size_t Height, float * Results);
+
+	/// Results[y * Width + x] = perlin(Origin + AxisX * x + AxisY * y) for a Width x Height grid, a plane through the 3D noise.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinGrid(vec3 const & Origin, vec3 const & AxisX, vec3 const & AxisY, std::size_t Width, std::size_t Height, float * Results);
+
+	/// Results[y * Width + x] = perlin(Origin + AxisX * x + AxisY * y, Rep) for a Width x Height grid.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinGrid(vec2 const & Origin, vec2 const & AxisX, vec2 const & AxisY, vec2 const & Rep, std::size_t Width, std::size_t Height, float * Results);
+
+	/// Results[y * Width + x] = perlin(Origin + AxisX * x + AxisY * y, Rep) for a Width x Height grid, a plane through the 3D noise.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void perlinGrid(vec3 const & Origin, vec3 const & AxisX, vec3 const & AxisY, vec3 const & Rep, std::size_t Width, std::size_t Height, float * Results);
+
+	/// Results[y * Width + x] = simplex(Origin + AxisX * x + AxisY * y) for a Width x Height grid.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void simplexGrid(vec2 const & Origin, vec2 const & AxisX, vec2 const & AxisY, std::size_t Width, std::size_t Height, float * Results);
+
+	/// Results[y * Width + x] = simplex(Origin + AxisX * x + AxisY * y) for a Width x Height grid, a plane through the 3D noise.
+	/// @see gtx_noise_batch
+	GLM_FUNC_DECL void simplexGrid(vec3 const & Origin, vec3 const & AxisX, vec3 const & AxisY, std::size_t Width, std::size_t Height, float * Results);
+
+	/// @}
+}//namespace glm
+
+#include "noise_batch.inl"
@@ -0,0 +1,694 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_noise_batch
+/// @file glm/gtx/noise_batch.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+// The packet kernels follow the operations of the webgl-noise based functions of
+// gtc/noise.inl, one point per lane instead of one corner per component.
+///////////////////////////////////////////////////////////////////////////////////
+
+#if GLM_DISPATCH_X86 && !(GLM_ARCH & GLM_ARCH_AVX)
+namespace glm{
+namespace detail
+{
+	// Eight float lanes for the AVX kernels of builds targeting a lower level than AVX,
+	// every function is compiled with GLM_TARGET_AVX and only reached through the dispatch table.
+	struct noise_packet8
+	{
+		typedef float value_type;
+
+		static GLM_RELAXED_CONSTEXPR length_t lanes = 8;
+
+		__m256 Data;
+
+		noise_packet8(){}
+		// Not trivially copyable so that it's passed and returned in memory whatever the target of a function,
+		// the generic building blocks aren't compiled for AVX when they aren't inlined
+		GLM_TARGET_AVX noise_packet8(noise_packet8 const & v) : Data(v.Data){}
+		GLM_TARGET_AVX noise_packet8(__m256 const & Data) : Data(Data){}
+		GLM_TARGET_AVX noise_packet8(float const & s) : Data(_mm256_set1_ps(s)){}
+
+		GLM_TARGET_AVX noise_packet8 & operator=(noise_packet8 const & v)
+		{
+			this->Data = v.Data;
+			return *this;
+		}
+
+		GLM_TARGET_AVX static noise_packet8 load(float const * p)
+		{
+			return noise_packet8(_mm256_loadu_ps(p));
+		}
+
+		GLM_TARGET_AVX void store(float * p) const
+		{
+			_mm256_storeu_ps(p, this->Data);
+		}
+
+		GLM_TARGET_AVX noise_packet8 & operator+=(noise_packet8 const & v)
+		{
+			this->Data = _mm256_add_ps(this->Data, v.Data);
+			return *this;
+		}
+
+		GLM_TARGET_AVX noise_packet8 & operator-=(noise_packet8 const & v)
+		{
+			this->Data = _mm256_sub_ps(this->Data, v.Data);
+			return *this;
+		}
+
+		GLM_TARGET_AVX noise_packet8 & operator*=(noise_packet8 const & v)
+		{
+			this->Data = _mm256_mul_ps(this->Data, v.Data);
+			return *this;
+		}
+	};
+
+	GLM_TARGET_AVX inline noise_packet8 operator+(noise_packet8 const & a, noise_packet8 const & b)
+	{
+		return _mm256_add_ps(a.Data, b.Data);
+	}
+
+	GLM_TARGET_AVX inline noise_packet8 operator-(noise_packet8 const & a, noise_packet8 const & b)
+	{
+		return _mm256_sub_ps(a.Data, b.Data);
+	}
+
+	GLM_TARGET_AVX inline noise_packet8 operator*(noise_packet8 const & a, noise_packet8 const & b)
+	{
+		return _mm256_mul_ps(a.Data, b.Data);
+	}
+
+	GLM_TARGET_AVX inline noise_packet8 operator/(noise_packet8 const & a, noise_packet8 const & b)
+	{
+		return _mm256_div_ps(a.Data, b.Data);
+	}
+
+	GLM_TARGET_AVX inline noise_packet8 operator-(noise_packet8 const & a)
+	{
+		return _mm256_xor_ps(a.Data, _mm256_set1_ps(-0.0f));
+	}
+
+	GLM_TARGET_AVX inline noise_packet8 operator<(noise_packet8 const & a, noise_packet8 const & b)
+	{
+		return _mm256_cmp_ps(a.Data, b.Data, _CMP_LT_OQ);
+	}
+
+	GLM_TARGET_AVX inline noise_packet8 operator>(noise_packet8 const & a, noise_packet8 const & b)
+	{
+		return _mm256_cmp_ps(a.Data, b.Data, _CMP_GT_OQ);
+	}
+}//namespace detail
+
+	GLM_TARGET_AVX inline detail::noise_packet8 select(detail::noise_packet8 const & mask, detail::noise_packet8 const & a, detail::noise_packet8 const & b)
+	{
+		return _mm256_blendv_ps(b.Data, a.Data, mask.Data);
+	}
+
+	GLM_TARGET_AVX inline detail::noise_packet8 min(detail::noise_packet8 const & a, detail::noise_packet8 const & b)
+	{
+		return _mm256_min_ps(a.Data, b.Data);
+	}
+
+	GLM_TARGET_AVX inline detail::noise_packet8 max(detail::noise_packet8 const & a, detail::noise_packet8 const & b)
+	{
+		return _mm256_max_ps(a.Data, b.Data);
+	}
+
+	GLM_TARGET_AVX inline detail::noise_packet8 abs(detail::noise_packet8 const & a)
+	{
+		return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.Data);
+	}
+
+	GLM_TARGET_AVX inline detail::noise_packet8 floor(detail::noise_packet8 const & a)
+	{
+		return _mm256_floor_ps(a.Data);
+	}
+
+	GLM_TARGET_AVX inline detail::noise_packet8 fma(detail::noise_packet8 const & a, detail::noise_packet8 const & b, detail::noise_packet8 const & c)
+	{
+		return _mm256_add_ps(_mm256_mul_ps(a.Data, b.Data), c.Data);
+	}
+}//namespace glm
+#endif//GLM_DISPATCH_X86 && !(GLM_ARCH & GLM_ARCH_AVX)
+
+namespace glm{
+namespace detail
+{
+#	if GLM_DISPATCH_X86
+	//////////////////////////////////////
+	// Packet building blocks
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_fract(packType const & x)
+	{
+		return x - glm::floor(x);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_mod(packType const & x, packType const & y)
+	{
+		return x - y * glm::floor(x / y);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_mod289(packType const & x)
+	{
+		return noise_mod(x, packType(289.0f));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_permute(packType const & x)
+	{
+		return noise_mod289((x * packType(34.0f) + packType(1.0f)) * x);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_taylorInvSqrt(packType const & r)
+	{
+		return glm::fma(packType(-0.85373472095314f), r, packType(1.79284291400159f));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_fade(packType const & t)
+	{
+		return (t * t * t) * glm::fma(t, glm::fma(t, packType(6.0f), packType(-15.0f)), packType(10.0f));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_mix(packType const & x, packType const & y, packType const & a)
+	{
+		return glm::fma(a, y - x, x);
+	}
+
+	// step(edge, x): 0 where x < edge, 1 otherwise
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_step(packType const & edge, packType const & x)
+	{
+		return glm::select(x < edge, packType(0.0f), packType(1.0f));
+	}
+
+	//////////////////////////////////////
+	// Classic perlin noise
+
+	// Contribution of one corner of the 2D perlin cell
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_perlin_grad(packType const & i, packType const & fx, packType const & fy)
+	{
+		packType gx = packType(2.0f) * noise_fract(i / packType(41.0f)) - packType(1.0f);
+		packType const gy = glm::abs(gx) - packType(0.5f);
+		gx = gx - glm::floor(gx + packType(0.5f));
+
+		packType const norm = noise_taylorInvSqrt(gx * gx + gy * gy);
+		return (gx * norm) * fx + (gy * norm) * fy;
+	}
+
+	template <bool Periodic, typename packType>
+	GLM_FUNC_QUALIFIER packType noise_perlin(tvec2packet<packType> const & Position, tvec2packet<packType> const & rep)
+	{
+		packType const Fx = glm::floor(Position.x);
+		packType const Fy = glm::floor(Position.y);
+		packType ix0 = Fx;
+		packType iy0 = Fy;
+		packType ix1 = Fx + packType(1.0f);
+		packType iy1 = Fy + packType(1.0f);
+		if(Periodic)
+		{
+			ix0 = noise_mod(ix0, rep.x);
+			iy0 = noise_mod(iy0, rep.y);
+			ix1 = noise_mod(ix1, rep.x);
+			iy1 = noise_mod(iy1, rep.y);
+		}
+		ix0 = noise_mod289(ix0);
+		iy0 = noise_mod289(iy0);
+		ix1 = noise_mod289(ix1);
+		iy1 = noise_mod289(iy1);
+
+		packType const fx0 = Position.x - Fx;
+		packType const fy0 = Position.y - Fy;
+		packType const fx1 = fx0 - packType(1.0f);
+		packType const fy1 = fy0 - packType(1.0f);
+
+		packType const hx0 = noise_permute(ix0);
+		packType const hx1 = noise_permute(ix1);
+
+		packType const n00 = noise_perlin_grad(noise_permute(hx0 + iy0), fx0, fy0);
+		packType const n10 = noise_perlin_grad(noise_permute(hx1 + iy0), fx1, fy0);
+		packType const n01 = noise_perlin_grad(noise_permute(hx0 + iy1), fx0, fy1);
+		packType const n11 = noise_perlin_grad(noise_permute(hx1 + iy1), fx1, fy1);
+
+		packType const fade_x = noise_fade(fx0);
+		packType const fade_y = noise_fade(fy0);
+		packType const n_x0 = noise_mix(n00, n10, fade_x);
+		packType const n_x1 = noise_mix(n01, n11, fade_x);
+		return packType(2.3f) * noise_mix(n_x0, n_x1, fade_y);
+	}
+
+	// Contribution of one corner of the 3D perlin cell
+	template <bool Periodic, typename packType>
+	GLM_FUNC_QUALIFIER packType noise_perlin_grad(packType const & i, packType const & fx, packType const & fy, packType const & fz)
+	{
+		packType gx = Periodic ? i / packType(7.0f) : i * packType(static_cast<float>(1.0 / 7.0));
+		packType gy = Periodic ? glm::floor(gx) / packType(7.0f) : glm::floor(gx) * packType(static_cast<float>(1.0 / 7.0));
+		gy = noise_fract(gy) - packType(0.5f);
+		gx = noise_fract(gx);
+		packType const gz = packType(0.5f) - glm::abs(gx) - glm::abs(gy);
+		packType const sz = noise_step(gz, packType(0.0f));
+		gx -= sz * (noise_step(packType(0.0f), gx) - packType(0.5f));
+		gy -= sz * (noise_step(packType(0.0f), gy) - packType(0.5f));
+
+		packType const norm = noise_taylorInvSqrt(gx * gx + gy * gy + gz * gz);
+		return (gx * norm) * fx + (gy * norm) * fy + (gz * norm) * fz;
+	}
+
+	template <bool Periodic, typename packType>
+	GLM_FUNC_QUALIFIER packType noise_perlin(tvec3packet<packType> const & Position, tvec3packet<packType> const & rep)
+	{
+		tvec3packet<packType> const F(glm::floor(Position.x), glm::floor(Position.y), glm::floor(Position.z));
+		tvec3packet<packType> Pi0(F);
+		tvec3packet<packType> Pi1(F.x + packType(1.0f), F.y + packType(1.0f), F.z + packType(1.0f));
+		if(Periodic)
+		{
+			Pi0 = tvec3packet<packType>(noise_mod(F.x, rep.x), noise_mod(F.y, rep.y), noise_mod(F.z, rep.z));
+			Pi1.x = noise_mod(Pi0.x + packType(1.0f), rep.x);
+			Pi1.y = noise_mod(Pi0.y + packType(1.0f), rep.y);
+			Pi1.z = noise_mod(Pi0.z + packType(1.0f), rep.z);
+		}
+		Pi0 = tvec3packet<packType>(noise_mod289(Pi0.x), noise_mod289(Pi0.y), noise_mod289(Pi0.z));
+		Pi1 = tvec3packet<packType>(noise_mod289(Pi1.x), noise_mod289(Pi1.y), noise_mod289(Pi1.z));
+
+		tvec3packet<packType> const Pf0 = Position - F;
+		tvec3packet<packType> const Pf1(Pf0.x - packType(1.0f), Pf0.y - packType(1.0f), Pf0.z - packType(1.0f));
+
+		packType const hx0 = noise_permute(Pi0.x);
+		packType const hx1 = noise_permute(Pi1.x);
+		packType const h00 = noise_permute(hx0 + Pi0.y);
+		packType const h10 = noise_permute(hx1 + Pi0.y);
+		packType const h01 = noise_permute(hx0 + Pi1.y);
+		packType const h11 = noise_permute(hx1 + Pi1.y);
+
+		packType const n000 = noise_perlin_grad<Periodic>(noise_permute(h00 + Pi0.z), Pf0.x, Pf0.y, Pf0.z);
+		packType const n100 = noise_perlin_grad<Periodic>(noise_permute(h10 + Pi0.z), Pf1.x, Pf0.y, Pf0.z);
+		packType const n010 = noise_perlin_grad<Periodic>(noise_permute(h01 + Pi0.z), Pf0.x, Pf1.y, Pf0.z);
+		packType const n110 = noise_perlin_grad<Periodic>(noise_permute(h11 + Pi0.z), Pf1.x, Pf1.y, Pf0.z);
+		packType const n001 = noise_perlin_grad<Periodic>(noise_permute(h00 + Pi1.z), Pf0.x, Pf0.y, Pf1.z);
+		packType const n101 = noise_perlin_grad<Periodic>(noise_permute(h10 + Pi1.z), Pf1.x, Pf0.y, Pf1.z);
+		packType const n011 = noise_perlin_grad<Periodic>(noise_permute(h01 + Pi1.z), Pf0.x, Pf1.y, Pf1.z);
+		packType const n111 = noise_perlin_grad<Periodic>(noise_permute(h11 + Pi1.z), Pf1.x, Pf1.y, Pf1.z);
+
+		packType const fade_x = noise_fade(Pf0.x);
+		packType const fade_y = noise_fade(Pf0.y);
+		packType const fade_z = noise_fade(Pf0.z);
+		packType const n_z00 = noise_mix(n000, n001, fade_z);
+		packType const n_z10 = noise_mix(n100, n101, fade_z);
+		packType const n_z01 = noise_mix(n010, n011, fade_z);
+		packType const n_z11 = noise_mix(n110, n111, fade_z);
+		packType const n_yz0 = noise_mix(n_z00, n_z01, fade_y);
+		packType const n_yz1 = noise_mix(n_z10, n_z11, fade_y);
+		return packType(2.2f) * noise_mix(n_yz0, n_yz1, fade_x);
+	}
+
+	//////////////////////////////////////
+	// Simplex noise
+
+	// Contribution of one corner of the 2D simplex
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_simplex_corner(packType const & p, packType const & x0, packType const & y0)
+	{
+		packType m = glm::max(packType(0.5f) - (x0 * x0 + y0 * y0), packType(0.0f));
+		m = m * m;
+		m = m * m;
+
+		packType const x = packType(2.0f) * noise_fract(p * packType(0.024390243902439f)) - packType(1.0f);
+		packType const h = glm::abs(x) - packType(0.5f);
+		packType const a0 = x - glm::floor(x + packType(0.5f));
+
+		m *= packType(1.79284291400159f) - packType(0.85373472095314f) * (a0 * a0 + h * h);
+		return m * (a0 * x0 + h * y0);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_simplex(tvec2packet<packType> const & v)
+	{
+		packType const C0(0.211324865405187f);	// (3.0 -  sqrt(3.0)) / 6.0
+		packType const C1(0.366025403784439f);	//  0.5 * (sqrt(3.0)  - 1.0)
+		packType const C2(-0.577350269189626f);	// -1.0 + 2.0 * C.x
+
+		// First corner
+		packType const s = v.x * C1 + v.y * C1;
+		packType ix = glm::floor(v.x + s);
+		packType iy = glm::floor(v.y + s);
+		packType const t = ix * C0 + iy * C0;
+		packType const x0 = v.x - ix + t;
+		packType const y0 = v.y - iy + t;
+
+		// Other corners
+		packType const Order = x0 > y0;
+		packType const i1x = glm::select(Order, packType(1.0f), packType(0.0f));
+		packType const i1y = glm::select(Order, packType(0.0f), packType(1.0f));
+
+		// Permutations
+		ix = noise_mod289(ix);
+		iy = noise_mod289(iy);
+		packType const p0 = noise_permute(noise_permute(iy) + ix);
+		packType const p1 = noise_permute(noise_permute(iy + i1y) + ix + i1x);
+		packType const p2 = noise_permute(noise_permute(iy + packType(1.0f)) + ix + packType(1.0f));
+
+		return packType(130.0f) * (
+			noise_simplex_corner(p0, x0, y0) +
+			noise_simplex_corner(p1, x0 + C0 - i1x, y0 + C0 - i1y) +
+			noise_simplex_corner(p2, x0 + C2, y0 + C2));
+	}
+
+	// Contribution of one corner of the 3D simplex
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_simplex_corner(packType const & p, tvec3packet<packType> const & x0)
+	{
+		// Gradients: 7x7 points over a square, mapped onto an octahedron.
+		float const n_ = 0.142857142857f; // 1.0/7.0
+		packType const nsx(n_ * 2.0f);
+		packType const nsy(n_ * 0.5f - 1.0f);
+		packType const nsz(n_);
+
+		packType const j = p - packType(49.0f) * glm::floor(p * nsz * nsz); // mod(p,7*7)
+		packType const x_ = glm::floor(j * nsz);
+		packType const y_ = glm::floor(j - packType(7.0f) * x_); // mod(j,N)
+
+		packType const x = x_ * nsx + nsy;
+		packType const y = y_ * nsx + nsy;
+		packType const h = packType(1.0f) - glm::abs(x) - glm::abs(y);
+		packType const sh = -noise_step(h, packType(0.0f));
+
+		packType const gx = x + (glm::floor(x) * packType(2.0f) + packType(1.0f)) * sh;
+		packType const gy = y + (glm::floor(y) * packType(2.0f) + packType(1.0f)) * sh;
+		packType const norm = noise_taylorInvSqrt(gx * gx + gy * gy + h * h);
+
+		packType m = glm::max(packType(0.6f) - dot(x0, x0), packType(0.0f));
+		m = m * m;
+		return (m * m) * (norm * (gx * x0.x + gy * x0.y + h * x0.z));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType noise_simplex(tvec3packet<packType> const & v)
+	{
+		packType const Cx(static_cast<float>(1.0 / 6.0));
+		packType const Cy(static_cast<float>(1.0 / 3.0));
+
+		// First corner
+		packType const s = v.x * Cy + v.y * Cy + v.z * Cy;
+		tvec3packet<packType> i(glm::floor(v.x + s), glm::floor(v.y + s), glm::floor(v.z + s));
+		packType const t = i.x * Cx + i.y * Cx + i.z * Cx;
+		tvec3packet<packType> const x0(v.x - i.x + t, v.y - i.y + t, v.z - i.z + t);
+
+		// Other corners
+		tvec3packet<packType> const g(noise_step(x0.y, x0.x), noise_step(x0.z, x0.y), noise_step(x0.x, x0.z));
+		tvec3packet<packType> const l(packType(1.0f) - g.x, packType(1.0f) - g.y, packType(1.0f) - g.z);
+		tvec3packet<packType> const i1(glm::min(g.x, l.z), glm::min(g.y, l.x), glm::min(g.z, l.y));
+		tvec3packet<packType> const i2(glm::max(g.x, l.z), glm::max(g.y, l.x), glm::max(g.z, l.y));
+
+		tvec3packet<packType> const x1(x0.x - i1.x + Cx, x0.y - i1.y + Cx, x0.z - i1.z + Cx);
+		tvec3packet<packType> const x2(x0.x - i2.x + Cy, x0.y - i2.y + Cy, x0.z - i2.z + Cy);
+		tvec3packet<packType> const x3(x0.x - packType(0.5f), x0.y - packType(0.5f), x0.z - packType(0.5f));
+
+		// Permutations
+		i = tvec3packet<packType>(noise_mod289(i.x), noise_mod289(i.y), noise_mod289(i.z));
+		packType const One(1.0f);
+		packType const p0 = noise_permute(noise_permute(noise_permute(i.z) + i.y) + i.x);
+		packType const p1 = noise_permute(noise_permute(noise_permute(i.z + i1.z) + i.y + i1.y) + i.x + i1.x);
+		packType const p2 = noise_permute(noise_permute(noise_permute(i.z + i2.z) + i.y + i2.y) + i.x + i2.x);
+		packType const p3 = noise_permute(noise_permute(noise_permute(i.z + One) + i.y + One) + i.x + One);
+
+		return packType(42.0f) * (
+			noise_simplex_corner(p0, x0) +
+			noise_simplex_corner(p1, x1) +
+			noise_simplex_corner(p2, x2) +
+			noise_simplex_corner(p3, x3));
+	}
+#	endif//GLM_DISPATCH_X86
+
+	//////////////////////////////////////
+	// Noise selection, scalar reference and packet implementation
+
+	struct noise_perlin_func
+	{
+		template <typename vecType>
+		GLM_FUNC_QUALIFIER static float call(vecType const & Position, vecType const &)
+		{
+			return perlin(Position);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packVecType>
+		GLM_FUNC_QUALIFIER static typename packVecType::value_type call_packet(packVecType const & Position, packVecType const & Rep)
+		{
+			return noise_perlin<false>(Position, Rep);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct noise_perlin_periodic_func
+	{
+		template <typename vecType>
+		GLM_FUNC_QUALIFIER static float call(vecType const & Position, vecType const & Rep)
+		{
+			return perlin(Position, Rep);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packVecType>
+		GLM_FUNC_QUALIFIER static typename packVecType::value_type call_packet(packVecType const & Position, packVecType const & Rep)
+		{
+			return noise_perlin<true>(Position, Rep);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct noise_simplex_func
+	{
+		template <typename vecType>
+		GLM_FUNC_QUALIFIER static float call(vecType const & Position, vecType const &)
+		{
+			return simplex(Position);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packVecType>
+		GLM_FUNC_QUALIFIER static typename packVecType::value_type call_packet(packVecType const & Position, packVecType const &)
+		{
+			return noise_simplex(Position);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	//////////////////////////////////////
+	// Kernels
+
+	template <typename noiseType, typename vecType>
+	GLM_FUNC_QUALIFIER void noise_batch_pure(vecType const * Positions, vecType const & Rep, float * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = noiseType::call(Positions[i], Rep);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <typename packType, typename vecType>
+	struct noise_packet_vec{};
+
+	template <typename packType>
+	struct noise_packet_vec<packType, vec2>
+	{
+		typedef tvec2packet<packType> type;
+	};
+
+	template <typename packType>
+	struct noise_packet_vec<packType, vec3>
+	{
+		typedef tvec3packet<packType> type;
+	};
+
+	template <typename noiseType, typename packType, typename vecType>
+	GLM_FUNC_QUALIFIER void noise_batch_packet(vecType const * Positions, vecType const & Rep, float * Results, std::size_t Count)
+	{
+		typedef typename noise_packet_vec<packType, vecType>::type packVecType;
+		std::size_t const Lanes = static_cast<std::size_t>(packType::lanes);
+
+		packVecType const PackedRep(Rep);
+
+		std::size_t i = 0;
+		for(; i + Lanes <= Count; i += Lanes)
+		{
+			packVecType Position;
+			gather(Positions + i, Position);
+			noiseType::call_packet(Position, PackedRep).store(Results + i);
+		}
+
+		// Remaining points, padded with the last one so that they go through the same path
+		if(i < Count)
+		{
+			vecType Tail[packType::lanes];
+			float TailResults[packType::lanes];
+			for(std::size_t j = 0; j < Lanes; ++j)
+				Tail[j] = Positions[i + (i + j < Count ? j : Count - i - 1)];
+
+			packVecType Position;
+			gather(Tail, Position);
+			noiseType::call_packet(Position, PackedRep).store(TailResults);
+			for(std::size_t j = 0; i + j < Count; ++j)
+				Results[i + j] = TailResults[j];
+		}
+	}
+
+#	if !(GLM_ARCH & GLM_ARCH_AVX)
+	// The packet functions are inlined in this kernel where the AVX instructions are enabled
+	template <typename noiseType, typename vecType>
+	GLM_TARGET_AVX GLM_FLATTEN void noise_batch_avx(vecType const * Positions, vecType const & Rep, float * Results, std::size_t Count)
+	{
+		noise_batch_packet<noiseType, noise_packet8, vecType>(Positions, Rep, Results, Count);
+	}
+#	endif//!(GLM_ARCH & GLM_ARCH_AVX)
+#	endif//GLM_DISPATCH_X86
+
+	template <typename noiseType, typename vecType>
+	struct noise_kernels
+	{
+		typedef void (*batch_func)(vecType const *, vecType const &, float *, std::size_t);
+
+		static batch_func select()
+		{
+#			if GLM_DISPATCH_X86
+				static batch_func const Table[SIMD_LEVEL_COUNT] = {
+					noise_batch_pure<noiseType, vecType>,
+					noise_batch_packet<noiseType, fpacket4SIMD, vecType>,
+					0,
+#					if GLM_ARCH & GLM_ARCH_AVX
+						noise_batch_packet<noiseType, fpacket8SIMD, vecType>,
+#					else
+						noise_batch_avx<noiseType, vecType>,
+#					endif
+					0};
+#			else
+				static batch_func const Table[SIMD_LEVEL_COUNT] = {noise_batch_pure<noiseType, vecType>, 0, 0, 0, 0};
+#			endif//GLM_DISPATCH_X86
+			return simd_select(Table);
+		}
+	};
+
+	template <typename noiseType, typename vecType>
+	GLM_FUNC_QUALIFIER void noise_batch(vecType const * Positions, vecType const & Rep, float * Results, std::size_t Count)
+	{
+		noise_kernels<noiseType, vecType>::select()(Positions, Rep, Results, Count);
+	}
+
+	template <typename noiseType, typename vecType>
+	GLM_FUNC_QUALIFIER void noise_grid(vecType const & Origin, vecType const & AxisX, vecType const & AxisY, vecType const & Rep, std::size_t Width, std::size_t Height, float * Results)
+	{
+		typename noise_kernels<noiseType, vecType>::batch_func const Kernel = noise_kernels<noiseType, vecType>::select();
+
+		// Each row is processed by chunks of positions small enough to stay in the L1 cache
+		std::size_t const ChunkSize = 64;
+		int const Rows = static_cast<int>(Height);
+
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for
+#		endif//GLM_HAS_OPENMP
+		for(int y = 0; y < Rows; ++y)
+		{
+			vecType Positions[ChunkSize];
+			vecType const RowOrigin = Origin + AxisY * static_cast<float>(y);
+			float * RowResults = Results + static_cast<std::size_t>(y) * Width;
+
+			for(std::size_t x = 0; x < Width; x += ChunkSize)
+			{
+				std::size_t const Count = Width - x < ChunkSize ? Width - x : ChunkSize;
+				for(std::size_t i = 0; i < Count; ++i)
+					Positions[i] = RowOrigin + AxisX * static_cast<float>(x + i);
+				Kernel(Positions, Rep, RowResults + x, Count);
+			}
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void perlinBatch(vec2 const * Positions, float * Results, std::size_t Count)
+	{
+		detail::noise_batch<detail::noise_perlin_func>(Positions, vec2(0), Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinBatch(vec3 const * Positions, float * Results, std::size_t Count)
+	{
+		detail::noise_batch<detail::noise_perlin_func>(Positions, vec3(0), Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinBatch(vec2 const * Positions, vec2 const & Rep, float * Results, std::size_t Count)
+	{
+		detail::noise_batch<detail::noise_perlin_periodic_func>(Positions, Rep, Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinBatch(vec3 const * Positions, vec3 const & Rep, float * Results, std::size_t Count)
+	{
+		detail::noise_batch<detail::noise_perlin_periodic_func>(Positions, Rep, Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexBatch(vec2 const * Positions, float * Results, std::size_t Count)
+	{
+		detail::noise_batch<detail::noise_simplex_func>(Positions, vec2(0), Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexBatch(vec3 const * Positions, float * Results, std::size_t Count)
+	{
+		detail::noise_batch<detail::noise_simplex_func>(Positions, vec3(0), Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinGrid(vec2 const & Origin, vec2 const & AxisX, vec2 const & AxisY, std::size_t Width, std::size_t Height, float * Results)
+	{
+		detail::noise_grid<detail::noise_perlin_func>(Origin, AxisX, AxisY, vec2(0), Width, Height, Results);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinGrid(vec3 const & Origin, vec3 const & AxisX, vec3 const & AxisY, std::size_t Width, std::size_t Height, float * Results)
+	{
+		detail::noise_grid<detail::noise_perlin_func>(Origin, AxisX, AxisY, vec3(0), Width, Height, Results);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinGrid(vec2 const & Origin, vec2 const & AxisX, vec2 const & AxisY, vec2 const & Rep, std::size_t Width, std::size_t Height, float * Results)
+	{
+		detail::noise_grid<detail::noise_perlin_periodic_func>(Origin, AxisX, AxisY, Rep, Width, Height, Results);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinGrid(vec3 const & Origin, vec3 const & AxisX, vec3 const & AxisY, vec3 const & Rep, std::size_t Width, std::size_t Height, float * Results)
+	{
+		detail::noise_grid<detail::noise_perlin_periodic_func>(Origin, AxisX, AxisY, Rep, Width, Height, Results);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexGrid(vec2 const & Origin, vec2 const & AxisX, vec2 const & AxisY, std::size_t Width, std::size_t Height, float * Results)
+	{
+		detail::noise_grid<detail::noise_simplex_func>(Origin, AxisX, AxisY, vec2(0), Width, Height, Results);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexGrid(vec3 const & Origin, vec3 const & AxisX, vec3 const & AxisY, std::size_t Width, std::size_t Height, float * Results)
+	{
+		detail::noise_grid<detail::noise_simplex_func>(Origin, AxisX, AxisY, vec3(0), Width, Height, Results);
+	}
+}//namespace glm
@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_packing_batch
+/// @file glm/gtx/packing_batch.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_packing_batch GLM_GTX_packing_batch
+/// @ingroup gtx
+///
+/// @brief Conversion of arrays of values to and from the packed formats of GLM_GTC_packing.
+///
+/// The results are bit exact with the scalar functions of GLM_GTC_packing, NANs
+/// included, whichever kernel is selected at runtime by GLM_GTX_simd_dispatch.
+/// The normalized formats are rounded the same way as round, the half
+/// precision conversions round ties up like packHalf1x16, including when the F16C
+/// instructions, which round ties to even, are used.
+///
+/// <glm/gtx/packing_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/packing.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_packing_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_packing_batch
+	/// @{
+
+	/// Dst[i] = packHalf1x16(Src[i]) for Count values.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packHalfBatch(float const * Src, uint16 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackHalf1x16(Src[i]) for Count values.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackHalfBatch(uint16 const * Src, float * Dst, std::size_t Count);
+
+	/// Dst[i] = packUnorm1x8(Src[i]) for Count values.
+	/// The components of vectors are contiguous, packUnorm2x8 of an array of vec2 is packUnorm1x8Batch(&v[0].x, Dst, 2 * Count).
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packUnorm1x8Batch(float const * Src, uint8 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackUnorm1x8(Src[i]) for Count values.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackUnorm1x8Batch(uint8 const * Src, float * Dst, std::size_t Count);
+
+	/// Dst[i] = packSnorm1x8(Src[i]) for Count values.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packSnorm1x8Batch(float const * Src, uint8 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackSnorm1x8(Src[i]) for Count values.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackSnorm1x8Batch(uint8 const * Src, float * Dst, std::size_t Count);
+
+	/// Dst[i] = packUnorm1x16(Src[i]) for Count values.
+	/// The components of vectors are contiguous, packUnorm4x16 of an array of vec4 is packUnorm1x16Batch(&v[0].x, Dst, 4 * Count).
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packUnorm1x16Batch(float const * Src, uint16 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackUnorm1x16(Src[i]) for Count values.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackUnorm1x16Batch(uint16 const * Src, float * Dst, std::size_t Count);
+
+	/// Dst[i] = packSnorm1x16(Src[i]) for Count values.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packSnorm1x16Batch(float const * Src, uint16 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackSnorm1x16(Src[i]) for Count values.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackSnorm1x16Batch(uint16 const * Src, float * Dst, std::size_t Count);
+
+	/// Dst[i] = packUnorm3x10_1x2(Src[i]) for Count vectors.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packUnorm3x10_1x2Batch(vec4 const * Src, uint32 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackUnorm3x10_1x2(Src[i]) for Count vectors.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackUnorm3x10_1x2Batch(uint32 const * Src, vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = packSnorm3x10_1x2(Src[i]) for Count vectors.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packSnorm3x10_1x2Batch(vec4 const * Src, uint32 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackSnorm3x10_1x2(Src[i]) for Count vectors.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2Batch(uint32 const * Src, vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = packF2x11_1x10(Src[i]) for Count vectors.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packF2x11_1x10Batch(vec3 const * Src, uint32 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackF2x11_1x10(Src[i]) for Count vectors.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackF2x11_1x10Batch(uint32 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = packOctahedral2x8(Src[i]) for Count directions.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packOctahedral2x8Batch(vec3 const * Src, uint16 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackOctahedral2x8(Src[i]) for Count directions.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackOctahedral2x8Batch(uint16 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = packOctahedral2x16(Src[i]) for Count directions.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packOctahedral2x16Batch(vec3 const * Src, uint32 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackOctahedral2x16(Src[i]) for Count directions.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackOctahedral2x16Batch(uint32 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = packQuat3x10_1x2(Src[i]) for Count quaternions.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packQuat3x10_1x2Batch(quat const * Src, uint32 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackQuat3x10_1x2(Src[i]) for Count quaternions.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackQuat3x10_1x2Batch(uint32 const * Src, quat * Dst, std::size_t Count);
+
+	/// Dst[i] = packQuat3x20_1x2(Src[i]) for Count quaternions.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packQuat3x20_1x2Batch(quat const * Src, uint64 * Dst, std::size_t Count);
+
+	/// Dst[i] = unpackQuat3x20_1x2(Src[i]) for Count quaternions.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackQuat3x20_1x2Batch(uint64 const * Src, quat * Dst, std::size_t Count);
+
+	/// Dst[i] = packSphericalFibonacci(Src[i], Points) for Count directions, computed by several threads when OpenMP is enabled.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void packSphericalFibonacciBatch(vec3 const * Src, uint32 * Dst, std::size_t Count, uint32 Points);
+
+	/// Dst[i] = unpackSphericalFibonacci(Src[i], Points) for Count indices, computed by several threads when OpenMP is enabled.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DECL void unpackSphericalFibonacciBatch(uint32 const * Src, vec3 * Dst, std::size_t Count, uint32 Points);
+
+	/// @}
+}//namespace glm
+
+#include "packing_batch.inl"
@@ -0,0 +1,1144 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_packing_batch
+/// @file glm/gtx/packing_batch.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Scalar kernel, also used for the remaining values of the SIMD kernels
+	template <typename srcType, typename dstType, typename paramType, dstType (*Func)(paramType)>
+	GLM_FUNC_QUALIFIER void packing_pure(srcType const * Src, dstType * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = Func(Src[i]);
+	}
+
+	//////////////////////////////////////
+	// Half precision kernels
+
+	GLM_FUNC_QUALIFIER void pack_half_pure(float const * Src, uint16 * Dst, std::size_t Count)
+	{
+		packing_pure<float, uint16, float, packHalf1x16>(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_half_pure(uint16 const * Src, float * Dst, std::size_t Count)
+	{
+		packing_pure<uint16, float, uint16, unpackHalf1x16>(Src, Dst, Count);
+	}
+
+#	if GLM_DISPATCH_X86
+	GLM_FUNC_QUALIFIER void pack_half_sse2(float const * Src, uint16 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i const Lo = sse_toFloat16_ps(_mm_loadu_ps(Src + i + 0));
+			__m128i const Hi = sse_toFloat16_ps(_mm_loadu_ps(Src + i + 4));
+
+			// Sign extend so that the saturating pack keeps the 16 bits untouched
+			__m128i const SignedLo = _mm_srai_epi32(_mm_slli_epi32(Lo, 16), 16);
+			__m128i const SignedHi = _mm_srai_epi32(_mm_slli_epi32(Hi, 16), 16);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_packs_epi32(SignedLo, SignedHi));
+		}
+		pack_half_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_half_sse2(uint16 const * Src, float * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i const Half = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			_mm_storeu_ps(Dst + i + 0, sse_toFloat32_ps(_mm_unpacklo_epi16(Half, _mm_setzero_si128())));
+			_mm_storeu_ps(Dst + i + 4, sse_toFloat32_ps(_mm_unpackhi_epi16(Half, _mm_setzero_si128())));
+		}
+		unpack_half_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	// vcvtps2ph rounds ties to even. Setting the last significand bit of every finite value
+	// moves the ties above the middle without making any other value cross it, so that
+	// the ties are rounded up like toFloat16. NANs are rare and converted by toFloat16,
+	// the instruction does not preserve the signaling ones.
+	GLM_TARGET_F16C inline void pack_half_f16c(float const * Src, uint16 * Dst, std::size_t Count)
+	{
+		__m256 const AbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+		__m256 const Infinity = _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000));
+		__m256 const LastBit = _mm256_castsi256_ps(_mm256_set1_epi32(1));
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m256 const v = _mm256_loadu_ps(Src + i);
+			__m256 const Finite = _mm256_cmp_ps(_mm256_and_ps(v, AbsMask), Infinity, _CMP_LT_OQ);
+			__m128i const Half = _mm256_cvtps_ph(_mm256_or_ps(v, _mm256_and_ps(Finite, LastBit)), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Half);
+
+			if(_mm256_movemask_ps(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)))
+				pack_half_pure(Src + i, Dst + i, 8);
+		}
+		pack_half_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_F16C inline void unpack_half_f16c(uint16 const * Src, float * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i const Half = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			_mm256_storeu_ps(Dst + i, _mm256_cvtph_ps(Half));
+
+			__m128i const NaN = _mm_cmpgt_epi16(_mm_and_si128(Half, _mm_set1_epi16(0x7fff)), _mm_set1_epi16(0x7c00));
+			if(_mm_movemask_epi8(NaN))
+				unpack_half_pure(Src + i, Dst + i, 8);
+		}
+		unpack_half_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	typedef void (*pack_half_func)(float const *, uint16 *, std::size_t);
+	typedef void (*unpack_half_func)(uint16 const *, float *, std::size_t);
+
+	GLM_FUNC_QUALIFIER pack_half_func pack_half_select()
+	{
+#		if GLM_DISPATCH_X86
+			static pack_half_func const Table[SIMD_LEVEL_COUNT] = {pack_half_pure, pack_half_sse2, 0, simdFeatures().F16C ? pack_half_f16c : 0, 0};
+#		else
+			static pack_half_func const Table[SIMD_LEVEL_COUNT] = {pack_half_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER unpack_half_func unpack_half_select()
+	{
+#		if GLM_DISPATCH_X86
+			static unpack_half_func const Table[SIMD_LEVEL_COUNT] = {unpack_half_pure, unpack_half_sse2, 0, simdFeatures().F16C ? unpack_half_f16c : 0, 0};
+#		else
+			static unpack_half_func const Table[SIMD_LEVEL_COUNT] = {unpack_half_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	//////////////////////////////////////
+	// Normalized kernels
+
+#	if GLM_DISPATCH_X86
+	// round for |v| < 2^23, following the implementation used by round
+	GLM_FUNC_QUALIFIER __m128i packing_round_ps(__m128 v)
+	{
+#		if GLM_HAS_CXX11_STL
+			// std::round: the fraction is exact, half away from zero
+			__m128i const Truncated = _mm_cvttps_epi32(v);
+			__m128 const Fraction = _mm_sub_ps(v, _mm_cvtepi32_ps(Truncated));
+			__m128i const Up = _mm_castps_si128(_mm_cmpge_ps(Fraction, _mm_set1_ps(0.5f)));
+			__m128i const Down = _mm_castps_si128(_mm_cmple_ps(Fraction, _mm_set1_ps(-0.5f)));
+			return _mm_add_epi32(_mm_sub_epi32(Truncated, Up), Down);
+#		else
+			// int(x + 0.5) or int(x - 0.5), the addition being rounded like the scalar one
+			__m128 const Half = _mm_or_ps(_mm_set1_ps(0.5f), _mm_and_ps(v, _mm_set1_ps(-0.0f)));
+			return _mm_cvttps_epi32(_mm_add_ps(v, Half));
+#		endif
+	}
+
+	// clamp(v, Min, 1) is min(max(v, Min), 1), maxps returns Min for NANs like max
+	GLM_FUNC_QUALIFIER __m128i packing_norm_ps(__m128 v, float Min, float Scale)
+	{
+		__m128 const Clamped = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(Min)), _mm_set1_ps(1.0f));
+		return packing_round_ps(_mm_mul_ps(Clamped, _mm_set1_ps(Scale)));
+	}
+
+	GLM_FUNC_QUALIFIER __m128 unpacking_snorm_ps(__m128i v, float Scale)
+	{
+		__m128 const Unpack = _mm_mul_ps(_mm_cvtepi32_ps(v), _mm_set1_ps(Scale));
+		return _mm_min_ps(_mm_max_ps(Unpack, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+	}
+
+	GLM_FUNC_QUALIFIER void pack_unorm8_sse2(float const * Src, uint8 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(15);
+		for(std::size_t i = 0; i < Packets; i += 16)
+		{
+			__m128i const a = packing_norm_ps(_mm_loadu_ps(Src + i + 0), 0.0f, 255.0f);
+			__m128i const b = packing_norm_ps(_mm_loadu_ps(Src + i + 4), 0.0f, 255.0f);
+			__m128i const c = packing_norm_ps(_mm_loadu_ps(Src + i + 8), 0.0f, 255.0f);
+			__m128i const d = packing_norm_ps(_mm_loadu_ps(Src + i + 12), 0.0f, 255.0f);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+		}
+		packing_pure<float, uint8, float, packUnorm1x8>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_unorm8_sse2(uint8 const * Src, float * Dst, std::size_t Count)
+	{
+		__m128i const Zero = _mm_setzero_si128();
+		__m128 const Scale = _mm_set1_ps(static_cast<float>(0.0039215686274509803921568627451)); // 1 / 255
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(15);
+		for(std::size_t i = 0; i < Packets; i += 16)
+		{
+			__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			__m128i const Lo = _mm_unpacklo_epi8(v, Zero);
+			__m128i const Hi = _mm_unpackhi_epi8(v, Zero);
+			_mm_storeu_ps(Dst + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Lo, Zero)), Scale));
+			_mm_storeu_ps(Dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Lo, Zero)), Scale));
+			_mm_storeu_ps(Dst + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Hi, Zero)), Scale));
+			_mm_storeu_ps(Dst + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Hi, Zero)), Scale));
+		}
+		packing_pure<uint8, float, uint8, unpackUnorm1x8>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void pack_snorm8_sse2(float const * Src, uint8 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(15);
+		for(std::size_t i = 0; i < Packets; i += 16)
+		{
+			__m128i const a = packing_norm_ps(_mm_loadu_ps(Src + i + 0), -1.0f, 127.0f);
+			__m128i const b = packing_norm_ps(_mm_loadu_ps(Src + i + 4), -1.0f, 127.0f);
+			__m128i const c = packing_norm_ps(_mm_loadu_ps(Src + i + 8), -1.0f, 127.0f);
+			__m128i const d = packing_norm_ps(_mm_loadu_ps(Src + i + 12), -1.0f, 127.0f);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+		}
+		packing_pure<float, uint8, float, packSnorm1x8>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_snorm8_sse2(uint8 const * Src, float * Dst, std::size_t Count)
+	{
+		float const Scale = 0.00787401574803149606299212598425f; // 1.0f / 127.0f
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(15);
+		for(std::size_t i = 0; i < Packets; i += 16)
+		{
+			// Sign extension by arithmetic shifts of the bytes placed in the high bits
+			__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			__m128i const Lo = _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8);
+			__m128i const Hi = _mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8);
+			_mm_storeu_ps(Dst + i + 0, unpacking_snorm_ps(_mm_srai_epi32(_mm_unpacklo_epi16(Lo, Lo), 16), Scale));
+			_mm_storeu_ps(Dst + i + 4, unpacking_snorm_ps(_mm_srai_epi32(_mm_unpackhi_epi16(Lo, Lo), 16), Scale));
+			_mm_storeu_ps(Dst + i + 8, unpacking_snorm_ps(_mm_srai_epi32(_mm_unpacklo_epi16(Hi, Hi), 16), Scale));
+			_mm_storeu_ps(Dst + i + 12, unpacking_snorm_ps(_mm_srai_epi32(_mm_unpackhi_epi16(Hi, Hi), 16), Scale));
+		}
+		packing_pure<uint8, float, uint8, unpackSnorm1x8>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void pack_unorm16_sse2(float const * Src, uint16 * Dst, std::size_t Count)
+	{
+		// packs_epi32 saturates to signed values, the range is moved down then back up
+		__m128i const Bias32 = _mm_set1_epi32(32768);
+		__m128i const Bias16 = _mm_set1_epi16(static_cast<short>(0x8000));
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i const a = _mm_sub_epi32(packing_norm_ps(_mm_loadu_ps(Src + i + 0), 0.0f, 65535.0f), Bias32);
+			__m128i const b = _mm_sub_epi32(packing_norm_ps(_mm_loadu_ps(Src + i + 4), 0.0f, 65535.0f), Bias32);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_xor_si128(_mm_packs_epi32(a, b), Bias16));
+		}
+		packing_pure<float, uint16, float, packUnorm1x16>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_unorm16_sse2(uint16 const * Src, float * Dst, std::size_t Count)
+	{
+		__m128i const Zero = _mm_setzero_si128();
+		__m128 const Scale = _mm_set1_ps(1.5259021896696421759365224689097e-5f); // 1.0 / 65535.0
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			_mm_storeu_ps(Dst + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, Zero)), Scale));
+			_mm_storeu_ps(Dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, Zero)), Scale));
+		}
+		packing_pure<uint16, float, uint16, unpackUnorm1x16>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void pack_snorm16_sse2(float const * Src, uint16 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i const a = packing_norm_ps(_mm_loadu_ps(Src + i + 0), -1.0f, 32767.0f);
+			__m128i const b = packing_norm_ps(_mm_loadu_ps(Src + i + 4), -1.0f, 32767.0f);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_packs_epi32(a, b));
+		}
+		packing_pure<float, uint16, float, packSnorm1x16>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_snorm16_sse2(uint16 const * Src, float * Dst, std::size_t Count)
+	{
+		float const Scale = 3.0518509475997192297128208258309e-5f; // 1.0f / 32767.0f
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			_mm_storeu_ps(Dst + i + 0, unpacking_snorm_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16), Scale));
+			_mm_storeu_ps(Dst + i + 4, unpacking_snorm_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16), Scale));
+		}
+		packing_pure<uint16, float, uint16, unpackSnorm1x16>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	//////////////////////////////////////
+	// 10_10_10_2 kernels, 4 vectors transposed to a structure of arrays
+
+	GLM_FUNC_QUALIFIER void pack_unorm3x10_1x2_sse2(vec4 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			tvec4packet<fpacket4SIMD> v;
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i, v);
+
+			__m128i const x = packing_norm_ps(v.x.Data, 0.0f, 1023.f);
+			__m128i const y = packing_norm_ps(v.y.Data, 0.0f, 1023.f);
+			__m128i const z = packing_norm_ps(v.z.Data, 0.0f, 1023.f);
+			__m128i const w = packing_norm_ps(v.w.Data, 0.0f, 3.f);
+			__m128i const Pack = _mm_or_si128(
+				_mm_or_si128(x, _mm_slli_epi32(y, 10)),
+				_mm_or_si128(_mm_slli_epi32(z, 20), _mm_slli_epi32(w, 30)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Pack);
+		}
+		packing_pure<vec4, uint32, vec4 const &, packUnorm3x10_1x2>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_unorm3x10_1x2_sse2(uint32 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		__m128i const Mask = _mm_set1_epi32(0x3ff);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m128i const Pack = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+
+			tvec4packet<fpacket4SIMD> v;
+			v.x.Data = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(Pack, Mask)), _mm_set1_ps(1023.f));
+			v.y.Data = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Pack, 10), Mask)), _mm_set1_ps(1023.f));
+			v.z.Data = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Pack, 20), Mask)), _mm_set1_ps(1023.f));
+			v.w.Data = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Pack, 30)), _mm_set1_ps(3.f));
+			compute_packet_transpose<fpacket4SIMD>::scatter(v, Dst + i);
+		}
+		packing_pure<uint32, vec4, uint32, unpackUnorm3x10_1x2>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void pack_snorm3x10_1x2_sse2(vec4 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		__m128i const Mask = _mm_set1_epi32(0x3ff);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			tvec4packet<fpacket4SIMD> v;
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i, v);
+
+			__m128i const x = _mm_and_si128(packing_norm_ps(v.x.Data, -1.0f, 511.f), Mask);
+			__m128i const y = _mm_and_si128(packing_norm_ps(v.y.Data, -1.0f, 511.f), Mask);
+			__m128i const z = _mm_and_si128(packing_norm_ps(v.z.Data, -1.0f, 511.f), Mask);
+			__m128i const w = packing_norm_ps(v.w.Data, -1.0f, 1.f);
+			__m128i const Pack = _mm_or_si128(
+				_mm_or_si128(x, _mm_slli_epi32(y, 10)),
+				_mm_or_si128(_mm_slli_epi32(z, 20), _mm_slli_epi32(w, 30)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Pack);
+		}
+		packing_pure<vec4, uint32, vec4 const &, packSnorm3x10_1x2>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_snorm3x10_1x2_sse2(uint32 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			// Sign extension by arithmetic shifts of the fields placed in the high bits
+			__m128i const Pack = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			__m128 const x = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Pack, 22), 22));
+			__m128 const y = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Pack, 12), 22));
+			__m128 const z = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Pack, 2), 22));
+			__m128 const w = _mm_cvtepi32_ps(_mm_srai_epi32(Pack, 30));
+
+			__m128 const Min = _mm_set1_ps(-1.0f);
+			__m128 const Max = _mm_set1_ps(1.0f);
+			tvec4packet<fpacket4SIMD> v;
+			v.x.Data = _mm_min_ps(_mm_max_ps(_mm_div_ps(x, _mm_set1_ps(511.f)), Min), Max);
+			v.y.Data = _mm_min_ps(_mm_max_ps(_mm_div_ps(y, _mm_set1_ps(511.f)), Min), Max);
+			v.z.Data = _mm_min_ps(_mm_max_ps(_mm_div_ps(z, _mm_set1_ps(511.f)), Min), Max);
+			v.w.Data = _mm_min_ps(_mm_max_ps(w, Min), Max);
+			compute_packet_transpose<fpacket4SIMD>::scatter(v, Dst + i);
+		}
+		packing_pure<uint32, vec4, uint32, unpackSnorm3x10_1x2>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	//////////////////////////////////////
+	// Packed float kernels
+
+	// floatTo11bit and floatTo10bit: truncated significand, zeros, NANs and infinities handled apart
+	template <int Shift>
+	GLM_FUNC_QUALIFIER __m128i packing_packed_float_ps(__m128 v)
+	{
+		int const Bits = 23 - Shift + 5;
+		__m128i const f = _mm_castps_si128(v);
+		__m128i const Exponent = _mm_and_si128(
+			_mm_srli_epi32(_mm_sub_epi32(_mm_and_si128(f, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x38000000)), Shift),
+			_mm_set1_epi32(0x1f << (23 - Shift)));
+		__m128i const Mantissa = _mm_and_si128(_mm_srli_epi32(f, Shift), _mm_set1_epi32((1 << (23 - Shift)) - 1));
+		__m128i Result = _mm_or_si128(Exponent, Mantissa);
+
+		__m128i const Inf = _mm_cmpeq_epi32(_mm_and_si128(f, _mm_set1_epi32(0x7fffffff)), _mm_set1_epi32(0x7f800000));
+		__m128i const NaN = _mm_castps_si128(_mm_cmpunord_ps(v, v));
+		__m128i const Zero = _mm_castps_si128(_mm_cmpeq_ps(v, _mm_setzero_ps()));
+		Result = _mm_or_si128(_mm_andnot_si128(Inf, Result), _mm_and_si128(Inf, _mm_set1_epi32(0x1f << (23 - Shift))));
+		Result = _mm_or_si128(_mm_andnot_si128(NaN, Result), _mm_and_si128(NaN, _mm_set1_epi32((1 << Bits) - 1)));
+		return _mm_andnot_si128(Zero, Result);
+	}
+
+	// packed11bitToFloat and packed10bitToFloat of the Bits wide fields at Offset
+	template <int Shift, int Offset>
+	GLM_FUNC_QUALIFIER __m128 unpacking_packed_float_ps(__m128i p)
+	{
+		int const Bits = 23 - Shift + 5;
+		__m128i const v = _mm_and_si128(_mm_srli_epi32(p, Offset), _mm_set1_epi32((1 << Bits) - 1));
+		__m128i const Exponent = _mm_and_si128(
+			_mm_add_epi32(_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x1f << (23 - Shift))), Shift), _mm_set1_epi32(0x38000000)),
+			_mm_set1_epi32(0x7f800000));
+		__m128i const Mantissa = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32((1 << (23 - Shift)) - 1)), Shift);
+		__m128i Result = _mm_or_si128(Exponent, Mantissa);
+
+		__m128i const Inf = _mm_cmpeq_epi32(v, _mm_set1_epi32(0x1f << (23 - Shift)));
+		__m128i const NaN = _mm_cmpeq_epi32(v, _mm_set1_epi32((1 << Bits) - 1));
+		__m128i const Zero = _mm_cmpeq_epi32(v, _mm_setzero_si128());
+		Result = _mm_or_si128(_mm_andnot_si128(Inf, Result), _mm_and_si128(Inf, _mm_castps_si128(_mm_set1_ps(std::numeric_limits<float>::infinity()))));
+		Result = _mm_or_si128(_mm_andnot_si128(NaN, Result), _mm_and_si128(NaN, _mm_castps_si128(_mm_set1_ps(std::numeric_limits<float>::quiet_NaN()))));
+		return _mm_castsi128_ps(_mm_andnot_si128(Zero, Result));
+	}
+
+	GLM_FUNC_QUALIFIER void pack_f2x11_1x10_sse2(vec3 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			tvec3packet<fpacket4SIMD> v;
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i, v);
+
+			__m128i const x = packing_packed_float_ps<17>(v.x.Data);
+			__m128i const y = packing_packed_float_ps<17>(v.y.Data);
+			__m128i const z = packing_packed_float_ps<18>(v.z.Data);
+			__m128i const Pack = _mm_or_si128(_mm_or_si128(x, _mm_slli_epi32(y, 11)), _mm_slli_epi32(z, 22));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Pack);
+		}
+		packing_pure<vec3, uint32, vec3 const &, packF2x11_1x10>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_f2x11_1x10_sse2(uint32 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m128i const Pack = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+
+			tvec3packet<fpacket4SIMD> v;
+			v.x.Data = unpacking_packed_float_ps<17, 0>(Pack);
+			v.y.Data = unpacking_packed_float_ps<17, 11>(Pack);
+			v.z.Data = unpacking_packed_float_ps<18, 22>(Pack);
+			compute_packet_transpose<fpacket4SIMD>::scatter(v, Dst + i);
+		}
+		packing_pure<uint32, vec3, uint32, unpackF2x11_1x10>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	//////////////////////////////////////
+	// Octahedral kernels
+
+	// octahedral_encode of 4 directions, p = v.xy / |v|_1 folded on the corners when v.z < 0
+	GLM_FUNC_QUALIFIER void octahedral_encode_ps(tvec3packet<fpacket4SIMD> const & v, __m128 & x, __m128 & y)
+	{
+		__m128 const AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+		__m128 const SignMask = _mm_set1_ps(-0.0f);
+		__m128 const Zero = _mm_setzero_ps();
+		__m128 const One = _mm_set1_ps(1.0f);
+
+		__m128 const Norm = _mm_add_ps(_mm_add_ps(_mm_and_ps(v.x.Data, AbsMask), _mm_and_ps(v.y.Data, AbsMask)), _mm_and_ps(v.z.Data, AbsMask));
+		__m128 const px = _mm_div_ps(v.x.Data, Norm);
+		__m128 const py = _mm_div_ps(v.y.Data, Norm);
+
+		// (1 - |p.yx|) * (p.xy >= 0 ? 1 : -1), the multiplication by -1 being a sign flip
+		__m128 const fx = _mm_xor_ps(_mm_sub_ps(One, _mm_and_ps(py, AbsMask)), _mm_andnot_ps(_mm_cmpge_ps(px, Zero), SignMask));
+		__m128 const fy = _mm_xor_ps(_mm_sub_ps(One, _mm_and_ps(px, AbsMask)), _mm_andnot_ps(_mm_cmpge_ps(py, Zero), SignMask));
+
+		__m128 const Fold = _mm_cmpnge_ps(v.z.Data, Zero);
+		x = _mm_or_ps(_mm_and_ps(Fold, fx), _mm_andnot_ps(Fold, px));
+		y = _mm_or_ps(_mm_and_ps(Fold, fy), _mm_andnot_ps(Fold, py));
+	}
+
+	// octahedral_decode of 4 directions, normalized like normalize
+	GLM_FUNC_QUALIFIER tvec3packet<fpacket4SIMD> octahedral_decode_ps(__m128 x, __m128 y)
+	{
+		__m128 const AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+		__m128 const SignMask = _mm_set1_ps(-0.0f);
+		__m128 const Zero = _mm_setzero_ps();
+
+		__m128 const z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_and_ps(x, AbsMask)), _mm_and_ps(y, AbsMask));
+		__m128 const t = _mm_max_ps(_mm_xor_ps(z, SignMask), Zero);
+
+		// v.xy += v.xy >= 0 ? -t : t
+		__m128 const tx = _mm_or_ps(_mm_and_ps(_mm_cmpge_ps(x, Zero), _mm_xor_ps(t, SignMask)), _mm_andnot_ps(_mm_cmpge_ps(x, Zero), t));
+		__m128 const ty = _mm_or_ps(_mm_and_ps(_mm_cmpge_ps(y, Zero), _mm_xor_ps(t, SignMask)), _mm_andnot_ps(_mm_cmpge_ps(y, Zero), t));
+
+		tvec3packet<fpacket4SIMD> v;
+		v.x.Data = _mm_add_ps(x, tx);
+		v.y.Data = _mm_add_ps(y, ty);
+		v.z.Data = z;
+
+		__m128 const Dot = sse_fma_ps(v.z.Data, v.z.Data, sse_fma_ps(v.y.Data, v.y.Data, _mm_mul_ps(v.x.Data, v.x.Data)));
+		__m128 const InverseSqrt = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(Dot));
+		v.x.Data = _mm_mul_ps(v.x.Data, InverseSqrt);
+		v.y.Data = _mm_mul_ps(v.y.Data, InverseSqrt);
+		v.z.Data = _mm_mul_ps(v.z.Data, InverseSqrt);
+		return v;
+	}
+
+	GLM_FUNC_QUALIFIER void pack_octahedral2x8_sse2(vec3 const * Src, uint16 * Dst, std::size_t Count)
+	{
+		__m128i const Mask = _mm_set1_epi32(0xff);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i Pack[2];
+			for(std::size_t j = 0; j < 2; ++j)
+			{
+				tvec3packet<fpacket4SIMD> v;
+				compute_packet_transpose<fpacket4SIMD>::gather(Src + i + j * 4, v);
+
+				__m128 x, y;
+				octahedral_encode_ps(v, x, y);
+				__m128i const Snorm = _mm_or_si128(
+					_mm_and_si128(packing_norm_ps(x, -1.0f, 127.0f), Mask),
+					_mm_slli_epi32(_mm_and_si128(packing_norm_ps(y, -1.0f, 127.0f), Mask), 8));
+
+				// Sign extend so that the saturating pack keeps the 16 bits untouched
+				Pack[j] = _mm_srai_epi32(_mm_slli_epi32(Snorm, 16), 16);
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), _mm_packs_epi32(Pack[0], Pack[1]));
+		}
+		packing_pure<vec3, uint16, vec3 const &, packOctahedral2x8>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_octahedral2x8_sse2(uint16 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		float const Scale = 0.00787401574803149606299212598425f; // 1.0f / 127.0f
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			__m128i const Pack[2] = {_mm_unpacklo_epi16(v, v), _mm_unpackhi_epi16(v, v)};
+			for(std::size_t j = 0; j < 2; ++j)
+			{
+				__m128 const x = unpacking_snorm_ps(_mm_srai_epi32(_mm_slli_epi32(Pack[j], 24), 24), Scale);
+				__m128 const y = unpacking_snorm_ps(_mm_srai_epi32(_mm_slli_epi32(Pack[j], 16), 24), Scale);
+				compute_packet_transpose<fpacket4SIMD>::scatter(octahedral_decode_ps(x, y), Dst + i + j * 4);
+			}
+		}
+		packing_pure<uint16, vec3, uint16, unpackOctahedral2x8>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void pack_octahedral2x16_sse2(vec3 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		__m128i const Mask = _mm_set1_epi32(0xffff);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			tvec3packet<fpacket4SIMD> v;
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i, v);
+
+			__m128 x, y;
+			octahedral_encode_ps(v, x, y);
+			__m128i const Pack = _mm_or_si128(
+				_mm_and_si128(packing_norm_ps(x, -1.0f, 32767.0f), Mask),
+				_mm_slli_epi32(packing_norm_ps(y, -1.0f, 32767.0f), 16));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Pack);
+		}
+		packing_pure<vec3, uint32, vec3 const &, packOctahedral2x16>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_octahedral2x16_sse2(uint32 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		float const Scale = 3.0518509475997192297128208258309e-5f; // 1.0f / 32767.0f
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m128i const Pack = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			__m128 const x = unpacking_snorm_ps(_mm_srai_epi32(_mm_slli_epi32(Pack, 16), 16), Scale);
+			__m128 const y = unpacking_snorm_ps(_mm_srai_epi32(Pack, 16), Scale);
+			compute_packet_transpose<fpacket4SIMD>::scatter(octahedral_decode_ps(x, y), Dst + i);
+		}
+		packing_pure<uint32, vec3, uint32, unpackOctahedral2x16>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	//////////////////////////////////////
+	// Smallest three quaternion kernels, the quaternions are handled as vec4 structures
+
+	GLM_FUNC_QUALIFIER __m128 packing_select_ps(__m128 Mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+	}
+
+	GLM_FUNC_QUALIFIER __m128i packing_select_epi32(__m128i Mask, __m128i a, __m128i b)
+	{
+		return _mm_or_si128(_mm_and_si128(Mask, a), _mm_andnot_si128(Mask, b));
+	}
+
+	// quat_smallest_three_encode of 4 quaternions: index of the largest component and the 3 other ones rounded on Bits
+	template <int Bits>
+	GLM_FUNC_QUALIFIER void quat_smallest_three_encode_ps(tvec4packet<fpacket4SIMD> const & q, __m128i & Largest, __m128i Smallest[3])
+	{
+		__m128 const AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+		__m128 const c[4] = {q.x.Data, q.y.Data, q.z.Data, q.w.Data};
+
+		// The first of the largest components like the strict comparisons of the scalar search
+		__m128i Index = _mm_setzero_si128();
+		__m128 Value = c[0];
+		__m128 Max = _mm_and_ps(c[0], AbsMask);
+		for(int i = 1; i < 4; ++i)
+		{
+			__m128 const Abs = _mm_and_ps(c[i], AbsMask);
+			__m128 const Greater = _mm_cmpgt_ps(Abs, Max);
+			Max = packing_select_ps(Greater, Abs, Max);
+			Value = packing_select_ps(Greater, c[i], Value);
+			Index = packing_select_epi32(_mm_castps_si128(Greater), _mm_set1_epi32(i), Index);
+		}
+
+		// The components before the largest one keep their slot, the following ones move down
+		__m128 const Sign = packing_select_ps(_mm_cmplt_ps(Value, _mm_setzero_ps()), _mm_set1_ps(-1.0f), _mm_set1_ps(1.0f));
+		for(int i = 0; i < 3; ++i)
+		{
+			__m128 const Before = _mm_castsi128_ps(_mm_cmpgt_epi32(Index, _mm_set1_epi32(i)));
+			__m128 const Component = packing_select_ps(Before, c[i], c[i + 1]);
+			__m128 const Unorm = sse_fma_ps(_mm_mul_ps(Component, Sign), _mm_set1_ps(0.70710678118654752440f), _mm_set1_ps(0.5f));
+			Smallest[i] = packing_norm_ps(Unorm, 0.0f, static_cast<float>((1 << Bits) - 2));
+		}
+		Largest = Index;
+	}
+
+	// quat_smallest_three_decode of 4 quaternions
+	template <int Bits>
+	GLM_FUNC_QUALIFIER tvec4packet<fpacket4SIMD> quat_smallest_three_decode_ps(__m128i Largest, __m128i const Smallest[3])
+	{
+		__m128 const Scale = _mm_set1_ps(static_cast<float>((1 << Bits) - 2));
+
+		__m128 c[3];
+		for(int i = 0; i < 3; ++i)
+			c[i] = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(Smallest[i]), Scale), _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f)), _mm_set1_ps(0.70710678118654752440f));
+
+		__m128 const Sum = sse_fma_ps(c[2], c[2], sse_fma_ps(c[1], c[1], _mm_mul_ps(c[0], c[0])));
+		__m128 const Value = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), Sum), _mm_setzero_ps()));
+
+		__m128 Result[4];
+		for(int i = 0; i < 4; ++i)
+		{
+			__m128 const Equal = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, _mm_set1_epi32(i)));
+			__m128 const Before = _mm_castsi128_ps(_mm_cmpgt_epi32(Largest, _mm_set1_epi32(i)));
+			__m128 const Component = i == 0 ? c[0] : i == 3 ? c[2] : packing_select_ps(Before, c[i], c[i - 1]);
+			Result[i] = packing_select_ps(Equal, Value, Component);
+		}
+
+		tvec4packet<fpacket4SIMD> q;
+		q.x.Data = Result[0];
+		q.y.Data = Result[1];
+		q.z.Data = Result[2];
+		q.w.Data = Result[3];
+		return q;
+	}
+
+	GLM_FUNC_QUALIFIER void pack_quat3x10_1x2_sse2(quat const * Src, uint32 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			tvec4packet<fpacket4SIMD> q;
+			compute_packet_transpose<fpacket4SIMD>::gather(reinterpret_cast<vec4 const*>(Src + i), q);
+
+			__m128i Largest, Smallest[3];
+			quat_smallest_three_encode_ps<10>(q, Largest, Smallest);
+			__m128i const Pack = _mm_or_si128(
+				_mm_or_si128(Smallest[0], _mm_slli_epi32(Smallest[1], 10)),
+				_mm_or_si128(_mm_slli_epi32(Smallest[2], 20), _mm_slli_epi32(Largest, 30)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i), Pack);
+		}
+		packing_pure<quat, uint32, quat const &, packQuat3x10_1x2>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_quat3x10_1x2_sse2(uint32 const * Src, quat * Dst, std::size_t Count)
+	{
+		__m128i const Mask = _mm_set1_epi32(0x3ff);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m128i const Pack = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i));
+			__m128i const Smallest[3] = {
+				_mm_and_si128(Pack, Mask),
+				_mm_and_si128(_mm_srli_epi32(Pack, 10), Mask),
+				_mm_and_si128(_mm_srli_epi32(Pack, 20), Mask)};
+			compute_packet_transpose<fpacket4SIMD>::scatter(quat_smallest_three_decode_ps<10>(_mm_srli_epi32(Pack, 30), Smallest), reinterpret_cast<vec4*>(Dst + i));
+		}
+		packing_pure<uint32, quat, uint32, unpackQuat3x10_1x2>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void pack_quat3x20_1x2_sse2(quat const * Src, uint64 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			tvec4packet<fpacket4SIMD> q;
+			compute_packet_transpose<fpacket4SIMD>::gather(reinterpret_cast<vec4 const*>(Src + i), q);
+
+			__m128i Largest, Smallest[3];
+			quat_smallest_three_encode_ps<20>(q, Largest, Smallest);
+
+			// The 32-bit fields are widened to 64-bit lanes, 2 quaternions at a time
+			__m128i const Zero = _mm_setzero_si128();
+			__m128i const Lo = _mm_or_si128(
+				_mm_or_si128(_mm_unpacklo_epi32(Smallest[0], Zero), _mm_slli_epi64(_mm_unpacklo_epi32(Smallest[1], Zero), 20)),
+				_mm_or_si128(_mm_slli_epi64(_mm_unpacklo_epi32(Smallest[2], Zero), 40), _mm_slli_epi64(_mm_unpacklo_epi32(Largest, Zero), 60)));
+			__m128i const Hi = _mm_or_si128(
+				_mm_or_si128(_mm_unpackhi_epi32(Smallest[0], Zero), _mm_slli_epi64(_mm_unpackhi_epi32(Smallest[1], Zero), 20)),
+				_mm_or_si128(_mm_slli_epi64(_mm_unpackhi_epi32(Smallest[2], Zero), 40), _mm_slli_epi64(_mm_unpackhi_epi32(Largest, Zero), 60)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i + 0), Lo);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i + 2), Hi);
+		}
+		packing_pure<quat, uint64, quat const &, packQuat3x20_1x2>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void unpack_quat3x20_1x2_sse2(uint64 const * Src, quat * Dst, std::size_t Count)
+	{
+		__m128i const Mask = _mm_set1_epi32(0xfffff);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m128i const Lo = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i + 0));
+			__m128i const Hi = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i + 2));
+
+			// The low 32 bits of the shifted 64-bit lanes of the 4 values
+			__m128i Fields[4];
+			for(int j = 0; j < 4; ++j)
+			{
+				__m128 const a = _mm_castsi128_ps(_mm_srli_epi64(Lo, j * 20));
+				__m128 const b = _mm_castsi128_ps(_mm_srli_epi64(Hi, j * 20));
+				Fields[j] = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+			}
+
+			__m128i const Smallest[3] = {
+				_mm_and_si128(Fields[0], Mask),
+				_mm_and_si128(Fields[1], Mask),
+				_mm_and_si128(Fields[2], Mask)};
+			__m128i const Largest = _mm_and_si128(Fields[3], _mm_set1_epi32(3));
+			compute_packet_transpose<fpacket4SIMD>::scatter(quat_smallest_three_decode_ps<20>(Largest, Smallest), reinterpret_cast<vec4*>(Dst + i));
+		}
+		packing_pure<uint64, quat, uint64, unpackQuat3x20_1x2>(Src + Packets, Dst + Packets, Count - Packets);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	typedef void (*packing_float_uint8_func)(float const *, uint8 *, std::size_t);
+	typedef void (*packing_uint8_float_func)(uint8 const *, float *, std::size_t);
+	typedef void (*packing_float_uint16_func)(float const *, uint16 *, std::size_t);
+	typedef void (*packing_uint16_float_func)(uint16 const *, float *, std::size_t);
+	typedef void (*packing_vec4_uint32_func)(vec4 const *, uint32 *, std::size_t);
+	typedef void (*packing_uint32_vec4_func)(uint32 const *, vec4 *, std::size_t);
+	typedef void (*packing_vec3_uint32_func)(vec3 const *, uint32 *, std::size_t);
+	typedef void (*packing_uint32_vec3_func)(uint32 const *, vec3 *, std::size_t);
+	typedef void (*packing_vec3_uint16_func)(vec3 const *, uint16 *, std::size_t);
+	typedef void (*packing_uint16_vec3_func)(uint16 const *, vec3 *, std::size_t);
+	typedef void (*packing_quat_uint32_func)(quat const *, uint32 *, std::size_t);
+	typedef void (*packing_uint32_quat_func)(uint32 const *, quat *, std::size_t);
+	typedef void (*packing_quat_uint64_func)(quat const *, uint64 *, std::size_t);
+	typedef void (*packing_uint64_quat_func)(uint64 const *, quat *, std::size_t);
+
+	GLM_FUNC_QUALIFIER packing_float_uint8_func pack_unorm8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_float_uint8_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<float, uint8, float, packUnorm1x8>, pack_unorm8_sse2, 0, 0, 0};
+#		else
+			static packing_float_uint8_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<float, uint8, float, packUnorm1x8>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint8_float_func unpack_unorm8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint8_float_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint8, float, uint8, unpackUnorm1x8>, unpack_unorm8_sse2, 0, 0, 0};
+#		else
+			static packing_uint8_float_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint8, float, uint8, unpackUnorm1x8>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_float_uint8_func pack_snorm8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_float_uint8_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<float, uint8, float, packSnorm1x8>, pack_snorm8_sse2, 0, 0, 0};
+#		else
+			static packing_float_uint8_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<float, uint8, float, packSnorm1x8>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint8_float_func unpack_snorm8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint8_float_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint8, float, uint8, unpackSnorm1x8>, unpack_snorm8_sse2, 0, 0, 0};
+#		else
+			static packing_uint8_float_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint8, float, uint8, unpackSnorm1x8>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_float_uint16_func pack_unorm16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_float_uint16_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<float, uint16, float, packUnorm1x16>, pack_unorm16_sse2, 0, 0, 0};
+#		else
+			static packing_float_uint16_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<float, uint16, float, packUnorm1x16>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint16_float_func unpack_unorm16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint16_float_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint16, float, uint16, unpackUnorm1x16>, unpack_unorm16_sse2, 0, 0, 0};
+#		else
+			static packing_uint16_float_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint16, float, uint16, unpackUnorm1x16>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_float_uint16_func pack_snorm16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_float_uint16_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<float, uint16, float, packSnorm1x16>, pack_snorm16_sse2, 0, 0, 0};
+#		else
+			static packing_float_uint16_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<float, uint16, float, packSnorm1x16>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint16_float_func unpack_snorm16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint16_float_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint16, float, uint16, unpackSnorm1x16>, unpack_snorm16_sse2, 0, 0, 0};
+#		else
+			static packing_uint16_float_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint16, float, uint16, unpackSnorm1x16>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_vec4_uint32_func pack_unorm3x10_1x2_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_vec4_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec4, uint32, vec4 const &, packUnorm3x10_1x2>, pack_unorm3x10_1x2_sse2, 0, 0, 0};
+#		else
+			static packing_vec4_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec4, uint32, vec4 const &, packUnorm3x10_1x2>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint32_vec4_func unpack_unorm3x10_1x2_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint32_vec4_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, vec4, uint32, unpackUnorm3x10_1x2>, unpack_unorm3x10_1x2_sse2, 0, 0, 0};
+#		else
+			static packing_uint32_vec4_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, vec4, uint32, unpackUnorm3x10_1x2>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_vec4_uint32_func pack_snorm3x10_1x2_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_vec4_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec4, uint32, vec4 const &, packSnorm3x10_1x2>, pack_snorm3x10_1x2_sse2, 0, 0, 0};
+#		else
+			static packing_vec4_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec4, uint32, vec4 const &, packSnorm3x10_1x2>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint32_vec4_func unpack_snorm3x10_1x2_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint32_vec4_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, vec4, uint32, unpackSnorm3x10_1x2>, unpack_snorm3x10_1x2_sse2, 0, 0, 0};
+#		else
+			static packing_uint32_vec4_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, vec4, uint32, unpackSnorm3x10_1x2>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_vec3_uint32_func pack_f2x11_1x10_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_vec3_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec3, uint32, vec3 const &, packF2x11_1x10>, pack_f2x11_1x10_sse2, 0, 0, 0};
+#		else
+			static packing_vec3_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec3, uint32, vec3 const &, packF2x11_1x10>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint32_vec3_func unpack_f2x11_1x10_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint32_vec3_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, vec3, uint32, unpackF2x11_1x10>, unpack_f2x11_1x10_sse2, 0, 0, 0};
+#		else
+			static packing_uint32_vec3_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, vec3, uint32, unpackF2x11_1x10>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_vec3_uint16_func pack_octahedral2x8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_vec3_uint16_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec3, uint16, vec3 const &, packOctahedral2x8>, pack_octahedral2x8_sse2, 0, 0, 0};
+#		else
+			static packing_vec3_uint16_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec3, uint16, vec3 const &, packOctahedral2x8>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint16_vec3_func unpack_octahedral2x8_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint16_vec3_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint16, vec3, uint16, unpackOctahedral2x8>, unpack_octahedral2x8_sse2, 0, 0, 0};
+#		else
+			static packing_uint16_vec3_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint16, vec3, uint16, unpackOctahedral2x8>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_vec3_uint32_func pack_octahedral2x16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_vec3_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec3, uint32, vec3 const &, packOctahedral2x16>, pack_octahedral2x16_sse2, 0, 0, 0};
+#		else
+			static packing_vec3_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<vec3, uint32, vec3 const &, packOctahedral2x16>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint32_vec3_func unpack_octahedral2x16_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint32_vec3_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, vec3, uint32, unpackOctahedral2x16>, unpack_octahedral2x16_sse2, 0, 0, 0};
+#		else
+			static packing_uint32_vec3_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, vec3, uint32, unpackOctahedral2x16>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_quat_uint32_func pack_quat3x10_1x2_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_quat_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<quat, uint32, quat const &, packQuat3x10_1x2>, pack_quat3x10_1x2_sse2, 0, 0, 0};
+#		else
+			static packing_quat_uint32_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<quat, uint32, quat const &, packQuat3x10_1x2>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint32_quat_func unpack_quat3x10_1x2_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint32_quat_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, quat, uint32, unpackQuat3x10_1x2>, unpack_quat3x10_1x2_sse2, 0, 0, 0};
+#		else
+			static packing_uint32_quat_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint32, quat, uint32, unpackQuat3x10_1x2>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_quat_uint64_func pack_quat3x20_1x2_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_quat_uint64_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<quat, uint64, quat const &, packQuat3x20_1x2>, pack_quat3x20_1x2_sse2, 0, 0, 0};
+#		else
+			static packing_quat_uint64_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<quat, uint64, quat const &, packQuat3x20_1x2>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER packing_uint64_quat_func unpack_quat3x20_1x2_select()
+	{
+#		if GLM_DISPATCH_X86
+			static packing_uint64_quat_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint64, quat, uint64, unpackQuat3x20_1x2>, unpack_quat3x20_1x2_sse2, 0, 0, 0};
+#		else
+			static packing_uint64_quat_func const Table[SIMD_LEVEL_COUNT] = {packing_pure<uint64, quat, uint64, unpackQuat3x20_1x2>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void packHalfBatch(float const * Src, uint16 * Dst, std::size_t Count)
+	{
+		detail::pack_half_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalfBatch(uint16 const * Src, float * Dst, std::size_t Count)
+	{
+		detail::unpack_half_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x8Batch(float const * Src, uint8 * Dst, std::size_t Count)
+	{
+		detail::pack_unorm8_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x8Batch(uint8 const * Src, float * Dst, std::size_t Count)
+	{
+		detail::unpack_unorm8_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x8Batch(float const * Src, uint8 * Dst, std::size_t Count)
+	{
+		detail::pack_snorm8_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x8Batch(uint8 const * Src, float * Dst, std::size_t Count)
+	{
+		detail::unpack_snorm8_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x16Batch(float const * Src, uint16 * Dst, std::size_t Count)
+	{
+		detail::pack_unorm16_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x16Batch(uint16 const * Src, float * Dst, std::size_t Count)
+	{
+		detail::unpack_unorm16_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x16Batch(float const * Src, uint16 * Dst, std::size_t Count)
+	{
+		detail::pack_snorm16_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x16Batch(uint16 const * Src, float * Dst, std::size_t Count)
+	{
+		detail::unpack_snorm16_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2Batch(vec4 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		detail::pack_unorm3x10_1x2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2Batch(uint32 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		detail::unpack_unorm3x10_1x2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2Batch(vec4 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		detail::pack_snorm3x10_1x2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2Batch(uint32 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		detail::unpack_snorm3x10_1x2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packF2x11_1x10Batch(vec3 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		detail::pack_f2x11_1x10_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF2x11_1x10Batch(uint32 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::unpack_f2x11_1x10_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral2x8Batch(vec3 const * Src, uint16 * Dst, std::size_t Count)
+	{
+		detail::pack_octahedral2x8_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral2x8Batch(uint16 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::unpack_octahedral2x8_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral2x16Batch(vec3 const * Src, uint32 * Dst, std::size_t Count)
+	{
+		detail::pack_octahedral2x16_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral2x16Batch(uint32 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::unpack_octahedral2x16_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packQuat3x10_1x2Batch(quat const * Src, uint32 * Dst, std::size_t Count)
+	{
+		detail::pack_quat3x10_1x2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQuat3x10_1x2Batch(uint32 const * Src, quat * Dst, std::size_t Count)
+	{
+		detail::unpack_quat3x10_1x2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packQuat3x20_1x2Batch(quat const * Src, uint64 * Dst, std::size_t Count)
+	{
+		detail::pack_quat3x20_1x2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQuat3x20_1x2Batch(uint64 const * Src, quat * Dst, std::size_t Count)
+	{
+		detail::unpack_quat3x20_1x2_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSphericalFibonacciBatch(vec3 const * Src, uint32 * Dst, std::size_t Count, uint32 Points)
+	{
+		// The lattice search and its double precision trigonometry don't fit SIMD lanes, the values are spread on threads
+		int const Size = static_cast<int>(Count);
+
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for
+#		endif//GLM_HAS_OPENMP
+		for(int i = 0; i < Size; ++i)
+			Dst[i] = packSphericalFibonacci(Src[i], Points);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSphericalFibonacciBatch(uint32 const * Src, vec3 * Dst, std::size_t Count, uint32 Points)
+	{
+		int const Size = static_cast<int>(Count);
+
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for
+#		endif//GLM_HAS_OPENMP
+		for(int i = 0; i < Size; ++i)
+			Dst[i] = unpackSphericalFibonacci(Src[i], Points);
+	}
+}//namespace glm
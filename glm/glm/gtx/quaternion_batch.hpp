@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_quaternion (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_quaternion_batch GLM_GTX_quaternion_batch
+/// @ingroup gtx
+///
+/// @brief Interpolation and conversion of arrays of quaternions, for animation sampling.
+///
+/// Each SIMD lane interpolates one pair of keys, the quaternions being transposed to
+/// a structure of arrays on load, so that the results match the scalar functions
+/// up to rounding. The kernels are selected at runtime with GLM_GTX_simd_dispatch:
+/// 4 lanes from SSE2 and 8 lanes when GLM_ARCH includes AVX.
+///
+/// fastSlerp is a normalized linear interpolation whose weight is corrected by a
+/// polynomial of the weight and of the cosine of the angle between the keys, it
+/// follows slerp within 0.001 radian for a fraction of its cost.
+///
+/// <glm/gtx/quaternion_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/quaternion.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_quaternion_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_batch
+	/// @{
+
+	/// Normalized linear interpolation of two quaternions, along the shortest path.
+	/// @see gtx_quaternion_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL tquat<T, P> nlerp(tquat<T, P> const & x, tquat<T, P> const & y, T a);
+
+	/// Normalized linear interpolation of two quaternions, along the shortest path,
+	/// with a weight corrected to approximate the constant angular velocity of slerp.
+	/// @see gtx_quaternion_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL tquat<T, P> fastSlerp(tquat<T, P> const & x, tquat<T, P> const & y, T a);
+
+	/// Results[i] = nlerp(X[i], Y[i], A[i]) for Count pairs of quaternions.
+	/// @see gtx_quaternion_batch
+	GLM_FUNC_DECL void nlerpBatch(quat const * X, quat const * Y, float const * A, quat * Results, std::size_t Count);
+
+	/// Results[i] = fastSlerp(X[i], Y[i], A[i]) for Count pairs of quaternions.
+	/// @see gtx_quaternion_batch
+	GLM_FUNC_DECL void fastSlerpBatch(quat const * X, quat const * Y, float const * A, quat * Results, std::size_t Count);
+
+	/// Results[i] = slerp(X[i], Y[i], A[i]) for Count pairs of quaternions.
+	/// @see gtx_quaternion_batch
+	GLM_FUNC_DECL void slerpBatch(quat const * X, quat const * Y, float const * A, quat * Results, std::size_t Count);
+
+	/// Results[i] = squad(Q1[i], Q2[i], S1[i], S2[i], H[i]) for Count segments.
+	/// @see gtx_quaternion_batch
+	GLM_FUNC_DECL void squadBatch(quat const * Q1, quat const * Q2, quat const * S1, quat const * S2, float const * H, quat * Results, std::size_t Count);
+
+	/// Results[i] = mat4_cast(Src[i]) for Count quaternions.
+	/// @see gtx_quaternion_batch
+	GLM_FUNC_DECL void mat4_castBatch(quat const * Src, mat4 * Results, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_batch.inl"
@@ -0,0 +1,429 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+// The weight correction of fastSlerp is a fit of the slerp weight over the cosine
+// of the angle between the keys, from "Approximating slerp", Arseny Kapoulkine.
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	template <typename T>
+	GLM_FUNC_QUALIFIER T quat_fast_slerp_weight(T const & CosTheta, T const & a)
+	{
+		T const d = abs(CosTheta);
+		T const A = T(1.0904) + d * (T(-3.2452) + d * (T(3.55645) - d * T(1.43519)));
+		T const B = T(0.848013) + d * (T(-1.06021) + d * T(0.215638));
+		T const k = A * (a - T(0.5)) * (a - T(0.5)) + B;
+		return a + a * (a - T(0.5)) * (a - T(1)) * k;
+	}
+
+#	if GLM_DISPATCH_X86
+	//////////////////////////////////////
+	// Packet building blocks
+
+	// acos(x) on [-1, 1] from Abramowitz and Stegun 4.4.46, absolute error below 2e-8
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType quat_acos(packType const & x)
+	{
+		packType const a = abs(x);
+		packType p = fma(packType(-0.0012624911f), a, packType(0.0066700901f));
+		p = fma(p, a, packType(-0.0170881256f));
+		p = fma(p, a, packType(0.0308918810f));
+		p = fma(p, a, packType(-0.0501743046f));
+		p = fma(p, a, packType(0.0889789874f));
+		p = fma(p, a, packType(-0.2145988016f));
+		p = fma(p, a, packType(1.5707963050f));
+		p = p * sqrt(max(packType(1.0f) - a, packType(0.0f)));
+		return select(x < packType(0.0f), packType(3.14159265358979f) - p, p);
+	}
+
+	// sin(x) reduced to [-pi/2, pi/2] as (-1)^k * sin(x - k * pi), valid for |x| < 8192 * pi
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType quat_sin(packType const & x)
+	{
+		packType const k = floor(fma(x, packType(0.318309886183791f), packType(0.5f)));
+		packType r = fma(k, packType(-3.140625f), x);
+		r = fma(k, packType(-9.67653589793e-4f), r);
+
+		packType const r2 = r * r;
+		packType p = fma(packType(-2.50521083854e-8f), r2, packType(2.75573192240e-6f));
+		p = fma(p, r2, packType(-1.98412698413e-4f));
+		p = fma(p, r2, packType(8.33333333333e-3f));
+		p = fma(p, r2, packType(-1.66666666667e-1f));
+		p = fma(p * r2, r, r);
+
+		packType const Odd = k - packType(2.0f) * floor(k * packType(0.5f));
+		return p * fma(Odd, packType(-2.0f), packType(1.0f));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> quat_nlerp(tvec4packet<packType> const & x, tvec4packet<packType> const & y, packType const & a)
+	{
+		packType const b = select(dot(x, y) < packType(0.0f), -a, a);
+		return normalize(x * (packType(1.0f) - a) + y * b);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> quat_fast_slerp(tvec4packet<packType> const & x, tvec4packet<packType> const & y, packType const & a)
+	{
+		packType const CosTheta = dot(x, y);
+		packType const d = abs(CosTheta);
+		packType const A = fma(d, fma(d, fma(d, packType(-1.43519f), packType(3.55645f)), packType(-3.2452f)), packType(1.0904f));
+		packType const B = fma(d, fma(d, packType(0.215638f), packType(-1.06021f)), packType(0.848013f));
+		packType const c = a - packType(0.5f);
+		packType const k = fma(A * c, c, B);
+		packType const b = fma(a * c * (a - packType(1.0f)), k, a);
+		return normalize(x * (packType(1.0f) - b) + y * select(CosTheta < packType(0.0f), -b, b));
+	}
+
+	// slerp when Shortest is true, mix otherwise
+	template <bool Shortest, typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> quat_slerp(tvec4packet<packType> const & x, tvec4packet<packType> const & y, packType const & a)
+	{
+		packType CosTheta = dot(x, y);
+		tvec4packet<packType> z = y;
+		if(Shortest)
+		{
+			packType const Negative = CosTheta < packType(0.0f);
+			z = select(Negative, -y, y);
+			CosTheta = select(Negative, -CosTheta, CosTheta);
+		}
+
+		// Linear interpolation where sin(angle) gets close to zero
+		packType const Linear = CosTheta > packType(1.0f - epsilon<float>());
+		packType const Angle = quat_acos(CosTheta);
+		packType const InvSin = packType(1.0f) / quat_sin(Angle);
+		packType const k0 = select(Linear, packType(1.0f) - a, quat_sin((packType(1.0f) - a) * Angle) * InvSin);
+		packType const k1 = select(Linear, a, quat_sin(a * Angle) * InvSin);
+		return x * k0 + z * k1;
+	}
+
+	//////////////////////////////////////
+	// Conversions between arrays of quaternions and packets
+
+	// Loads the Count first quaternions, the missing lanes being padded with the last one
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void quat_batch_load(quat const * Src, std::size_t Count, tvec4packet<packType> & Dst)
+	{
+		if(Count >= static_cast<std::size_t>(packType::lanes))
+			gather(reinterpret_cast<vec4 const *>(Src), Dst);
+		else
+		{
+			vec4 Tail[packType::lanes];
+			for(length_t j = 0; j < packType::lanes; ++j)
+			{
+				quat const & q = Src[static_cast<std::size_t>(j) < Count ? j : Count - 1];
+				Tail[j] = vec4(q.x, q.y, q.z, q.w);
+			}
+			gather(Tail, Dst);
+		}
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType quat_batch_load(float const * Src, std::size_t Count)
+	{
+		if(Count >= static_cast<std::size_t>(packType::lanes))
+			return packType::load(Src);
+
+		float Tail[packType::lanes];
+		for(length_t j = 0; j < packType::lanes; ++j)
+			Tail[j] = Src[static_cast<std::size_t>(j) < Count ? j : Count - 1];
+		return packType::load(Tail);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void quat_batch_store(tvec4packet<packType> const & Src, std::size_t Count, quat * Dst)
+	{
+		if(Count >= static_cast<std::size_t>(packType::lanes))
+			scatter(Src, reinterpret_cast<vec4 *>(Dst));
+		else
+		{
+			vec4 Tail[packType::lanes];
+			scatter(Src, Tail);
+			for(std::size_t j = 0; j < Count; ++j)
+				Dst[j] = quat(Tail[j].w, Tail[j].x, Tail[j].y, Tail[j].z);
+		}
+	}
+#	endif//GLM_DISPATCH_X86
+
+	//////////////////////////////////////
+	// Interpolation selection, scalar reference and packet implementation
+
+	struct quat_nlerp_func
+	{
+		GLM_FUNC_QUALIFIER static quat call(quat const & x, quat const & y, float a)
+		{
+			return nlerp(x, y, a);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec4packet<packType> call_packet(tvec4packet<packType> const & x, tvec4packet<packType> const & y, packType const & a)
+		{
+			return quat_nlerp(x, y, a);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct quat_fast_slerp_func
+	{
+		GLM_FUNC_QUALIFIER static quat call(quat const & x, quat const & y, float a)
+		{
+			return fastSlerp(x, y, a);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec4packet<packType> call_packet(tvec4packet<packType> const & x, tvec4packet<packType> const & y, packType const & a)
+		{
+			return quat_fast_slerp(x, y, a);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	struct quat_slerp_func
+	{
+		GLM_FUNC_QUALIFIER static quat call(quat const & x, quat const & y, float a)
+		{
+			return slerp(x, y, a);
+		}
+
+#		if GLM_DISPATCH_X86
+		template <typename packType>
+		GLM_FUNC_QUALIFIER static tvec4packet<packType> call_packet(tvec4packet<packType> const & x, tvec4packet<packType> const & y, packType const & a)
+		{
+			return quat_slerp<true>(x, y, a);
+		}
+#		endif//GLM_DISPATCH_X86
+	};
+
+	//////////////////////////////////////
+	// Kernels
+
+	template <typename interpolateType>
+	GLM_FUNC_QUALIFIER void quat_interpolate_pure(quat const * X, quat const * Y, float const * A, quat * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = interpolateType::call(X[i], Y[i], A[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void quat_squad_pure(quat const * Q1, quat const * Q2, quat const * S1, quat const * S2, float const * H, quat * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = squad(Q1[i], Q2[i], S1[i], S2[i], H[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void quat_mat4_cast_pure(quat const * Src, mat4 * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = mat4_cast(Src[i]);
+	}
+
+#	if GLM_DISPATCH_X86
+	template <typename interpolateType, typename packType>
+	GLM_FUNC_QUALIFIER void quat_interpolate_packet(quat const * X, quat const * Y, float const * A, quat * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; i += static_cast<std::size_t>(packType::lanes))
+		{
+			std::size_t const Remain = Count - i;
+
+			tvec4packet<packType> x, y;
+			quat_batch_load(X + i, Remain, x);
+			quat_batch_load(Y + i, Remain, y);
+			packType const a = quat_batch_load<packType>(A + i, Remain);
+			quat_batch_store(interpolateType::call_packet(x, y, a), Remain, Results + i);
+		}
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void quat_squad_packet(quat const * Q1, quat const * Q2, quat const * S1, quat const * S2, float const * H, quat * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; i += static_cast<std::size_t>(packType::lanes))
+		{
+			std::size_t const Remain = Count - i;
+
+			tvec4packet<packType> q1, q2, s1, s2;
+			quat_batch_load(Q1 + i, Remain, q1);
+			quat_batch_load(Q2 + i, Remain, q2);
+			quat_batch_load(S1 + i, Remain, s1);
+			quat_batch_load(S2 + i, Remain, s2);
+			packType const h = quat_batch_load<packType>(H + i, Remain);
+
+			tvec4packet<packType> const q = quat_slerp<false>(q1, q2, h);
+			tvec4packet<packType> const s = quat_slerp<false>(s1, s2, h);
+			quat_batch_store(quat_slerp<false>(q, s, packType(2.0f) * (packType(1.0f) - h) * h), Remain, Results + i);
+		}
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER void quat_mat4_cast_packet(quat const * Src, mat4 * Results, std::size_t Count)
+	{
+		packType const Zero(0.0f);
+		packType const One(1.0f);
+		packType const Two(2.0f);
+
+		for(std::size_t i = 0; i < Count; i += static_cast<std::size_t>(packType::lanes))
+		{
+			std::size_t const Remain = Count - i;
+
+			tvec4packet<packType> q;
+			quat_batch_load(Src + i, Remain, q);
+
+			packType const qxx(q.x * q.x);
+			packType const qyy(q.y * q.y);
+			packType const qzz(q.z * q.z);
+			packType const qxz(q.x * q.z);
+			packType const qxy(q.x * q.y);
+			packType const qyz(q.y * q.z);
+			packType const qwx(q.w * q.x);
+			packType const qwy(q.w * q.y);
+			packType const qwz(q.w * q.z);
+
+			// The columns of the matrices of the packet, transposed back to arrays of structures
+			vec4 Columns[4][packType::lanes];
+			scatter(tvec4packet<packType>(One - Two * (qyy + qzz), Two * (qxy + qwz), Two * (qxz - qwy), Zero), Columns[0]);
+			scatter(tvec4packet<packType>(Two * (qxy - qwz), One - Two * (qxx + qzz), Two * (qyz + qwx), Zero), Columns[1]);
+			scatter(tvec4packet<packType>(Two * (qxz + qwy), Two * (qyz - qwx), One - Two * (qxx + qyy), Zero), Columns[2]);
+
+			std::size_t const Lanes = Remain < static_cast<std::size_t>(packType::lanes) ? Remain : static_cast<std::size_t>(packType::lanes);
+			for(std::size_t j = 0; j < Lanes; ++j)
+				Results[i + j] = mat4(Columns[0][j], Columns[1][j], Columns[2][j], vec4(0.0f, 0.0f, 0.0f, 1.0f));
+		}
+	}
+#	endif//GLM_DISPATCH_X86
+
+	template <typename interpolateType>
+	struct quat_interpolate_kernels
+	{
+		typedef void (*batch_func)(quat const *, quat const *, float const *, quat *, std::size_t);
+
+		static batch_func select()
+		{
+#			if GLM_DISPATCH_X86
+				static batch_func const Table[SIMD_LEVEL_COUNT] = {
+					quat_interpolate_pure<interpolateType>,
+					quat_interpolate_packet<interpolateType, fpacket4SIMD>,
+					0,
+#					if GLM_ARCH & GLM_ARCH_AVX
+						quat_interpolate_packet<interpolateType, fpacket8SIMD>,
+#					else
+						0,
+#					endif
+					0};
+#			else
+				static batch_func const Table[SIMD_LEVEL_COUNT] = {quat_interpolate_pure<interpolateType>, 0, 0, 0, 0};
+#			endif//GLM_DISPATCH_X86
+			return simd_select(Table);
+		}
+	};
+
+	typedef void (*quat_squad_func)(quat const *, quat const *, quat const *, quat const *, float const *, quat *, std::size_t);
+	typedef void (*quat_mat4_cast_func)(quat const *, mat4 *, std::size_t);
+
+	GLM_FUNC_QUALIFIER quat_squad_func quat_squad_select()
+	{
+#		if GLM_DISPATCH_X86
+			static quat_squad_func const Table[SIMD_LEVEL_COUNT] = {
+				quat_squad_pure,
+				quat_squad_packet<fpacket4SIMD>,
+				0,
+#				if GLM_ARCH & GLM_ARCH_AVX
+					quat_squad_packet<fpacket8SIMD>,
+#				else
+					0,
+#				endif
+				0};
+#		else
+			static quat_squad_func const Table[SIMD_LEVEL_COUNT] = {quat_squad_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER quat_mat4_cast_func quat_mat4_cast_select()
+	{
+#		if GLM_DISPATCH_X86
+			static quat_mat4_cast_func const Table[SIMD_LEVEL_COUNT] = {
+				quat_mat4_cast_pure,
+				quat_mat4_cast_packet<fpacket4SIMD>,
+				0,
+#				if GLM_ARCH & GLM_ARCH_AVX
+					quat_mat4_cast_packet<fpacket8SIMD>,
+#				else
+					0,
+#				endif
+				0};
+#		else
+			static quat_mat4_cast_func const Table[SIMD_LEVEL_COUNT] = {quat_mat4_cast_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tquat<T, P> nlerp(tquat<T, P> const & x, tquat<T, P> const & y, T a)
+	{
+		T const b = dot(x, y) < static_cast<T>(0) ? -a : a;
+		return normalize(x * (static_cast<T>(1) - a) + y * b);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tquat<T, P> fastSlerp(tquat<T, P> const & x, tquat<T, P> const & y, T a)
+	{
+		T const CosTheta = dot(x, y);
+		T const b = detail::quat_fast_slerp_weight(CosTheta, a);
+		return normalize(x * (static_cast<T>(1) - b) + y * (CosTheta < static_cast<T>(0) ? -b : b));
+	}
+
+	GLM_FUNC_QUALIFIER void nlerpBatch(quat const * X, quat const * Y, float const * A, quat * Results, std::size_t Count)
+	{
+		detail::quat_interpolate_kernels<detail::quat_nlerp_func>::select()(X, Y, A, Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastSlerpBatch(quat const * X, quat const * Y, float const * A, quat * Results, std::size_t Count)
+	{
+		detail::quat_interpolate_kernels<detail::quat_fast_slerp_func>::select()(X, Y, A, Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void slerpBatch(quat const * X, quat const * Y, float const * A, quat * Results, std::size_t Count)
+	{
+		detail::quat_interpolate_kernels<detail::quat_slerp_func>::select()(X, Y, A, Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void squadBatch(quat const * Q1, quat const * Q2, quat const * S1, quat const * S2, float const * H, quat * Results, std::size_t Count)
+	{
+		detail::quat_squad_select()(Q1, Q2, S1, S2, H, Results, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void mat4_castBatch(quat const * Src, mat4 * Results, std::size_t Count)
+	{
+		detail::quat_mat4_cast_select()(Src, Results, Count);
+	}
+}//namespace glm
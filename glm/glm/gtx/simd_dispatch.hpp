@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_dispatch
+/// @file glm/gtx/simd_dispatch.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtx_simd_packet (dependence)
+///
+/// @defgroup gtx_simd_dispatch GLM_GTX_simd_dispatch
+/// @ingroup gtx
+///
+/// @brief Runtime selection of the instruction set used by bulk kernels.
+///
+/// GLM_ARCH is a compile time choice. This extension detects the instruction
+/// sets supported by the running CPU with cpuid, once, and routes the bulk
+/// kernels through tables of functions compiled for SSE2, SSE4.1, AVX and
+/// AVX2 + FMA, so that a single binary built for the lowest common
+/// denominator still takes advantage of recent CPUs. The selected level may be
+/// lowered with simdForceLevel, for example to compare the paths in tests.
+///
+/// Only GCC, Clang and Visual C++ on x86 are able to build the kernels of a
+/// higher level than GLM_ARCH, other configurations use the platform independent
+/// kernels.
+///
+/// <glm/gtx/simd_dispatch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_simd_dispatch extension included")
+#endif
+
+#if(defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)) && (GLM_ARCH & GLM_ARCH_SSE2)
+#	if GLM_COMPILER & GLM_COMPILER_VC
+#		include <intrin.h>
+#		define GLM_DISPATCH_X86 1
+#	elif GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_LLVM | GLM_COMPILER_APPLE_CLANG)
+#		include <cpuid.h>
+#		include <immintrin.h>
+#		define GLM_DISPATCH_X86 1
+#	else
+#		define GLM_DISPATCH_X86 0
+#	endif
+#else
+#	define GLM_DISPATCH_X86 0
+#endif
+
+// Function attributes allowing to use the instructions of a higher level than GLM_ARCH in a function
+#if GLM_DISPATCH_X86 && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_LLVM | GLM_COMPILER_APPLE_CLANG))
+#	define GLM_TARGET_SSE4 __attribute__((__target__("sse4.1")))
+#	define GLM_TARGET_AVX __attribute__((__target__("avx")))
+#	define GLM_TARGET_AVX2 __attribute__((__target__("avx2,fma")))
+#	define GLM_TARGET_F16C __attribute__((__target__("avx,f16c")))
+#	define GLM_TARGET_BMI2 __attribute__((__target__("bmi2")))
+// Inlines every call of a kernel so that generic code is also compiled with the target of the kernel
+#	define GLM_FLATTEN __attribute__((__flatten__))
+#else
+#	define GLM_TARGET_SSE4
+#	define GLM_TARGET_AVX
+#	define GLM_TARGET_AVX2
+#	define GLM_TARGET_F16C
+#	define GLM_TARGET_BMI2
+#	define GLM_FLATTEN
+#endif
+
+#if GLM_DISPATCH_X86
+#	include "simd_packet.hpp"
+#	include "../detail/intrinsic_matrix.hpp"
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_simd_dispatch
+	/// @{
+
+	/// Instruction set levels, each level implies the previous ones.
+	enum simd_level
+	{
+		SIMD_LEVEL_PURE,
+		SIMD_LEVEL_SSE2,
+		SIMD_LEVEL_SSE4,
+		SIMD_LEVEL_AVX,
+		SIMD_LEVEL_AVX2,	///< AVX2 and FMA
+		SIMD_LEVEL_COUNT
+	};
+
+	/// Instruction sets supported by the CPU and the operating system.
+	struct simd_features
+	{
+		bool SSE2;
+		bool SSE3;
+		bool SSSE3;
+		bool SSE41;
+		bool SSE42;
+		bool POPCNT;
+		bool AVX;
+		bool AVX2;
+		bool FMA;
+		bool F16C;
+		bool BMI1;
+		bool BMI2;
+	};
+
+	/// Returns the instruction sets supported by the running CPU, detected once.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL simd_features const & simdFeatures();
+
+	/// Returns the highest level supported by both the running CPU and the compiler.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL simd_level simdMaxLevel();
+
+	/// Returns the level currently used by the bulk kernels.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL simd_level simdLevel();
+
+	/// Selects the level used by the bulk kernels, clamped to simdMaxLevel.
+	/// Returns the level actually selected. Not thread safe, to be called at initialization or in tests.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL simd_level simdForceLevel(simd_level Level);
+
+	/// Returns the name of a level.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL char const * simdLevelName(simd_level Level);
+
+	/// Dst[i] = m * Src[i] for Count vectors.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL void transformBatch(mat4 const & m, vec4 const * Src, vec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = vec3(m * vec4(Src[i], 1)) for Count points, m is assumed affine.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL void transformPointBatch(mat4 const & m, vec3 const * Src, vec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = inverse(Src[i]) for Count matrices.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL void inverseBatch(mat4 const * Src, mat4 * Dst, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "simd_dispatch.inl"
@@ -0,0 +1,481 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_dispatch
+/// @file glm/gtx/simd_dispatch.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	//////////////////////////////////////
+	// Detection
+
+#	if GLM_DISPATCH_X86
+		GLM_FUNC_QUALIFIER void cpuid(unsigned int Leaf, unsigned int Subleaf, unsigned int Regs[4])
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+				int Info[4];
+				__cpuidex(Info, static_cast<int>(Leaf), static_cast<int>(Subleaf));
+				for(int i = 0; i < 4; ++i)
+					Regs[i] = static_cast<unsigned int>(Info[i]);
+#			else
+				__cpuid_count(Leaf, Subleaf, Regs[0], Regs[1], Regs[2], Regs[3]);
+#			endif
+		}
+
+		// Returns the XCR0 register, the state components enabled by the operating system
+		GLM_FUNC_QUALIFIER unsigned int xgetbv0()
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+				return static_cast<unsigned int>(_xgetbv(0));
+#			else
+				unsigned int Eax, Edx;
+				__asm__ __volatile__("xgetbv" : "=a"(Eax), "=d"(Edx) : "c"(0));
+				return Eax;
+#			endif
+		}
+#	endif//GLM_DISPATCH_X86
+
+	GLM_FUNC_QUALIFIER simd_features detect_simd_features()
+	{
+		simd_features Features = {false, false, false, false, false, false, false, false, false, false, false, false};
+
+#		if GLM_DISPATCH_X86
+			unsigned int Regs[4];
+			cpuid(0, 0, Regs);
+			unsigned int const MaxLeaf = Regs[0];
+			if(MaxLeaf < 1)
+				return Features;
+
+			cpuid(1, 0, Regs);
+			unsigned int const Ecx1 = Regs[2];
+			unsigned int const Edx1 = Regs[3];
+
+			Features.SSE2 = (Edx1 & (1u << 26)) != 0;
+			Features.SSE3 = (Ecx1 & (1u << 0)) != 0;
+			Features.SSSE3 = (Ecx1 & (1u << 9)) != 0;
+			Features.SSE41 = (Ecx1 & (1u << 19)) != 0;
+			Features.SSE42 = (Ecx1 & (1u << 20)) != 0;
+			Features.POPCNT = (Ecx1 & (1u << 23)) != 0;
+
+			// AVX registers must be saved by the operating system
+			bool const OSXSAVE = (Ecx1 & (1u << 27)) != 0;
+			bool const OSAVX = OSXSAVE && (xgetbv0() & 0x6) == 0x6;
+
+			Features.AVX = OSAVX && (Ecx1 & (1u << 28)) != 0;
+			Features.FMA = Features.AVX && (Ecx1 & (1u << 12)) != 0;
+			Features.F16C = Features.AVX && (Ecx1 & (1u << 29)) != 0;
+
+			if(MaxLeaf >= 7)
+			{
+				cpuid(7, 0, Regs);
+				unsigned int const Ebx7 = Regs[1];
+
+				Features.AVX2 = Features.AVX && (Ebx7 & (1u << 5)) != 0;
+				Features.BMI1 = (Ebx7 & (1u << 3)) != 0;
+				Features.BMI2 = (Ebx7 & (1u << 8)) != 0;
+			}
+#		endif//GLM_DISPATCH_X86
+
+		return Features;
+	}
+
+	GLM_FUNC_QUALIFIER simd_level & simd_current_level()
+	{
+		static simd_level Level = simdMaxLevel();
+		return Level;
+	}
+
+	// Returns the function of the highest level available in Table, not above the current level.
+	template <typename funcType>
+	GLM_FUNC_QUALIFIER funcType simd_select(funcType const (&Table)[SIMD_LEVEL_COUNT])
+	{
+		for(int Level = simdLevel(); Level > SIMD_LEVEL_PURE; --Level)
+			if(Table[Level])
+				return Table[Level];
+		return Table[SIMD_LEVEL_PURE];
+	}
+
+	//////////////////////////////////////
+	// transformBatch kernels
+
+	GLM_FUNC_QUALIFIER void transform_pure(mat4 const & m, vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = m * Src[i];
+	}
+
+	GLM_FUNC_QUALIFIER void transform_point_pure(mat4 const & m, vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = vec3(m * vec4(Src[i], 1.0f));
+	}
+
+	GLM_FUNC_QUALIFIER void inverse_pure(mat4 const * Src, mat4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = inverse(Src[i]);
+	}
+
+#	if GLM_DISPATCH_X86
+	GLM_FUNC_QUALIFIER void transform_sse2(mat4 const & m, vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		__m128 const c0 = _mm_loadu_ps(&m[0][0]);
+		__m128 const c1 = _mm_loadu_ps(&m[1][0]);
+		__m128 const c2 = _mm_loadu_ps(&m[2][0]);
+		__m128 const c3 = _mm_loadu_ps(&m[3][0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			__m128 const v = _mm_loadu_ps(&Src[i].x);
+			__m128 const x = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+			__m128 const y = _mm_mul_ps(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+			__m128 const z = _mm_mul_ps(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+			__m128 const w = _mm_mul_ps(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+			_mm_storeu_ps(&Dst[i].x, _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w)));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void transform_point_sse2(mat4 const & m, vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			tvec3packet<fpacket4SIMD> P;
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i, P);
+			compute_packet_transpose<fpacket4SIMD>::scatter(glm::transformPoint(m, P), Dst + i);
+		}
+		transform_point_pure(m, Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_FUNC_QUALIFIER void inverse_sse2(mat4 const * Src, mat4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			__m128 In[4];
+			__m128 Out[4];
+			for(length_t c = 0; c < 4; ++c)
+				In[c] = _mm_loadu_ps(&Src[i][c][0]);
+			sse_inverse_ps(In, Out);
+			for(length_t c = 0; c < 4; ++c)
+				_mm_storeu_ps(&Dst[i][c][0], Out[c]);
+		}
+	}
+
+	GLM_TARGET_AVX inline __m256 avx_broadcast_ps(float const * p)
+	{
+		__m128 const v = _mm_loadu_ps(p);
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(v), v, 1);
+	}
+
+	GLM_TARGET_AVX inline __m256 avx_load2_ps(float const * a, float const * b)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(a)), _mm_loadu_ps(b), 1);
+	}
+
+	GLM_TARGET_AVX inline void avx_store2_ps(float * a, float * b, __m256 v)
+	{
+		_mm_storeu_ps(a, _mm256_castps256_ps128(v));
+		_mm_storeu_ps(b, _mm256_extractf128_ps(v, 1));
+	}
+
+	GLM_TARGET_AVX inline void transform_avx(mat4 const & m, vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		__m256 const c0 = avx_broadcast_ps(&m[0][0]);
+		__m256 const c1 = avx_broadcast_ps(&m[1][0]);
+		__m256 const c2 = avx_broadcast_ps(&m[2][0]);
+		__m256 const c3 = avx_broadcast_ps(&m[3][0]);
+
+		std::size_t const Pairs = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Pairs; i += 2)
+		{
+			__m256 const v = _mm256_loadu_ps(&Src[i].x);
+			__m256 const x = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+			__m256 const y = _mm256_mul_ps(c1, _mm256_permute_ps(v, 0x55));
+			__m256 const z = _mm256_mul_ps(c2, _mm256_permute_ps(v, 0xAA));
+			__m256 const w = _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xFF));
+			_mm256_storeu_ps(&Dst[i].x, _mm256_add_ps(_mm256_add_ps(x, y), _mm256_add_ps(z, w)));
+		}
+		transform_sse2(m, Src + Pairs, Dst + Pairs, Count - Pairs);
+	}
+
+	GLM_TARGET_AVX2 inline void transform_avx2(mat4 const & m, vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		__m256 const c0 = avx_broadcast_ps(&m[0][0]);
+		__m256 const c1 = avx_broadcast_ps(&m[1][0]);
+		__m256 const c2 = avx_broadcast_ps(&m[2][0]);
+		__m256 const c3 = avx_broadcast_ps(&m[3][0]);
+
+		std::size_t const Pairs = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Pairs; i += 2)
+		{
+			__m256 const v = _mm256_loadu_ps(&Src[i].x);
+			__m256 r = _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xFF));
+			r = _mm256_fmadd_ps(c2, _mm256_permute_ps(v, 0xAA), r);
+			r = _mm256_fmadd_ps(c1, _mm256_permute_ps(v, 0x55), r);
+			r = _mm256_fmadd_ps(c0, _mm256_permute_ps(v, 0x00), r);
+			_mm256_storeu_ps(&Dst[i].x, r);
+		}
+		transform_sse2(m, Src + Pairs, Dst + Pairs, Count - Pairs);
+	}
+
+	// Two groups of 4 points are transposed with SSE then processed in 8 lanes
+	GLM_TARGET_AVX inline void transform_point_avx(mat4 const & m, vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		__m256 M[4][3];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 3; ++r)
+			M[c][r] = _mm256_set1_ps(m[c][r]);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			tvec3packet<fpacket4SIMD> Lo, Hi;
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i + 0, Lo);
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i + 4, Hi);
+
+			__m256 const x = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.x.Data), Hi.x.Data, 1);
+			__m256 const y = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.y.Data), Hi.y.Data, 1);
+			__m256 const z = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.z.Data), Hi.z.Data, 1);
+
+			__m256 Result[3];
+			for(length_t r = 0; r < 3; ++r)
+				Result[r] = _mm256_add_ps(
+					_mm256_add_ps(_mm256_mul_ps(M[0][r], x), _mm256_mul_ps(M[1][r], y)),
+					_mm256_add_ps(_mm256_mul_ps(M[2][r], z), M[3][r]));
+
+			Lo.x.Data = _mm256_castps256_ps128(Result[0]);
+			Lo.y.Data = _mm256_castps256_ps128(Result[1]);
+			Lo.z.Data = _mm256_castps256_ps128(Result[2]);
+			Hi.x.Data = _mm256_extractf128_ps(Result[0], 1);
+			Hi.y.Data = _mm256_extractf128_ps(Result[1], 1);
+			Hi.z.Data = _mm256_extractf128_ps(Result[2], 1);
+			compute_packet_transpose<fpacket4SIMD>::scatter(Lo, Dst + i + 0);
+			compute_packet_transpose<fpacket4SIMD>::scatter(Hi, Dst + i + 4);
+		}
+		transform_point_sse2(m, Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX2 inline void transform_point_avx2(mat4 const & m, vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		__m256 M[4][3];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 3; ++r)
+			M[c][r] = _mm256_set1_ps(m[c][r]);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Packets; i += 8)
+		{
+			tvec3packet<fpacket4SIMD> Lo, Hi;
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i + 0, Lo);
+			compute_packet_transpose<fpacket4SIMD>::gather(Src + i + 4, Hi);
+
+			__m256 const x = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.x.Data), Hi.x.Data, 1);
+			__m256 const y = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.y.Data), Hi.y.Data, 1);
+			__m256 const z = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.z.Data), Hi.z.Data, 1);
+
+			__m256 Result[3];
+			for(length_t r = 0; r < 3; ++r)
+				Result[r] = _mm256_fmadd_ps(M[0][r], x, _mm256_fmadd_ps(M[1][r], y, _mm256_fmadd_ps(M[2][r], z, M[3][r])));
+
+			Lo.x.Data = _mm256_castps256_ps128(Result[0]);
+			Lo.y.Data = _mm256_castps256_ps128(Result[1]);
+			Lo.z.Data = _mm256_castps256_ps128(Result[2]);
+			Hi.x.Data = _mm256_extractf128_ps(Result[0], 1);
+			Hi.y.Data = _mm256_extractf128_ps(Result[1], 1);
+			Hi.z.Data = _mm256_extractf128_ps(Result[2], 1);
+			compute_packet_transpose<fpacket4SIMD>::scatter(Lo, Dst + i + 0);
+			compute_packet_transpose<fpacket4SIMD>::scatter(Hi, Dst + i + 4);
+		}
+		transform_point_sse2(m, Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	// Cofactor factors of sse_inverse_ps, computed for two matrices at once. All the
+	// shuffles operate within 128 bits lanes so each lane holds a different matrix.
+	template <int A, int B>
+	GLM_TARGET_AVX inline __m256 avx_inverse_factor(__m256 const in[4])
+	{
+		__m256 const Swp0a = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(A, A, A, A));
+		__m256 const Swp0b = _mm256_shuffle_ps(in[3], in[2], _MM_SHUFFLE(B, B, B, B));
+		__m256 const Swp00 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(B, B, B, B));
+		__m256 const Swp01 = _mm256_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 const Swp02 = _mm256_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+		__m256 const Swp03 = _mm256_shuffle_ps(in[2], in[1], _MM_SHUFFLE(A, A, A, A));
+		return _mm256_sub_ps(_mm256_mul_ps(Swp00, Swp01), _mm256_mul_ps(Swp02, Swp03));
+	}
+
+	template <int C>
+	GLM_TARGET_AVX inline __m256 avx_inverse_vec(__m256 const in[4])
+	{
+		__m256 const Temp = _mm256_shuffle_ps(in[1], in[0], _MM_SHUFFLE(C, C, C, C));
+		return _mm256_shuffle_ps(Temp, Temp, _MM_SHUFFLE(2, 2, 2, 0));
+	}
+
+	GLM_TARGET_AVX inline void avx_inverse2_ps(__m256 const in[4], __m256 out[4])
+	{
+		__m256 const Fac0 = avx_inverse_factor<3, 2>(in);
+		__m256 const Fac1 = avx_inverse_factor<3, 1>(in);
+		__m256 const Fac2 = avx_inverse_factor<2, 1>(in);
+		__m256 const Fac3 = avx_inverse_factor<3, 0>(in);
+		__m256 const Fac4 = avx_inverse_factor<2, 0>(in);
+		__m256 const Fac5 = avx_inverse_factor<1, 0>(in);
+
+		__m256 const SignA = _mm256_set_ps( 1.0f,-1.0f, 1.0f,-1.0f, 1.0f,-1.0f, 1.0f,-1.0f);
+		__m256 const SignB = _mm256_set_ps(-1.0f, 1.0f,-1.0f, 1.0f,-1.0f, 1.0f,-1.0f, 1.0f);
+
+		__m256 const Vec0 = avx_inverse_vec<0>(in);
+		__m256 const Vec1 = avx_inverse_vec<1>(in);
+		__m256 const Vec2 = avx_inverse_vec<2>(in);
+		__m256 const Vec3 = avx_inverse_vec<3>(in);
+
+		__m256 const Inv0 = _mm256_mul_ps(SignB, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(Vec1, Fac0), _mm256_mul_ps(Vec2, Fac1)), _mm256_mul_ps(Vec3, Fac2)));
+		__m256 const Inv1 = _mm256_mul_ps(SignA, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(Vec0, Fac0), _mm256_mul_ps(Vec2, Fac3)), _mm256_mul_ps(Vec3, Fac4)));
+		__m256 const Inv2 = _mm256_mul_ps(SignB, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(Vec0, Fac1), _mm256_mul_ps(Vec1, Fac3)), _mm256_mul_ps(Vec3, Fac5)));
+		__m256 const Inv3 = _mm256_mul_ps(SignA, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(Vec0, Fac2), _mm256_mul_ps(Vec1, Fac4)), _mm256_mul_ps(Vec2, Fac5)));
+
+		__m256 const Row0 = _mm256_shuffle_ps(Inv0, Inv1, _MM_SHUFFLE(0, 0, 0, 0));
+		__m256 const Row1 = _mm256_shuffle_ps(Inv2, Inv3, _MM_SHUFFLE(0, 0, 0, 0));
+		__m256 const Row2 = _mm256_shuffle_ps(Row0, Row1, _MM_SHUFFLE(2, 0, 2, 0));
+
+		__m256 Det = _mm256_mul_ps(in[0], Row2);
+		Det = _mm256_hadd_ps(Det, Det);
+		Det = _mm256_hadd_ps(Det, Det);
+		__m256 const Rcp = _mm256_div_ps(_mm256_set1_ps(1.0f), Det);
+
+		out[0] = _mm256_mul_ps(Inv0, Rcp);
+		out[1] = _mm256_mul_ps(Inv1, Rcp);
+		out[2] = _mm256_mul_ps(Inv2, Rcp);
+		out[3] = _mm256_mul_ps(Inv3, Rcp);
+	}
+
+	GLM_TARGET_AVX inline void inverse_avx(mat4 const * Src, mat4 * Dst, std::size_t Count)
+	{
+		std::size_t const Pairs = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Pairs; i += 2)
+		{
+			__m256 In[4];
+			__m256 Out[4];
+			for(length_t c = 0; c < 4; ++c)
+				In[c] = avx_load2_ps(&Src[i][c][0], &Src[i + 1][c][0]);
+			avx_inverse2_ps(In, Out);
+			for(length_t c = 0; c < 4; ++c)
+				avx_store2_ps(&Dst[i][c][0], &Dst[i + 1][c][0], Out[c]);
+		}
+		inverse_sse2(Src + Pairs, Dst + Pairs, Count - Pairs);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	typedef void (*transform_func)(mat4 const &, vec4 const *, vec4 *, std::size_t);
+	typedef void (*transform_point_func)(mat4 const &, vec3 const *, vec3 *, std::size_t);
+	typedef void (*inverse_func)(mat4 const *, mat4 *, std::size_t);
+
+	GLM_FUNC_QUALIFIER transform_func transform_select()
+	{
+#		if GLM_DISPATCH_X86
+			static transform_func const Table[SIMD_LEVEL_COUNT] = {transform_pure, transform_sse2, 0, transform_avx, transform_avx2};
+#		else
+			static transform_func const Table[SIMD_LEVEL_COUNT] = {transform_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER transform_point_func transform_point_select()
+	{
+#		if GLM_DISPATCH_X86
+			static transform_point_func const Table[SIMD_LEVEL_COUNT] = {transform_point_pure, transform_point_sse2, 0, transform_point_avx, transform_point_avx2};
+#		else
+			static transform_point_func const Table[SIMD_LEVEL_COUNT] = {transform_point_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER inverse_func inverse_select()
+	{
+#		if GLM_DISPATCH_X86
+			static inverse_func const Table[SIMD_LEVEL_COUNT] = {inverse_pure, inverse_sse2, 0, inverse_avx, 0};
+#		else
+			static inverse_func const Table[SIMD_LEVEL_COUNT] = {inverse_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER simd_features const & simdFeatures()
+	{
+		static simd_features const Features = detail::detect_simd_features();
+		return Features;
+	}
+
+	GLM_FUNC_QUALIFIER simd_level simdMaxLevel()
+	{
+		simd_features const & Features = simdFeatures();
+
+		if(Features.AVX2 && Features.FMA)
+			return SIMD_LEVEL_AVX2;
+		if(Features.AVX)
+			return SIMD_LEVEL_AVX;
+		if(Features.SSE41)
+			return SIMD_LEVEL_SSE4;
+		if(Features.SSE2)
+			return SIMD_LEVEL_SSE2;
+		return SIMD_LEVEL_PURE;
+	}
+
+	GLM_FUNC_QUALIFIER simd_level simdLevel()
+	{
+		return detail::simd_current_level();
+	}
+
+	GLM_FUNC_QUALIFIER simd_level simdForceLevel(simd_level Level)
+	{
+		simd_level const Max = simdMaxLevel();
+		detail::simd_current_level() = Level < Max ? Level : Max;
+		return detail::simd_current_level();
+	}
+
+	GLM_FUNC_QUALIFIER char const * simdLevelName(simd_level Level)
+	{
+		static char const * const Names[SIMD_LEVEL_COUNT] = {"pure", "SSE2", "SSE4.1", "AVX", "AVX2+FMA"};
+		return Level < SIMD_LEVEL_COUNT ? Names[Level] : "unknown";
+	}
+
+	GLM_FUNC_QUALIFIER void transformBatch(mat4 const & m, vec4 const * Src, vec4 * Dst, std::size_t Count)
+	{
+		detail::transform_select()(m, Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void transformPointBatch(mat4 const & m, vec3 const * Src, vec3 * Dst, std::size_t Count)
+	{
+		detail::transform_point_select()(m, Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void inverseBatch(mat4 const * Src, mat4 * Dst, std::size_t Count)
+	{
+		detail::inverse_select()(Src, Dst, Count);
+	}
+}//namespace glm
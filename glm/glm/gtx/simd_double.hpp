@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_double
+/// @file glm/gtx/simd_double.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_simd_double GLM_GTX_simd_double
+/// @ingroup gtx
+///
+/// @brief AVX arithmetic, products, inverses and geometric functions of arrays of dvec3, dvec4 and dmat4.
+///
+/// A dvec4 fills a 256 bits AVX register: the component-wise arithmetic, the
+/// matrix products and the transforms process one vector or one matrix column per
+/// instruction. The dot products, cross products, normalizations, point transforms
+/// and inverses process 4 vectors or 4 matrices at once, transposed so that each lane
+/// holds a different element.
+///
+/// The kernels are selected at runtime with GLM_GTX_simd_dispatch, the AVX2 level
+/// also uses fused multiply-add in the products. Without FMA, the arithmetic, cross,
+/// normalize, dot and inverse kernels evaluate the same operations in the same order
+/// as the scalar functions. SSE2 only holds 2 doubles, no faster than the
+/// vectorized scalar code, so the SSE2 and SSE4.1 levels use the scalar functions.
+///
+/// <glm/gtx/simd_double.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_simd_double extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_simd_double
+	/// @{
+
+	/// Dst[i] = A[i] + B[i] for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void addBatch(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] - B[i] for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void subBatch(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] * B[i], component-wise, for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void mulBatch(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] / B[i], component-wise, for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void divBatch(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = A[i] * B[i], matrix product, for Count matrices.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void mulBatch(dmat4 const * A, dmat4 const * B, dmat4 * Dst, std::size_t Count);
+
+	/// Dst[i] = m * Src[i] for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void transformBatch(dmat4 const & m, dvec4 const * Src, dvec4 * Dst, std::size_t Count);
+
+	/// Dst[i] = dvec3(m * dvec4(Src[i], 1)) for Count points, m is assumed affine.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void transformPointBatch(dmat4 const & m, dvec3 const * Src, dvec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = inverse(Src[i]) for Count matrices.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void inverseBatch(dmat4 const * Src, dmat4 * Dst, std::size_t Count);
+
+	/// Dst[i] = dot(A[i], B[i]) for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void dotBatch(dvec3 const * A, dvec3 const * B, double * Dst, std::size_t Count);
+
+	/// Dst[i] = dot(A[i], B[i]) for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void dotBatch(dvec4 const * A, dvec4 const * B, double * Dst, std::size_t Count);
+
+	/// Dst[i] = cross(A[i], B[i]) for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void crossBatch(dvec3 const * A, dvec3 const * B, dvec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = normalize(Src[i]) for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void normalizeBatch(dvec3 const * Src, dvec3 * Dst, std::size_t Count);
+
+	/// Dst[i] = normalize(Src[i]) for Count vectors.
+	/// @see gtx_simd_double
+	GLM_FUNC_DECL void normalizeBatch(dvec4 const * Src, dvec4 * Dst, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "simd_double.inl"
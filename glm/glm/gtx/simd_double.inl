@@ -0,0 +1,704 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_double
+/// @file glm/gtx/simd_double.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	//////////////////////////////////////
+	// Platform independent kernels
+
+	GLM_FUNC_QUALIFIER void add_dvec4_pure(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = A[i] + B[i];
+	}
+
+	GLM_FUNC_QUALIFIER void sub_dvec4_pure(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = A[i] - B[i];
+	}
+
+	GLM_FUNC_QUALIFIER void mul_dvec4_pure(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = A[i] * B[i];
+	}
+
+	GLM_FUNC_QUALIFIER void div_dvec4_pure(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = A[i] / B[i];
+	}
+
+	GLM_FUNC_QUALIFIER void mul_dmat4_pure(dmat4 const * A, dmat4 const * B, dmat4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = A[i] * B[i];
+	}
+
+	GLM_FUNC_QUALIFIER void transform_dvec4_pure(dmat4 const & m, dvec4 const * Src, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = m * Src[i];
+	}
+
+	GLM_FUNC_QUALIFIER void transform_point_dvec3_pure(dmat4 const & m, dvec3 const * Src, dvec3 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = dvec3(m * dvec4(Src[i], 1.0));
+	}
+
+	GLM_FUNC_QUALIFIER void inverse_dmat4_pure(dmat4 const * Src, dmat4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = inverse(Src[i]);
+	}
+
+	template <typename vecType>
+	GLM_FUNC_QUALIFIER void dot_pure(vecType const * A, vecType const * B, double * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = dot(A[i], B[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void cross_dvec3_pure(dvec3 const * A, dvec3 const * B, dvec3 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = cross(A[i], B[i]);
+	}
+
+	template <typename vecType>
+	GLM_FUNC_QUALIFIER void normalize_pure(vecType const * Src, vecType * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = normalize(Src[i]);
+	}
+
+#	if GLM_DISPATCH_X86
+	//////////////////////////////////////
+	// AVX helpers
+
+	// Loads 4 consecutive dvec3 and transposes them, each of x, y and z holds a component of the 4 vectors.
+	GLM_TARGET_AVX inline void avx_load3_pd(dvec3 const * Src, __m256d & x, __m256d & y, __m256d & z)
+	{
+		// m0 = x0 y0 | z0 x1, m1 = y1 z1 | x2 y2, m2 = z2 x3 | y3 z3
+		__m256d const m0 = _mm256_loadu_pd(&Src[0].x);
+		__m256d const m1 = _mm256_loadu_pd(&Src[0].x + 4);
+		__m256d const m2 = _mm256_loadu_pd(&Src[0].x + 8);
+
+		__m256d const xy = _mm256_blend_pd(m0, m1, 0xC);			// x0 y0 | x2 y2
+		__m256d const zx = _mm256_permute2f128_pd(m0, m2, 0x21);	// z0 x1 | z2 x3
+		__m256d const yz = _mm256_blend_pd(m1, m2, 0xC);			// y1 z1 | y3 z3
+
+		x = _mm256_blend_pd(xy, zx, 0xA);
+		y = _mm256_shuffle_pd(xy, yz, 0x5);
+		z = _mm256_blend_pd(zx, yz, 0xA);
+	}
+
+	// Inverse of avx_load3_pd
+	GLM_TARGET_AVX inline void avx_store3_pd(dvec3 * Dst, __m256d x, __m256d y, __m256d z)
+	{
+		__m256d const xy = _mm256_shuffle_pd(x, y, 0x0);
+		__m256d const yz = _mm256_shuffle_pd(y, z, 0xF);
+		__m256d const zx = _mm256_blend_pd(z, x, 0xA);
+
+		_mm256_storeu_pd(&Dst[0].x, _mm256_permute2f128_pd(xy, zx, 0x20));
+		_mm256_storeu_pd(&Dst[0].x + 4, _mm256_permute2f128_pd(yz, xy, 0x30));
+		_mm256_storeu_pd(&Dst[0].x + 8, _mm256_permute2f128_pd(zx, yz, 0x31));
+	}
+
+	GLM_TARGET_AVX inline void avx_transpose4_pd(__m256d v[4])
+	{
+		__m256d const t0 = _mm256_unpacklo_pd(v[0], v[1]);
+		__m256d const t1 = _mm256_unpackhi_pd(v[0], v[1]);
+		__m256d const t2 = _mm256_unpacklo_pd(v[2], v[3]);
+		__m256d const t3 = _mm256_unpackhi_pd(v[2], v[3]);
+
+		v[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+		v[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+		v[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+		v[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+	}
+
+	// Sums of the components of 4 vectors, (x + y) + (z + w) like dot
+	GLM_TARGET_AVX inline __m256d avx_hsum4_pd(__m256d a, __m256d b, __m256d c, __m256d d)
+	{
+		__m256d const ab = _mm256_hadd_pd(a, b);	// a.x+a.y b.x+b.y | a.z+a.w b.z+b.w
+		__m256d const cd = _mm256_hadd_pd(c, d);
+		return _mm256_add_pd(_mm256_permute2f128_pd(ab, cd, 0x20), _mm256_permute2f128_pd(ab, cd, 0x31));
+	}
+
+	//////////////////////////////////////
+	// AVX kernels
+
+	GLM_TARGET_AVX inline void add_dvec4_avx(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm256_storeu_pd(&Dst[i].x, _mm256_add_pd(_mm256_loadu_pd(&A[i].x), _mm256_loadu_pd(&B[i].x)));
+	}
+
+	GLM_TARGET_AVX inline void sub_dvec4_avx(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm256_storeu_pd(&Dst[i].x, _mm256_sub_pd(_mm256_loadu_pd(&A[i].x), _mm256_loadu_pd(&B[i].x)));
+	}
+
+	GLM_TARGET_AVX inline void mul_dvec4_avx(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm256_storeu_pd(&Dst[i].x, _mm256_mul_pd(_mm256_loadu_pd(&A[i].x), _mm256_loadu_pd(&B[i].x)));
+	}
+
+	GLM_TARGET_AVX inline void div_dvec4_avx(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm256_storeu_pd(&Dst[i].x, _mm256_div_pd(_mm256_loadu_pd(&A[i].x), _mm256_loadu_pd(&B[i].x)));
+	}
+
+	GLM_TARGET_AVX inline __m256d avx_mul_dmat4_col(__m256d const c[4], double const * v)
+	{
+		__m256d const x = _mm256_mul_pd(c[0], _mm256_broadcast_sd(v + 0));
+		__m256d const y = _mm256_mul_pd(c[1], _mm256_broadcast_sd(v + 1));
+		__m256d const z = _mm256_mul_pd(c[2], _mm256_broadcast_sd(v + 2));
+		__m256d const w = _mm256_mul_pd(c[3], _mm256_broadcast_sd(v + 3));
+		return _mm256_add_pd(_mm256_add_pd(x, y), _mm256_add_pd(z, w));
+	}
+
+	GLM_TARGET_AVX2 inline __m256d avx2_mul_dmat4_col(__m256d const c[4], double const * v)
+	{
+		__m256d const xy = _mm256_fmadd_pd(c[1], _mm256_broadcast_sd(v + 1), _mm256_mul_pd(c[0], _mm256_broadcast_sd(v + 0)));
+		__m256d const zw = _mm256_fmadd_pd(c[3], _mm256_broadcast_sd(v + 3), _mm256_mul_pd(c[2], _mm256_broadcast_sd(v + 2)));
+		return _mm256_add_pd(xy, zw);
+	}
+
+	GLM_TARGET_AVX inline void mul_dmat4_avx(dmat4 const * A, dmat4 const * B, dmat4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			__m256d const c[4] = {
+				_mm256_loadu_pd(&A[i][0][0]), _mm256_loadu_pd(&A[i][1][0]),
+				_mm256_loadu_pd(&A[i][2][0]), _mm256_loadu_pd(&A[i][3][0])};
+			__m256d const r0 = avx_mul_dmat4_col(c, &B[i][0][0]);
+			__m256d const r1 = avx_mul_dmat4_col(c, &B[i][1][0]);
+			__m256d const r2 = avx_mul_dmat4_col(c, &B[i][2][0]);
+			__m256d const r3 = avx_mul_dmat4_col(c, &B[i][3][0]);
+			_mm256_storeu_pd(&Dst[i][0][0], r0);
+			_mm256_storeu_pd(&Dst[i][1][0], r1);
+			_mm256_storeu_pd(&Dst[i][2][0], r2);
+			_mm256_storeu_pd(&Dst[i][3][0], r3);
+		}
+	}
+
+	GLM_TARGET_AVX2 inline void mul_dmat4_avx2(dmat4 const * A, dmat4 const * B, dmat4 * Dst, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			__m256d const c[4] = {
+				_mm256_loadu_pd(&A[i][0][0]), _mm256_loadu_pd(&A[i][1][0]),
+				_mm256_loadu_pd(&A[i][2][0]), _mm256_loadu_pd(&A[i][3][0])};
+			__m256d const r0 = avx2_mul_dmat4_col(c, &B[i][0][0]);
+			__m256d const r1 = avx2_mul_dmat4_col(c, &B[i][1][0]);
+			__m256d const r2 = avx2_mul_dmat4_col(c, &B[i][2][0]);
+			__m256d const r3 = avx2_mul_dmat4_col(c, &B[i][3][0]);
+			_mm256_storeu_pd(&Dst[i][0][0], r0);
+			_mm256_storeu_pd(&Dst[i][1][0], r1);
+			_mm256_storeu_pd(&Dst[i][2][0], r2);
+			_mm256_storeu_pd(&Dst[i][3][0], r3);
+		}
+	}
+
+	GLM_TARGET_AVX inline void transform_dvec4_avx(dmat4 const & m, dvec4 const * Src, dvec4 * Dst, std::size_t Count)
+	{
+		__m256d c[4];
+		for(length_t k = 0; k < 4; ++k)
+			c[k] = _mm256_loadu_pd(&m[k][0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm256_storeu_pd(&Dst[i].x, avx_mul_dmat4_col(c, &Src[i].x));
+	}
+
+	GLM_TARGET_AVX2 inline void transform_dvec4_avx2(dmat4 const & m, dvec4 const * Src, dvec4 * Dst, std::size_t Count)
+	{
+		__m256d c[4];
+		for(length_t k = 0; k < 4; ++k)
+			c[k] = _mm256_loadu_pd(&m[k][0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			_mm256_storeu_pd(&Dst[i].x, avx2_mul_dmat4_col(c, &Src[i].x));
+	}
+
+	GLM_TARGET_AVX inline void transform_point_dvec3_avx(dmat4 const & m, dvec3 const * Src, dvec3 * Dst, std::size_t Count)
+	{
+		__m256d M[4][3];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 3; ++r)
+			M[c][r] = _mm256_set1_pd(m[c][r]);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d x, y, z;
+			avx_load3_pd(Src + i, x, y, z);
+
+			__m256d Result[3];
+			for(length_t r = 0; r < 3; ++r)
+				Result[r] = _mm256_add_pd(
+					_mm256_add_pd(_mm256_mul_pd(M[0][r], x), _mm256_mul_pd(M[1][r], y)),
+					_mm256_add_pd(_mm256_mul_pd(M[2][r], z), M[3][r]));
+
+			avx_store3_pd(Dst + i, Result[0], Result[1], Result[2]);
+		}
+		transform_point_dvec3_pure(m, Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX2 inline void transform_point_dvec3_avx2(dmat4 const & m, dvec3 const * Src, dvec3 * Dst, std::size_t Count)
+	{
+		__m256d M[4][3];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 3; ++r)
+			M[c][r] = _mm256_set1_pd(m[c][r]);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d x, y, z;
+			avx_load3_pd(Src + i, x, y, z);
+
+			__m256d Result[3];
+			for(length_t r = 0; r < 3; ++r)
+				Result[r] = _mm256_fmadd_pd(M[0][r], x, _mm256_fmadd_pd(M[1][r], y, _mm256_fmadd_pd(M[2][r], z, M[3][r])));
+
+			avx_store3_pd(Dst + i, Result[0], Result[1], Result[2]);
+		}
+		transform_point_dvec3_pure(m, Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	// compute_inverse with a different matrix in each lane
+	GLM_TARGET_AVX inline __m256d avx_cofactor_pd(__m256d a, __m256d b, __m256d c, __m256d d)
+	{
+		return _mm256_sub_pd(_mm256_mul_pd(a, b), _mm256_mul_pd(c, d));
+	}
+
+	GLM_TARGET_AVX inline void avx_inverse4_pd(__m256d const m[4][4], __m256d Out[4][4])
+	{
+		__m256d const Coef00 = avx_cofactor_pd(m[2][2], m[3][3], m[3][2], m[2][3]);
+		__m256d const Coef02 = avx_cofactor_pd(m[1][2], m[3][3], m[3][2], m[1][3]);
+		__m256d const Coef03 = avx_cofactor_pd(m[1][2], m[2][3], m[2][2], m[1][3]);
+
+		__m256d const Coef04 = avx_cofactor_pd(m[2][1], m[3][3], m[3][1], m[2][3]);
+		__m256d const Coef06 = avx_cofactor_pd(m[1][1], m[3][3], m[3][1], m[1][3]);
+		__m256d const Coef07 = avx_cofactor_pd(m[1][1], m[2][3], m[2][1], m[1][3]);
+
+		__m256d const Coef08 = avx_cofactor_pd(m[2][1], m[3][2], m[3][1], m[2][2]);
+		__m256d const Coef10 = avx_cofactor_pd(m[1][1], m[3][2], m[3][1], m[1][2]);
+		__m256d const Coef11 = avx_cofactor_pd(m[1][1], m[2][2], m[2][1], m[1][2]);
+
+		__m256d const Coef12 = avx_cofactor_pd(m[2][0], m[3][3], m[3][0], m[2][3]);
+		__m256d const Coef14 = avx_cofactor_pd(m[1][0], m[3][3], m[3][0], m[1][3]);
+		__m256d const Coef15 = avx_cofactor_pd(m[1][0], m[2][3], m[2][0], m[1][3]);
+
+		__m256d const Coef16 = avx_cofactor_pd(m[2][0], m[3][2], m[3][0], m[2][2]);
+		__m256d const Coef18 = avx_cofactor_pd(m[1][0], m[3][2], m[3][0], m[1][2]);
+		__m256d const Coef19 = avx_cofactor_pd(m[1][0], m[2][2], m[2][0], m[1][2]);
+
+		__m256d const Coef20 = avx_cofactor_pd(m[2][0], m[3][1], m[3][0], m[2][1]);
+		__m256d const Coef22 = avx_cofactor_pd(m[1][0], m[3][1], m[3][0], m[1][1]);
+		__m256d const Coef23 = avx_cofactor_pd(m[1][0], m[2][1], m[2][0], m[1][1]);
+
+		__m256d const Fac[6][4] = {
+			{Coef00, Coef00, Coef02, Coef03},
+			{Coef04, Coef04, Coef06, Coef07},
+			{Coef08, Coef08, Coef10, Coef11},
+			{Coef12, Coef12, Coef14, Coef15},
+			{Coef16, Coef16, Coef18, Coef19},
+			{Coef20, Coef20, Coef22, Coef23}};
+
+		__m256d const Vec[4][4] = {
+			{m[1][0], m[0][0], m[0][0], m[0][0]},
+			{m[1][1], m[0][1], m[0][1], m[0][1]},
+			{m[1][2], m[0][2], m[0][2], m[0][2]},
+			{m[1][3], m[0][3], m[0][3], m[0][3]}};
+
+		// Signs of the cofactors, SignA for the columns 0 and 2, SignB for 1 and 3
+		__m256d const Sign[2] = {_mm256_set1_pd(1.0), _mm256_set1_pd(-1.0)};
+
+		for(length_t k = 0; k < 4; ++k)
+		{
+			__m256d const SignA = Sign[k & 1];
+			__m256d const SignB = Sign[(k & 1) ^ 1];
+			Out[0][k] = _mm256_mul_pd(SignA, _mm256_add_pd(avx_cofactor_pd(Vec[1][k], Fac[0][k], Vec[2][k], Fac[1][k]), _mm256_mul_pd(Vec[3][k], Fac[2][k])));
+			Out[1][k] = _mm256_mul_pd(SignB, _mm256_add_pd(avx_cofactor_pd(Vec[0][k], Fac[0][k], Vec[2][k], Fac[3][k]), _mm256_mul_pd(Vec[3][k], Fac[4][k])));
+			Out[2][k] = _mm256_mul_pd(SignA, _mm256_add_pd(avx_cofactor_pd(Vec[0][k], Fac[1][k], Vec[1][k], Fac[3][k]), _mm256_mul_pd(Vec[3][k], Fac[5][k])));
+			Out[3][k] = _mm256_mul_pd(SignB, _mm256_add_pd(avx_cofactor_pd(Vec[0][k], Fac[2][k], Vec[1][k], Fac[4][k]), _mm256_mul_pd(Vec[2][k], Fac[5][k])));
+		}
+
+		__m256d const Det = _mm256_add_pd(
+			_mm256_add_pd(_mm256_mul_pd(m[0][0], Out[0][0]), _mm256_mul_pd(m[0][1], Out[1][0])),
+			_mm256_add_pd(_mm256_mul_pd(m[0][2], Out[2][0]), _mm256_mul_pd(m[0][3], Out[3][0])));
+		__m256d const OneOverDeterminant = _mm256_div_pd(_mm256_set1_pd(1.0), Det);
+
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			Out[c][r] = _mm256_mul_pd(Out[c][r], OneOverDeterminant);
+	}
+
+	GLM_TARGET_AVX inline void inverse_dmat4_avx(dmat4 const * Src, dmat4 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d In[4][4];
+			for(length_t c = 0; c < 4; ++c)
+			{
+				for(length_t j = 0; j < 4; ++j)
+					In[c][j] = _mm256_loadu_pd(&Src[i + j][c][0]);
+				avx_transpose4_pd(In[c]);
+			}
+
+			__m256d Out[4][4];
+			avx_inverse4_pd(In, Out);
+
+			for(length_t c = 0; c < 4; ++c)
+			{
+				avx_transpose4_pd(Out[c]);
+				for(length_t j = 0; j < 4; ++j)
+					_mm256_storeu_pd(&Dst[i + j][c][0], Out[c][j]);
+			}
+		}
+		inverse_dmat4_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX inline void dot_dvec3_avx(dvec3 const * A, dvec3 const * B, double * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d ax, ay, az, bx, by, bz;
+			avx_load3_pd(A + i, ax, ay, az);
+			avx_load3_pd(B + i, bx, by, bz);
+			__m256d const Dot = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(ax, bx), _mm256_mul_pd(ay, by)), _mm256_mul_pd(az, bz));
+			_mm256_storeu_pd(Dst + i, Dot);
+		}
+		dot_pure(A + Packets, B + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX2 inline void dot_dvec3_avx2(dvec3 const * A, dvec3 const * B, double * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d ax, ay, az, bx, by, bz;
+			avx_load3_pd(A + i, ax, ay, az);
+			avx_load3_pd(B + i, bx, by, bz);
+			__m256d const Dot = _mm256_fmadd_pd(az, bz, _mm256_fmadd_pd(ay, by, _mm256_mul_pd(ax, bx)));
+			_mm256_storeu_pd(Dst + i, Dot);
+		}
+		dot_pure(A + Packets, B + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX inline void dot_dvec4_avx(dvec4 const * A, dvec4 const * B, double * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d p[4];
+			for(std::size_t j = 0; j < 4; ++j)
+				p[j] = _mm256_mul_pd(_mm256_loadu_pd(&A[i + j].x), _mm256_loadu_pd(&B[i + j].x));
+			_mm256_storeu_pd(Dst + i, avx_hsum4_pd(p[0], p[1], p[2], p[3]));
+		}
+		dot_pure(A + Packets, B + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX inline void cross_dvec3_avx(dvec3 const * A, dvec3 const * B, dvec3 * Dst, std::size_t Count)
+	{
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d ax, ay, az, bx, by, bz;
+			avx_load3_pd(A + i, ax, ay, az);
+			avx_load3_pd(B + i, bx, by, bz);
+			avx_store3_pd(Dst + i,
+				_mm256_sub_pd(_mm256_mul_pd(ay, bz), _mm256_mul_pd(by, az)),
+				_mm256_sub_pd(_mm256_mul_pd(az, bx), _mm256_mul_pd(bz, ax)),
+				_mm256_sub_pd(_mm256_mul_pd(ax, by), _mm256_mul_pd(bx, ay)));
+		}
+		cross_dvec3_pure(A + Packets, B + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX inline void normalize_dvec3_avx(dvec3 const * Src, dvec3 * Dst, std::size_t Count)
+	{
+		__m256d const One = _mm256_set1_pd(1.0);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d x, y, z;
+			avx_load3_pd(Src + i, x, y, z);
+			__m256d const Dot = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y)), _mm256_mul_pd(z, z));
+			__m256d const InvLength = _mm256_div_pd(One, _mm256_sqrt_pd(Dot));
+			avx_store3_pd(Dst + i, _mm256_mul_pd(x, InvLength), _mm256_mul_pd(y, InvLength), _mm256_mul_pd(z, InvLength));
+		}
+		normalize_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+
+	GLM_TARGET_AVX inline void normalize_dvec4_avx(dvec4 const * Src, dvec4 * Dst, std::size_t Count)
+	{
+		__m256d const One = _mm256_set1_pd(1.0);
+
+		std::size_t const Packets = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Packets; i += 4)
+		{
+			__m256d v[4];
+			for(std::size_t j = 0; j < 4; ++j)
+				v[j] = _mm256_loadu_pd(&Src[i + j].x);
+			__m256d const Dot = avx_hsum4_pd(_mm256_mul_pd(v[0], v[0]), _mm256_mul_pd(v[1], v[1]), _mm256_mul_pd(v[2], v[2]), _mm256_mul_pd(v[3], v[3]));
+			__m256d const InvLength = _mm256_div_pd(One, _mm256_sqrt_pd(Dot));
+
+			// Broadcast the lane j of InvLength to the vector j
+			__m256d const Lo = _mm256_permute2f128_pd(InvLength, InvLength, 0x00);
+			__m256d const Hi = _mm256_permute2f128_pd(InvLength, InvLength, 0x11);
+			_mm256_storeu_pd(&Dst[i + 0].x, _mm256_mul_pd(v[0], _mm256_permute_pd(Lo, 0x0)));
+			_mm256_storeu_pd(&Dst[i + 1].x, _mm256_mul_pd(v[1], _mm256_permute_pd(Lo, 0xF)));
+			_mm256_storeu_pd(&Dst[i + 2].x, _mm256_mul_pd(v[2], _mm256_permute_pd(Hi, 0x0)));
+			_mm256_storeu_pd(&Dst[i + 3].x, _mm256_mul_pd(v[3], _mm256_permute_pd(Hi, 0xF)));
+		}
+		normalize_pure(Src + Packets, Dst + Packets, Count - Packets);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	typedef void (*dvec4_binary_func)(dvec4 const *, dvec4 const *, dvec4 *, std::size_t);
+	typedef void (*dmat4_binary_func)(dmat4 const *, dmat4 const *, dmat4 *, std::size_t);
+	typedef void (*transform_dvec4_func)(dmat4 const &, dvec4 const *, dvec4 *, std::size_t);
+	typedef void (*transform_point_dvec3_func)(dmat4 const &, dvec3 const *, dvec3 *, std::size_t);
+	typedef void (*inverse_dmat4_func)(dmat4 const *, dmat4 *, std::size_t);
+	typedef void (*dot_dvec3_func)(dvec3 const *, dvec3 const *, double *, std::size_t);
+	typedef void (*dot_dvec4_func)(dvec4 const *, dvec4 const *, double *, std::size_t);
+	typedef void (*cross_dvec3_func)(dvec3 const *, dvec3 const *, dvec3 *, std::size_t);
+	typedef void (*normalize_dvec3_func)(dvec3 const *, dvec3 *, std::size_t);
+	typedef void (*normalize_dvec4_func)(dvec4 const *, dvec4 *, std::size_t);
+
+	GLM_FUNC_QUALIFIER dvec4_binary_func add_dvec4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static dvec4_binary_func const Table[SIMD_LEVEL_COUNT] = {add_dvec4_pure, 0, 0, add_dvec4_avx, 0};
+#		else
+			static dvec4_binary_func const Table[SIMD_LEVEL_COUNT] = {add_dvec4_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER dvec4_binary_func sub_dvec4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static dvec4_binary_func const Table[SIMD_LEVEL_COUNT] = {sub_dvec4_pure, 0, 0, sub_dvec4_avx, 0};
+#		else
+			static dvec4_binary_func const Table[SIMD_LEVEL_COUNT] = {sub_dvec4_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER dvec4_binary_func mul_dvec4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static dvec4_binary_func const Table[SIMD_LEVEL_COUNT] = {mul_dvec4_pure, 0, 0, mul_dvec4_avx, 0};
+#		else
+			static dvec4_binary_func const Table[SIMD_LEVEL_COUNT] = {mul_dvec4_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER dvec4_binary_func div_dvec4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static dvec4_binary_func const Table[SIMD_LEVEL_COUNT] = {div_dvec4_pure, 0, 0, div_dvec4_avx, 0};
+#		else
+			static dvec4_binary_func const Table[SIMD_LEVEL_COUNT] = {div_dvec4_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER dmat4_binary_func mul_dmat4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static dmat4_binary_func const Table[SIMD_LEVEL_COUNT] = {mul_dmat4_pure, 0, 0, mul_dmat4_avx, mul_dmat4_avx2};
+#		else
+			static dmat4_binary_func const Table[SIMD_LEVEL_COUNT] = {mul_dmat4_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER transform_dvec4_func transform_dvec4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static transform_dvec4_func const Table[SIMD_LEVEL_COUNT] = {transform_dvec4_pure, 0, 0, transform_dvec4_avx, transform_dvec4_avx2};
+#		else
+			static transform_dvec4_func const Table[SIMD_LEVEL_COUNT] = {transform_dvec4_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER transform_point_dvec3_func transform_point_dvec3_select()
+	{
+#		if GLM_DISPATCH_X86
+			static transform_point_dvec3_func const Table[SIMD_LEVEL_COUNT] = {transform_point_dvec3_pure, 0, 0, transform_point_dvec3_avx, transform_point_dvec3_avx2};
+#		else
+			static transform_point_dvec3_func const Table[SIMD_LEVEL_COUNT] = {transform_point_dvec3_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER inverse_dmat4_func inverse_dmat4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static inverse_dmat4_func const Table[SIMD_LEVEL_COUNT] = {inverse_dmat4_pure, 0, 0, inverse_dmat4_avx, 0};
+#		else
+			static inverse_dmat4_func const Table[SIMD_LEVEL_COUNT] = {inverse_dmat4_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER dot_dvec3_func dot_dvec3_select()
+	{
+#		if GLM_DISPATCH_X86
+			static dot_dvec3_func const Table[SIMD_LEVEL_COUNT] = {dot_pure<dvec3>, 0, 0, dot_dvec3_avx, dot_dvec3_avx2};
+#		else
+			static dot_dvec3_func const Table[SIMD_LEVEL_COUNT] = {dot_pure<dvec3>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER dot_dvec4_func dot_dvec4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static dot_dvec4_func const Table[SIMD_LEVEL_COUNT] = {dot_pure<dvec4>, 0, 0, dot_dvec4_avx, 0};
+#		else
+			static dot_dvec4_func const Table[SIMD_LEVEL_COUNT] = {dot_pure<dvec4>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER cross_dvec3_func cross_dvec3_select()
+	{
+#		if GLM_DISPATCH_X86
+			static cross_dvec3_func const Table[SIMD_LEVEL_COUNT] = {cross_dvec3_pure, 0, 0, cross_dvec3_avx, 0};
+#		else
+			static cross_dvec3_func const Table[SIMD_LEVEL_COUNT] = {cross_dvec3_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER normalize_dvec3_func normalize_dvec3_select()
+	{
+#		if GLM_DISPATCH_X86
+			static normalize_dvec3_func const Table[SIMD_LEVEL_COUNT] = {normalize_pure<dvec3>, 0, 0, normalize_dvec3_avx, 0};
+#		else
+			static normalize_dvec3_func const Table[SIMD_LEVEL_COUNT] = {normalize_pure<dvec3>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER normalize_dvec4_func normalize_dvec4_select()
+	{
+#		if GLM_DISPATCH_X86
+			static normalize_dvec4_func const Table[SIMD_LEVEL_COUNT] = {normalize_pure<dvec4>, 0, 0, normalize_dvec4_avx, 0};
+#		else
+			static normalize_dvec4_func const Table[SIMD_LEVEL_COUNT] = {normalize_pure<dvec4>, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void addBatch(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		detail::add_dvec4_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void subBatch(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		detail::sub_dvec4_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void mulBatch(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		detail::mul_dvec4_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void divBatch(dvec4 const * A, dvec4 const * B, dvec4 * Dst, std::size_t Count)
+	{
+		detail::div_dvec4_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void mulBatch(dmat4 const * A, dmat4 const * B, dmat4 * Dst, std::size_t Count)
+	{
+		detail::mul_dmat4_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void transformBatch(dmat4 const & m, dvec4 const * Src, dvec4 * Dst, std::size_t Count)
+	{
+		detail::transform_dvec4_select()(m, Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void transformPointBatch(dmat4 const & m, dvec3 const * Src, dvec3 * Dst, std::size_t Count)
+	{
+		detail::transform_point_dvec3_select()(m, Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void inverseBatch(dmat4 const * Src, dmat4 * Dst, std::size_t Count)
+	{
+		detail::inverse_dmat4_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void dotBatch(dvec3 const * A, dvec3 const * B, double * Dst, std::size_t Count)
+	{
+		detail::dot_dvec3_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void dotBatch(dvec4 const * A, dvec4 const * B, double * Dst, std::size_t Count)
+	{
+		detail::dot_dvec4_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void crossBatch(dvec3 const * A, dvec3 const * B, dvec3 * Dst, std::size_t Count)
+	{
+		detail::cross_dvec3_select()(A, B, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void normalizeBatch(dvec3 const * Src, dvec3 * Dst, std::size_t Count)
+	{
+		detail::normalize_dvec3_select()(Src, Dst, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void normalizeBatch(dvec4 const * Src, dvec4 * Dst, std::size_t Count)
+	{
+		detail::normalize_dvec4_select()(Src, Dst, Count);
+	}
+}//namespace glm
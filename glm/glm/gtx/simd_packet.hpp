@@ -0,0 +1,471 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_packet
+/// @file glm/gtx/simd_packet.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_simd_packet GLM_GTX_simd_packet
+/// @ingroup gtx
+///
+/// @brief Structure of arrays vector types processing 4 (SSE) or 8 (AVX) vectors at once.
+///
+/// A packet stores one SIMD register per component: a vec3x4 holds the x of
+/// four vec3 in one register, the y in another and the z in a third one, so
+/// that no lane is wasted and every operation works on all the vectors at once.
+/// Comparisons return lane masks (all bits set for true) that can be consumed
+/// by select, any, all and movemask.
+///
+/// <glm/gtx/simd_packet.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#if(GLM_ARCH != GLM_ARCH_PURE)
+
+#if(!(GLM_ARCH & GLM_ARCH_SSE2))
+#	error "GLM: GLM_GTX_simd_packet requires compiler support of SSE2 through intrinsics"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_simd_packet extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	/// Four float lanes stored in a SSE register.
+	/// \ingroup gtx_simd_packet
+	GLM_ALIGNED_STRUCT(16) fpacket4SIMD
+	{
+		typedef float value_type;
+		typedef __m128 data_type;
+		typedef fpacket4SIMD type;
+
+		static GLM_RELAXED_CONSTEXPR length_t lanes = 4;
+
+		__m128 Data;
+
+		fpacket4SIMD() GLM_DEFAULT_CTOR;
+		fpacket4SIMD(__m128 const & Data);
+		fpacket4SIMD(float const & s);
+		fpacket4SIMD(float const & a, float const & b, float const & c, float const & d);
+
+		/// Load 4 consecutive floats, p doesn't need to be aligned.
+		static fpacket4SIMD load(float const * p);
+		/// Store 4 consecutive floats, p doesn't need to be aligned.
+		void store(float * p) const;
+
+		float operator[](length_t i) const;
+
+		fpacket4SIMD & operator+=(fpacket4SIMD const & v);
+		fpacket4SIMD & operator-=(fpacket4SIMD const & v);
+		fpacket4SIMD & operator*=(fpacket4SIMD const & v);
+		fpacket4SIMD & operator/=(fpacket4SIMD const & v);
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX
+	/// Eight float lanes stored in an AVX register.
+	/// \ingroup gtx_simd_packet
+	GLM_ALIGNED_STRUCT(32) fpacket8SIMD
+	{
+		typedef float value_type;
+		typedef __m256 data_type;
+		typedef fpacket8SIMD type;
+
+		static GLM_RELAXED_CONSTEXPR length_t lanes = 8;
+
+		__m256 Data;
+
+		fpacket8SIMD() GLM_DEFAULT_CTOR;
+		fpacket8SIMD(__m256 const & Data);
+		fpacket8SIMD(float const & s);
+
+		/// Load 8 consecutive floats, p doesn't need to be aligned.
+		static fpacket8SIMD load(float const * p);
+		/// Store 8 consecutive floats, p doesn't need to be aligned.
+		void store(float * p) const;
+
+		float operator[](length_t i) const;
+
+		fpacket8SIMD & operator+=(fpacket8SIMD const & v);
+		fpacket8SIMD & operator-=(fpacket8SIMD const & v);
+		fpacket8SIMD & operator*=(fpacket8SIMD const & v);
+		fpacket8SIMD & operator/=(fpacket8SIMD const & v);
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX
+
+	/// Structure of arrays of 2 components vectors.
+	/// \ingroup gtx_simd_packet
+	template <typename packType>
+	struct tvec2packet
+	{
+		typedef packType value_type;
+		typedef tvec2packet<packType> type;
+
+		static GLM_RELAXED_CONSTEXPR length_t components = 2;
+		static GLM_RELAXED_CONSTEXPR length_t lanes = packType::lanes;
+
+		packType x, y;
+
+		tvec2packet() GLM_DEFAULT_CTOR;
+		tvec2packet(packType const & x, packType const & y);
+		template <precision P>
+		explicit tvec2packet(tvec2<float, P> const & v);
+
+		/// Extract the vector stored in lane i.
+		vec2 operator[](length_t i) const;
+	};
+
+	/// Structure of arrays of 3 components vectors.
+	/// \ingroup gtx_simd_packet
+	template <typename packType>
+	struct tvec3packet
+	{
+		typedef packType value_type;
+		typedef tvec3packet<packType> type;
+
+		static GLM_RELAXED_CONSTEXPR length_t components = 3;
+		static GLM_RELAXED_CONSTEXPR length_t lanes = packType::lanes;
+
+		packType x, y, z;
+
+		tvec3packet() GLM_DEFAULT_CTOR;
+		tvec3packet(packType const & x, packType const & y, packType const & z);
+		template <precision P>
+		explicit tvec3packet(tvec3<float, P> const & v);
+
+		/// Extract the vector stored in lane i.
+		vec3 operator[](length_t i) const;
+	};
+
+	/// Structure of arrays of 4 components vectors.
+	/// \ingroup gtx_simd_packet
+	template <typename packType>
+	struct tvec4packet
+	{
+		typedef packType value_type;
+		typedef tvec4packet<packType> type;
+
+		static GLM_RELAXED_CONSTEXPR length_t components = 4;
+		static GLM_RELAXED_CONSTEXPR length_t lanes = packType::lanes;
+
+		packType x, y, z, w;
+
+		tvec4packet() GLM_DEFAULT_CTOR;
+		tvec4packet(packType const & x, packType const & y, packType const & z, packType const & w);
+		tvec4packet(tvec3packet<packType> const & v, packType const & w);
+		template <precision P>
+		explicit tvec4packet(tvec4<float, P> const & v);
+
+		/// Extract the vector stored in lane i.
+		vec4 operator[](length_t i) const;
+	};
+}//namespace detail
+
+	/// @addtogroup gtx_simd_packet
+	/// @{
+
+	typedef detail::fpacket4SIMD					simdPacket4;
+	typedef detail::tvec2packet<simdPacket4>		vec2x4;
+	typedef detail::tvec3packet<simdPacket4>		vec3x4;
+	typedef detail::tvec4packet<simdPacket4>		vec4x4;
+
+#	if GLM_ARCH & GLM_ARCH_AVX
+	typedef detail::fpacket8SIMD					simdPacket8;
+	typedef detail::tvec2packet<simdPacket8>		vec2x8;
+	typedef detail::tvec3packet<simdPacket8>		vec3x8;
+	typedef detail::tvec4packet<simdPacket8>		vec4x8;
+#	endif//GLM_ARCH & GLM_ARCH_AVX
+
+	//////////////////////////////////////
+	// Lane functions
+
+	/// Returns a for each lane where the mask is set and b otherwise.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD select(detail::fpacket4SIMD const & mask, detail::fpacket4SIMD const & a, detail::fpacket4SIMD const & b);
+
+	/// Returns a bitfield where the bit i is set if the lane i of the mask is set.
+	/// @see gtx_simd_packet
+	int movemask(detail::fpacket4SIMD const & mask);
+
+	/// Returns true if at least one lane of the mask is set.
+	/// @see gtx_simd_packet
+	bool any(detail::fpacket4SIMD const & mask);
+
+	/// Returns true if all the lanes of the mask are set.
+	/// @see gtx_simd_packet
+	bool all(detail::fpacket4SIMD const & mask);
+
+	/// Per lane minimum.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD min(detail::fpacket4SIMD const & a, detail::fpacket4SIMD const & b);
+
+	/// Per lane maximum.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD max(detail::fpacket4SIMD const & a, detail::fpacket4SIMD const & b);
+
+	/// Per lane absolute value.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD abs(detail::fpacket4SIMD const & a);
+
+	/// Per lane floor, valid for values in the int range.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD floor(detail::fpacket4SIMD const & a);
+
+	/// Per lane square root.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD sqrt(detail::fpacket4SIMD const & a);
+
+	/// Per lane reciprocal square root, refined with a Newton-Raphson iteration.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD inversesqrt(detail::fpacket4SIMD const & a);
+
+	/// Computes a * b + c per lane, fused when GLM_HAS_FMA is set.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD fma(detail::fpacket4SIMD const & a, detail::fpacket4SIMD const & b, detail::fpacket4SIMD const & c);
+
+#	if GLM_ARCH & GLM_ARCH_AVX
+	detail::fpacket8SIMD select(detail::fpacket8SIMD const & mask, detail::fpacket8SIMD const & a, detail::fpacket8SIMD const & b);
+	int movemask(detail::fpacket8SIMD const & mask);
+	bool any(detail::fpacket8SIMD const & mask);
+	bool all(detail::fpacket8SIMD const & mask);
+	detail::fpacket8SIMD min(detail::fpacket8SIMD const & a, detail::fpacket8SIMD const & b);
+	detail::fpacket8SIMD max(detail::fpacket8SIMD const & a, detail::fpacket8SIMD const & b);
+	detail::fpacket8SIMD abs(detail::fpacket8SIMD const & a);
+	detail::fpacket8SIMD floor(detail::fpacket8SIMD const & a);
+	detail::fpacket8SIMD sqrt(detail::fpacket8SIMD const & a);
+	detail::fpacket8SIMD inversesqrt(detail::fpacket8SIMD const & a);
+	detail::fpacket8SIMD fma(detail::fpacket8SIMD const & a, detail::fpacket8SIMD const & b, detail::fpacket8SIMD const & c);
+#	endif//GLM_ARCH & GLM_ARCH_AVX
+
+	/// Per lane clamp.
+	/// @see gtx_simd_packet
+	detail::fpacket4SIMD clamp(detail::fpacket4SIMD const & x, detail::fpacket4SIMD const & minVal, detail::fpacket4SIMD const & maxVal);
+
+#	if GLM_ARCH & GLM_ARCH_AVX
+	detail::fpacket8SIMD clamp(detail::fpacket8SIMD const & x, detail::fpacket8SIMD const & minVal, detail::fpacket8SIMD const & maxVal);
+#	endif//GLM_ARCH & GLM_ARCH_AVX
+
+	//////////////////////////////////////
+	// Geometric functions
+
+	/// Returns the dot product of each pair of vectors.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	packType dot(detail::tvec2packet<packType> const & a, detail::tvec2packet<packType> const & b);
+
+	template <typename packType>
+	packType dot(detail::tvec3packet<packType> const & a, detail::tvec3packet<packType> const & b);
+
+	template <typename packType>
+	packType dot(detail::tvec4packet<packType> const & a, detail::tvec4packet<packType> const & b);
+
+	/// Returns the cross product of each pair of vectors.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec3packet<packType> cross(detail::tvec3packet<packType> const & a, detail::tvec3packet<packType> const & b);
+
+	/// Returns the length of each vector.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	packType length(detail::tvec2packet<packType> const & v);
+
+	template <typename packType>
+	packType length(detail::tvec3packet<packType> const & v);
+
+	template <typename packType>
+	packType length(detail::tvec4packet<packType> const & v);
+
+	/// Returns each vector divided by its length.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> normalize(detail::tvec2packet<packType> const & v);
+
+	template <typename packType>
+	detail::tvec3packet<packType> normalize(detail::tvec3packet<packType> const & v);
+
+	template <typename packType>
+	detail::tvec4packet<packType> normalize(detail::tvec4packet<packType> const & v);
+
+	/// Linear blend of x and y per lane: x * (1 - a) + y * a.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> mix(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y, packType const & a);
+
+	template <typename packType>
+	detail::tvec3packet<packType> mix(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y, packType const & a);
+
+	template <typename packType>
+	detail::tvec4packet<packType> mix(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y, packType const & a);
+
+	//////////////////////////////////////
+	// Vector relational functions, returning lane masks
+
+	/// Returns the lane masks of the component-wise comparison x < y.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> lessThan(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec3packet<packType> lessThan(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec4packet<packType> lessThan(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y);
+
+	/// Returns the lane masks of the component-wise comparison x <= y.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> lessThanEqual(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec3packet<packType> lessThanEqual(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec4packet<packType> lessThanEqual(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y);
+
+	/// Returns the lane masks of the component-wise comparison x > y.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> greaterThan(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec3packet<packType> greaterThan(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec4packet<packType> greaterThan(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y);
+
+	/// Returns the lane masks of the component-wise comparison x >= y.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> greaterThanEqual(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec3packet<packType> greaterThanEqual(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec4packet<packType> greaterThanEqual(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y);
+
+	/// Returns the lane masks of the component-wise comparison x == y.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> equal(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec3packet<packType> equal(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec4packet<packType> equal(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y);
+
+	/// Returns the lane masks of the component-wise comparison x != y.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> notEqual(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec3packet<packType> notEqual(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y);
+
+	template <typename packType>
+	detail::tvec4packet<packType> notEqual(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y);
+
+	/// Selects per lane between the vectors a, where the mask is set, and b.
+	/// @see gtx_simd_packet
+	template <typename packType>
+	detail::tvec2packet<packType> select(packType const & mask, detail::tvec2packet<packType> const & a, detail::tvec2packet<packType> const & b);
+
+	template <typename packType>
+	detail::tvec3packet<packType> select(packType const & mask, detail::tvec3packet<packType> const & a, detail::tvec3packet<packType> const & b);
+
+	template <typename packType>
+	detail::tvec4packet<packType> select(packType const & mask, detail::tvec4packet<packType> const & a, detail::tvec4packet<packType> const & b);
+
+	//////////////////////////////////////
+	// Matrix functions
+
+	/// Transforms each vector of the packet by the matrix m.
+	/// @see gtx_simd_packet
+	template <typename packType, precision P>
+	detail::tvec3packet<packType> operator*(tmat3x3<float, P> const & m, detail::tvec3packet<packType> const & v);
+
+	/// Transforms each vector of the packet by the matrix m.
+	/// @see gtx_simd_packet
+	template <typename packType, precision P>
+	detail::tvec4packet<packType> operator*(tmat4x4<float, P> const & m, detail::tvec4packet<packType> const & v);
+
+	/// Transforms each point of the packet by the matrix m, assuming w = 1 and an affine matrix.
+	/// @see gtx_simd_packet
+	template <typename packType, precision P>
+	detail::tvec3packet<packType> transformPoint(tmat4x4<float, P> const & m, detail::tvec3packet<packType> const & v);
+
+	/// Transforms each direction of the packet by the matrix m, assuming w = 0.
+	/// @see gtx_simd_packet
+	template <typename packType, precision P>
+	detail::tvec3packet<packType> transformVector(tmat4x4<float, P> const & m, detail::tvec3packet<packType> const & v);
+
+	//////////////////////////////////////
+	// Conversion from and to arrays of structures
+
+	/// Loads packType::lanes consecutive vectors from an array of structures.
+	/// @see gtx_simd_packet
+	template <typename packType, precision P>
+	void gather(tvec2<float, P> const * Src, detail::tvec2packet<packType> & Dst);
+
+	template <typename packType, precision P>
+	void gather(tvec3<float, P> const * Src, detail::tvec3packet<packType> & Dst);
+
+	template <typename packType, precision P>
+	void gather(tvec4<float, P> const * Src, detail::tvec4packet<packType> & Dst);
+
+	/// Loads packType::lanes vectors addressed by Indices from an array of structures.
+	/// @see gtx_simd_packet
+	template <typename packType, precision P>
+	void gather(tvec3<float, P> const * Src, unsigned int const * Indices, detail::tvec3packet<packType> & Dst);
+
+	template <typename packType, precision P>
+	void gather(tvec4<float, P> const * Src, unsigned int const * Indices, detail::tvec4packet<packType> & Dst);
+
+	/// Stores packType::lanes consecutive vectors to an array of structures.
+	/// @see gtx_simd_packet
+	template <typename packType, precision P>
+	void scatter(detail::tvec2packet<packType> const & Src, tvec2<float, P> * Dst);
+
+	template <typename packType, precision P>
+	void scatter(detail::tvec3packet<packType> const & Src, tvec3<float, P> * Dst);
+
+	template <typename packType, precision P>
+	void scatter(detail::tvec4packet<packType> const & Src, tvec4<float, P> * Dst);
+
+	/// @}
+}//namespace glm
+
+#include "simd_packet.inl"
+
+#endif//(GLM_ARCH != GLM_ARCH_PURE)
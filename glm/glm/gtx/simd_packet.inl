@@ -0,0 +1,1091 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_packet
+/// @file glm/gtx/simd_packet.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	//////////////////////////////////////
+	// fpacket4SIMD
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+		GLM_FUNC_QUALIFIER fpacket4SIMD::fpacket4SIMD()
+#			ifndef GLM_FORCE_NO_CTOR_INIT
+				: Data(_mm_setzero_ps())
+#			endif
+		{}
+#	endif
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD::fpacket4SIMD(__m128 const & Data) :
+		Data(Data)
+	{}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD::fpacket4SIMD(float const & s) :
+		Data(_mm_set1_ps(s))
+	{}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD::fpacket4SIMD(float const & a, float const & b, float const & c, float const & d) :
+		Data(_mm_set_ps(d, c, b, a))
+	{}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD fpacket4SIMD::load(float const * p)
+	{
+		return fpacket4SIMD(_mm_loadu_ps(p));
+	}
+
+	GLM_FUNC_QUALIFIER void fpacket4SIMD::store(float * p) const
+	{
+		_mm_storeu_ps(p, this->Data);
+	}
+
+	GLM_FUNC_QUALIFIER float fpacket4SIMD::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < lanes);
+
+		GLM_ALIGN(16) float Lanes[4];
+		_mm_store_ps(Lanes, this->Data);
+		return Lanes[i];
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD & fpacket4SIMD::operator+=(fpacket4SIMD const & v)
+	{
+		this->Data = _mm_add_ps(this->Data, v.Data);
+		return *this;
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD & fpacket4SIMD::operator-=(fpacket4SIMD const & v)
+	{
+		this->Data = _mm_sub_ps(this->Data, v.Data);
+		return *this;
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD & fpacket4SIMD::operator*=(fpacket4SIMD const & v)
+	{
+		this->Data = _mm_mul_ps(this->Data, v.Data);
+		return *this;
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD & fpacket4SIMD::operator/=(fpacket4SIMD const & v)
+	{
+		this->Data = _mm_div_ps(this->Data, v.Data);
+		return *this;
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator+(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_add_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator-(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_sub_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator*(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_mul_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator/(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_div_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator-(fpacket4SIMD const & a)
+	{
+		return _mm_xor_ps(a.Data, _mm_set1_ps(-0.0f));
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator&(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_and_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator|(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_or_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator^(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_xor_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator~(fpacket4SIMD const & a)
+	{
+		return _mm_xor_ps(a.Data, _mm_castsi128_ps(_mm_set1_epi32(-1)));
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator<(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_cmplt_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator<=(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_cmple_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator>(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_cmpgt_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator>=(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_cmpge_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator==(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_cmpeq_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket4SIMD operator!=(fpacket4SIMD const & a, fpacket4SIMD const & b)
+	{
+		return _mm_cmpneq_ps(a.Data, b.Data);
+	}
+
+	//////////////////////////////////////
+	// fpacket8SIMD
+
+#	if GLM_ARCH & GLM_ARCH_AVX
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+		GLM_FUNC_QUALIFIER fpacket8SIMD::fpacket8SIMD()
+#			ifndef GLM_FORCE_NO_CTOR_INIT
+				: Data(_mm256_setzero_ps())
+#			endif
+		{}
+#	endif
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD::fpacket8SIMD(__m256 const & Data) :
+		Data(Data)
+	{}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD::fpacket8SIMD(float const & s) :
+		Data(_mm256_set1_ps(s))
+	{}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD fpacket8SIMD::load(float const * p)
+	{
+		return fpacket8SIMD(_mm256_loadu_ps(p));
+	}
+
+	GLM_FUNC_QUALIFIER void fpacket8SIMD::store(float * p) const
+	{
+		_mm256_storeu_ps(p, this->Data);
+	}
+
+	GLM_FUNC_QUALIFIER float fpacket8SIMD::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < lanes);
+
+		GLM_ALIGN(32) float Lanes[8];
+		_mm256_store_ps(Lanes, this->Data);
+		return Lanes[i];
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD & fpacket8SIMD::operator+=(fpacket8SIMD const & v)
+	{
+		this->Data = _mm256_add_ps(this->Data, v.Data);
+		return *this;
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD & fpacket8SIMD::operator-=(fpacket8SIMD const & v)
+	{
+		this->Data = _mm256_sub_ps(this->Data, v.Data);
+		return *this;
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD & fpacket8SIMD::operator*=(fpacket8SIMD const & v)
+	{
+		this->Data = _mm256_mul_ps(this->Data, v.Data);
+		return *this;
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD & fpacket8SIMD::operator/=(fpacket8SIMD const & v)
+	{
+		this->Data = _mm256_div_ps(this->Data, v.Data);
+		return *this;
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator+(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_add_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator-(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_sub_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator*(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_mul_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator/(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_div_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator-(fpacket8SIMD const & a)
+	{
+		return _mm256_xor_ps(a.Data, _mm256_set1_ps(-0.0f));
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator&(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_and_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator|(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_or_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator^(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_xor_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator~(fpacket8SIMD const & a)
+	{
+		return _mm256_xor_ps(a.Data, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator<(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_cmp_ps(a.Data, b.Data, _CMP_LT_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator<=(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_cmp_ps(a.Data, b.Data, _CMP_LE_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator>(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_cmp_ps(a.Data, b.Data, _CMP_GT_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator>=(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_cmp_ps(a.Data, b.Data, _CMP_GE_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator==(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_cmp_ps(a.Data, b.Data, _CMP_EQ_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fpacket8SIMD operator!=(fpacket8SIMD const & a, fpacket8SIMD const & b)
+	{
+		return _mm256_cmp_ps(a.Data, b.Data, _CMP_NEQ_UQ);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX
+
+	//////////////////////////////////////
+	// tvec2packet
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+		template <typename packType>
+		GLM_FUNC_QUALIFIER tvec2packet<packType>::tvec2packet()
+		{}
+#	endif
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType>::tvec2packet(packType const & x, packType const & y) :
+		x(x), y(y)
+	{}
+
+	template <typename packType>
+	template <precision P>
+	GLM_FUNC_QUALIFIER tvec2packet<packType>::tvec2packet(tvec2<float, P> const & v) :
+		x(v.x), y(v.y)
+	{}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER vec2 tvec2packet<packType>::operator[](length_t i) const
+	{
+		return vec2(this->x[i], this->y[i]);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType> operator+(tvec2packet<packType> const & a, tvec2packet<packType> const & b)
+	{
+		return tvec2packet<packType>(a.x + b.x, a.y + b.y);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType> operator-(tvec2packet<packType> const & a, tvec2packet<packType> const & b)
+	{
+		return tvec2packet<packType>(a.x - b.x, a.y - b.y);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType> operator*(tvec2packet<packType> const & a, tvec2packet<packType> const & b)
+	{
+		return tvec2packet<packType>(a.x * b.x, a.y * b.y);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType> operator*(tvec2packet<packType> const & a, packType const & s)
+	{
+		return tvec2packet<packType>(a.x * s, a.y * s);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType> operator*(packType const & s, tvec2packet<packType> const & a)
+	{
+		return tvec2packet<packType>(s * a.x, s * a.y);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType> operator/(tvec2packet<packType> const & a, tvec2packet<packType> const & b)
+	{
+		return tvec2packet<packType>(a.x / b.x, a.y / b.y);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType> operator/(tvec2packet<packType> const & a, packType const & s)
+	{
+		return tvec2packet<packType>(a.x / s, a.y / s);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec2packet<packType> operator-(tvec2packet<packType> const & a)
+	{
+		return tvec2packet<packType>(-a.x, -a.y);
+	}
+
+	//////////////////////////////////////
+	// tvec3packet
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+		template <typename packType>
+		GLM_FUNC_QUALIFIER tvec3packet<packType>::tvec3packet()
+		{}
+#	endif
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType>::tvec3packet(packType const & x, packType const & y, packType const & z) :
+		x(x), y(y), z(z)
+	{}
+
+	template <typename packType>
+	template <precision P>
+	GLM_FUNC_QUALIFIER tvec3packet<packType>::tvec3packet(tvec3<float, P> const & v) :
+		x(v.x), y(v.y), z(v.z)
+	{}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER vec3 tvec3packet<packType>::operator[](length_t i) const
+	{
+		return vec3(this->x[i], this->y[i], this->z[i]);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType> operator+(tvec3packet<packType> const & a, tvec3packet<packType> const & b)
+	{
+		return tvec3packet<packType>(a.x + b.x, a.y + b.y, a.z + b.z);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType> operator-(tvec3packet<packType> const & a, tvec3packet<packType> const & b)
+	{
+		return tvec3packet<packType>(a.x - b.x, a.y - b.y, a.z - b.z);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType> operator*(tvec3packet<packType> const & a, tvec3packet<packType> const & b)
+	{
+		return tvec3packet<packType>(a.x * b.x, a.y * b.y, a.z * b.z);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType> operator*(tvec3packet<packType> const & a, packType const & s)
+	{
+		return tvec3packet<packType>(a.x * s, a.y * s, a.z * s);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType> operator*(packType const & s, tvec3packet<packType> const & a)
+	{
+		return tvec3packet<packType>(s * a.x, s * a.y, s * a.z);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType> operator/(tvec3packet<packType> const & a, tvec3packet<packType> const & b)
+	{
+		return tvec3packet<packType>(a.x / b.x, a.y / b.y, a.z / b.z);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType> operator/(tvec3packet<packType> const & a, packType const & s)
+	{
+		return tvec3packet<packType>(a.x / s, a.y / s, a.z / s);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec3packet<packType> operator-(tvec3packet<packType> const & a)
+	{
+		return tvec3packet<packType>(-a.x, -a.y, -a.z);
+	}
+
+	//////////////////////////////////////
+	// tvec4packet
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+		template <typename packType>
+		GLM_FUNC_QUALIFIER tvec4packet<packType>::tvec4packet()
+		{}
+#	endif
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType>::tvec4packet(packType const & x, packType const & y, packType const & z, packType const & w) :
+		x(x), y(y), z(z), w(w)
+	{}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType>::tvec4packet(tvec3packet<packType> const & v, packType const & w) :
+		x(v.x), y(v.y), z(v.z), w(w)
+	{}
+
+	template <typename packType>
+	template <precision P>
+	GLM_FUNC_QUALIFIER tvec4packet<packType>::tvec4packet(tvec4<float, P> const & v) :
+		x(v.x), y(v.y), z(v.z), w(v.w)
+	{}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER vec4 tvec4packet<packType>::operator[](length_t i) const
+	{
+		return vec4(this->x[i], this->y[i], this->z[i], this->w[i]);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> operator+(tvec4packet<packType> const & a, tvec4packet<packType> const & b)
+	{
+		return tvec4packet<packType>(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> operator-(tvec4packet<packType> const & a, tvec4packet<packType> const & b)
+	{
+		return tvec4packet<packType>(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> operator*(tvec4packet<packType> const & a, tvec4packet<packType> const & b)
+	{
+		return tvec4packet<packType>(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> operator*(tvec4packet<packType> const & a, packType const & s)
+	{
+		return tvec4packet<packType>(a.x * s, a.y * s, a.z * s, a.w * s);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> operator*(packType const & s, tvec4packet<packType> const & a)
+	{
+		return tvec4packet<packType>(s * a.x, s * a.y, s * a.z, s * a.w);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> operator/(tvec4packet<packType> const & a, tvec4packet<packType> const & b)
+	{
+		return tvec4packet<packType>(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> operator/(tvec4packet<packType> const & a, packType const & s)
+	{
+		return tvec4packet<packType>(a.x / s, a.y / s, a.z / s, a.w / s);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER tvec4packet<packType> operator-(tvec4packet<packType> const & a)
+	{
+		return tvec4packet<packType>(-a.x, -a.y, -a.z, -a.w);
+	}
+
+	//////////////////////////////////////
+	// Array of structures to structure of arrays transposes
+
+	template <typename packType>
+	struct compute_packet_transpose
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void gather(tvec3<float, P> const * Src, tvec3packet<packType> & Dst)
+		{
+			float X[packType::lanes], Y[packType::lanes], Z[packType::lanes];
+			for(length_t i = 0; i < packType::lanes; ++i)
+			{
+				X[i] = Src[i].x;
+				Y[i] = Src[i].y;
+				Z[i] = Src[i].z;
+			}
+			Dst.x = packType::load(X);
+			Dst.y = packType::load(Y);
+			Dst.z = packType::load(Z);
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void gather(tvec4<float, P> const * Src, tvec4packet<packType> & Dst)
+		{
+			float X[packType::lanes], Y[packType::lanes], Z[packType::lanes], W[packType::lanes];
+			for(length_t i = 0; i < packType::lanes; ++i)
+			{
+				X[i] = Src[i].x;
+				Y[i] = Src[i].y;
+				Z[i] = Src[i].z;
+				W[i] = Src[i].w;
+			}
+			Dst.x = packType::load(X);
+			Dst.y = packType::load(Y);
+			Dst.z = packType::load(Z);
+			Dst.w = packType::load(W);
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void scatter(tvec3packet<packType> const & Src, tvec3<float, P> * Dst)
+		{
+			float X[packType::lanes], Y[packType::lanes], Z[packType::lanes];
+			Src.x.store(X);
+			Src.y.store(Y);
+			Src.z.store(Z);
+			for(length_t i = 0; i < packType::lanes; ++i)
+				Dst[i] = tvec3<float, P>(X[i], Y[i], Z[i]);
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void scatter(tvec4packet<packType> const & Src, tvec4<float, P> * Dst)
+		{
+			float X[packType::lanes], Y[packType::lanes], Z[packType::lanes], W[packType::lanes];
+			Src.x.store(X);
+			Src.y.store(Y);
+			Src.z.store(Z);
+			Src.w.store(W);
+			for(length_t i = 0; i < packType::lanes; ++i)
+				Dst[i] = tvec4<float, P>(X[i], Y[i], Z[i], W[i]);
+		}
+	};
+
+	template <>
+	struct compute_packet_transpose<fpacket4SIMD>
+	{
+		// 4 vec3 are loaded with 3 unaligned loads then shuffled:
+		// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void gather(tvec3<float, P> const * Src, tvec3packet<fpacket4SIMD> & Dst)
+		{
+			float const * p = &Src[0].x;
+			__m128 const a = _mm_loadu_ps(p + 0);
+			__m128 const b = _mm_loadu_ps(p + 4);
+			__m128 const c = _mm_loadu_ps(p + 8);
+
+			__m128 const x2y2x3y3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+			__m128 const y0z0y1z1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+
+			Dst.x.Data = _mm_shuffle_ps(a, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+			Dst.y.Data = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+			Dst.z.Data = _mm_shuffle_ps(y0z0y1z1, c, _MM_SHUFFLE(3, 0, 3, 1));
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void gather(tvec4<float, P> const * Src, tvec4packet<fpacket4SIMD> & Dst)
+		{
+			__m128 r0 = _mm_loadu_ps(&Src[0].x);
+			__m128 r1 = _mm_loadu_ps(&Src[1].x);
+			__m128 r2 = _mm_loadu_ps(&Src[2].x);
+			__m128 r3 = _mm_loadu_ps(&Src[3].x);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			Dst.x.Data = r0;
+			Dst.y.Data = r1;
+			Dst.z.Data = r2;
+			Dst.w.Data = r3;
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void scatter(tvec3packet<fpacket4SIMD> const & Src, tvec3<float, P> * Dst)
+		{
+			__m128 const x0y0x1y1 = _mm_unpacklo_ps(Src.x.Data, Src.y.Data); // x0 y0 x1 y1
+			__m128 const x2y2x3y3 = _mm_unpackhi_ps(Src.x.Data, Src.y.Data); // x2 y2 x3 y3
+			__m128 const z = Src.z.Data;
+
+			float * p = &Dst[0].x;
+			// x0 y0 z0 x1
+			_mm_storeu_ps(p + 0, _mm_shuffle_ps(x0y0x1y1, _mm_shuffle_ps(z, x0y0x1y1, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+			// y1 z1 x2 y2
+			_mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(x0y0x1y1, z, _MM_SHUFFLE(1, 1, 3, 3)), x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0)));
+			// z2 x3 y3 z3
+			_mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x2y2x3y3, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(x2y2x3y3, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void scatter(tvec4packet<fpacket4SIMD> const & Src, tvec4<float, P> * Dst)
+		{
+			__m128 r0 = Src.x.Data;
+			__m128 r1 = Src.y.Data;
+			__m128 r2 = Src.z.Data;
+			__m128 r3 = Src.w.Data;
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(&Dst[0].x, r0);
+			_mm_storeu_ps(&Dst[1].x, r1);
+			_mm_storeu_ps(&Dst[2].x, r2);
+			_mm_storeu_ps(&Dst[3].x, r3);
+		}
+	};
+}//namespace detail
+
+	//////////////////////////////////////
+	// Lane functions
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD select(detail::fpacket4SIMD const & mask, detail::fpacket4SIMD const & a, detail::fpacket4SIMD const & b)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE4
+			return _mm_blendv_ps(b.Data, a.Data, mask.Data);
+#		else
+			return _mm_or_ps(_mm_and_ps(mask.Data, a.Data), _mm_andnot_ps(mask.Data, b.Data));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER int movemask(detail::fpacket4SIMD const & mask)
+	{
+		return _mm_movemask_ps(mask.Data);
+	}
+
+	GLM_FUNC_QUALIFIER bool any(detail::fpacket4SIMD const & mask)
+	{
+		return _mm_movemask_ps(mask.Data) != 0;
+	}
+
+	GLM_FUNC_QUALIFIER bool all(detail::fpacket4SIMD const & mask)
+	{
+		return _mm_movemask_ps(mask.Data) == 0xF;
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD min(detail::fpacket4SIMD const & a, detail::fpacket4SIMD const & b)
+	{
+		return _mm_min_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD max(detail::fpacket4SIMD const & a, detail::fpacket4SIMD const & b)
+	{
+		return _mm_max_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD clamp(detail::fpacket4SIMD const & x, detail::fpacket4SIMD const & minVal, detail::fpacket4SIMD const & maxVal)
+	{
+		return _mm_min_ps(_mm_max_ps(x.Data, minVal.Data), maxVal.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD abs(detail::fpacket4SIMD const & a)
+	{
+		return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD floor(detail::fpacket4SIMD const & a)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE4
+			return _mm_floor_ps(a.Data);
+#		else
+			// Truncate then subtract one where the truncation rounded up
+			__m128 const Trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.Data));
+			__m128 const Greater = _mm_cmpgt_ps(Trunc, a.Data);
+			return _mm_sub_ps(Trunc, _mm_and_ps(Greater, _mm_set1_ps(1.0f)));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD sqrt(detail::fpacket4SIMD const & a)
+	{
+		return _mm_sqrt_ps(a.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD inversesqrt(detail::fpacket4SIMD const & a)
+	{
+		__m128 const Estimate = _mm_rsqrt_ps(a.Data);
+		__m128 const Square = _mm_mul_ps(_mm_mul_ps(a.Data, Estimate), Estimate);
+		return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), Estimate), _mm_sub_ps(_mm_set1_ps(3.0f), Square));
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket4SIMD fma(detail::fpacket4SIMD const & a, detail::fpacket4SIMD const & b, detail::fpacket4SIMD const & c)
+	{
+#		if GLM_HAS_FMA
+			return _mm_fmadd_ps(a.Data, b.Data, c.Data);
+#		else
+			return _mm_add_ps(_mm_mul_ps(a.Data, b.Data), c.Data);
+#		endif
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD select(detail::fpacket8SIMD const & mask, detail::fpacket8SIMD const & a, detail::fpacket8SIMD const & b)
+	{
+		return _mm256_blendv_ps(b.Data, a.Data, mask.Data);
+	}
+
+	GLM_FUNC_QUALIFIER int movemask(detail::fpacket8SIMD const & mask)
+	{
+		return _mm256_movemask_ps(mask.Data);
+	}
+
+	GLM_FUNC_QUALIFIER bool any(detail::fpacket8SIMD const & mask)
+	{
+		return _mm256_movemask_ps(mask.Data) != 0;
+	}
+
+	GLM_FUNC_QUALIFIER bool all(detail::fpacket8SIMD const & mask)
+	{
+		return _mm256_movemask_ps(mask.Data) == 0xFF;
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD min(detail::fpacket8SIMD const & a, detail::fpacket8SIMD const & b)
+	{
+		return _mm256_min_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD max(detail::fpacket8SIMD const & a, detail::fpacket8SIMD const & b)
+	{
+		return _mm256_max_ps(a.Data, b.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD clamp(detail::fpacket8SIMD const & x, detail::fpacket8SIMD const & minVal, detail::fpacket8SIMD const & maxVal)
+	{
+		return _mm256_min_ps(_mm256_max_ps(x.Data, minVal.Data), maxVal.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD abs(detail::fpacket8SIMD const & a)
+	{
+		return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD floor(detail::fpacket8SIMD const & a)
+	{
+		return _mm256_floor_ps(a.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD sqrt(detail::fpacket8SIMD const & a)
+	{
+		return _mm256_sqrt_ps(a.Data);
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD inversesqrt(detail::fpacket8SIMD const & a)
+	{
+		__m256 const Estimate = _mm256_rsqrt_ps(a.Data);
+		__m256 const Square = _mm256_mul_ps(_mm256_mul_ps(a.Data, Estimate), Estimate);
+		return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), Estimate), _mm256_sub_ps(_mm256_set1_ps(3.0f), Square));
+	}
+
+	GLM_FUNC_QUALIFIER detail::fpacket8SIMD fma(detail::fpacket8SIMD const & a, detail::fpacket8SIMD const & b, detail::fpacket8SIMD const & c)
+	{
+#		if GLM_HAS_FMA
+			return _mm256_fmadd_ps(a.Data, b.Data, c.Data);
+#		else
+			return _mm256_add_ps(_mm256_mul_ps(a.Data, b.Data), c.Data);
+#		endif
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX
+
+	//////////////////////////////////////
+	// Geometric functions
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType dot(detail::tvec2packet<packType> const & a, detail::tvec2packet<packType> const & b)
+	{
+		return fma(a.x, b.x, a.y * b.y);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType dot(detail::tvec3packet<packType> const & a, detail::tvec3packet<packType> const & b)
+	{
+		return fma(a.x, b.x, fma(a.y, b.y, a.z * b.z));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType dot(detail::tvec4packet<packType> const & a, detail::tvec4packet<packType> const & b)
+	{
+		return fma(a.x, b.x, fma(a.y, b.y, fma(a.z, b.z, a.w * b.w)));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> cross(detail::tvec3packet<packType> const & a, detail::tvec3packet<packType> const & b)
+	{
+		return detail::tvec3packet<packType>(
+			a.y * b.z - b.y * a.z,
+			a.z * b.x - b.z * a.x,
+			a.x * b.y - b.x * a.y);
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType length(detail::tvec2packet<packType> const & v)
+	{
+		return sqrt(dot(v, v));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType length(detail::tvec3packet<packType> const & v)
+	{
+		return sqrt(dot(v, v));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER packType length(detail::tvec4packet<packType> const & v)
+	{
+		return sqrt(dot(v, v));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec2packet<packType> normalize(detail::tvec2packet<packType> const & v)
+	{
+		return v * inversesqrt(dot(v, v));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> normalize(detail::tvec3packet<packType> const & v)
+	{
+		return v * inversesqrt(dot(v, v));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec4packet<packType> normalize(detail::tvec4packet<packType> const & v)
+	{
+		return v * inversesqrt(dot(v, v));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec2packet<packType> mix(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y, packType const & a)
+	{
+		return detail::tvec2packet<packType>(
+			fma(y.x - x.x, a, x.x),
+			fma(y.y - x.y, a, x.y));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> mix(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y, packType const & a)
+	{
+		return detail::tvec3packet<packType>(
+			fma(y.x - x.x, a, x.x),
+			fma(y.y - x.y, a, x.y),
+			fma(y.z - x.z, a, x.z));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec4packet<packType> mix(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y, packType const & a)
+	{
+		return detail::tvec4packet<packType>(
+			fma(y.x - x.x, a, x.x),
+			fma(y.y - x.y, a, x.y),
+			fma(y.z - x.z, a, x.z),
+			fma(y.w - x.w, a, x.w));
+	}
+
+	//////////////////////////////////////
+	// Vector relational functions
+
+#	define GLM_PACKET_RELATIONAL(NAME, OP) \
+	template <typename packType> \
+	GLM_FUNC_QUALIFIER detail::tvec2packet<packType> NAME(detail::tvec2packet<packType> const & x, detail::tvec2packet<packType> const & y) \
+	{ \
+		return detail::tvec2packet<packType>(x.x OP y.x, x.y OP y.y); \
+	} \
+	template <typename packType> \
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> NAME(detail::tvec3packet<packType> const & x, detail::tvec3packet<packType> const & y) \
+	{ \
+		return detail::tvec3packet<packType>(x.x OP y.x, x.y OP y.y, x.z OP y.z); \
+	} \
+	template <typename packType> \
+	GLM_FUNC_QUALIFIER detail::tvec4packet<packType> NAME(detail::tvec4packet<packType> const & x, detail::tvec4packet<packType> const & y) \
+	{ \
+		return detail::tvec4packet<packType>(x.x OP y.x, x.y OP y.y, x.z OP y.z, x.w OP y.w); \
+	}
+
+	GLM_PACKET_RELATIONAL(lessThan, <)
+	GLM_PACKET_RELATIONAL(lessThanEqual, <=)
+	GLM_PACKET_RELATIONAL(greaterThan, >)
+	GLM_PACKET_RELATIONAL(greaterThanEqual, >=)
+	GLM_PACKET_RELATIONAL(equal, ==)
+	GLM_PACKET_RELATIONAL(notEqual, !=)
+
+#	undef GLM_PACKET_RELATIONAL
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec2packet<packType> select(packType const & mask, detail::tvec2packet<packType> const & a, detail::tvec2packet<packType> const & b)
+	{
+		return detail::tvec2packet<packType>(
+			select(mask, a.x, b.x),
+			select(mask, a.y, b.y));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> select(packType const & mask, detail::tvec3packet<packType> const & a, detail::tvec3packet<packType> const & b)
+	{
+		return detail::tvec3packet<packType>(
+			select(mask, a.x, b.x),
+			select(mask, a.y, b.y),
+			select(mask, a.z, b.z));
+	}
+
+	template <typename packType>
+	GLM_FUNC_QUALIFIER detail::tvec4packet<packType> select(packType const & mask, detail::tvec4packet<packType> const & a, detail::tvec4packet<packType> const & b)
+	{
+		return detail::tvec4packet<packType>(
+			select(mask, a.x, b.x),
+			select(mask, a.y, b.y),
+			select(mask, a.z, b.z),
+			select(mask, a.w, b.w));
+	}
+
+	//////////////////////////////////////
+	// Matrix functions
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> operator*(tmat3x3<float, P> const & m, detail::tvec3packet<packType> const & v)
+	{
+		return detail::tvec3packet<packType>(
+			fma(packType(m[0][0]), v.x, fma(packType(m[1][0]), v.y, packType(m[2][0]) * v.z)),
+			fma(packType(m[0][1]), v.x, fma(packType(m[1][1]), v.y, packType(m[2][1]) * v.z)),
+			fma(packType(m[0][2]), v.x, fma(packType(m[1][2]), v.y, packType(m[2][2]) * v.z)));
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER detail::tvec4packet<packType> operator*(tmat4x4<float, P> const & m, detail::tvec4packet<packType> const & v)
+	{
+		return detail::tvec4packet<packType>(
+			fma(packType(m[0][0]), v.x, fma(packType(m[1][0]), v.y, fma(packType(m[2][0]), v.z, packType(m[3][0]) * v.w))),
+			fma(packType(m[0][1]), v.x, fma(packType(m[1][1]), v.y, fma(packType(m[2][1]), v.z, packType(m[3][1]) * v.w))),
+			fma(packType(m[0][2]), v.x, fma(packType(m[1][2]), v.y, fma(packType(m[2][2]), v.z, packType(m[3][2]) * v.w))),
+			fma(packType(m[0][3]), v.x, fma(packType(m[1][3]), v.y, fma(packType(m[2][3]), v.z, packType(m[3][3]) * v.w))));
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> transformPoint(tmat4x4<float, P> const & m, detail::tvec3packet<packType> const & v)
+	{
+		return detail::tvec3packet<packType>(
+			fma(packType(m[0][0]), v.x, fma(packType(m[1][0]), v.y, fma(packType(m[2][0]), v.z, packType(m[3][0])))),
+			fma(packType(m[0][1]), v.x, fma(packType(m[1][1]), v.y, fma(packType(m[2][1]), v.z, packType(m[3][1])))),
+			fma(packType(m[0][2]), v.x, fma(packType(m[1][2]), v.y, fma(packType(m[2][2]), v.z, packType(m[3][2])))));
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER detail::tvec3packet<packType> transformVector(tmat4x4<float, P> const & m, detail::tvec3packet<packType> const & v)
+	{
+		return detail::tvec3packet<packType>(
+			fma(packType(m[0][0]), v.x, fma(packType(m[1][0]), v.y, packType(m[2][0]) * v.z)),
+			fma(packType(m[0][1]), v.x, fma(packType(m[1][1]), v.y, packType(m[2][1]) * v.z)),
+			fma(packType(m[0][2]), v.x, fma(packType(m[1][2]), v.y, packType(m[2][2]) * v.z)));
+	}
+
+	//////////////////////////////////////
+	// Conversion from and to arrays of structures
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER void gather(tvec2<float, P> const * Src, detail::tvec2packet<packType> & Dst)
+	{
+		float X[packType::lanes], Y[packType::lanes];
+		for(length_t i = 0; i < packType::lanes; ++i)
+		{
+			X[i] = Src[i].x;
+			Y[i] = Src[i].y;
+		}
+		Dst.x = packType::load(X);
+		Dst.y = packType::load(Y);
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER void gather(tvec3<float, P> const * Src, detail::tvec3packet<packType> & Dst)
+	{
+		detail::compute_packet_transpose<packType>::gather(Src, Dst);
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER void gather(tvec4<float, P> const * Src, detail::tvec4packet<packType> & Dst)
+	{
+		detail::compute_packet_transpose<packType>::gather(Src, Dst);
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER void gather(tvec3<float, P> const * Src, unsigned int const * Indices, detail::tvec3packet<packType> & Dst)
+	{
+		float X[packType::lanes], Y[packType::lanes], Z[packType::lanes];
+		for(length_t i = 0; i < packType::lanes; ++i)
+		{
+			tvec3<float, P> const & v = Src[Indices[i]];
+			X[i] = v.x;
+			Y[i] = v.y;
+			Z[i] = v.z;
+		}
+		Dst.x = packType::load(X);
+		Dst.y = packType::load(Y);
+		Dst.z = packType::load(Z);
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER void gather(tvec4<float, P> const * Src, unsigned int const * Indices, detail::tvec4packet<packType> & Dst)
+	{
+		float X[packType::lanes], Y[packType::lanes], Z[packType::lanes], W[packType::lanes];
+		for(length_t i = 0; i < packType::lanes; ++i)
+		{
+			tvec4<float, P> const & v = Src[Indices[i]];
+			X[i] = v.x;
+			Y[i] = v.y;
+			Z[i] = v.z;
+			W[i] = v.w;
+		}
+		Dst.x = packType::load(X);
+		Dst.y = packType::load(Y);
+		Dst.z = packType::load(Z);
+		Dst.w = packType::load(W);
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER void scatter(detail::tvec2packet<packType> const & Src, tvec2<float, P> * Dst)
+	{
+		float X[packType::lanes], Y[packType::lanes];
+		Src.x.store(X);
+		Src.y.store(Y);
+		for(length_t i = 0; i < packType::lanes; ++i)
+			Dst[i] = tvec2<float, P>(X[i], Y[i]);
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER void scatter(detail::tvec3packet<packType> const & Src, tvec3<float, P> * Dst)
+	{
+		detail::compute_packet_transpose<packType>::scatter(Src, Dst);
+	}
+
+	template <typename packType, precision P>
+	GLM_FUNC_QUALIFIER void scatter(detail::tvec4packet<packType> const & Src, tvec4<float, P> * Dst)
+	{
+		detail::compute_packet_transpose<packType>::scatter(Src, Dst);
+	}
+}//namespace glm
@@ -534,7 +534,7 @@ GLM_FUNC_QUALIFIER detail::fvec4SIMD fma
 	detail::fvec4SIMD const & c
 )
 {
-	return _mm_add_ps(_mm_mul_ps(a.Data, b.Data), c.Data);
+	return detail::sse_fma_ps(a.Data, b.Data, c.Data);
 }
 
 GLM_FUNC_QUALIFIER float length
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_skinning
+/// @file glm/gtx/skinning.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_type_precision (dependence)
+/// @see gtx_dual_quaternion (dependence)
+/// @see gtx_simd_dispatch (dependence)
+///
+/// @defgroup gtx_skinning GLM_GTX_skinning
+/// @ingroup gtx
+///
+/// @brief Skinning of vertex arrays by palettes of joints, with up to 4 influences per vertex.
+///
+/// Linear blend skinning blends the matrices of the joints, dual quaternion skinning
+/// blends their rigid transformations as dual quaternions, which preserves the volume
+/// around twisted joints. The weights of each vertex are expected to sum to 1, unused
+/// influences having a weight of 0.
+///
+/// The kernels process a vertex per SSE register or two vertices per AVX register,
+/// selected at runtime with GLM_GTX_simd_dispatch, and the vertex array is split
+/// among threads when OpenMP is enabled.
+///
+/// <glm/gtx/skinning.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/type_precision.hpp"
+#include "dual_quaternion.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_skinning extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_skinning
+	/// @{
+
+	/// Returns the sum of the matrices Palette[Joints[i]] weighted by Weights[i].
+	/// @see gtx_skinning
+	GLM_FUNC_DECL mat4 blendLinear(mat4 const * Palette, u16vec4 const & Joints, vec4 const & Weights);
+
+	/// Returns the normalized sum of the dual quaternions Palette[Joints[i]] weighted by Weights[i].
+	/// The weights of the dual quaternions whose real part is in the opposite hemisphere of the first one are negated.
+	/// @see gtx_skinning
+	GLM_FUNC_DECL dualquat blendDualQuat(dualquat const * Palette, u16vec4 const & Joints, vec4 const & Weights);
+
+	/// Transforms Count vertices by the blend of their joint matrices:
+	/// SkinnedPositions[i] = vec3(M * vec4(Positions[i], 1)) and SkinnedNormals[i] = normalize(mat3(M) * Normals[i])
+	/// where M = blendLinear(Palette, Joints[i], Weights[i]).
+	/// Normals and SkinnedNormals may be null to skin the positions only.
+	/// @see gtx_skinning
+	GLM_FUNC_DECL void skinLinearBatch(
+		mat4 const * Palette,
+		u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals,
+		std::size_t Count);
+
+	/// Transforms Count vertices by the blend of their joint dual quaternions:
+	/// SkinnedPositions[i] = Q * Positions[i] and SkinnedNormals[i] = Q.real * Normals[i]
+	/// where Q = blendDualQuat(Palette, Joints[i], Weights[i]).
+	/// Normals and SkinnedNormals may be null to skin the positions only.
+	/// @see gtx_skinning
+	GLM_FUNC_DECL void skinDualQuatBatch(
+		dualquat const * Palette,
+		u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals,
+		std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "skinning.inl"
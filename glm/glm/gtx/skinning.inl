@@ -0,0 +1,400 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_skinning
+/// @file glm/gtx/skinning.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	typedef void (*skin_linear_func)(mat4 const *, u16vec4 const *, vec4 const *, vec3 const *, vec3 const *, vec3 *, vec3 *, std::size_t);
+	typedef void (*skin_dual_quat_func)(dualquat const *, u16vec4 const *, vec4 const *, vec3 const *, vec3 const *, vec3 *, vec3 *, std::size_t);
+
+	GLM_FUNC_QUALIFIER void skin_linear_pure(
+		mat4 const * Palette, u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals, vec3 * SkinnedPositions, vec3 * SkinnedNormals, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			mat4 const m = blendLinear(Palette, Joints[i], Weights[i]);
+			SkinnedPositions[i] = vec3(m * vec4(Positions[i], 1.0f));
+			if(Normals)
+				SkinnedNormals[i] = normalize(mat3(m) * Normals[i]);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void skin_dual_quat_pure(
+		dualquat const * Palette, u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals, vec3 * SkinnedPositions, vec3 * SkinnedNormals, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			dualquat const q = blendDualQuat(Palette, Joints[i], Weights[i]);
+			SkinnedPositions[i] = q * Positions[i];
+			if(Normals)
+				SkinnedNormals[i] = q.real * Normals[i];
+		}
+	}
+
+#	if GLM_DISPATCH_X86
+	GLM_FUNC_QUALIFIER __m128 skin_load3(vec3 const & v)
+	{
+		return _mm_setr_ps(v.x, v.y, v.z, 0.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void skin_store3(vec3 & Dst, __m128 v)
+	{
+		_mm_storel_pi(reinterpret_cast<__m64 *>(&Dst.x), v);
+		_mm_store_ss(&Dst.z, _mm_movehl_ps(v, v));
+	}
+
+	// Negates the weight w when the real part r is in the opposite hemisphere of r0
+	GLM_FUNC_QUALIFIER __m128 skin_hemisphere_sse2(__m128 r0, __m128 r, __m128 w)
+	{
+		__m128 const Negative = _mm_cmplt_ps(sse_dot_ps(r0, r), _mm_setzero_ps());
+		return _mm_xor_ps(w, _mm_and_ps(Negative, _mm_set1_ps(-0.0f)));
+	}
+
+	GLM_FUNC_QUALIFIER void skin_linear_sse2(
+		mat4 const * Palette, u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals, vec3 * SkinnedPositions, vec3 * SkinnedNormals, std::size_t Count)
+	{
+		__m128 const MaskXYZ = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			__m128 const w = _mm_loadu_ps(&Weights[i].x);
+			__m128 const w0 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 0, 0, 0));
+			__m128 const w1 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 1, 1, 1));
+			__m128 const w2 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 2, 2));
+			__m128 const w3 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 3, 3));
+
+			mat4 const & m0 = Palette[Joints[i].x];
+			mat4 const & m1 = Palette[Joints[i].y];
+			mat4 const & m2 = Palette[Joints[i].z];
+			mat4 const & m3 = Palette[Joints[i].w];
+
+			__m128 c[4];
+			for(length_t k = 0; k < 4; ++k)
+			{
+				c[k] = _mm_mul_ps(_mm_loadu_ps(&m0[k][0]), w0);
+				c[k] = sse_fma_ps(_mm_loadu_ps(&m1[k][0]), w1, c[k]);
+				c[k] = sse_fma_ps(_mm_loadu_ps(&m2[k][0]), w2, c[k]);
+				c[k] = sse_fma_ps(_mm_loadu_ps(&m3[k][0]), w3, c[k]);
+			}
+
+			vec3 const & p = Positions[i];
+			__m128 const Position = sse_fma_ps(c[0], _mm_set1_ps(p.x), sse_fma_ps(c[1], _mm_set1_ps(p.y), sse_fma_ps(c[2], _mm_set1_ps(p.z), c[3])));
+			skin_store3(SkinnedPositions[i], Position);
+
+			if(Normals)
+			{
+				vec3 const & n = Normals[i];
+				__m128 const Normal = _mm_and_ps(sse_fma_ps(c[0], _mm_set1_ps(n.x), sse_fma_ps(c[1], _mm_set1_ps(n.y), _mm_mul_ps(c[2], _mm_set1_ps(n.z)))), MaskXYZ);
+				skin_store3(SkinnedNormals[i], _mm_div_ps(Normal, _mm_sqrt_ps(sse_dot_ps(Normal, Normal))));
+			}
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void skin_dual_quat_sse2(
+		dualquat const * Palette, u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals, vec3 * SkinnedPositions, vec3 * SkinnedNormals, std::size_t Count)
+	{
+		__m128 const Two = _mm_set1_ps(2.0f);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			dualquat const & q0 = Palette[Joints[i].x];
+			dualquat const & q1 = Palette[Joints[i].y];
+			dualquat const & q2 = Palette[Joints[i].z];
+			dualquat const & q3 = Palette[Joints[i].w];
+
+			__m128 const r0 = _mm_loadu_ps(&q0.real.x);
+			__m128 const r1 = _mm_loadu_ps(&q1.real.x);
+			__m128 const r2 = _mm_loadu_ps(&q2.real.x);
+			__m128 const r3 = _mm_loadu_ps(&q3.real.x);
+
+			__m128 const w = _mm_loadu_ps(&Weights[i].x);
+			__m128 const w0 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 0, 0, 0));
+			__m128 const w1 = skin_hemisphere_sse2(r0, r1, _mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 1, 1, 1)));
+			__m128 const w2 = skin_hemisphere_sse2(r0, r2, _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 2, 2)));
+			__m128 const w3 = skin_hemisphere_sse2(r0, r3, _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 3, 3)));
+
+			__m128 r = _mm_mul_ps(r0, w0);
+			r = sse_fma_ps(r1, w1, r);
+			r = sse_fma_ps(r2, w2, r);
+			r = sse_fma_ps(r3, w3, r);
+
+			__m128 d = _mm_mul_ps(_mm_loadu_ps(&q0.dual.x), w0);
+			d = sse_fma_ps(_mm_loadu_ps(&q1.dual.x), w1, d);
+			d = sse_fma_ps(_mm_loadu_ps(&q2.dual.x), w2, d);
+			d = sse_fma_ps(_mm_loadu_ps(&q3.dual.x), w3, d);
+
+			__m128 const Length = _mm_sqrt_ps(sse_dot_ps(r, r));
+			r = _mm_div_ps(r, Length);
+			d = _mm_div_ps(d, Length);
+			__m128 const rw = _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3));
+			__m128 const dw = _mm_shuffle_ps(d, d, _MM_SHUFFLE(3, 3, 3, 3));
+
+			// (cross(r, cross(r, p) + p * r.w + d) + d * r.w - r * d.w) * 2 + p, the w component is ignored
+			__m128 const p = skin_load3(Positions[i]);
+			__m128 const t = _mm_add_ps(sse_fma_ps(p, rw, sse_xpd_ps(r, p)), d);
+			__m128 const Position = sse_fma_ps(_mm_sub_ps(sse_fma_ps(d, rw, sse_xpd_ps(r, t)), _mm_mul_ps(r, dw)), Two, p);
+			skin_store3(SkinnedPositions[i], Position);
+
+			if(Normals)
+			{
+				// n + (cross(r, n) * r.w + cross(r, cross(r, n))) * 2
+				__m128 const n = skin_load3(Normals[i]);
+				__m128 const uv = sse_xpd_ps(r, n);
+				__m128 const Normal = sse_fma_ps(sse_fma_ps(uv, rw, sse_xpd_ps(r, uv)), Two, n);
+				skin_store3(SkinnedNormals[i], Normal);
+			}
+		}
+	}
+
+	GLM_TARGET_AVX inline __m256 skin_set2_ps(float a, float b)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a)), _mm_set1_ps(b), 1);
+	}
+
+	GLM_TARGET_AVX inline __m256 skin_load2_ps(vec3 const & a, vec3 const & b)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(skin_load3(a)), skin_load3(b), 1);
+	}
+
+	GLM_TARGET_AVX inline void skin_store2_ps(vec3 & a, vec3 & b, __m256 v)
+	{
+		skin_store3(a, _mm256_castps256_ps128(v));
+		skin_store3(b, _mm256_extractf128_ps(v, 1));
+	}
+
+	// Cross product of the xyz components within each 128 bits lane
+	GLM_TARGET_AVX2 inline __m256 skin_cross_avx2(__m256 a, __m256 b)
+	{
+		__m256 const a_yzx = _mm256_permute_ps(a, _MM_SHUFFLE(3, 0, 2, 1));
+		__m256 const b_yzx = _mm256_permute_ps(b, _MM_SHUFFLE(3, 0, 2, 1));
+		__m256 const c = _mm256_fmsub_ps(a, b_yzx, _mm256_mul_ps(a_yzx, b));
+		return _mm256_permute_ps(c, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	GLM_TARGET_AVX2 inline __m256 skin_hemisphere_avx2(__m256 r0, __m256 r, __m256 w)
+	{
+		__m256 const Negative = _mm256_cmp_ps(_mm256_dp_ps(r0, r, 0xFF), _mm256_setzero_ps(), _CMP_LT_OQ);
+		return _mm256_xor_ps(w, _mm256_and_ps(Negative, _mm256_set1_ps(-0.0f)));
+	}
+
+	// Two vertices per iteration, one in each 128 bits lane
+	GLM_TARGET_AVX2 inline void skin_linear_avx2(
+		mat4 const * Palette, u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals, vec3 * SkinnedPositions, vec3 * SkinnedNormals, std::size_t Count)
+	{
+		std::size_t const Pairs = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Pairs; i += 2)
+		{
+			__m256 const w = _mm256_loadu_ps(&Weights[i].x);
+			__m256 const w0 = _mm256_permute_ps(w, _MM_SHUFFLE(0, 0, 0, 0));
+			__m256 const w1 = _mm256_permute_ps(w, _MM_SHUFFLE(1, 1, 1, 1));
+			__m256 const w2 = _mm256_permute_ps(w, _MM_SHUFFLE(2, 2, 2, 2));
+			__m256 const w3 = _mm256_permute_ps(w, _MM_SHUFFLE(3, 3, 3, 3));
+
+			u16vec4 const & ja = Joints[i + 0];
+			u16vec4 const & jb = Joints[i + 1];
+
+			__m256 c[4];
+			for(length_t k = 0; k < 4; ++k)
+			{
+				c[k] = _mm256_mul_ps(avx_load2_ps(&Palette[ja.x][k][0], &Palette[jb.x][k][0]), w0);
+				c[k] = _mm256_fmadd_ps(avx_load2_ps(&Palette[ja.y][k][0], &Palette[jb.y][k][0]), w1, c[k]);
+				c[k] = _mm256_fmadd_ps(avx_load2_ps(&Palette[ja.z][k][0], &Palette[jb.z][k][0]), w2, c[k]);
+				c[k] = _mm256_fmadd_ps(avx_load2_ps(&Palette[ja.w][k][0], &Palette[jb.w][k][0]), w3, c[k]);
+			}
+
+			vec3 const & pa = Positions[i + 0];
+			vec3 const & pb = Positions[i + 1];
+			__m256 Position = _mm256_fmadd_ps(c[2], skin_set2_ps(pa.z, pb.z), c[3]);
+			Position = _mm256_fmadd_ps(c[1], skin_set2_ps(pa.y, pb.y), Position);
+			Position = _mm256_fmadd_ps(c[0], skin_set2_ps(pa.x, pb.x), Position);
+			skin_store2_ps(SkinnedPositions[i + 0], SkinnedPositions[i + 1], Position);
+
+			if(Normals)
+			{
+				vec3 const & na = Normals[i + 0];
+				vec3 const & nb = Normals[i + 1];
+				__m256 Normal = _mm256_mul_ps(c[2], skin_set2_ps(na.z, nb.z));
+				Normal = _mm256_fmadd_ps(c[1], skin_set2_ps(na.y, nb.y), Normal);
+				Normal = _mm256_fmadd_ps(c[0], skin_set2_ps(na.x, nb.x), Normal);
+				Normal = _mm256_div_ps(Normal, _mm256_sqrt_ps(_mm256_dp_ps(Normal, Normal, 0x7F)));
+				skin_store2_ps(SkinnedNormals[i + 0], SkinnedNormals[i + 1], Normal);
+			}
+		}
+		skin_linear_sse2(Palette, Joints + Pairs, Weights + Pairs, Positions + Pairs, Normals ? Normals + Pairs : 0, SkinnedPositions + Pairs, Normals ? SkinnedNormals + Pairs : 0, Count - Pairs);
+	}
+
+	GLM_TARGET_AVX2 inline void skin_dual_quat_avx2(
+		dualquat const * Palette, u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals, vec3 * SkinnedPositions, vec3 * SkinnedNormals, std::size_t Count)
+	{
+		__m256 const Two = _mm256_set1_ps(2.0f);
+
+		std::size_t const Pairs = Count & ~static_cast<std::size_t>(1);
+		for(std::size_t i = 0; i < Pairs; i += 2)
+		{
+			u16vec4 const & ja = Joints[i + 0];
+			u16vec4 const & jb = Joints[i + 1];
+
+			__m256 const r0 = avx_load2_ps(&Palette[ja.x].real.x, &Palette[jb.x].real.x);
+			__m256 const r1 = avx_load2_ps(&Palette[ja.y].real.x, &Palette[jb.y].real.x);
+			__m256 const r2 = avx_load2_ps(&Palette[ja.z].real.x, &Palette[jb.z].real.x);
+			__m256 const r3 = avx_load2_ps(&Palette[ja.w].real.x, &Palette[jb.w].real.x);
+
+			__m256 const w = _mm256_loadu_ps(&Weights[i].x);
+			__m256 const w0 = _mm256_permute_ps(w, _MM_SHUFFLE(0, 0, 0, 0));
+			__m256 const w1 = skin_hemisphere_avx2(r0, r1, _mm256_permute_ps(w, _MM_SHUFFLE(1, 1, 1, 1)));
+			__m256 const w2 = skin_hemisphere_avx2(r0, r2, _mm256_permute_ps(w, _MM_SHUFFLE(2, 2, 2, 2)));
+			__m256 const w3 = skin_hemisphere_avx2(r0, r3, _mm256_permute_ps(w, _MM_SHUFFLE(3, 3, 3, 3)));
+
+			__m256 r = _mm256_mul_ps(r0, w0);
+			r = _mm256_fmadd_ps(r1, w1, r);
+			r = _mm256_fmadd_ps(r2, w2, r);
+			r = _mm256_fmadd_ps(r3, w3, r);
+
+			__m256 d = _mm256_mul_ps(avx_load2_ps(&Palette[ja.x].dual.x, &Palette[jb.x].dual.x), w0);
+			d = _mm256_fmadd_ps(avx_load2_ps(&Palette[ja.y].dual.x, &Palette[jb.y].dual.x), w1, d);
+			d = _mm256_fmadd_ps(avx_load2_ps(&Palette[ja.z].dual.x, &Palette[jb.z].dual.x), w2, d);
+			d = _mm256_fmadd_ps(avx_load2_ps(&Palette[ja.w].dual.x, &Palette[jb.w].dual.x), w3, d);
+
+			__m256 const Length = _mm256_sqrt_ps(_mm256_dp_ps(r, r, 0xFF));
+			r = _mm256_div_ps(r, Length);
+			d = _mm256_div_ps(d, Length);
+			__m256 const rw = _mm256_permute_ps(r, _MM_SHUFFLE(3, 3, 3, 3));
+			__m256 const dw = _mm256_permute_ps(d, _MM_SHUFFLE(3, 3, 3, 3));
+
+			__m256 const p = skin_load2_ps(Positions[i + 0], Positions[i + 1]);
+			__m256 const t = _mm256_add_ps(_mm256_fmadd_ps(p, rw, skin_cross_avx2(r, p)), d);
+			__m256 const Position = _mm256_fmadd_ps(_mm256_fnmadd_ps(r, dw, _mm256_fmadd_ps(d, rw, skin_cross_avx2(r, t))), Two, p);
+			skin_store2_ps(SkinnedPositions[i + 0], SkinnedPositions[i + 1], Position);
+
+			if(Normals)
+			{
+				__m256 const n = skin_load2_ps(Normals[i + 0], Normals[i + 1]);
+				__m256 const uv = skin_cross_avx2(r, n);
+				__m256 const Normal = _mm256_fmadd_ps(_mm256_fmadd_ps(uv, rw, skin_cross_avx2(r, uv)), Two, n);
+				skin_store2_ps(SkinnedNormals[i + 0], SkinnedNormals[i + 1], Normal);
+			}
+		}
+		skin_dual_quat_sse2(Palette, Joints + Pairs, Weights + Pairs, Positions + Pairs, Normals ? Normals + Pairs : 0, SkinnedPositions + Pairs, Normals ? SkinnedNormals + Pairs : 0, Count - Pairs);
+	}
+#	endif//GLM_DISPATCH_X86
+
+	GLM_FUNC_QUALIFIER skin_linear_func skin_linear_select()
+	{
+#		if GLM_DISPATCH_X86
+			// CPUs with AVX but without AVX2 use the SSE2 kernels, each vertex gathering its own joints
+			static skin_linear_func const Table[SIMD_LEVEL_COUNT] = {skin_linear_pure, skin_linear_sse2, 0, 0, skin_linear_avx2};
+#		else
+			static skin_linear_func const Table[SIMD_LEVEL_COUNT] = {skin_linear_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER skin_dual_quat_func skin_dual_quat_select()
+	{
+#		if GLM_DISPATCH_X86
+			static skin_dual_quat_func const Table[SIMD_LEVEL_COUNT] = {skin_dual_quat_pure, skin_dual_quat_sse2, 0, 0, skin_dual_quat_avx2};
+#		else
+			static skin_dual_quat_func const Table[SIMD_LEVEL_COUNT] = {skin_dual_quat_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	// Splits the vertices in blocks processed in parallel when OpenMP is enabled
+	template <typename paletteType, typename kernelType>
+	GLM_FUNC_QUALIFIER void skin_batch(
+		kernelType Kernel, paletteType const * Palette, u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals, vec3 * SkinnedPositions, vec3 * SkinnedNormals, std::size_t Count)
+	{
+		std::size_t const BlockSize = 4096;
+		int const Blocks = static_cast<int>((Count + BlockSize - 1) / BlockSize);
+
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for
+#		endif//GLM_HAS_OPENMP
+		for(int Block = 0; Block < Blocks; ++Block)
+		{
+			std::size_t const First = static_cast<std::size_t>(Block) * BlockSize;
+			std::size_t const Size = Count - First < BlockSize ? Count - First : BlockSize;
+			Kernel(Palette, Joints + First, Weights + First, Positions + First,
+				Normals ? Normals + First : 0, SkinnedPositions + First, Normals ? SkinnedNormals + First : 0, Size);
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER mat4 blendLinear(mat4 const * Palette, u16vec4 const & Joints, vec4 const & Weights)
+	{
+		return
+			Palette[Joints.x] * Weights.x +
+			Palette[Joints.y] * Weights.y +
+			Palette[Joints.z] * Weights.z +
+			Palette[Joints.w] * Weights.w;
+	}
+
+	GLM_FUNC_QUALIFIER dualquat blendDualQuat(dualquat const * Palette, u16vec4 const & Joints, vec4 const & Weights)
+	{
+		dualquat const & q0 = Palette[Joints.x];
+		dualquat const & q1 = Palette[Joints.y];
+		dualquat const & q2 = Palette[Joints.z];
+		dualquat const & q3 = Palette[Joints.w];
+
+		float const w1 = dot(q0.real, q1.real) < 0.0f ? -Weights.y : Weights.y;
+		float const w2 = dot(q0.real, q2.real) < 0.0f ? -Weights.z : Weights.z;
+		float const w3 = dot(q0.real, q3.real) < 0.0f ? -Weights.w : Weights.w;
+
+		return normalize(q0 * Weights.x + q1 * w1 + q2 * w2 + q3 * w3);
+	}
+
+	GLM_FUNC_QUALIFIER void skinLinearBatch(
+		mat4 const * Palette,
+		u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals,
+		std::size_t Count)
+	{
+		detail::skin_batch(detail::skin_linear_select(), Palette, Joints, Weights, Positions, Normals, SkinnedPositions, SkinnedNormals, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void skinDualQuatBatch(
+		dualquat const * Palette,
+		u16vec4 const * Joints, vec4 const * Weights,
+		vec3 const * Positions, vec3 const * Normals,
+		vec3 * SkinnedPositions, vec3 * SkinnedNormals,
+		std::size_t Count)
+	{
+		detail::skin_batch(detail::skin_dual_quat_select(), Palette, Joints, Weights, Positions, Normals, SkinnedPositions, SkinnedNormals, Count);
+	}
+}//namespace glm
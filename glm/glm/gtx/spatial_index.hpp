@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_spatial_index
+/// @file glm/gtx/spatial_index.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_bitfield (dependence)
+/// @see gtx_bitfield_batch (dependence)
+/// @see gtx_fast_hash (dependence)
+///
+/// @defgroup gtx_spatial_index GLM_GTX_spatial_index
+/// @ingroup gtx
+///
+/// @brief Uniform hash grid and Morton ordered linear octree over points, for radius and nearest neighbor queries.
+///
+/// The grid stores the points sorted by the bucket of their cell. Blocks of 4 x 4 x 4 cells are
+/// hashed with fastHash of GLM_GTX_fast_hash, each bucket of a block holding 64 buckets of cells,
+/// so that neighboring cells are close in memory. Queries visit the buckets overlapping the query,
+/// nearest neighbor queries with a growing radius. It suits points spread evenly at a known scale,
+/// such as particles whose neighbors are searched within the smoothing radius.
+///
+/// The octree stores the points sorted by the Morton code of their coordinates quantized on 16 bits
+/// in the cube containing them, computed with bitfieldInterleave. Its nodes are the ranges of codes
+/// sharing a prefix, with the bounds of their points, the chains of nodes with a single child being
+/// skipped. It adapts to unevenly spread points.
+///
+/// The keys of the points are computed in parallel when OpenMP is enabled, and so are the batch queries.
+/// Both structures keep a copy of the points, the queries return the indices of the points in the
+/// array the structure was built from. Nearest neighbors are sorted by increasing distance, the
+/// smallest index first for equal distances.
+///
+/// <glm/gtx/spatial_index.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/bitfield.hpp"
+#include "../gtc/type_precision.hpp"
+#include "bitfield_batch.hpp"
+#include "fast_hash.hpp"
+#include <cstddef>
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_spatial_index extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_spatial_index
+	/// @{
+
+	/// Uniform grid of points hashed by cell.
+	struct point_grid
+	{
+		float CellSize;
+		uint32 Mask;	///< Number of buckets of blocks - 1, the number of buckets of blocks being a power of two
+		ivec3 CellMin;	///< Smallest cell containing points
+		ivec3 CellMax;	///< Largest cell containing points
+		std::vector<uint32> Starts;		///< Index in Points of the first point of each bucket of cells, followed by the number of points
+		std::vector<vec3> Points;		///< Points sorted by bucket
+		std::vector<uint32> Indices;	///< Indices of the sorted points in the array the grid was built from
+	};
+
+	/// Node of a point octree, the root being the first node.
+	struct point_octree_node
+	{
+		vec3 Min;		///< Bounds of the points of the node
+		uint32 Begin;	///< Index in point_octree::Points of the first point of the node
+		vec3 Max;
+		uint32 End;		///< Index in point_octree::Points following the last point of the node
+		uint32 Children;	///< Index of the first child, the children being consecutive, 0 for leaves
+		uint32 ChildCount;
+	};
+
+	/// Points sorted in Morton order.
+	struct point_octree
+	{
+		std::vector<point_octree_node> Nodes;
+		std::vector<uint64> Codes;		///< Morton codes of the quantized points, in increasing order
+		std::vector<vec3> Points;		///< Points sorted by code
+		std::vector<uint32> Indices;	///< Indices of the sorted points in the array the octree was built from
+	};
+
+	/// Builds the grid of cells of size CellSize of Count points.
+	/// @see gtx_spatial_index
+	GLM_FUNC_DECL void pointGridBuild(vec3 const * Points, std::size_t Count, float CellSize, point_grid & Grid);
+
+	/// Appends to Indices the indices of the points within Radius of Center.
+	/// Returns the number of indices appended.
+	/// @see gtx_spatial_index
+	GLM_FUNC_DECL std::size_t pointGridRadius(point_grid const & Grid, vec3 const & Center, float Radius, std::vector<uint32> & Indices);
+
+	/// Writes to Indices the indices of the K points nearest to Center, sorted by increasing distance.
+	/// Returns the number of indices written, smaller than K when the grid has less than K points.
+	/// @see gtx_spatial_index
+	GLM_FUNC_DECL std::size_t pointGridNearest(point_grid const & Grid, vec3 const & Center, std::size_t K, uint32 * Indices);
+
+	/// pointGridNearest(Grid, Queries[i], K, Indices + i * K) for Count queries, split among threads when OpenMP is enabled.
+	/// K must not exceed the number of points.
+	/// @see gtx_spatial_index
+	GLM_FUNC_DECL void pointGridNearestBatch(point_grid const & Grid, vec3 const * Queries, std::size_t Count, std::size_t K, uint32 * Indices);
+
+	/// Builds the octree of Count points.
+	/// @see gtx_spatial_index
+	GLM_FUNC_DECL void pointOctreeBuild(vec3 const * Points, std::size_t Count, point_octree & Octree);
+
+	/// Appends to Indices the indices of the points within Radius of Center.
+	/// Returns the number of indices appended.
+	/// @see gtx_spatial_index
+	GLM_FUNC_DECL std::size_t pointOctreeRadius(point_octree const & Octree, vec3 const & Center, float Radius, std::vector<uint32> & Indices);
+
+	/// Writes to Indices the indices of the K points nearest to Center, sorted by increasing distance.
+	/// Returns the number of indices written, smaller than K when the octree has less than K points.
+	/// @see gtx_spatial_index
+	GLM_FUNC_DECL std::size_t pointOctreeNearest(point_octree const & Octree, vec3 const & Center, std::size_t K, uint32 * Indices);
+
+	/// pointOctreeNearest(Octree, Queries[i], K, Indices + i * K) for Count queries, split among threads when OpenMP is enabled.
+	/// K must not exceed the number of points.
+	/// @see gtx_spatial_index
+	GLM_FUNC_DECL void pointOctreeNearestBatch(point_octree const & Octree, vec3 const * Queries, std::size_t Count, std::size_t K, uint32 * Indices);
+
+	/// @}
+}//namespace glm
+
+#include "spatial_index.inl"
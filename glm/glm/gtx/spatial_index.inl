@@ -0,0 +1,557 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_spatial_index
+/// @file glm/gtx/spatial_index.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace glm{
+namespace detail
+{
+	enum
+	{
+		SPATIAL_CHUNK_SIZE = 4096,	// Points per parallel task of the builds
+		SPATIAL_OCTREE_LEAF_SIZE = 16,
+		SPATIAL_OCTREE_BITS = 16
+	};
+
+	typedef std::pair<float, uint32> spatial_neighbor;
+
+	// Max heap of the K nearest points found so far, ordered by distance then index
+	struct spatial_nearest
+	{
+		spatial_neighbor * Heap;
+		std::size_t Size;
+		std::size_t K;
+
+		float bound() const
+		{
+			return Size < K ? std::numeric_limits<float>::infinity() : Heap[0].first;
+		}
+
+		void push(float Distance2, uint32 Index)
+		{
+			spatial_neighbor const Neighbor(Distance2, Index);
+			if(Size < K)
+			{
+				Heap[Size++] = Neighbor;
+				std::push_heap(Heap, Heap + Size);
+			}
+			else if(Neighbor < Heap[0])
+			{
+				std::pop_heap(Heap, Heap + Size);
+				Heap[Size - 1] = Neighbor;
+				std::push_heap(Heap, Heap + Size);
+			}
+		}
+
+		std::size_t write(uint32 * Indices)
+		{
+			std::sort_heap(Heap, Heap + Size);
+			for(std::size_t i = 0; i < Size; ++i)
+				Indices[i] = Heap[i].second;
+			return Size;
+		}
+	};
+
+	GLM_FUNC_QUALIFIER float spatial_distance2(vec3 const & a, vec3 const & b)
+	{
+		vec3 const d = a - b;
+		return dot(d, d);
+	}
+
+	GLM_FUNC_QUALIFIER void spatial_bounds(vec3 const * Points, std::size_t Count, vec3 & Min, vec3 & Max)
+	{
+		Min = Max = Points[0];
+		for(std::size_t i = 1; i < Count; ++i)
+		{
+			Min = min(Min, Points[i]);
+			Max = max(Max, Points[i]);
+		}
+	}
+
+	// Copies the points in the order of the sorted keys
+	GLM_FUNC_QUALIFIER void spatial_gather(vec3 const * Points, std::vector<uint32> const & Indices, std::vector<vec3> & Sorted)
+	{
+		Sorted.resize(Indices.size());
+
+		int const Count = static_cast<int>(Indices.size());
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for
+#		endif//GLM_HAS_OPENMP
+		for(int i = 0; i < Count; ++i)
+			Sorted[i] = Points[Indices[i]];
+	}
+
+	//////////////////////////////////////
+	// Grid
+
+	// Block of 4 x 4 x 4 cells containing a cell, rounded toward minus infinity
+	GLM_FUNC_QUALIFIER ivec3 grid_block(ivec3 const & Cell)
+	{
+		return (Cell - (Cell & 3)) / 4;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 grid_block_bucket(point_grid const & Grid, ivec3 const & Block)
+	{
+		return static_cast<uint32>(fastHash(Block)) & Grid.Mask;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 grid_bucket(point_grid const & Grid, ivec3 const & Cell)
+	{
+		ivec3 const Local = Cell & 3;
+		return grid_block_bucket(Grid, grid_block(Cell)) * 64 + static_cast<uint32>(Local.z * 16 + Local.y * 4 + Local.x);
+	}
+
+	// Calls Visit(Begin, End) on ranges of Grid.Points holding the points of the cells from CellLo to CellHi, each point once.
+	// The ranges may hold other points too.
+	template <typename visitorType>
+	GLM_FUNC_QUALIFIER void grid_visit(point_grid const & Grid, ivec3 const & CellLo, ivec3 const & CellHi, visitorType & Visit)
+	{
+		ivec3 const Lo = max(CellLo, Grid.CellMin);
+		ivec3 const Hi = min(CellHi, Grid.CellMax);
+		if(any(lessThan(Hi, Lo)))
+			return;
+
+		ivec3 const BlockLo = grid_block(Lo);
+		ivec3 const Blocks = grid_block(Hi) - BlockLo + 1;
+		double const BlockCount = static_cast<double>(Blocks.x) * static_cast<double>(Blocks.y) * static_cast<double>(Blocks.z);
+		if(BlockCount > static_cast<double>(Grid.Mask + 1))
+		{
+			Visit(0, static_cast<uint32>(Grid.Points.size()));
+			return;
+		}
+
+		// The buckets of the blocks, sorted to find the buckets shared by several blocks
+		std::size_t const Count = static_cast<std::size_t>(BlockCount);
+		std::pair<uint32, uint32> Small[64];
+		std::vector<std::pair<uint32, uint32> > Large(Count > 64 ? Count : 0);
+		std::pair<uint32, uint32> * Buckets = Count > 64 ? &Large[0] : Small;
+
+		uint32 Block = 0;
+		for(int z = 0; z < Blocks.z; ++z)
+		for(int y = 0; y < Blocks.y; ++y)
+		for(int x = 0; x < Blocks.x; ++x, ++Block)
+			Buckets[Block] = std::make_pair(grid_block_bucket(Grid, BlockLo + ivec3(x, y, z)), Block);
+		std::sort(Buckets, Buckets + Count);
+
+		uint32 const * Starts = &Grid.Starts[0];
+		for(std::size_t i = 0, j = 1; i < Count; i = j++)
+		{
+			while(j < Count && Buckets[j].first == Buckets[i].first)
+				++j;
+
+			uint32 const Base = Buckets[i].first * 64;
+			if(j - i > 1)
+			{
+				Visit(Starts[Base], Starts[Base + 64]);
+				continue;
+			}
+
+			// The rows of cells of the block within the range, the cells of a row being consecutive
+			uint32 const Linear = Buckets[i].second;
+			ivec3 const Corner = (BlockLo + ivec3(Linear % Blocks.x, Linear / Blocks.x % Blocks.y, Linear / (Blocks.x * Blocks.y))) * 4;
+			ivec3 const LocalLo = max(Lo - Corner, 0);
+			ivec3 const LocalHi = min(Hi - Corner, 3);
+			for(int z = LocalLo.z; z <= LocalHi.z; ++z)
+			for(int y = LocalLo.y; y <= LocalHi.y; ++y)
+			{
+				uint32 const Row = Base + static_cast<uint32>(z * 16 + y * 4);
+				Visit(Starts[Row + LocalLo.x], Starts[Row + LocalHi.x + 1]);
+			}
+		}
+	}
+
+	struct grid_radius_visitor
+	{
+		point_grid const * Grid;
+		vec3 Center;
+		float Radius2;
+		std::vector<uint32> * Indices;
+
+		void operator()(uint32 Begin, uint32 End)
+		{
+			for(uint32 i = Begin; i < End; ++i)
+				if(spatial_distance2(Grid->Points[i], Center) <= Radius2)
+					Indices->push_back(Grid->Indices[i]);
+		}
+	};
+
+	struct grid_nearest_visitor
+	{
+		point_grid const * Grid;
+		vec3 Center;
+		spatial_nearest * Nearest;
+
+		void operator()(uint32 Begin, uint32 End)
+		{
+			for(uint32 i = Begin; i < End; ++i)
+			{
+				float const Distance2 = spatial_distance2(Grid->Points[i], Center);
+				if(Distance2 <= Nearest->bound())
+					Nearest->push(Distance2, Grid->Indices[i]);
+			}
+		}
+	};
+
+	// Searches the cells within a radius doubled until the K nearest points found are within the radius
+	GLM_FUNC_QUALIFIER void spatial_find_nearest(point_grid const & Grid, vec3 const & Center, spatial_nearest & Nearest)
+	{
+		if(Grid.Points.empty() || Nearest.K == 0)
+			return;
+
+		grid_nearest_visitor Visit = {&Grid, Center, &Nearest};
+		for(float Radius = Grid.CellSize;; Radius *= 2.0f)
+		{
+			Nearest.Size = 0;
+
+			ivec3 const Lo = quantizeCell(Center - Radius, Grid.CellSize);
+			ivec3 const Hi = quantizeCell(Center + Radius, Grid.CellSize);
+			grid_visit(Grid, Lo, Hi, Visit);
+
+			if(Nearest.Size == Nearest.K && Nearest.bound() <= Radius * Radius)
+				return;
+			if(all(lessThanEqual(Lo, Grid.CellMin)) && all(greaterThanEqual(Hi, Grid.CellMax)))
+				return;
+		}
+	}
+
+	//////////////////////////////////////
+	// Octree
+
+	GLM_FUNC_QUALIFIER float octree_box_distance2(point_octree_node const & Node, vec3 const & Center)
+	{
+		vec3 const d = max(max(Node.Min - Center, Center - Node.Max), vec3(0.0f));
+		return dot(d, d);
+	}
+
+	// Splits the codes of a node among its 8 children, Bounds[c] to Bounds[c + 1] being the codes of the child c
+	GLM_FUNC_QUALIFIER void octree_children(point_octree const & Octree, uint32 Begin, uint32 End, uint64 Code, int Shift, uint32 * Bounds)
+	{
+		uint64 const * Codes = &Octree.Codes[0];
+		int const ChildShift = 3 * (Shift - 1);
+
+		Bounds[0] = Begin;
+		for(uint64 Child = 1; Child < 8; ++Child)
+			Bounds[Child] = static_cast<uint32>(std::lower_bound(Codes + Bounds[Child - 1], Codes + End, Code | (Child << ChildShift)) - Codes);
+		Bounds[8] = End;
+	}
+
+	// Builds the subtree of the node of the codes from Begin to End sharing the bits of Code above 3 * Shift
+	GLM_FUNC_QUALIFIER void octree_build(point_octree & Octree, uint32 Node, uint32 Begin, uint32 End, uint64 Code, int Shift)
+	{
+		uint32 Bounds[9];
+		uint32 ChildCount = 0;
+
+		// Skips the levels where all the points are in the same child
+		while(End - Begin > SPATIAL_OCTREE_LEAF_SIZE && Shift > 0)
+		{
+			octree_children(Octree, Begin, End, Code, Shift, Bounds);
+
+			uint32 Single = 0;
+			ChildCount = 0;
+			for(uint32 Child = 0; Child < 8; ++Child)
+				if(Bounds[Child] < Bounds[Child + 1])
+				{
+					Single = Child;
+					++ChildCount;
+				}
+			if(ChildCount > 1)
+				break;
+
+			Code |= static_cast<uint64>(Single) << (3 * (Shift - 1));
+			--Shift;
+		}
+
+		Octree.Nodes[Node].Begin = Begin;
+		Octree.Nodes[Node].End = End;
+
+		if(ChildCount <= 1)
+		{
+			vec3 Min, Max;
+			spatial_bounds(&Octree.Points[Begin], End - Begin, Min, Max);
+			Octree.Nodes[Node].Min = Min;
+			Octree.Nodes[Node].Max = Max;
+			Octree.Nodes[Node].Children = 0;
+			Octree.Nodes[Node].ChildCount = 0;
+			return;
+		}
+
+		uint32 const First = static_cast<uint32>(Octree.Nodes.size());
+		Octree.Nodes.resize(First + ChildCount);
+		Octree.Nodes[Node].Children = First;
+		Octree.Nodes[Node].ChildCount = ChildCount;
+
+		for(uint32 Child = 0, Slot = First; Child < 8; ++Child)
+			if(Bounds[Child] < Bounds[Child + 1])
+				octree_build(Octree, Slot++, Bounds[Child], Bounds[Child + 1], Code | (static_cast<uint64>(Child) << (3 * (Shift - 1))), Shift - 1);
+
+		vec3 Min = Octree.Nodes[First].Min;
+		vec3 Max = Octree.Nodes[First].Max;
+		for(uint32 i = First + 1; i < First + ChildCount; ++i)
+		{
+			Min = min(Min, Octree.Nodes[i].Min);
+			Max = max(Max, Octree.Nodes[i].Max);
+		}
+		Octree.Nodes[Node].Min = Min;
+		Octree.Nodes[Node].Max = Max;
+	}
+
+	GLM_FUNC_QUALIFIER void octree_radius(point_octree const & Octree, uint32 NodeIndex, vec3 const & Center, float Radius2, std::vector<uint32> & Indices)
+	{
+		point_octree_node const & Node = Octree.Nodes[NodeIndex];
+		if(octree_box_distance2(Node, Center) > Radius2)
+			return;
+
+		// All the points of the node are in the sphere
+		vec3 const Far = max(Center - Node.Min, Node.Max - Center);
+		if(dot(Far, Far) <= Radius2)
+		{
+			Indices.insert(Indices.end(), Octree.Indices.begin() + Node.Begin, Octree.Indices.begin() + Node.End);
+			return;
+		}
+
+		if(Node.Children == 0)
+		{
+			for(uint32 i = Node.Begin; i < Node.End; ++i)
+				if(spatial_distance2(Octree.Points[i], Center) <= Radius2)
+					Indices.push_back(Octree.Indices[i]);
+			return;
+		}
+
+		for(uint32 i = Node.Children; i < Node.Children + Node.ChildCount; ++i)
+			octree_radius(Octree, i, Center, Radius2, Indices);
+	}
+
+	// Depth first, the closest children first, skipping the nodes further than the K nearest points found so far
+	GLM_FUNC_QUALIFIER void octree_nearest(point_octree const & Octree, uint32 NodeIndex, vec3 const & Center, spatial_nearest & Nearest)
+	{
+		point_octree_node const & Node = Octree.Nodes[NodeIndex];
+		if(Node.Children == 0)
+		{
+			for(uint32 i = Node.Begin; i < Node.End; ++i)
+			{
+				float const Distance2 = spatial_distance2(Octree.Points[i], Center);
+				if(Distance2 <= Nearest.bound())
+					Nearest.push(Distance2, Octree.Indices[i]);
+			}
+			return;
+		}
+
+		// Insertion sort of the children by distance
+		std::pair<float, uint32> Children[8];
+		for(uint32 Child = 0; Child < Node.ChildCount; ++Child)
+		{
+			std::pair<float, uint32> const Entry(octree_box_distance2(Octree.Nodes[Node.Children + Child], Center), Node.Children + Child);
+
+			uint32 i = Child;
+			for(; i > 0 && Entry < Children[i - 1]; --i)
+				Children[i] = Children[i - 1];
+			Children[i] = Entry;
+		}
+
+		for(uint32 i = 0; i < Node.ChildCount; ++i)
+		{
+			if(Children[i].first > Nearest.bound())
+				break;
+			octree_nearest(Octree, Children[i].second, Center, Nearest);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void spatial_find_nearest(point_octree const & Octree, vec3 const & Center, spatial_nearest & Nearest)
+	{
+		if(Octree.Points.empty() || Nearest.K == 0)
+			return;
+
+		octree_nearest(Octree, 0, Center, Nearest);
+	}
+
+	template <typename indexType>
+	GLM_FUNC_QUALIFIER void spatial_nearest_batch(indexType const & Index, vec3 const * Queries, std::size_t Count, std::size_t K, uint32 * Indices)
+	{
+		int const QueryCount = static_cast<int>(Count);
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel
+#		endif//GLM_HAS_OPENMP
+		{
+			std::vector<spatial_neighbor> Heap(K > 0 ? K : 1);
+#			if GLM_HAS_OPENMP
+#				pragma omp for schedule(dynamic, 64)
+#			endif//GLM_HAS_OPENMP
+			for(int i = 0; i < QueryCount; ++i)
+			{
+				spatial_nearest Nearest = {&Heap[0], 0, K};
+				spatial_find_nearest(Index, Queries[i], Nearest);
+				Nearest.write(Indices + static_cast<std::size_t>(i) * K);
+			}
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void pointGridBuild(vec3 const * Points, std::size_t Count, float CellSize, point_grid & Grid)
+	{
+		// About a bucket of cells per point
+		uint32 BlockBucketCount = 1;
+		while(BlockBucketCount * 64 < Count)
+			BlockBucketCount <<= 1;
+
+		Grid.CellSize = CellSize;
+		Grid.Mask = BlockBucketCount - 1;
+		Grid.Starts.assign(BlockBucketCount * 64 + 1, 0);
+		Grid.Indices.resize(Count);
+
+		if(Count == 0)
+		{
+			// No cell is visited by the queries
+			Grid.CellMin = ivec3(1);
+			Grid.CellMax = ivec3(0);
+			Grid.Points.clear();
+			return;
+		}
+
+		vec3 Min, Max;
+		detail::spatial_bounds(Points, Count, Min, Max);
+		Grid.CellMin = quantizeCell(Min, CellSize);
+		Grid.CellMax = quantizeCell(Max, CellSize);
+
+		std::vector<uint64> Buckets(Count);
+		int const PointCount = static_cast<int>(Count);
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for
+#		endif//GLM_HAS_OPENMP
+		for(int i = 0; i < PointCount; ++i)
+		{
+			Buckets[i] = detail::grid_bucket(Grid, quantizeCell(Points[i], CellSize));
+			Grid.Indices[i] = static_cast<uint32>(i);
+		}
+
+		sortInterleaved(&Buckets[0], &Grid.Indices[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			++Grid.Starts[static_cast<std::size_t>(Buckets[i]) + 1];
+		for(std::size_t i = 1; i < Grid.Starts.size(); ++i)
+			Grid.Starts[i] += Grid.Starts[i - 1];
+
+		detail::spatial_gather(Points, Grid.Indices, Grid.Points);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t pointGridRadius(point_grid const & Grid, vec3 const & Center, float Radius, std::vector<uint32> & Indices)
+	{
+		if(Grid.Points.empty())
+			return 0;
+
+		std::size_t const First = Indices.size();
+		detail::grid_radius_visitor Visit = {&Grid, Center, Radius * Radius, &Indices};
+		detail::grid_visit(Grid, quantizeCell(Center - Radius, Grid.CellSize), quantizeCell(Center + Radius, Grid.CellSize), Visit);
+		return Indices.size() - First;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t pointGridNearest(point_grid const & Grid, vec3 const & Center, std::size_t K, uint32 * Indices)
+	{
+		std::vector<detail::spatial_neighbor> Heap(K > 0 ? K : 1);
+		detail::spatial_nearest Nearest = {&Heap[0], 0, K};
+		detail::spatial_find_nearest(Grid, Center, Nearest);
+		return Nearest.write(Indices);
+	}
+
+	GLM_FUNC_QUALIFIER void pointGridNearestBatch(point_grid const & Grid, vec3 const * Queries, std::size_t Count, std::size_t K, uint32 * Indices)
+	{
+		detail::spatial_nearest_batch(Grid, Queries, Count, K, Indices);
+	}
+
+	GLM_FUNC_QUALIFIER void pointOctreeBuild(vec3 const * Points, std::size_t Count, point_octree & Octree)
+	{
+		Octree.Nodes.clear();
+		Octree.Codes.resize(Count);
+		Octree.Indices.resize(Count);
+
+		if(Count == 0)
+		{
+			Octree.Points.clear();
+			return;
+		}
+
+		vec3 Min, Max;
+		detail::spatial_bounds(Points, Count, Min, Max);
+		vec3 const Extent = Max - Min;
+		float const Size = max(max(Extent.x, Extent.y), Extent.z);
+		float const Scale = Size > 0.0f ? 65535.0f / Size : 0.0f;
+
+		int const ChunkCount = static_cast<int>((Count + detail::SPATIAL_CHUNK_SIZE - 1) / detail::SPATIAL_CHUNK_SIZE);
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for
+#		endif//GLM_HAS_OPENMP
+		for(int Chunk = 0; Chunk < ChunkCount; ++Chunk)
+		{
+			std::size_t const Begin = static_cast<std::size_t>(Chunk) * detail::SPATIAL_CHUNK_SIZE;
+			std::size_t const End = std::min<std::size_t>(Begin + detail::SPATIAL_CHUNK_SIZE, Count);
+
+			u16vec3 Quantized[detail::SPATIAL_CHUNK_SIZE];
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				Quantized[i - Begin] = u16vec3(clamp((Points[i] - Min) * Scale, 0.0f, 65535.0f));
+				Octree.Indices[i] = static_cast<uint32>(i);
+			}
+			bitfieldInterleaveBatch(Quantized, &Octree.Codes[Begin], End - Begin);
+		}
+
+		sortInterleaved(&Octree.Codes[0], &Octree.Indices[0], Count);
+		detail::spatial_gather(Points, Octree.Indices, Octree.Points);
+
+		Octree.Nodes.reserve(Count / detail::SPATIAL_OCTREE_LEAF_SIZE * 2 + 1);
+		Octree.Nodes.resize(1);
+		detail::octree_build(Octree, 0, 0, static_cast<uint32>(Count), 0, detail::SPATIAL_OCTREE_BITS);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t pointOctreeRadius(point_octree const & Octree, vec3 const & Center, float Radius, std::vector<uint32> & Indices)
+	{
+		if(Octree.Points.empty())
+			return 0;
+
+		std::size_t const First = Indices.size();
+		detail::octree_radius(Octree, 0, Center, Radius * Radius, Indices);
+		return Indices.size() - First;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t pointOctreeNearest(point_octree const & Octree, vec3 const & Center, std::size_t K, uint32 * Indices)
+	{
+		std::vector<detail::spatial_neighbor> Heap(K > 0 ? K : 1);
+		detail::spatial_nearest Nearest = {&Heap[0], 0, K};
+		detail::spatial_find_nearest(Octree, Center, Nearest);
+		return Nearest.write(Indices);
+	}
+
+	GLM_FUNC_QUALIFIER void pointOctreeNearestBatch(point_octree const & Octree, vec3 const * Queries, std::size_t Count, std::size_t K, uint32 * Indices)
+	{
+		detail::spatial_nearest_batch(Octree, Queries, Count, K, Indices);
+	}
+}//namespace glm
@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_spline_curve
+/// @file glm/gtx/spline_curve.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtx_simd_dispatch (dependence)
+/// @see gtx_spline (dependence)
+///
+/// @defgroup gtx_spline_curve GLM_GTX_spline_curve
+/// @ingroup gtx
+///
+/// @brief Piecewise cubic curves with batch evaluation, arc length parameterization and adaptive tessellation.
+///
+/// A spline_curve stores the polynomial coefficients of each segment of a Catmull-Rom
+/// or Hermite spline, so that evaluating a point only costs a Horner scheme. The curve
+/// parameter t goes from 0 to the number of segments, segment i covering [i, i + 1].
+///
+/// An arc length table maps distances along the curve to parameters in logarithmic
+/// time, refined by a Newton step, for constant speed motion. Batches of parameters
+/// are evaluated with the kernels selected by GLM_GTX_simd_dispatch.
+///
+/// <glm/gtx/spline_curve.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "spline.hpp"
+#include "simd_dispatch.hpp"
+#include <cstddef>
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_spline_curve extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_spline_curve
+	/// @{
+
+	/// Piecewise cubic curve.
+	struct spline_curve
+	{
+		std::vector<vec3> Coefficients;	///< 4 per segment, the arguments of cubic: ((A * s + B) * s + C) * s + D
+		std::vector<float> Parameters;	///< Parameters of the samples of the arc length table
+		std::vector<float> Lengths;		///< Arc lengths from the start of the curve to the samples
+	};
+
+	/// Builds the Catmull-Rom spline of PointCount control points, made of PointCount - 3 segments
+	/// going from Points[1] to Points[PointCount - 2]. Segment i evaluates as catmullRom(Points[i], Points[i + 1], Points[i + 2], Points[i + 3], s).
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL void splineCatmullRom(vec3 const * Points, std::size_t PointCount, spline_curve & Curve);
+
+	/// Builds the Hermite spline of PointCount points and tangents, made of PointCount - 1 segments.
+	/// Segment i evaluates as hermite(Points[i], Tangents[i], Points[i + 1], Tangents[i + 1], s).
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL void splineHermite(vec3 const * Points, vec3 const * Tangents, std::size_t PointCount, spline_curve & Curve);
+
+	/// Returns the number of segments of the curve.
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL std::size_t splineSegmentCount(spline_curve const & Curve);
+
+	/// Returns the point of the curve at parameter t, clamped to [0, splineSegmentCount(Curve)].
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL vec3 splineEvaluate(spline_curve const & Curve, float t);
+
+	/// Returns the derivative of the curve with respect to t, clamped to [0, splineSegmentCount(Curve)].
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL vec3 splineDerivative(spline_curve const & Curve, float t);
+
+	/// Positions[i] = splineEvaluate(Curve, Parameters[i]) for Count parameters.
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL void splineEvaluateBatch(spline_curve const & Curve, float const * Parameters, vec3 * Positions, std::size_t Count);
+
+	/// Builds the arc length table of the curve with SamplesPerSegment samples per segment,
+	/// the length between two samples being integrated with a 5 points Gauss-Legendre quadrature.
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL void splineBuildArcLength(spline_curve & Curve, std::size_t SamplesPerSegment = 16);
+
+	/// Returns the length of the curve, requires splineBuildArcLength.
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL float splineLength(spline_curve const & Curve);
+
+	/// Returns the parameter of the point at distance Length from the start of the curve,
+	/// found by a binary search in the arc length table refined by a Newton step. Requires splineBuildArcLength.
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL float splineParameterAtLength(spline_curve const & Curve, float Length);
+
+	/// Parameters[i] = splineParameterAtLength(Curve, Lengths[i]) for Count lengths.
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL void splineParameterAtLengthBatch(spline_curve const & Curve, float const * Lengths, float * Parameters, std::size_t Count);
+
+	/// Appends to Parameters the parameters of a polyline approximating the curve on screen, from 0 to splineSegmentCount(Curve).
+	/// Segments are split until the projections of the curve stay within Tolerance pixels of the projections of the polyline,
+	/// parts of the curve behind the viewer are not refined. Returns the number of parameters appended.
+	/// @see gtx_spline_curve
+	GLM_FUNC_DECL std::size_t splineTessellate(
+		spline_curve const & Curve,
+		mat4 const & ViewProjection, vec2 const & ViewportSize, float Tolerance,
+		std::vector<float> & Parameters);
+
+	/// @}
+}//namespace glm
+
+#include "spline_curve.inl"
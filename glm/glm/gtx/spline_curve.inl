@@ -0,0 +1,365 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @ref gtx_spline_curve
+/// @file glm/gtx/spline_curve.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	typedef void (*spline_evaluate_func)(vec3 const *, std::size_t, float const *, vec3 *, std::size_t);
+
+	// Segment of the parameter t, t being replaced by the parameter in the segment
+	GLM_FUNC_QUALIFIER std::size_t spline_segment(std::size_t SegmentCount, float & t)
+	{
+		float const Last = static_cast<float>(SegmentCount);
+		t = clamp(t, 0.0f, Last);
+		std::size_t const Segment = glm::min(static_cast<std::size_t>(t), SegmentCount - 1);
+		t -= static_cast<float>(Segment);
+		return Segment;
+	}
+
+	GLM_FUNC_QUALIFIER vec3 spline_evaluate(vec3 const * Coefficients, std::size_t SegmentCount, float t)
+	{
+		std::size_t const Segment = spline_segment(SegmentCount, t);
+		vec3 const * c = Coefficients + Segment * 4;
+		return cubic(c[0], c[1], c[2], c[3], t);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 spline_derivative(vec3 const * Coefficients, std::size_t SegmentCount, float t)
+	{
+		std::size_t const Segment = spline_segment(SegmentCount, t);
+		vec3 const * c = Coefficients + Segment * 4;
+		return (c[0] * (3.0f * t) + c[1] * 2.0f) * t + c[2];
+	}
+
+	// Length of the curve between t0 and t1 in the same segment, 5 points Gauss-Legendre quadrature
+	GLM_FUNC_QUALIFIER float spline_length(vec3 const * Coefficients, std::size_t SegmentCount, float t0, float t1)
+	{
+		static float const Abscissas[] = {0.0f, -0.5384693101f, 0.5384693101f, -0.9061798459f, 0.9061798459f};
+		static float const Weights[] = {0.5688888889f, 0.4786286705f, 0.4786286705f, 0.2369268851f, 0.2369268851f};
+
+		float const Center = (t0 + t1) * 0.5f;
+		float const Radius = (t1 - t0) * 0.5f;
+
+		// The segment of the center, the bounds may be on the next segment
+		float s = Center;
+		std::size_t const Segment = spline_segment(SegmentCount, s);
+		vec3 const * c = Coefficients + Segment * 4;
+
+		float Sum = 0.0f;
+		for(std::size_t i = 0; i < 5; ++i)
+		{
+			float const u = s + Radius * Abscissas[i];
+			Sum += Weights[i] * length((c[0] * (3.0f * u) + c[1] * 2.0f) * u + c[2]);
+		}
+		return Sum * Radius;
+	}
+
+	GLM_FUNC_QUALIFIER void spline_evaluate_pure(vec3 const * Coefficients, std::size_t SegmentCount, float const * Parameters, vec3 * Positions, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Positions[i] = spline_evaluate(Coefficients, SegmentCount, Parameters[i]);
+	}
+
+#	if GLM_DISPATCH_X86
+	// The last coefficient of the curve may be the end of the array, only 3 floats are read
+	GLM_FUNC_QUALIFIER __m128 spline_load3(float const * p)
+	{
+		return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(p)), _mm_load_ss(p + 2));
+	}
+
+	GLM_FUNC_QUALIFIER float const * spline_coefficients(vec3 const * Coefficients, std::size_t SegmentCount, float Parameter, float & s)
+	{
+		s = Parameter;
+		return &Coefficients[spline_segment(SegmentCount, s) * 4].x;
+	}
+
+	// Horner scheme of a point per register, the 4th lane of the coefficients belonging to the next one
+	GLM_FUNC_QUALIFIER void spline_evaluate_sse2(vec3 const * Coefficients, std::size_t SegmentCount, float const * Parameters, vec3 * Positions, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float s;
+			float const * c = spline_coefficients(Coefficients, SegmentCount, Parameters[i], s);
+			__m128 const S = _mm_set1_ps(s);
+
+			__m128 r = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(c + 0), S), _mm_loadu_ps(c + 3));
+			r = _mm_add_ps(_mm_mul_ps(r, S), _mm_loadu_ps(c + 6));
+			r = _mm_add_ps(_mm_mul_ps(r, S), spline_load3(c + 9));
+
+			// The 4th lane is overwritten by the next position
+			if(i + 1 < Count)
+				_mm_storeu_ps(&Positions[i].x, r);
+			else
+			{
+				_mm_storel_pi(reinterpret_cast<__m64 *>(&Positions[i].x), r);
+				_mm_store_ss(&Positions[i].z, _mm_movehl_ps(r, r));
+			}
+		}
+	}
+#	endif//GLM_DISPATCH_X86
+
+	GLM_FUNC_QUALIFIER spline_evaluate_func spline_evaluate_select()
+	{
+#		if GLM_DISPATCH_X86
+			static spline_evaluate_func const Table[SIMD_LEVEL_COUNT] = {
+				spline_evaluate_pure,
+				spline_evaluate_sse2,
+				0,
+				0,
+				0};
+#		else
+			static spline_evaluate_func const Table[SIMD_LEVEL_COUNT] = {spline_evaluate_pure, 0, 0, 0, 0};
+#		endif//GLM_DISPATCH_X86
+		return simd_select(Table);
+	}
+
+	GLM_FUNC_QUALIFIER vec2 spline_project(mat4 const & ViewProjection, vec2 const & ViewportSize, vec3 const & Position, bool & Visible)
+	{
+		vec4 const Clip(ViewProjection * vec4(Position, 1.0f));
+		Visible = Clip.w > std::numeric_limits<float>::epsilon();
+		if(!Visible)
+			return vec2(0.0f);
+		return (vec2(Clip) / Clip.w * 0.5f + 0.5f) * ViewportSize;
+	}
+
+	GLM_FUNC_QUALIFIER float spline_distance_to_chord(vec2 const & p, vec2 const & a, vec2 const & b)
+	{
+		vec2 const ab(b - a);
+		float const Length2 = dot(ab, ab);
+		float const h = Length2 > 0.0f ? clamp(dot(p - a, ab) / Length2, 0.0f, 1.0f) : 0.0f;
+		return distance(p, a + ab * h);
+	}
+
+	struct spline_tessellator
+	{
+		spline_curve const * Curve;
+		mat4 ViewProjection;
+		vec2 ViewportSize;
+		float Tolerance;
+		std::vector<float> * Parameters;
+
+		enum
+		{
+			MAX_DEPTH = 16
+		};
+
+		GLM_FUNC_QUALIFIER vec2 project(float t, bool & Visible) const
+		{
+			vec3 const Position(spline_evaluate(&Curve->Coefficients[0], Curve->Coefficients.size() / 4, t));
+			return spline_project(ViewProjection, ViewportSize, Position, Visible);
+		}
+
+		// Appends the parameters in (t0, t1), the chord [p0, p1] being tested at the quarters and the middle of the interval
+		GLM_FUNC_QUALIFIER void subdivide(float t0, float t1, vec2 const & p0, vec2 const & p1, bool Visible0, bool Visible1, int Depth) const
+		{
+			if(Depth >= MAX_DEPTH)
+				return;
+
+			float const tm = (t0 + t1) * 0.5f;
+			bool VisibleQ0, VisibleM, VisibleQ1;
+			vec2 const q0(project((t0 + tm) * 0.5f, VisibleQ0));
+			vec2 const pm(project(tm, VisibleM));
+			vec2 const q1(project((tm + t1) * 0.5f, VisibleQ1));
+
+			bool const AllVisible = Visible0 && VisibleQ0 && VisibleM && VisibleQ1 && Visible1;
+			bool const NoneVisible = !Visible0 && !VisibleQ0 && !VisibleM && !VisibleQ1 && !Visible1;
+			if(NoneVisible)
+				return;
+			if(AllVisible &&
+				spline_distance_to_chord(q0, p0, p1) <= Tolerance &&
+				spline_distance_to_chord(pm, p0, p1) <= Tolerance &&
+				spline_distance_to_chord(q1, p0, p1) <= Tolerance)
+				return;
+
+			subdivide(t0, tm, p0, pm, Visible0, VisibleM, Depth + 1);
+			Parameters->push_back(tm);
+			subdivide(tm, t1, pm, p1, VisibleM, Visible1, Depth + 1);
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void splineCatmullRom(vec3 const * Points, std::size_t PointCount, spline_curve & Curve)
+	{
+		Curve.Coefficients.clear();
+		Curve.Parameters.clear();
+		Curve.Lengths.clear();
+
+		for(std::size_t i = 0; i + 3 < PointCount; ++i)
+		{
+			vec3 const & v1 = Points[i + 0];
+			vec3 const & v2 = Points[i + 1];
+			vec3 const & v3 = Points[i + 2];
+			vec3 const & v4 = Points[i + 3];
+
+			Curve.Coefficients.push_back((-v1 + v2 * 3.0f - v3 * 3.0f + v4) * 0.5f);
+			Curve.Coefficients.push_back((v1 * 2.0f - v2 * 5.0f + v3 * 4.0f - v4) * 0.5f);
+			Curve.Coefficients.push_back((v3 - v1) * 0.5f);
+			Curve.Coefficients.push_back(v2);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void splineHermite(vec3 const * Points, vec3 const * Tangents, std::size_t PointCount, spline_curve & Curve)
+	{
+		Curve.Coefficients.clear();
+		Curve.Parameters.clear();
+		Curve.Lengths.clear();
+
+		for(std::size_t i = 0; i + 1 < PointCount; ++i)
+		{
+			vec3 const & v1 = Points[i + 0];
+			vec3 const & t1 = Tangents[i + 0];
+			vec3 const & v2 = Points[i + 1];
+			vec3 const & t2 = Tangents[i + 1];
+
+			Curve.Coefficients.push_back(v1 * 2.0f - v2 * 2.0f + t1 + t2);
+			Curve.Coefficients.push_back(v2 * 3.0f - v1 * 3.0f - t1 * 2.0f - t2);
+			Curve.Coefficients.push_back(t1);
+			Curve.Coefficients.push_back(v1);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t splineSegmentCount(spline_curve const & Curve)
+	{
+		return Curve.Coefficients.size() / 4;
+	}
+
+	GLM_FUNC_QUALIFIER vec3 splineEvaluate(spline_curve const & Curve, float t)
+	{
+		assert(!Curve.Coefficients.empty());
+		return detail::spline_evaluate(&Curve.Coefficients[0], splineSegmentCount(Curve), t);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 splineDerivative(spline_curve const & Curve, float t)
+	{
+		assert(!Curve.Coefficients.empty());
+		return detail::spline_derivative(&Curve.Coefficients[0], splineSegmentCount(Curve), t);
+	}
+
+	GLM_FUNC_QUALIFIER void splineEvaluateBatch(spline_curve const & Curve, float const * Parameters, vec3 * Positions, std::size_t Count)
+	{
+		assert(!Curve.Coefficients.empty());
+		detail::spline_evaluate_select()(&Curve.Coefficients[0], splineSegmentCount(Curve), Parameters, Positions, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void splineBuildArcLength(spline_curve & Curve, std::size_t SamplesPerSegment)
+	{
+		assert(!Curve.Coefficients.empty() && SamplesPerSegment > 0);
+
+		std::size_t const SegmentCount = splineSegmentCount(Curve);
+		std::size_t const SampleCount = SegmentCount * SamplesPerSegment + 1;
+		Curve.Parameters.resize(SampleCount);
+		Curve.Lengths.resize(SampleCount);
+
+		Curve.Parameters[0] = 0.0f;
+		Curve.Lengths[0] = 0.0f;
+		for(std::size_t i = 1; i < SampleCount; ++i)
+		{
+			std::size_t const Segment = (i - 1) / SamplesPerSegment;
+			std::size_t const Sample = i - Segment * SamplesPerSegment;
+			Curve.Parameters[i] = static_cast<float>(Segment) + static_cast<float>(Sample) / static_cast<float>(SamplesPerSegment);
+			Curve.Lengths[i] = Curve.Lengths[i - 1] + detail::spline_length(&Curve.Coefficients[0], SegmentCount, Curve.Parameters[i - 1], Curve.Parameters[i]);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER float splineLength(spline_curve const & Curve)
+	{
+		assert(!Curve.Lengths.empty());
+		return Curve.Lengths.back();
+	}
+
+	GLM_FUNC_QUALIFIER float splineParameterAtLength(spline_curve const & Curve, float Length)
+	{
+		assert(Curve.Lengths.size() > 1);
+
+		std::size_t const SegmentCount = splineSegmentCount(Curve);
+		float const Target = clamp(Length, 0.0f, Curve.Lengths.back());
+
+		// Interval of the table containing the length
+		std::size_t const Upper = static_cast<std::size_t>(std::upper_bound(Curve.Lengths.begin(), Curve.Lengths.end(), Target) - Curve.Lengths.begin());
+		std::size_t const Sample = Upper == 0 ? 0 : glm::min(Upper - 1, Curve.Lengths.size() - 2);
+
+		float const t0 = Curve.Parameters[Sample];
+		float const t1 = Curve.Parameters[Sample + 1];
+		float const L0 = Curve.Lengths[Sample];
+		float const L1 = Curve.Lengths[Sample + 1];
+		if(L1 <= L0)
+			return t0;
+
+		// Linear interpolation in the interval refined by a Newton step on the length
+		float t = t0 + (t1 - t0) * (Target - L0) / (L1 - L0);
+		float const Error = L0 + detail::spline_length(&Curve.Coefficients[0], SegmentCount, t0, t) - Target;
+		float const Speed = length(detail::spline_derivative(&Curve.Coefficients[0], SegmentCount, t));
+		if(Speed > std::numeric_limits<float>::epsilon())
+			t = clamp(t - Error / Speed, t0, t1);
+		return t;
+	}
+
+	GLM_FUNC_QUALIFIER void splineParameterAtLengthBatch(spline_curve const & Curve, float const * Lengths, float * Parameters, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Parameters[i] = splineParameterAtLength(Curve, Lengths[i]);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t splineTessellate
+	(
+		spline_curve const & Curve,
+		mat4 const & ViewProjection, vec2 const & ViewportSize, float Tolerance,
+		std::vector<float> & Parameters
+	)
+	{
+		assert(!Curve.Coefficients.empty());
+
+		std::size_t const First = Parameters.size();
+		std::size_t const SegmentCount = splineSegmentCount(Curve);
+
+		detail::spline_tessellator const Tessellator = {&Curve, ViewProjection, ViewportSize, Tolerance, &Parameters};
+
+		bool Visible0;
+		vec2 p0(Tessellator.project(0.0f, Visible0));
+		Parameters.push_back(0.0f);
+		for(std::size_t i = 0; i < SegmentCount; ++i)
+		{
+			float const t1 = static_cast<float>(i + 1);
+			bool Visible1;
+			vec2 const p1(Tessellator.project(t1, Visible1));
+			Tessellator.subdivide(static_cast<float>(i), t1, p0, p1, Visible0, Visible1, 0);
+			Parameters.push_back(t1);
+
+			p0 = p1;
+			Visible0 = Visible1;
+		}
+
+		return Parameters.size() - First;
+	}
+}//namespace glm
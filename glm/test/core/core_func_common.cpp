@@ -39,6 +39,7 @@
 #include <cstdio>
 #include <cmath>
 #include <ctime>
+#include <limits>
 
 namespace floor_
 {
@@ -846,6 +847,37 @@ namespace isinf_
 	}
 }//namespace isinf_
 
+namespace fma_
+{
+	int test()
+	{
+		int Error(0);
+
+		// Exact: 3 * 5 + 7
+		Error += glm::fma(3.0f, 5.0f, 7.0f) == 22.0f ? 0 : 1;
+		Error += glm::fma(3.0, 5.0, 7.0) == 22.0 ? 0 : 1;
+		Error += glm::all(glm::equal(glm::fma(glm::vec4(1, 2, 3, 4), glm::vec4(2), glm::vec4(1)), glm::vec4(3, 5, 7, 9))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::fma(glm::dvec4(1, 2, 3, 4), glm::dvec4(2), glm::dvec4(1)), glm::dvec4(3, 5, 7, 9))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::fma(glm::vec3(1, 2, 3), glm::vec3(2), glm::vec3(1)), glm::vec3(3, 5, 7))) ? 0 : 1;
+
+		// Single rounding: within one ULP of the double precision result, the product is exact in double
+#		if GLM_HAS_FMA
+			for(int i = 1; i < 256; ++i)
+			{
+				float const a = 1.0f + static_cast<float>(i) / 3.0f;
+				float const b = 1.0f / static_cast<float>(i);
+				float const c = -static_cast<float>(i) * 0.1f;
+				float const Reference = static_cast<float>(static_cast<double>(a) * static_cast<double>(b) + static_cast<double>(c));
+
+				float const Result = glm::fma(a, b, c);
+				Error += glm::abs(Result - Reference) <= glm::abs(Reference) * std::numeric_limits<float>::epsilon() ? 0 : 1;
+			}
+#		endif//GLM_HAS_FMA
+
+		return Error;
+	}
+}//namespace fma_
+
 namespace sign
 {
 	template <typename genFIType> 
@@ -1171,6 +1203,7 @@ int main()
 	Error += roundEven::test();
 	Error += isnan_::test();
 	Error += isinf_::test();
+	Error += fma_::test();
 
 #	ifdef NDEBUG
 		Error += sign::perf();
@@ -465,10 +465,30 @@ namespace bitfieldReverse
 		return Error;
 	}
 
+	int test_bitfieldReverseVec()
+	{
+		int Error = 0;
+
+		glm::uvec4 const U(0x00000001, 0x80000000, 0x0F0F0F0F, 0x12345678);
+		glm::uvec4 const ResultU = glm::bitfieldReverse(U);
+		for(glm::length_t i = 0; i < 4; ++i)
+			Error += ResultU[i] == glm::bitfieldReverse(U[i]) ? 0 : 1;
+		Error += ResultU == glm::uvec4(0x80000000, 0x00000001, 0xF0F0F0F0, 0x1E6A2C48) ? 0 : 1;
+
+		glm::ivec4 const I(-1, -2, 1, static_cast<int>(0x80000000));
+		glm::ivec4 const ResultI = glm::bitfieldReverse(I);
+		for(glm::length_t i = 0; i < 4; ++i)
+			Error += ResultI[i] == glm::bitfieldReverse(I[i]) ? 0 : 1;
+		Error += ResultI == glm::ivec4(-1, 0x7FFFFFFF, static_cast<int>(0x80000000), 1) ? 0 : 1;
+
+		return Error;
+	}
+
 	int test()
 	{
 		int Error = 0;
 
+		Error += test_bitfieldReverseVec();
 		Error += test32_bitfieldReverse();
 		Error += test32_bitfieldReverseLoop();
 		Error += test32_bitfieldReverseUint32();
@@ -1559,6 +1579,17 @@ namespace bitCount
 			assert(!Error);
 		}
 
+		glm::ivec4 const I(DataI32[0].Value, DataI32[1].Value, DataI32[2].Value, -1);
+		Error += glm::bitCount(I) == glm::ivec4(DataI32[0].Return, DataI32[1].Return, DataI32[2].Return, 32) ? 0 : 1;
+		Error += glm::bitCount(glm::uvec4(I)) == glm::ivec4(DataI32[0].Return, DataI32[1].Return, DataI32[2].Return, 32) ? 0 : 1;
+		Error += glm::findLSB(glm::uvec4(0, 1, 8, 0x80000000)) == glm::ivec4(-1, 0, 3, 31) ? 0 : 1;
+		Error += glm::findMSB(glm::uvec4(0, 1, 9, 0x80000000)) == glm::ivec4(-1, 0, 3, 31) ? 0 : 1;
+
+		glm::ivec4 const Signed(0, -1, 9, -9);
+		glm::ivec4 const SignedMSB = glm::findMSB(Signed);
+		for(glm::length_t i = 0; i < 4; ++i)
+			Error += SignedMSB[i] == glm::findMSB(Signed[i]) ? 0 : 1;
+
 		return Error;
 	}
 }//bitCount
@@ -32,6 +32,7 @@
 // This has the programs for computing the number of 1-bits
 // in a word, or byte, etc.
 // Max line length is 57, to fit in hacker.book.
+#include <glm/glm.hpp>
 #include <stdio.h>
 #include <stdlib.h>     //To define "exit", req'd by XLC.
 #include <ctime>
@@ -315,6 +316,24 @@ int main()
 
 	printf("pop9: %ld clocks\n", TimestampEnd - TimestampBeg);
 
+	TimestampBeg = std::clock();
+	for (std::size_t k = 0; k < Count; ++k)
+	for (i = 0; i < n; i += 2) {
+		if (glm::bitCount(test[i]) != static_cast<int>(test[i+1])) error(test[i], glm::bitCount(test[i]));}
+	TimestampEnd = std::clock();
+
+	printf("glm::bitCount: %ld clocks\n", TimestampEnd - TimestampBeg);
+
+	// Four values per call, SSE2 optimized
+	TimestampBeg = std::clock();
+	for (std::size_t k = 0; k < Count; ++k)
+	for (i = 0; i + 7 < n; i += 8) {
+		glm::ivec4 const Result = glm::bitCount(glm::uvec4(test[i], test[i+2], test[i+4], test[i+6]));
+		if (Result != glm::ivec4(test[i+1], test[i+3], test[i+5], test[i+7])) error(test[i], Result.x);}
+	TimestampEnd = std::clock();
+
+	printf("glm::bitCount uvec4: %ld clocks\n", TimestampEnd - TimestampBeg);
+
 	if (errors == 0)
 		printf("Passed all %d cases.\n", sizeof(test)/8);
 
@@ -32,6 +32,7 @@
 // in a word.
 // Max line length is 57, to fit in hacker.book.
 // Compile with g++, not gcc.
+#include <glm/glm.hpp>
 #include <cstdio>
 #include <cstdlib>     // To define "exit", req'd by XLC.
 #include <ctime>
@@ -461,6 +462,25 @@ int main()
 
 	printf("nlz10b: %d clocks\n", TimestampEnd - TimestampBeg);
 
+	// The number of leading zeros is 31 - findMSB, findMSB(0) is -1
+	TimestampBeg = std::clock();
+	for (std::size_t k = 0; k < Count; ++k)
+	for (i = 0; i < n; i += 2) {
+		if (31 - glm::findMSB(test[i]) != static_cast<int>(test[i+1])) error(test[i], 31 - glm::findMSB(test[i]));}
+	TimestampEnd = std::clock();
+
+	printf("glm::findMSB: %d clocks\n", TimestampEnd - TimestampBeg);
+
+	// Four values per call, SSE2 optimized
+	TimestampBeg = std::clock();
+	for (std::size_t k = 0; k < Count; ++k)
+	for (i = 0; i + 7 < n; i += 8) {
+		glm::ivec4 const Result = glm::ivec4(31) - glm::findMSB(glm::uvec4(test[i], test[i+2], test[i+4], test[i+6]));
+		if (Result != glm::ivec4(test[i+1], test[i+3], test[i+5], test[i+7])) error(test[i], Result.x);}
+	TimestampEnd = std::clock();
+
+	printf("glm::findMSB uvec4: %d clocks\n", TimestampEnd - TimestampBeg);
+
 	if (errors == 0)
 		printf("Passed all %d cases.\n", sizeof(test)/8);
 
@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/core/core_type_constexpr.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#if GLM_HAS_CONSTEXPR && !GLM_HAS_ANONYMOUS_UNION
+namespace ctor
+{
+	constexpr glm::vec2 A(1.0f, 2.0f);
+	constexpr glm::vec3 B(A, 3.0f);
+	constexpr glm::vec4 C(B, 4.0f);
+	constexpr glm::ivec4 D(C);
+	constexpr glm::quat Q(1.0f, 0.0f, 0.0f, 0.0f);
+
+	static_assert(B.z == 3.0f, "GLM: vec3 constructor isn't constexpr");
+	static_assert(C.x == 1.0f && C.w == 4.0f, "GLM: vec4 constructor isn't constexpr");
+	static_assert(D.y == 2, "GLM: vec4 conversion constructor isn't constexpr");
+	static_assert(Q.w == 1.0f && Q.x == 0.0f, "GLM: quat constructor isn't constexpr");
+
+	constexpr glm::vec3 X(1.0f, 0.0f, 0.0f);
+	constexpr glm::vec3 Y(0.0f, 1.0f, 0.0f);
+	constexpr glm::vec3 Z = glm::cross(X, Y);
+
+	static_assert(Z.x == 0.0f && Z.y == 0.0f && Z.z == 1.0f, "GLM: cross isn't constexpr");
+	static_assert(glm::dot(C, C) == 30.0f, "GLM: dot isn't constexpr");
+	static_assert(glm::dot(B, Z) == 3.0f, "GLM: dot isn't constexpr");
+
+	int test()
+	{
+		int Error = 0;
+
+		glm::vec3 const RuntimeX(1.0f, 0.0f, 0.0f);
+		glm::vec3 const RuntimeY(0.0f, 1.0f, 0.0f);
+		Error += glm::cross(RuntimeX, RuntimeY) == Z ? 0 : 1;
+		Error += glm::dot(glm::vec4(1, 2, 3, 4), glm::vec4(1, 2, 3, 4)) == glm::dot(C, C) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace ctor
+#endif//GLM_HAS_CONSTEXPR
+
+#if GLM_HAS_CONSTEXPR_CXX14 && !GLM_HAS_ANONYMOUS_UNION
+namespace operators
+{
+	constexpr glm::vec4 A = glm::vec4(1, 2, 3, 4) * 2.0f + glm::vec4(1);
+	constexpr glm::mat4 M = glm::mat4(2.0f) * glm::mat4(3.0f);
+	constexpr glm::vec4 V = M * A;
+	constexpr glm::quat Q = glm::quat(1, 2, 3, 4) * glm::quat(0, 1, 0, 0);
+
+	static_assert(A == glm::vec4(3, 5, 7, 9), "GLM: vec4 operators aren't constexpr");
+	static_assert(A[3] == 9.0f, "GLM: vec4 operator[] isn't constexpr");
+	static_assert(M[1][1] == 6.0f && M[0][1] == 0.0f, "GLM: mat4 operators aren't constexpr");
+	static_assert(V == A * 6.0f, "GLM: mat4 * vec4 isn't constexpr");
+	static_assert(Q == glm::quat(1, 2, 3, 4) * glm::quat(0, 1, 0, 0), "GLM: quat operators aren't constexpr");
+	static_assert(glm::dot(Q, Q) == glm::dot(Q, Q), "GLM: quat dot isn't constexpr");
+
+	int test()
+	{
+		int Error = 0;
+
+		glm::vec4 const RuntimeA(1, 2, 3, 4);
+		glm::quat const RuntimeQ(1, 2, 3, 4);
+		Error += RuntimeA * 2.0f + glm::vec4(1) == A ? 0 : 1;
+		Error += glm::mat4(2.0f) * glm::mat4(3.0f) * (RuntimeA * 2.0f + glm::vec4(1)) == V ? 0 : 1;
+		Error += RuntimeQ * glm::quat(0, 1, 0, 0) == Q ? 0 : 1;
+
+		return Error;
+	}
+}//namespace operators
+
+namespace transform
+{
+	constexpr glm::mat4 Translate = glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3));
+	constexpr glm::mat4 Scale = glm::scale(Translate, glm::vec3(2));
+	constexpr glm::mat4 Ortho = glm::ortho(-2.0f, 2.0f, -1.0f, 1.0f, 1.0f, 3.0f);
+	constexpr glm::mat4 Frustum = glm::frustum(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 3.0f);
+
+	static_assert(Translate[3] == glm::vec4(1, 2, 3, 1), "GLM: translate isn't constexpr");
+	static_assert(Scale * glm::vec4(1, 1, 1, 1) == glm::vec4(3, 4, 5, 1), "GLM: scale isn't constexpr");
+	static_assert(Ortho * glm::vec4(2, 1, -3, 1) == glm::vec4(1, 1, 1, 1), "GLM: ortho isn't constexpr");
+	static_assert(Frustum[2][3] == -1.0f && Frustum[3][2] == -3.0f, "GLM: frustum isn't constexpr");
+
+#	if GLM_COMPILER & GLM_COMPILER_GCC
+		// Only GCC evaluates the trigonometric functions in constant expressions
+		constexpr glm::mat4 Perspective = glm::perspective(1.5707964f, 2.0f, 1.0f, 3.0f);
+
+		static_assert(glm::abs(Perspective[1][1] - 1.0f) < 1e-6f, "GLM: perspective isn't constexpr");
+		static_assert(Perspective[2][3] == -1.0f, "GLM: perspective isn't constexpr");
+#	endif
+
+	int test()
+	{
+		int Error = 0;
+
+		glm::vec3 const RuntimeOffset(1, 2, 3);
+		Error += glm::translate(glm::mat4(1.0f), RuntimeOffset) == Translate ? 0 : 1;
+		Error += glm::scale(glm::translate(glm::mat4(1.0f), RuntimeOffset), glm::vec3(2)) == Scale ? 0 : 1;
+		Error += glm::ortho(-2.0f, 2.0f, -1.0f, 1.0f, 1.0f, 3.0f) == Ortho ? 0 : 1;
+
+		return Error;
+	}
+}//namespace transform
+
+namespace table
+{
+	// The 24 rotations of a cube, built at compile time
+	struct rotations
+	{
+		glm::mat3 Data[24];
+	};
+
+	constexpr glm::mat3 RotateX(glm::vec3(1, 0, 0), glm::vec3(0, 0, 1), glm::vec3(0, -1, 0));
+	constexpr glm::mat3 RotateY(glm::vec3(0, 0, -1), glm::vec3(0, 1, 0), glm::vec3(1, 0, 0));
+	constexpr glm::mat3 RotateZ(glm::vec3(0, 1, 0), glm::vec3(-1, 0, 0), glm::vec3(0, 0, 1));
+
+	constexpr rotations build()
+	{
+		glm::mat3 Faces[6] = {glm::mat3(1), RotateX, RotateX * RotateX, RotateX * RotateX * RotateX, RotateY, RotateY * RotateY * RotateY};
+
+		rotations Result{};
+		for(int i = 0; i < 6; ++i)
+		{
+			glm::mat3 Spin(1);
+			for(int j = 0; j < 4; ++j)
+			{
+				Result.Data[i * 4 + j] = Faces[i] * Spin;
+				Spin *= RotateZ;
+			}
+		}
+		return Result;
+	}
+
+	constexpr int duplicates(rotations const & Table)
+	{
+		int Count = 0;
+		for(int i = 0; i < 24; ++i)
+		for(int j = i + 1; j < 24; ++j)
+			Count += Table.Data[i] == Table.Data[j] ? 1 : 0;
+		return Count;
+	}
+
+	constexpr rotations Rotations = build();
+
+	static_assert(duplicates(Rotations) == 0, "GLM: the rotation table isn't built at compile time");
+	static_assert(Rotations.Data[5] == RotateX * RotateZ, "GLM: the rotation table isn't built at compile time");
+	static_assert(Rotations.Data[16] * glm::vec3(0, 0, 1) == glm::vec3(1, 0, 0), "GLM: the rotation table isn't built at compile time");
+
+	int test()
+	{
+		int Error = 0;
+
+		for(int i = 0; i < 24; ++i)
+		{
+			glm::vec3 const Axis = Rotations.Data[i] * glm::vec3(0, 0, 1);
+			Error += glm::dot(Axis, Axis) == 1.0f ? 0 : 1;
+			Error += Rotations.Data[i] * glm::transpose(Rotations.Data[i]) == glm::mat3(1) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace table
+#endif//GLM_HAS_CONSTEXPR_CXX14
+
+int main()
+{
+	int Error = 0;
+
+#	if GLM_HAS_CONSTEXPR && !GLM_HAS_ANONYMOUS_UNION
+		Error += ctor::test();
+#	endif
+
+#	if GLM_HAS_CONSTEXPR_CXX14 && !GLM_HAS_ANONYMOUS_UNION
+		Error += operators::test();
+		Error += transform::test();
+		Error += table::test();
+#	endif
+
+	return Error;
+}
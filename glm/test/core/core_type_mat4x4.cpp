@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/ulp.hpp>
 #include <glm/matrix.hpp>
 #include <glm/mat2x2.hpp>
 #include <glm/mat2x3.hpp>
@@ -41,6 +42,7 @@
 #include <glm/mat4x3.hpp>
 #include <glm/mat4x4.hpp>
 #include <cstdio>
+#include <ctime>
 #include <vector>
 
 
@@ -273,14 +275,94 @@ int test_ctr()
 	return Error;
 }
 
-int perf_mul()
+namespace mul
 {
-	int Error = 0;
+	// Positive coefficients, the products don't suffer from cancellation
+	glm::mat4 make_mat4(int Seed)
+	{
+		glm::mat4 Result(1.0f);
+		for(glm::length_t c = 0; c < 4; ++c)
+		for(glm::length_t r = 0; r < 4; ++r)
+			Result[c][r] = 0.25f + static_cast<float>((Seed * 7 + c * 5 + r * 3) % 17) / 13.0f;
+		return Result;
+	}
 
+	// Accuracy of the float products against a double precision reference, in ULPs
+	int test()
+	{
+		int Error = 0;
 
+		glm::uint MaxUlpMat = 0;
+		glm::uint MaxUlpVec = 0;
+		for(int i = 0; i < 64; ++i)
+		{
+			glm::mat4 const A = make_mat4(i);
+			glm::mat4 const B = make_mat4(i + 1);
+			glm::vec4 const V = B[i % 4];
 
-	return Error;
-}
+			glm::mat4 const ResultMat = A * B;
+			glm::mat4 const ReferenceMat(glm::dmat4(A) * glm::dmat4(B));
+			glm::vec4 const ResultVec = A * V;
+			glm::vec4 const ReferenceVec(glm::dmat4(A) * glm::dvec4(V));
+
+			for(glm::length_t c = 0; c < 4; ++c)
+			{
+				glm::uvec4 const UlpMat = glm::float_distance(ResultMat[c], ReferenceMat[c]);
+				for(glm::length_t r = 0; r < 4; ++r)
+					MaxUlpMat = glm::max(MaxUlpMat, UlpMat[r]);
+			}
+
+			glm::uvec4 const UlpVec = glm::float_distance(ResultVec, ReferenceVec);
+			for(glm::length_t r = 0; r < 4; ++r)
+				MaxUlpVec = glm::max(MaxUlpVec, UlpVec[r]);
+		}
+
+		std::printf("mat4 * mat4: %u ULP, mat4 * vec4: %u ULP (GLM_HAS_FMA: %d)\n", MaxUlpMat, MaxUlpVec, GLM_HAS_FMA);
+
+		Error += MaxUlpMat <= 4 ? 0 : 1;
+		Error += MaxUlpVec <= 4 ? 0 : 1;
+
+		return Error;
+	}
+
+	int perf()
+	{
+		int Error = 0;
+
+		std::size_t const Count = 1 << 16;
+
+		std::vector<glm::mat4> A(Count);
+		std::vector<glm::vec4> V(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A[i] = make_mat4(static_cast<int>(i));
+			V[i] = A[i][i % 4];
+		}
+
+		glm::mat4 const B = make_mat4(3);
+		std::vector<glm::mat4> ResultMat(Count);
+		std::vector<glm::vec4> ResultVec(Count);
+
+		std::clock_t const TimeMatStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			ResultMat[i] = A[i] * B;
+		std::clock_t const TimeMatEnd = std::clock();
+
+		std::clock_t const TimeVecStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			ResultVec[i] = A[i] * V[i];
+		std::clock_t const TimeVecEnd = std::clock();
+
+		std::printf("mat4 * mat4: %d clocks, mat4 * vec4: %d clocks\n",
+			static_cast<int>(TimeMatEnd - TimeMatStart),
+			static_cast<int>(TimeVecEnd - TimeVecStart));
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::epsilonEqual(ResultMat[i][0], A[i] * B[0], 0.0001f)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace mul
 
 namespace cast
 {
@@ -332,8 +414,9 @@ int main()
 	Error += test_inverse_mat4x4();
 	Error += test_operators();
 	Error += test_inverse();
+	Error += mul::test();
 
-	Error += perf_mul();
+	Error += mul::perf();
 
 	return Error;
 }
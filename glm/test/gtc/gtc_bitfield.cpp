@@ -656,6 +656,62 @@ namespace bitfieldInterleave
 	}
 }//namespace bitfieldInterleave
 
+namespace bitfieldDeinterleave
+{
+	int test()
+	{
+		int Error(0);
+
+		for(glm::uint32 i = 0; i < (1 << 16); i += 7)
+		{
+			glm::uint8 const x = static_cast<glm::uint8>(i);
+			glm::uint8 const y = static_cast<glm::uint8>(i >> 8);
+			glm::uint8 const z = static_cast<glm::uint8>(i * 13);
+			glm::uint8 const w = static_cast<glm::uint8>(i * 29);
+
+			glm::uint8 a, b, c, d;
+			glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y), a, b);
+			Error += a == x && b == y ? 0 : 1;
+			glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y, z), a, b, c);
+			Error += a == x && b == y && c == z ? 0 : 1;
+			glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y, z, w), a, b, c, d);
+			Error += a == x && b == y && c == z && d == w ? 0 : 1;
+		}
+
+		for(glm::uint32 i = 0; i < (1 << 20); i += 97)
+		{
+			glm::uint16 const x = static_cast<glm::uint16>(i);
+			glm::uint16 const y = static_cast<glm::uint16>(i * 40503u);
+			glm::uint16 const z = static_cast<glm::uint16>(i >> 4);
+			glm::uint16 const w = static_cast<glm::uint16>(i * 2654435761u >> 16);
+
+			glm::uint16 a, b, c, d;
+			glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y), a, b);
+			Error += a == x && b == y ? 0 : 1;
+			glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y, z), a, b, c);
+			Error += a == x && b == y && c == z ? 0 : 1;
+			glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y, z, w), a, b, c, d);
+			Error += a == x && b == y && c == z && d == w ? 0 : 1;
+		}
+
+		for(glm::uint32 i = 0; i < (1 << 20); i += 97)
+		{
+			glm::uint32 const x = i * 2654435761u;
+			glm::uint32 const y = i * 40503u + 0x80000000u;
+
+			glm::uint32 a, b, c;
+			glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y), a, b);
+			Error += a == x && b == y ? 0 : 1;
+
+			// Only the 22, 21 and 21 low bits of the components are stored
+			glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y, x ^ y), a, b, c);
+			Error += a == (x & 0x3FFFFF) && b == (y & 0x1FFFFF) && c == ((x ^ y) & 0x1FFFFF) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace bitfieldDeinterleave
+
 int main()
 {
 	int Error(0);
@@ -664,6 +720,7 @@ int main()
 	Error += ::bitfieldInterleave3::test();
 	Error += ::bitfieldInterleave4::test();
 	Error += ::bitfieldInterleave::test();
+	Error += ::bitfieldDeinterleave::test();
 	//Error += ::bitRevert::test();
 
 #	ifdef NDEBUG
@@ -29,11 +29,126 @@
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
+#define GLM_FORCE_CHECK_MATRIX_CLASS
 #include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtx/matrix_transform_2d.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+namespace
+{
+	glm::mat4 make_rigid(std::size_t i)
+	{
+		float const f = static_cast<float>(i);
+		glm::mat4 const Translate = glm::translate(glm::mat4(1.0f), glm::vec3(f * 0.01f, -3.0f, 2.0f));
+		return glm::rotate(Translate, 0.3f + f * 0.001f, glm::normalize(glm::vec3(1.0f, 2.0f, 0.5f + f * 0.01f)));
+	}
+
+	glm::mat4 make_affine(std::size_t i)
+	{
+		float const f = static_cast<float>(i % 16);
+		return glm::scale(make_rigid(i), glm::vec3(1.0f + f * 0.25f, 2.0f, 0.5f));
+	}
+
+	template <typename matType>
+	int equal(matType const & a, matType const & b, typename matType::value_type Epsilon)
+	{
+		int Error = 0;
+		for(glm::length_t i = 0; i < a.length(); ++i)
+			Error += glm::all(glm::epsilonEqual(a[i], b[i], Epsilon)) ? 0 : 1;
+		return Error;
+	}
+}//namespace
+
+namespace affine
+{
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t i = 0; i < 32; ++i)
+		{
+			glm::mat4 const Affine = make_affine(i);
+			glm::mat4 const Rigid = make_rigid(i);
+
+			Error += equal(glm::affineInverse(Affine), glm::inverse(Affine), 0.0001f);
+			Error += equal(glm::affineInverse(Rigid), glm::inverse(Rigid), 0.0001f);
+			Error += equal(glm::rigidInverse(Rigid), glm::inverse(Rigid), 0.0001f);
+			Error += equal(glm::inverseTranspose3x3(Affine), glm::inverseTranspose(glm::mat3(Affine)), 0.0001f);
+
+			glm::dmat4 const AffineDouble(Affine);
+			Error += equal(glm::affineInverse(AffineDouble), glm::inverse(AffineDouble), 0.0001f);
+			Error += equal(glm::rigidInverse(glm::dmat4(Rigid)), glm::inverse(glm::dmat4(Rigid)), 0.0001f);
+			Error += equal(glm::inverseTranspose3x3(AffineDouble), glm::inverseTranspose(glm::dmat3(AffineDouble)), 0.0001f);
+		}
+
+		glm::mat3 const Affine2D = glm::scale(glm::rotate(glm::translate(glm::mat3(1.0f), glm::vec2(1.0f, 2.0f)), 0.5f), glm::vec2(2.0f, 3.0f));
+		Error += equal(glm::affineInverse(Affine2D), glm::inverse(Affine2D), 0.0001f);
+
+		glm::mat3 const Rigid2D = glm::rotate(glm::translate(glm::mat3(1.0f), glm::vec2(1.0f, 2.0f)), 0.5f);
+		Error += equal(glm::rigidInverse(Rigid2D), glm::inverse(Rigid2D), 0.0001f);
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1000000;
+
+		std::vector<glm::mat4> Src(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Src[i] = make_rigid(i);
+
+		std::vector<glm::mat4> Dst(Count);
+		std::vector<glm::mat3> Normal(Count);
+
+		std::clock_t const TimeInverseStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = glm::inverse(Src[i]);
+		std::clock_t const TimeInverseEnd = std::clock();
+
+		std::clock_t const TimeAffineStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = glm::affineInverse(Src[i]);
+		std::clock_t const TimeAffineEnd = std::clock();
+
+		std::clock_t const TimeRigidStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = glm::rigidInverse(Src[i]);
+		std::clock_t const TimeRigidEnd = std::clock();
+
+		std::clock_t const TimeInverseTransposeStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Normal[i] = glm::inverseTranspose(glm::mat3(Src[i]));
+		std::clock_t const TimeInverseTransposeEnd = std::clock();
+
+		std::clock_t const TimeInverseTranspose3x3Start = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Normal[i] = glm::inverseTranspose3x3(Src[i]);
+		std::clock_t const TimeInverseTranspose3x3End = std::clock();
+
+		std::printf("inverse: %d clocks\n", static_cast<int>(TimeInverseEnd - TimeInverseStart));
+		std::printf("affineInverse: %d clocks\n", static_cast<int>(TimeAffineEnd - TimeAffineStart));
+		std::printf("rigidInverse: %d clocks\n", static_cast<int>(TimeRigidEnd - TimeRigidStart));
+		std::printf("inverseTranspose(mat3): %d clocks\n", static_cast<int>(TimeInverseTransposeEnd - TimeInverseTransposeStart));
+		std::printf("inverseTranspose3x3: %d clocks\n", static_cast<int>(TimeInverseTranspose3x3End - TimeInverseTranspose3x3Start));
+
+		return 0;
+	}
+}//namespace affine
 
 int main()
 {
 	int Error = 0;
 
+	Error += affine::test();
+
+#	ifdef NDEBUG
+		Error += affine::perf();
+#	endif//NDEBUG
+
 	return Error;
 }
@@ -31,7 +31,9 @@
 
 #include <glm/gtc/packing.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/constants.hpp>
 #include <cstdio>
+#include <cmath>
 #include <vector>
 
 void print_bits(float const & s)
@@ -220,13 +222,15 @@ int test_Unorm3x10_1x2()
 
 	for(std::size_t i = 0; i < Tests.size(); ++i)
 	{
-		glm::uint32 p0 = glm::packSnorm3x10_1x2(Tests[i]);
-		glm::vec4 v0 = glm::unpackSnorm3x10_1x2(p0);
-		glm::uint32 p1 = glm::packSnorm3x10_1x2(v0);
-		glm::vec4 v1 = glm::unpackSnorm3x10_1x2(p1);
+		glm::uint32 p0 = glm::packUnorm3x10_1x2(Tests[i]);
+		glm::vec4 v0 = glm::unpackUnorm3x10_1x2(p0);
+		glm::uint32 p1 = glm::packUnorm3x10_1x2(v0);
+		glm::vec4 v1 = glm::unpackUnorm3x10_1x2(p1);
 		Error += glm::all(glm::equal(v0, v1)) ? 0 : 1;
 	}
 
+	Error += glm::all(glm::equal(glm::unpackUnorm3x10_1x2(glm::packUnorm3x10_1x2(glm::vec4(1.0f))), glm::vec4(1.0f))) ? 0 : 1;
+
 	return Error;
 }
 
@@ -251,6 +255,9 @@ int test_F2x11_1x10()
 		Error += glm::all(glm::equal(v0, v1)) ? 0 : 1;
 	}
 
+	// Each component is decoded independently of the others
+	Error += glm::all(glm::equal(glm::unpackF2x11_1x10(glm::packF2x11_1x10(glm::vec3(0.0f, 1.0f, 2.0f))), glm::vec3(0.0f, 1.0f, 2.0f))) ? 0 : 1;
+
 	return Error;
 }
 
@@ -501,6 +508,138 @@ int test_packSnorm4x8()
 	return Error;
 }
 
+// Directions spread over the sphere, the poles, the axes and the octahedron edges included
+std::vector<glm::vec3> make_directions()
+{
+	std::vector<glm::vec3> Result;
+	for(int j = 0; j <= 256; ++j)
+	for(int i = 0; i < 512; ++i)
+	{
+		float const Theta = glm::pi<float>() * static_cast<float>(j) / 256.0f;
+		float const Phi = glm::two_pi<float>() * (static_cast<float>(i) + 0.37f) / 512.0f;
+		Result.push_back(glm::vec3(std::cos(Phi) * std::sin(Theta), std::sin(Phi) * std::sin(Theta), std::cos(Theta)));
+	}
+	for(int i = 0; i < 3; ++i)
+	{
+		glm::vec3 Axis(0.0f);
+		Axis[i] = 1.0f;
+		Result.push_back(Axis);
+		Result.push_back(-Axis);
+	}
+	Result.push_back(glm::normalize(glm::vec3(1.0f, -1.0f, 0.0f)));
+	Result.push_back(glm::normalize(glm::vec3(-1.0f, 0.0f, -1.0f)));
+	return Result;
+}
+
+// Angle between two directions, computed in double
+double angle(glm::vec3 const & a, glm::vec3 const & b)
+{
+	glm::dvec3 const x(glm::normalize(glm::dvec3(a)));
+	glm::dvec3 const y(glm::normalize(glm::dvec3(b)));
+	return std::atan2(glm::length(glm::cross(x, y)), glm::dot(x, y));
+}
+
+// Angle between the rotations of two quaternions, q and -q being the same rotation
+double angle(glm::quat const & a, glm::quat const & b)
+{
+	glm::dvec4 const x(glm::normalize(glm::dvec4(a.x, a.y, a.z, a.w)));
+	glm::dvec4 const y(glm::normalize(glm::dvec4(b.x, b.y, b.z, b.w)));
+	double const Distance = glm::min(glm::length(x - y), glm::length(x + y));
+	return 4.0 * std::asin(glm::min(Distance * 0.5, 1.0));
+}
+
+int test_Octahedral()
+{
+	int Error = 0;
+
+	double const Degree = glm::pi<double>() / 180.0;
+	std::vector<glm::vec3> const A = make_directions();
+
+	double Max8 = 0.0, Max16 = 0.0;
+	for(std::size_t i = 0; i < A.size(); ++i)
+	{
+		Max8 = glm::max(Max8, angle(A[i], glm::unpackOctahedral2x8(glm::packOctahedral2x8(A[i]))));
+		Max16 = glm::max(Max16, angle(A[i], glm::unpackOctahedral2x16(glm::packOctahedral2x16(A[i]))));
+
+		// Not normalized directions
+		Error += glm::packOctahedral2x16(A[i] * 4.0f) == glm::packOctahedral2x16(A[i]) ? 0 : 1;
+	}
+	Error += Max8 < 1.0 * Degree ? 0 : 1;
+	Error += Max16 < 0.004 * Degree ? 0 : 1;
+
+	Error += glm::all(glm::equal(glm::unpackOctahedral2x16(glm::packOctahedral2x16(glm::vec3(0, 0, 1))), glm::vec3(0, 0, 1))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::unpackOctahedral2x16(glm::packOctahedral2x16(glm::vec3(0, 0, -1))), glm::vec3(0, 0, -1))) ? 0 : 1;
+
+	return Error;
+}
+
+int test_Quat_1x2()
+{
+	int Error = 0;
+
+	double const Degree = glm::pi<double>() / 180.0;
+	std::vector<glm::vec3> const Axes = make_directions();
+
+	double Max10 = 0.0, Max20 = 0.0;
+	for(std::size_t i = 0; i < Axes.size(); ++i)
+	{
+		float const Angle = static_cast<float>(i % 97) * 0.0654f - 0.3f;
+		glm::quat const q = glm::angleAxis(Angle, Axes[i]);
+
+		glm::quat const q10 = glm::unpackQuat3x10_1x2(glm::packQuat3x10_1x2(q));
+		glm::quat const q20 = glm::unpackQuat3x20_1x2(glm::packQuat3x20_1x2(q));
+		Max10 = glm::max(Max10, angle(q, q10));
+		Max20 = glm::max(Max20, angle(q, q20));
+
+		// q and -q are packed the same way
+		Error += glm::packQuat3x10_1x2(-q) == glm::packQuat3x10_1x2(q) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::length(q20), 1.0f, 0.0001f) ? 0 : 1;
+	}
+	Error += Max10 < 0.26 * Degree ? 0 : 1;
+	Error += Max20 < 0.0003 * Degree ? 0 : 1;
+
+	glm::quat const Identity(1.0f, 0.0f, 0.0f, 0.0f);
+	Error += Identity == glm::unpackQuat3x20_1x2(glm::packQuat3x20_1x2(Identity)) ? 0 : 1;
+
+	return Error;
+}
+
+int test_SphericalFibonacci()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> const A = make_directions();
+
+	// The index is the one of the closest point
+	glm::uint32 const Count = 1000;
+	std::vector<glm::vec3> Points(Count);
+	for(glm::uint32 i = 0; i < Count; ++i)
+		Points[i] = glm::unpackSphericalFibonacci(i, Count);
+
+	for(std::size_t i = 0; i < A.size(); i += 7)
+	{
+		glm::uint32 const Index = glm::packSphericalFibonacci(A[i], Count);
+		float const Distance = glm::distance(Points[Index], A[i]);
+
+		float Closest = 4.0f;
+		for(glm::uint32 j = 0; j < Count; ++j)
+			Closest = glm::min(Closest, glm::distance(Points[j], A[i]));
+		Error += Distance <= Closest + 0.00001f ? 0 : 1;
+	}
+
+	// Error bound for a large point set
+	glm::uint32 const LargeCount = 1 << 20;
+	double const Bound = 0.75 * std::sqrt(4.0 * glm::pi<double>() / static_cast<double>(LargeCount));
+	for(std::size_t i = 0; i < A.size(); ++i)
+	{
+		glm::uint32 const Index = glm::packSphericalFibonacci(A[i], LargeCount);
+		Error += Index < LargeCount ? 0 : 1;
+		Error += angle(A[i], glm::unpackSphericalFibonacci(Index, LargeCount)) < Bound ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error(0);
@@ -528,6 +667,9 @@ int main()
 	Error += test_U3x10_1x2();
 	Error += test_Half1x16();
 	Error += test_U3x10_1x2();
+	Error += test_Octahedral();
+	Error += test_Quat_1x2();
+	Error += test_SphericalFibonacci();
 
 	return Error;
 }
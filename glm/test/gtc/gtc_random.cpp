@@ -31,6 +31,9 @@
 
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 #	include <array>
 #endif
@@ -349,6 +352,358 @@ int test_ballRand()
 
 	return Error;
 }
+int test_gaussRand()
+{
+	int Error = 0;
+
+	// The samples have the requested mean and standard deviation
+	{
+		std::size_t const Count = 100000;
+		glm::xoshiro128 Engine(17);
+
+		double SumFloat = 0.0, SquareSumFloat = 0.0;
+		double SumDouble = 0.0, SquareSumDouble = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const a = glm::gaussRand(3.0f, 2.5f, Engine);
+			double const b = glm::gaussRand(-1.0, 0.5, Engine);
+			Error += glm::isinf(a) || glm::isnan(a) ? 1 : 0;
+			Error += glm::isinf(b) || glm::isnan(b) ? 1 : 0;
+			SumFloat += a;
+			SquareSumFloat += static_cast<double>(a) * a;
+			SumDouble += b;
+			SquareSumDouble += b * b;
+		}
+
+		double const MeanFloat = SumFloat / Count;
+		double const DeviationFloat = glm::sqrt(SquareSumFloat / Count - MeanFloat * MeanFloat);
+		double const MeanDouble = SumDouble / Count;
+		double const DeviationDouble = glm::sqrt(SquareSumDouble / Count - MeanDouble * MeanDouble);
+
+		Error += glm::abs(MeanFloat - 3.0) < 0.05 ? 0 : 1;
+		Error += glm::abs(DeviationFloat - 2.5) < 0.05 ? 0 : 1;
+		Error += glm::abs(MeanDouble + 1.0) < 0.01 ? 0 : 1;
+		Error += glm::abs(DeviationDouble - 0.5) < 0.01 ? 0 : 1;
+		assert(!Error);
+	}
+
+	return Error;
+}
+
+int test_engine()
+{
+	int Error = 0;
+
+	// Reference outputs of the PCG32 demo with a seed of 42 and a stream of 54
+	{
+		glm::uint32 const Expected[] = {0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e};
+
+		glm::pcg32 Engine(42, 54);
+		for(std::size_t i = 0; i < sizeof(Expected) / sizeof(Expected[0]); ++i)
+			Error += Engine() == Expected[i] ? 0 : 1;
+		assert(!Error);
+	}
+
+	// Known answer of Philox4x32-10 for a null counter and key
+	{
+		glm::uint32 const Expected[] = {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8};
+
+		glm::philox4x32 Engine(0, 0);
+		for(std::size_t i = 0; i < sizeof(Expected) / sizeof(Expected[0]); ++i)
+			Error += Engine() == Expected[i] ? 0 : 1;
+		assert(!Error);
+	}
+
+	// discard is equivalent to drawing the values
+	{
+		glm::uint64 const Counts[] = {0, 1, 3, 4, 7, 8, 1001};
+		for(std::size_t i = 0; i < sizeof(Counts) / sizeof(Counts[0]); ++i)
+		{
+			glm::philox4x32 A(7, 3);
+			glm::philox4x32 B(7, 3);
+			A();
+			B();
+			A.discard(Counts[i]);
+			for(glm::uint64 j = 0; j < Counts[i]; ++j)
+				B();
+			Error += A() == B() ? 0 : 1;
+			Error += A() == B() ? 0 : 1;
+		}
+		assert(!Error);
+	}
+
+	// Streams are jumps ahead of the stream 0
+	{
+		glm::xoshiro128 A(1, 0);
+		glm::xoshiro128 B(1, 1);
+		A.jump();
+		for(std::size_t i = 0; i < 16; ++i)
+			Error += A() == B() ? 0 : 1;
+
+		glm::xoshiro128 C(1, 0);
+		glm::xoshiro128 D(1, 2);
+		std::size_t Equal = 0;
+		for(std::size_t i = 0; i < 16; ++i)
+			Equal += C() == D() ? 1 : 0;
+		Error += Equal < 2 ? 0 : 1;
+		assert(!Error);
+	}
+
+	// Engines give reproducible sequences, independent of std::rand
+	{
+		glm::pcg32 A(5);
+		glm::pcg32 B(5);
+		for(std::size_t i = 0; i < 100; ++i)
+		{
+			glm::vec3 const a = glm::linearRand(glm::vec3(-1), glm::vec3(1), A);
+			std::rand();
+			glm::vec3 const b = glm::linearRand(glm::vec3(-1), glm::vec3(1), B);
+			Error += glm::all(glm::equal(a, b)) ? 0 : 1;
+			Error += glm::all(glm::lessThanEqual(glm::abs(a), glm::vec3(1))) ? 0 : 1;
+		}
+		assert(!Error);
+	}
+
+	// Integer ranges are covered
+	{
+		glm::xoshiro128 Engine(3);
+		glm::u8vec2 AMin(255), AMax(0);
+		glm::i32vec2 BMin(100), BMax(-100);
+		for(std::size_t i = 0; i < 10000; ++i)
+		{
+			glm::u8vec2 const A = glm::linearRand(glm::u8vec2(16), glm::u8vec2(32), Engine);
+			AMin = glm::min(AMin, A);
+			AMax = glm::max(AMax, A);
+			glm::i32vec2 const B = glm::linearRand(glm::i32vec2(-16), glm::i32vec2(16), Engine);
+			BMin = glm::min(BMin, B);
+			BMax = glm::max(BMax, B);
+		}
+		Error += glm::all(glm::equal(AMin, glm::u8vec2(16))) && glm::all(glm::equal(AMax, glm::u8vec2(32))) ? 0 : 1;
+		Error += glm::all(glm::equal(BMin, glm::i32vec2(-16))) && glm::all(glm::equal(BMax, glm::i32vec2(16))) ? 0 : 1;
+		assert(!Error);
+	}
+
+	// The distributions with an engine stay in their domain
+	{
+		glm::philox4x32 Engine(11);
+		for(std::size_t i = 0; i < 1000; ++i)
+		{
+			Error += glm::length(glm::diskRand(2.0f, Engine)) <= 2.0001f ? 0 : 1;
+			Error += glm::length(glm::ballRand(2.0f, Engine)) <= 2.0001f ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(glm::circularRand(2.0f, Engine)), 2.0f, 0.0001f) ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(glm::sphericalRand(2.0f, Engine)), 2.0f, 0.0001f) ? 0 : 1;
+		}
+		assert(!Error);
+	}
+
+	return Error;
+}
+
+// Mean and variance of the uniform floats and chi-square of the bytes of the raw outputs
+template <typename engineType>
+int test_quality(engineType & Engine)
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 18;
+
+	double Sum = 0.0;
+	double SumSquare = 0.0;
+	std::size_t Buckets[256] = {0};
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::uint32 const Bits = Engine();
+		for(int Byte = 0; Byte < 4; ++Byte)
+			++Buckets[(Bits >> (Byte * 8)) & 0xFF];
+
+		double const Value = static_cast<double>(Bits) / 4294967296.0;
+		Sum += Value;
+		SumSquare += Value * Value;
+	}
+
+	double const Mean = Sum / static_cast<double>(Count);
+	double const Variance = SumSquare / static_cast<double>(Count) - Mean * Mean;
+	Error += glm::abs(Mean - 0.5) < 0.005 ? 0 : 1;
+	Error += glm::abs(Variance - 1.0 / 12.0) < 0.005 ? 0 : 1;
+
+	// 255 degrees of freedom, 350 is more than 4 standard deviations away from the expected 255
+	double const Expected = static_cast<double>(Count * 4) / 256.0;
+	double ChiSquare = 0.0;
+	for(std::size_t i = 0; i < 256; ++i)
+		ChiSquare += (static_cast<double>(Buckets[i]) - Expected) * (static_cast<double>(Buckets[i]) - Expected) / Expected;
+	Error += ChiSquare < 350.0 ? 0 : 1;
+
+	assert(!Error);
+	return Error;
+}
+
+int test_quality()
+{
+	int Error = 0;
+
+	glm::xoshiro128 Xoshiro(1234);
+	Error += test_quality(Xoshiro);
+	glm::pcg32 PCG(1234);
+	Error += test_quality(PCG);
+	glm::philox4x32 Philox(1234);
+	Error += test_quality(Philox);
+
+	return Error;
+}
+
+int test_batch()
+{
+	int Error = 0;
+
+	// A count which isn't a multiple of the batch size to cover the remaining values
+	std::size_t const Count = 10003;
+
+	{
+		glm::vec3 const Min(-1.0f, 2.0f, 10.0f);
+		glm::vec3 const Max(1.0f, 4.0f, 11.0f);
+
+		std::vector<glm::vec3> Results(Count, glm::vec3(-100.0f));
+		glm::pcg32 Engine(7);
+		glm::linearRandBatch(&Results[0], Count, Min, Max, Engine);
+
+		glm::dvec3 Sum(0.0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::greaterThanEqual(Results[i], Min)) && glm::all(glm::lessThan(Results[i], Max)) ? 0 : 1;
+			Sum += glm::dvec3(Results[i]);
+		}
+		glm::dvec3 const Mean = Sum / static_cast<double>(Count);
+		Error += glm::all(glm::epsilonEqual(Mean, glm::dvec3(Min + Max) * 0.5, 0.02)) ? 0 : 1;
+
+		// The same engine state gives the same values
+		std::vector<glm::vec3> Replay(Count);
+		glm::pcg32 Replayed(7);
+		glm::linearRandBatch(&Replay[0], Count, Min, Max, Replayed);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Results[i], Replay[i])) ? 0 : 1;
+		assert(!Error);
+	}
+
+	{
+		std::vector<float> Results(Count);
+		glm::xoshiro128 Engine(8);
+		glm::linearRandBatch(&Results[0], Count, 0.0f, 1.0f, Engine);
+
+		double Sum = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Results[i] >= 0.0f && Results[i] < 1.0f ? 0 : 1;
+			Sum += Results[i];
+		}
+		Error += glm::abs(Sum / static_cast<double>(Count) - 0.5) < 0.01 ? 0 : 1;
+		assert(!Error);
+	}
+
+	{
+		std::vector<glm::vec3> Results(Count);
+		glm::philox4x32 Engine(9);
+		glm::sphericalRandBatch(&Results[0], Count, 3.0f, Engine);
+
+		glm::dvec3 Sum(0.0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::epsilonEqual(glm::length(Results[i]), 3.0f, 0.0001f) ? 0 : 1;
+			Sum += glm::dvec3(Results[i]);
+		}
+		Error += glm::length(Sum / static_cast<double>(Count)) < 0.1 ? 0 : 1;
+		assert(!Error);
+	}
+
+	{
+		// Empty batches don't access Results, which may be null
+		glm::pcg32 Engine(10);
+		glm::linearRandBatch(static_cast<float *>(0), 0, 0.0f, 1.0f, Engine);
+		glm::linearRandBatch(static_cast<glm::vec2 *>(0), 0, glm::vec2(0.0f), glm::vec2(1.0f), Engine);
+		glm::linearRandBatch(static_cast<glm::vec3 *>(0), 0, glm::vec3(0.0f), glm::vec3(1.0f), Engine);
+		glm::linearRandBatch(static_cast<glm::vec4 *>(0), 0, glm::vec4(0.0f), glm::vec4(1.0f), Engine);
+		glm::circularRandBatch(static_cast<glm::vec2 *>(0), 0, 1.0f, Engine);
+		glm::sphericalRandBatch(static_cast<glm::vec3 *>(0), 0, 1.0f, Engine);
+	}
+
+	{
+		std::vector<glm::vec2> Results(Count);
+		glm::xoshiro128 Engine(10);
+		glm::circularRandBatch(&Results[0], Count, 0.5f, Engine);
+
+		glm::dvec2 Sum(0.0);
+		std::size_t Quadrants[4] = {0, 0, 0, 0};
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::epsilonEqual(glm::length(Results[i]), 0.5f, 0.0001f) ? 0 : 1;
+			Sum += glm::dvec2(Results[i]);
+			++Quadrants[(Results[i].x < 0.0f ? 1 : 0) + (Results[i].y < 0.0f ? 2 : 0)];
+		}
+		Error += glm::length(Sum / static_cast<double>(Count)) < 0.02 ? 0 : 1;
+		for(std::size_t i = 0; i < 4; ++i)
+			Error += Quadrants[i] > Count / 5 ? 0 : 1;
+		assert(!Error);
+	}
+
+	return Error;
+}
+
+int perf_engine()
+{
+	std::size_t const Count = 1 << 22;
+	std::vector<glm::vec4> Results(Count);
+	glm::vec4 const Min(-1.0f);
+	glm::vec4 const Max(1.0f);
+
+	std::clock_t const TimeRandStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Results[i] = glm::linearRand(Min, Max);
+	std::clock_t const TimeRandEnd = std::clock();
+
+	glm::xoshiro128 Xoshiro(1);
+	std::clock_t const TimeXoshiroStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Results[i] = glm::linearRand(Min, Max, Xoshiro);
+	std::clock_t const TimeXoshiroEnd = std::clock();
+
+	glm::pcg32 PCG(1);
+	std::clock_t const TimePCGStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Results[i] = glm::linearRand(Min, Max, PCG);
+	std::clock_t const TimePCGEnd = std::clock();
+
+	glm::philox4x32 Philox(1);
+	std::clock_t const TimePhiloxStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Results[i] = glm::linearRand(Min, Max, Philox);
+	std::clock_t const TimePhiloxEnd = std::clock();
+
+	std::clock_t const TimeBatchStart = std::clock();
+	glm::linearRandBatch(&Results[0], Count, Min, Max, Xoshiro);
+	std::clock_t const TimeBatchEnd = std::clock();
+
+	std::vector<glm::vec3> Spherical(Count);
+	std::clock_t const TimeSphericalStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Spherical[i] = glm::sphericalRand(1.0f, Xoshiro);
+	std::clock_t const TimeSphericalEnd = std::clock();
+
+	std::clock_t const TimeSphericalBatchStart = std::clock();
+	glm::sphericalRandBatch(&Spherical[0], Count, 1.0f, Xoshiro);
+	std::clock_t const TimeSphericalBatchEnd = std::clock();
+
+	double const Seconds = 1.0 / static_cast<double>(CLOCKS_PER_SEC);
+	double const Values = static_cast<double>(Count) * 1e-6;
+	std::printf("linearRand(vec4) std::rand: %.1f Mvec4/s\n", Values / (static_cast<double>(TimeRandEnd - TimeRandStart) * Seconds));
+	std::printf("linearRand(vec4) xoshiro128: %.1f Mvec4/s\n", Values / (static_cast<double>(TimeXoshiroEnd - TimeXoshiroStart) * Seconds));
+	std::printf("linearRand(vec4) pcg32: %.1f Mvec4/s\n", Values / (static_cast<double>(TimePCGEnd - TimePCGStart) * Seconds));
+	std::printf("linearRand(vec4) philox4x32: %.1f Mvec4/s\n", Values / (static_cast<double>(TimePhiloxEnd - TimePhiloxStart) * Seconds));
+	std::printf("linearRandBatch(vec4): %.1f Mvec4/s\n", Values / (static_cast<double>(TimeBatchEnd - TimeBatchStart) * Seconds));
+	std::printf("sphericalRand xoshiro128: %.1f Mvec3/s\n", Values / (static_cast<double>(TimeSphericalEnd - TimeSphericalStart) * Seconds));
+	std::printf("sphericalRandBatch: %.1f Mvec3/s\n", Values / (static_cast<double>(TimeSphericalBatchEnd - TimeSphericalBatchStart) * Seconds));
+
+	return 0;
+}
+
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -399,10 +754,18 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_gaussRand();
+	Error += test_engine();
+	Error += test_quality();
+	Error += test_batch();
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
 #endif
 */
+#	ifdef NDEBUG
+		Error += perf_engine();
+#	endif//NDEBUG
+
 	return Error;
 }
@@ -0,0 +1,380 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_approx_math.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtx/approx_math.hpp>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	typedef void (*batch_func)(float const *, float *, std::size_t);
+
+	double ref_exp2(double x) {return std::pow(2.0, x);}
+	double ref_exp(double x) {return std::exp(x);}
+	double ref_log2(double x) {return std::log(x) / std::log(2.0);}
+	double ref_log(double x) {return std::log(x);}
+	double ref_sin(double x) {return std::sin(x);}
+	double ref_cos(double x) {return std::cos(x);}
+	double ref_atan(double x) {return std::atan(x);}
+	double ref_inversesqrt(double x) {return 1.0 / std::sqrt(x);}
+
+	float libm_exp2(float x) {return std::pow(2.0f, x);}
+	float libm_exp(float x) {return std::exp(x);}
+	float libm_log2(float x) {return std::log(x) * 1.44269504f;}
+	float libm_log(float x) {return std::log(x);}
+	float libm_sin(float x) {return std::sin(x);}
+	float libm_cos(float x) {return std::cos(x);}
+	float libm_atan(float x) {return std::atan(x);}
+	float libm_inversesqrt(float x) {return 1.0f / std::sqrt(x);}
+
+	// Calls of the vec4 overloads, their address is ambiguous with the generic vector overloads
+	template <int Bits> glm::vec4 vec4_exp2(glm::vec4 const & x) {return glm::approxExp2<Bits>(x);}
+	template <int Bits> glm::vec4 vec4_exp(glm::vec4 const & x) {return glm::approxExp<Bits>(x);}
+	template <int Bits> glm::vec4 vec4_log2(glm::vec4 const & x) {return glm::approxLog2<Bits>(x);}
+	template <int Bits> glm::vec4 vec4_log(glm::vec4 const & x) {return glm::approxLog<Bits>(x);}
+	template <int Bits> glm::vec4 vec4_sin(glm::vec4 const & x) {return glm::approxSin<Bits>(x);}
+	template <int Bits> glm::vec4 vec4_cos(glm::vec4 const & x) {return glm::approxCos<Bits>(x);}
+	template <int Bits> glm::vec4 vec4_atan(glm::vec4 const & x) {return glm::approxAtan<Bits>(x);}
+	template <int Bits> glm::vec4 vec4_inversesqrt(glm::vec4 const & x) {return glm::approxInverseSqrt<Bits>(x);}
+
+	int const Bits[] = {2, 12, 22};
+
+	// The functions of the three tiers with their domain
+	struct function
+	{
+		char const * Name;
+		double (*Reference)(double);
+		float (*Libm)(float);
+		float (*Scalar[3])(float);
+		glm::vec4 (*Vector[3])(glm::vec4 const &);
+		batch_func Batch[3];
+		float Min;
+		float Max;
+		bool Geometric;	// Sweeps the bit patterns of the positive floats in [Min, Max] rather than the values
+		bool Absolute;	// The bound applies to the absolute error
+	};
+
+	function const Functions[] =
+	{
+		{"exp2", ref_exp2, libm_exp2,
+			{glm::approxExp2<2>, glm::approxExp2<12>, glm::approxExp2<22>},
+			{vec4_exp2<2>, vec4_exp2<12>, vec4_exp2<22>},
+			{glm::approxExp2Batch<2>, glm::approxExp2Batch<12>, glm::approxExp2Batch<22>},
+			-126.0f, 127.0f, false, false},
+		{"exp", ref_exp, libm_exp,
+			{glm::approxExp<2>, glm::approxExp<12>, glm::approxExp<22>},
+			{vec4_exp<2>, vec4_exp<12>, vec4_exp<22>},
+			{glm::approxExpBatch<2>, glm::approxExpBatch<12>, glm::approxExpBatch<22>},
+			-87.0f, 88.0f, false, false},
+		{"log2", ref_log2, libm_log2,
+			{glm::approxLog2<2>, glm::approxLog2<12>, glm::approxLog2<22>},
+			{vec4_log2<2>, vec4_log2<12>, vec4_log2<22>},
+			{glm::approxLog2Batch<2>, glm::approxLog2Batch<12>, glm::approxLog2Batch<22>},
+			1e-37f, 1e37f, true, false},
+		{"log", ref_log, libm_log,
+			{glm::approxLog<2>, glm::approxLog<12>, glm::approxLog<22>},
+			{vec4_log<2>, vec4_log<12>, vec4_log<22>},
+			{glm::approxLogBatch<2>, glm::approxLogBatch<12>, glm::approxLogBatch<22>},
+			1e-37f, 1e37f, true, false},
+		{"sin", ref_sin, libm_sin,
+			{glm::approxSin<2>, glm::approxSin<12>, glm::approxSin<22>},
+			{vec4_sin<2>, vec4_sin<12>, vec4_sin<22>},
+			{glm::approxSinBatch<2>, glm::approxSinBatch<12>, glm::approxSinBatch<22>},
+			-8192.0f, 8192.0f, false, true},
+		{"cos", ref_cos, libm_cos,
+			{glm::approxCos<2>, glm::approxCos<12>, glm::approxCos<22>},
+			{vec4_cos<2>, vec4_cos<12>, vec4_cos<22>},
+			{glm::approxCosBatch<2>, glm::approxCosBatch<12>, glm::approxCosBatch<22>},
+			-8192.0f, 8192.0f, false, true},
+		{"atan", ref_atan, libm_atan,
+			{glm::approxAtan<2>, glm::approxAtan<12>, glm::approxAtan<22>},
+			{vec4_atan<2>, vec4_atan<12>, vec4_atan<22>},
+			{glm::approxAtanBatch<2>, glm::approxAtanBatch<12>, glm::approxAtanBatch<22>},
+			-1e6f, 1e6f, false, false},
+		{"inversesqrt", ref_inversesqrt, libm_inversesqrt,
+			{glm::approxInverseSqrt<2>, glm::approxInverseSqrt<12>, glm::approxInverseSqrt<22>},
+			{vec4_inversesqrt<2>, vec4_inversesqrt<12>, vec4_inversesqrt<22>},
+			{glm::approxInverseSqrtBatch<2>, glm::approxInverseSqrtBatch<12>, glm::approxInverseSqrtBatch<22>},
+			1e-37f, 1e37f, true, false}
+	};
+
+	std::size_t const FunctionCount = sizeof(Functions) / sizeof(Functions[0]);
+
+	std::vector<float> sweep(function const & Func, std::size_t Count)
+	{
+		std::vector<float> Samples(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double const a = static_cast<double>(i) / static_cast<double>(Count - 1);
+			if(Func.Geometric)
+			{
+				double const First = static_cast<double>(glm::floatBitsToUint(Func.Min));
+				double const Last = static_cast<double>(glm::floatBitsToUint(Func.Max));
+				Samples[i] = glm::uintBitsToFloat(static_cast<glm::uint>(First + (Last - First) * a));
+			}
+			else
+				Samples[i] = static_cast<float>(Func.Min + (Func.Max - Func.Min) * a);
+		}
+		return Samples;
+	}
+
+	// Size of the unit in the last place of the float closest to x
+	double ulp(double x)
+	{
+		int Exponent = 0;
+		std::frexp(x, &Exponent);
+		return std::ldexp(1.0, glm::max(Exponent, -125) - 24);
+	}
+
+	struct error
+	{
+		double Max;		// Largest relative or absolute error
+		double Ulps;	// Largest distance to the exact result in units in the last place
+	};
+
+	void accumulate(error & Error, float Result, double Reference, bool Absolute)
+	{
+		double const Diff = std::abs(static_cast<double>(Result) - Reference);
+		if(Diff == 0.0)
+			return;
+		Error.Max = glm::max(Error.Max, Absolute ? Diff : Diff / std::abs(Reference));
+		Error.Ulps = glm::max(Error.Ulps, Diff / ulp(Reference));
+	}
+
+	// Measures the error of each path of a tier over a sweep of the domain
+	int check(function const & Func, int Tier, std::vector<float> const & Samples, std::vector<double> const & References)
+	{
+		int Error = 0;
+		double const Bound = std::ldexp(1.0, -Bits[Tier]);
+		std::size_t const Count = Samples.size();
+		std::vector<float> Results(Count);
+
+		error Scalar = {0.0, 0.0};
+		for(std::size_t i = 0; i < Count; ++i)
+			accumulate(Scalar, Func.Scalar[Tier](Samples[i]), References[i], Func.Absolute);
+		if(Scalar.Max > Bound)
+		{
+			std::printf("approx %s<%d> scalar: error %g above %g\n", Func.Name, Bits[Tier], Scalar.Max, Bound);
+			++Error;
+		}
+
+		error Vector = {0.0, 0.0};
+		for(std::size_t i = 0; i + 4 <= Count; i += 4)
+		{
+			glm::vec4 const v = Func.Vector[Tier](glm::vec4(Samples[i + 0], Samples[i + 1], Samples[i + 2], Samples[i + 3]));
+			for(glm::length_t j = 0; j < 4; ++j)
+				accumulate(Vector, v[j], References[i + j], Func.Absolute);
+		}
+		if(Vector.Max > Bound)
+		{
+			std::printf("approx %s<%d> vec4: error %g above %g\n", Func.Name, Bits[Tier], Vector.Max, Bound);
+			++Error;
+		}
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			Func.Batch[Tier](&Samples[0], &Results[0], Count);
+			error Batch = {0.0, 0.0};
+			for(std::size_t i = 0; i < Count; ++i)
+				accumulate(Batch, Results[i], References[i], Func.Absolute);
+			if(Batch.Max > Bound)
+			{
+				std::printf("approx %s<%d> batch at the %s level: error %g above %g\n", Func.Name, Bits[Tier], glm::simdLevelName(static_cast<glm::simd_level>(Level)), Batch.Max, Bound);
+				++Error;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+}//namespace
+
+namespace accuracy
+{
+	int test()
+	{
+		int Error = 0;
+
+		// Not a multiple of the SIMD width, to cover the remaining values
+		std::size_t const Count = (1 << 16) + 3;
+		for(std::size_t f = 0; f < FunctionCount; ++f)
+		{
+			std::vector<float> const Samples(sweep(Functions[f], Count));
+			std::vector<double> References(Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				References[i] = Functions[f].Reference(static_cast<double>(Samples[i]));
+
+			for(int Tier = 0; Tier < 3; ++Tier)
+				Error += check(Functions[f], Tier, Samples, References);
+		}
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 22;
+		std::vector<float> Results(Count);
+
+		for(std::size_t f = 0; f < FunctionCount; ++f)
+		{
+			std::vector<float> const Samples(sweep(Functions[f], Count));
+			for(int Tier = 0; Tier < 3; ++Tier)
+			{
+				Functions[f].Batch[Tier](&Samples[0], &Results[0], Count);
+				error Error = {0.0, 0.0};
+				for(std::size_t i = 0; i < Count; ++i)
+					accumulate(Error, Results[i], Functions[f].Reference(static_cast<double>(Samples[i])), Functions[f].Absolute);
+				std::printf("approx %s<%d>: %s error %.2e, %.1f ULPs\n", Functions[f].Name, Bits[Tier], Functions[f].Absolute ? "absolute" : "relative", Error.Max, Error.Ulps);
+			}
+		}
+
+		return 0;
+	}
+}//namespace accuracy
+
+namespace power
+{
+	// The error of pow grows with the magnitude of y * log2(x)
+	int test()
+	{
+		int Error = 0;
+
+		std::size_t const Count = 4099;
+		std::vector<float> X(Count), Y(Count), Results(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = std::pow(2.0f, static_cast<float>(i % 97) / 8.0f - 6.0f);
+			Y[i] = static_cast<float>(i % 89) / 11.0f - 4.0f;
+		}
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Tier = 0; Tier < 3; ++Tier)
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			switch(Tier)
+			{
+			case 0: glm::approxPowBatch<2>(&X[0], &Y[0], &Results[0], Count); break;
+			case 1: glm::approxPowBatch<12>(&X[0], &Y[0], &Results[0], Count); break;
+			default: glm::approxPowBatch<22>(&X[0], &Y[0], &Results[0], Count); break;
+			}
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				double const Exponent = static_cast<double>(Y[i]) * std::log(static_cast<double>(X[i])) / std::log(2.0);
+				double const Bound = std::ldexp(1.0, -Bits[Tier]) * (1.0 + std::abs(Exponent) * std::log(2.0));
+				double const Reference = std::pow(static_cast<double>(X[i]), static_cast<double>(Y[i]));
+				Error += std::abs(static_cast<double>(Results[i]) - Reference) <= Bound * Reference ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		glm::vec4 const x(0.5f, 2.0f, 3.0f, 10.0f);
+		glm::vec4 const y(2.0f, 0.5f, -1.0f, 3.0f);
+		glm::vec4 const Exact(0.25f, std::sqrt(2.0f), 1.0f / 3.0f, 1000.0f);
+		Error += glm::all(glm::lessThan(glm::abs(glm::approxPow<22>(x, y) - Exact), Exact * 1e-5f)) ? 0 : 1;
+		Error += glm::all(glm::lessThan(glm::abs(glm::approxPow<12>(glm::vec3(x), glm::vec3(y)) - glm::vec3(Exact)), glm::vec3(Exact) * 1e-2f)) ? 0 : 1;
+		Error += std::abs(glm::approxPow<22>(2.0f, 10.0f) - 1024.0f) < 1e-3f ? 0 : 1;
+
+		return Error;
+	}
+}//namespace power
+
+namespace throughput
+{
+	double rate(std::size_t Count, std::clock_t Start, std::clock_t End)
+	{
+		double const Time = static_cast<double>(End - Start) / CLOCKS_PER_SEC;
+		return Time > 0.0 ? static_cast<double>(Count) / Time * 1e-6 : 0.0;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 22;
+		std::vector<float> Results(Count);
+		float Sum = 0.0f;
+
+		for(std::size_t f = 0; f < FunctionCount; ++f)
+		{
+			function const & Func = Functions[f];
+			std::vector<float> const Samples(sweep(Func, Count));
+
+			std::clock_t const TimeLibmStart = std::clock();
+			for(std::size_t i = 0; i < Count; ++i)
+				Results[i] = Func.Libm(Samples[i]);
+			std::clock_t const TimeLibmEnd = std::clock();
+			Sum += Results[Count / 2];
+
+			std::printf("%s: libm %.0f M/s", Func.Name, rate(Count, TimeLibmStart, TimeLibmEnd));
+
+			glm::simd_level const Max = glm::simdMaxLevel();
+			for(int Tier = 0; Tier < 3; ++Tier)
+			for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; Level += Max > glm::SIMD_LEVEL_PURE ? Max - glm::SIMD_LEVEL_PURE : 1)
+			{
+				glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+				std::clock_t const TimeStart = std::clock();
+				Func.Batch[Tier](&Samples[0], &Results[0], Count);
+				std::clock_t const TimeEnd = std::clock();
+				Sum += Results[Count / 2];
+
+				std::printf(", %d bits %s %.0f M/s", Bits[Tier], glm::simdLevelName(static_cast<glm::simd_level>(Level)), rate(Count, TimeStart, TimeEnd));
+			}
+			glm::simdForceLevel(Max);
+			std::printf("\n");
+		}
+
+		return glm::isnan(Sum) ? 1 : 0;
+	}
+}//namespace throughput
+
+int main()
+{
+	int Error(0);
+
+	Error += accuracy::test();
+	Error += power::test();
+
+#	ifdef NDEBUG
+		Error += accuracy::perf();
+		Error += throughput::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
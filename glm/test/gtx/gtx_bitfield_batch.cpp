@@ -0,0 +1,358 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_bitfield_batch.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/bitfield.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/bitfield_batch.hpp>
+#include <algorithm>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	std::vector<glm::u16vec3> make_u16vec3(std::size_t Count)
+	{
+		glm::pcg32 Engine(1);
+		std::vector<glm::u16vec3> Data(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint32 const Bits = Engine();
+			Data[i] = glm::u16vec3(static_cast<glm::uint16>(Bits), static_cast<glm::uint16>(Bits >> 16), static_cast<glm::uint16>(Engine()));
+		}
+		return Data;
+	}
+
+	std::vector<glm::u32vec2> make_u32vec2(std::size_t Count)
+	{
+		glm::pcg32 Engine(2);
+		std::vector<glm::u32vec2> Data(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint32 const x = Engine();
+			glm::uint32 const y = Engine();
+			Data[i] = glm::u32vec2(x, y);
+		}
+		return Data;
+	}
+}//namespace
+
+namespace interleave
+{
+	int test()
+	{
+		int Error(0);
+
+		// An odd count to exercise the remainders of the packets
+		std::size_t const Count = 1027;
+		std::vector<glm::u16vec3> const Src3 = make_u16vec3(Count);
+		std::vector<glm::u32vec2> const Src2 = make_u32vec2(Count);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::uint64> Keys3(Count);
+			std::vector<glm::uint64> Keys2(Count);
+			glm::bitfieldInterleaveBatch(&Src3[0], &Keys3[0], Count);
+			glm::bitfieldInterleaveBatch(&Src2[0], &Keys2[0], Count);
+
+			std::vector<glm::u16vec3> Dst3(Count);
+			std::vector<glm::u32vec2> Dst2(Count);
+			glm::bitfieldDeinterleaveBatch(&Keys3[0], &Dst3[0], Count);
+			glm::bitfieldDeinterleaveBatch(&Keys2[0], &Dst2[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += Keys3[i] == glm::bitfieldInterleave(Src3[i].x, Src3[i].y, Src3[i].z) ? 0 : 1;
+				Error += Keys2[i] == glm::bitfieldInterleave(Src2[i].x, Src2[i].y) ? 0 : 1;
+				Error += Dst3[i] == Src3[i] ? 0 : 1;
+				Error += Dst2[i] == Src2[i] ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 22;
+		std::size_t const Passes = 8;
+
+		std::vector<glm::u16vec3> Src3 = make_u16vec3(Count);
+		std::vector<glm::u32vec2> Src2 = make_u32vec2(Count);
+		std::vector<glm::uint64> Keys(Count);
+		double const Elements = static_cast<double>(Count * Passes);
+
+		std::clock_t const TimeScalarStart = std::clock();
+		for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+		for(std::size_t i = 0; i < Count; ++i)
+			Keys[i] = glm::bitfieldInterleave(Src3[i].x, Src3[i].y, Src3[i].z);
+		std::clock_t const TimeScalarEnd = std::clock();
+
+		double const ScalarTime = static_cast<double>(TimeScalarEnd - TimeScalarStart) / CLOCKS_PER_SEC;
+		std::printf("bitfieldInterleave u16vec3: %.1f M keys/s\n", ScalarTime > 0.0 ? Elements / ScalarTime * 1e-6 : 0.0);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeEncode3Start = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::bitfieldInterleaveBatch(&Src3[0], &Keys[0], Count);
+			std::clock_t const TimeEncode3End = std::clock();
+
+			std::clock_t const TimeDecode3Start = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::bitfieldDeinterleaveBatch(&Keys[0], &Src3[0], Count);
+			std::clock_t const TimeDecode3End = std::clock();
+
+			std::clock_t const TimeEncode2Start = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::bitfieldInterleaveBatch(&Src2[0], &Keys[0], Count);
+			std::clock_t const TimeEncode2End = std::clock();
+
+			std::clock_t const TimeDecode2Start = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::bitfieldDeinterleaveBatch(&Keys[0], &Src2[0], Count);
+			std::clock_t const TimeDecode2End = std::clock();
+
+			double const Encode3Time = static_cast<double>(TimeEncode3End - TimeEncode3Start) / CLOCKS_PER_SEC;
+			double const Decode3Time = static_cast<double>(TimeDecode3End - TimeDecode3Start) / CLOCKS_PER_SEC;
+			double const Encode2Time = static_cast<double>(TimeEncode2End - TimeEncode2Start) / CLOCKS_PER_SEC;
+			double const Decode2Time = static_cast<double>(TimeDecode2End - TimeDecode2Start) / CLOCKS_PER_SEC;
+			char const * Name = glm::simdLevelName(glm::simdLevel());
+			std::printf("bitfieldInterleaveBatch u16vec3 at the %s level: %.1f M keys/s\n", Name, Encode3Time > 0.0 ? Elements / Encode3Time * 1e-6 : 0.0);
+			std::printf("bitfieldDeinterleaveBatch u16vec3 at the %s level: %.1f M keys/s\n", Name, Decode3Time > 0.0 ? Elements / Decode3Time * 1e-6 : 0.0);
+			std::printf("bitfieldInterleaveBatch u32vec2 at the %s level: %.1f M keys/s\n", Name, Encode2Time > 0.0 ? Elements / Encode2Time * 1e-6 : 0.0);
+			std::printf("bitfieldDeinterleaveBatch u32vec2 at the %s level: %.1f M keys/s\n", Name, Decode2Time > 0.0 ? Elements / Decode2Time * 1e-6 : 0.0);
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace interleave
+
+namespace sort
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 5000;
+		std::vector<glm::u16vec3> const Src = make_u16vec3(Count);
+
+		std::vector<glm::uint64> Keys(Count);
+		glm::bitfieldInterleaveBatch(&Src[0], &Keys[0], Count);
+
+		// Duplicated keys to check the stability of the sort
+		for(std::size_t i = 0; i < Count; i += 10)
+			Keys[i + 1] = Keys[i];
+
+		std::vector<glm::uint32> Indices(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Indices[i] = static_cast<glm::uint32>(i);
+
+		std::vector<glm::uint64> const Unsorted(Keys);
+		std::vector<glm::uint64> Expected(Keys);
+		std::sort(Expected.begin(), Expected.end());
+
+		glm::sortInterleaved(&Keys[0], &Indices[0], Count);
+		Error += Keys == Expected ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Unsorted[Indices[i]] == Keys[i] ? 0 : 1;
+		for(std::size_t i = 1; i < Count; ++i)
+			Error += Keys[i - 1] != Keys[i] || Indices[i - 1] < Indices[i] ? 0 : 1;
+
+		// Keys sharing their high bytes, the corresponding passes are skipped
+		std::vector<glm::uint64> Small(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Small[i] = (Count - i) * 7 % 1021;
+		std::vector<glm::uint64> SmallExpected(Small);
+		std::sort(SmallExpected.begin(), SmallExpected.end());
+		glm::sortInterleaved(&Small[0], 0, Count);
+		Error += Small == SmallExpected ? 0 : 1;
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 22;
+
+		std::vector<glm::u16vec3> const Src = make_u16vec3(Count);
+		std::vector<glm::uint64> Keys(Count);
+		glm::bitfieldInterleaveBatch(&Src[0], &Keys[0], Count);
+		std::vector<glm::uint64> Copy(Keys);
+
+		std::vector<glm::uint32> Indices(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Indices[i] = static_cast<glm::uint32>(i);
+
+		std::clock_t const TimeRadixStart = std::clock();
+		glm::sortInterleaved(&Keys[0], &Indices[0], Count);
+		std::clock_t const TimeRadixEnd = std::clock();
+
+		std::clock_t const TimeStdStart = std::clock();
+		std::sort(Copy.begin(), Copy.end());
+		std::clock_t const TimeStdEnd = std::clock();
+
+		double const Elements = static_cast<double>(Count);
+		double const RadixTime = static_cast<double>(TimeRadixEnd - TimeRadixStart) / CLOCKS_PER_SEC;
+		double const StdTime = static_cast<double>(TimeStdEnd - TimeStdStart) / CLOCKS_PER_SEC;
+		std::printf("sortInterleaved with indices: %.1f M keys/s\n", RadixTime > 0.0 ? Elements / RadixTime * 1e-6 : 0.0);
+		std::printf("std::sort: %.1f M keys/s\n", StdTime > 0.0 ? Elements / StdTime * 1e-6 : 0.0);
+
+		return Keys == Copy ? 0 : 1;
+	}
+}//namespace sort
+
+namespace bit
+{
+	std::vector<glm::uint32> make_uint32(std::size_t Count)
+	{
+		glm::pcg32 Engine(3);
+		std::vector<glm::uint32> Data(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			// Varying magnitudes, zeros and powers of two
+			glm::uint32 const Bits = Engine();
+			Data[i] = i % 7 == 0 ? 0 : i % 5 == 0 ? 1u << (i % 32) : Bits >> (i % 32);
+		}
+		return Data;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		std::vector<glm::uint32> const Src = make_uint32(Count);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<int> BitCount(Count), LSB(Count), MSB(Count);
+			std::vector<glm::uint32> Reverse(Count);
+			glm::bitCountBatch(&Src[0], &BitCount[0], Count);
+			glm::findLSBBatch(&Src[0], &LSB[0], Count);
+			glm::findMSBBatch(&Src[0], &MSB[0], Count);
+			glm::bitfieldReverseBatch(&Src[0], &Reverse[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += BitCount[i] == glm::bitCount(Src[i]) ? 0 : 1;
+				Error += LSB[i] == glm::findLSB(Src[i]) ? 0 : 1;
+				Error += MSB[i] == glm::findMSB(Src[i]) ? 0 : 1;
+				Error += Reverse[i] == glm::bitfieldReverse(Src[i]) ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 22;
+		std::size_t const Passes = 16;
+
+		std::vector<glm::uint32> const Src = make_uint32(Count);
+		std::vector<int> Dst(Count);
+		std::vector<glm::uint32> Reverse(Count);
+		double const Elements = static_cast<double>(Count * Passes);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeBitCountStart = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::bitCountBatch(&Src[0], &Dst[0], Count);
+			std::clock_t const TimeBitCountEnd = std::clock();
+
+			std::clock_t const TimeFindLSBStart = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::findLSBBatch(&Src[0], &Dst[0], Count);
+			std::clock_t const TimeFindLSBEnd = std::clock();
+
+			std::clock_t const TimeFindMSBStart = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::findMSBBatch(&Src[0], &Dst[0], Count);
+			std::clock_t const TimeFindMSBEnd = std::clock();
+
+			std::clock_t const TimeReverseStart = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::bitfieldReverseBatch(&Src[0], &Reverse[0], Count);
+			std::clock_t const TimeReverseEnd = std::clock();
+
+			double const BitCountTime = static_cast<double>(TimeBitCountEnd - TimeBitCountStart) / CLOCKS_PER_SEC;
+			double const FindLSBTime = static_cast<double>(TimeFindLSBEnd - TimeFindLSBStart) / CLOCKS_PER_SEC;
+			double const FindMSBTime = static_cast<double>(TimeFindMSBEnd - TimeFindMSBStart) / CLOCKS_PER_SEC;
+			double const ReverseTime = static_cast<double>(TimeReverseEnd - TimeReverseStart) / CLOCKS_PER_SEC;
+			char const * Name = glm::simdLevelName(glm::simdLevel());
+			std::printf("bitCountBatch at the %s level: %.1f M/s\n", Name, BitCountTime > 0.0 ? Elements / BitCountTime * 1e-6 : 0.0);
+			std::printf("findLSBBatch at the %s level: %.1f M/s\n", Name, FindLSBTime > 0.0 ? Elements / FindLSBTime * 1e-6 : 0.0);
+			std::printf("findMSBBatch at the %s level: %.1f M/s\n", Name, FindMSBTime > 0.0 ? Elements / FindMSBTime * 1e-6 : 0.0);
+			std::printf("bitfieldReverseBatch at the %s level: %.1f M/s\n", Name, ReverseTime > 0.0 ? Elements / ReverseTime * 1e-6 : 0.0);
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace bit
+
+int main()
+{
+	int Error(0);
+
+	Error += interleave::test();
+	Error += sort::test();
+	Error += bit::test();
+
+#	ifdef NDEBUG
+		Error += interleave::perf();
+		Error += sort::perf();
+		Error += bit::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
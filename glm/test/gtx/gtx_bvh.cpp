@@ -0,0 +1,503 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @file test/gtx/gtx_bvh.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/bvh.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <algorithm>
+#include <ctime>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	// Indexed torus of Rings * Sides * 2 triangles, 24 * 24 matches the size of the mesh of the Android sample
+	void make_torus(std::size_t Rings, std::size_t Sides, std::vector<glm::vec3> & Vertices, std::vector<glm::uint32> & Indices)
+	{
+		for(std::size_t i = 0; i < Rings; ++i)
+		for(std::size_t j = 0; j < Sides; ++j)
+		{
+			float const u = glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(Rings);
+			float const v = glm::two_pi<float>() * static_cast<float>(j) / static_cast<float>(Sides);
+			float const r = 1.0f + 0.4f * glm::cos(v);
+			Vertices.push_back(glm::vec3(r * glm::cos(u), 0.4f * glm::sin(v), r * glm::sin(u)));
+		}
+
+		for(std::size_t i = 0; i < Rings; ++i)
+		for(std::size_t j = 0; j < Sides; ++j)
+		{
+			glm::uint32 const a = static_cast<glm::uint32>(i * Sides + j);
+			glm::uint32 const b = static_cast<glm::uint32>(((i + 1) % Rings) * Sides + j);
+			glm::uint32 const c = static_cast<glm::uint32>(((i + 1) % Rings) * Sides + (j + 1) % Sides);
+			glm::uint32 const d = static_cast<glm::uint32>(i * Sides + (j + 1) % Sides);
+			glm::uint32 const Quad[] = {a, b, c, a, c, d};
+			Indices.insert(Indices.end(), Quad, Quad + 6);
+		}
+	}
+
+	std::vector<glm::vec3> make_soup(std::vector<glm::vec3> const & Vertices, std::vector<glm::uint32> const & Indices)
+	{
+		std::vector<glm::vec3> Soup(Indices.size());
+		for(std::size_t i = 0; i < Indices.size(); ++i)
+			Soup[i] = Vertices[Indices[i]];
+		return Soup;
+	}
+
+	// Small triangles scattered in a cube, overlapping each other
+	std::vector<glm::vec3> make_random_soup(std::size_t TriangleCount)
+	{
+		glm::pcg32 Engine(1);
+		std::vector<glm::vec3> Soup;
+		for(std::size_t i = 0; i < TriangleCount; ++i)
+		{
+			glm::vec3 const Center(glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine));
+			Soup.push_back(Center + glm::linearRand(glm::vec3(-0.2f), glm::vec3(0.2f), Engine));
+			Soup.push_back(Center + glm::linearRand(glm::vec3(-0.2f), glm::vec3(0.2f), Engine));
+			Soup.push_back(Center + glm::linearRand(glm::vec3(-0.2f), glm::vec3(0.2f), Engine));
+		}
+		return Soup;
+	}
+
+	// Two sided closest intersection with intersectRayTriangle
+	bool brute_force(std::vector<glm::vec3> const & Soup, glm::vec3 const & Origin, glm::vec3 const & Direction, float MaxDistance, float & Distance)
+	{
+		Distance = MaxDistance;
+		bool Result = false;
+		for(std::size_t i = 0; i < Soup.size(); i += 3)
+		{
+			glm::vec3 Front, Back;
+			if(glm::intersectRayTriangle(Origin, Direction, Soup[i + 0], Soup[i + 1], Soup[i + 2], Front) && Front.z <= Distance)
+			{
+				Distance = Front.z;
+				Result = true;
+			}
+			if(glm::intersectRayTriangle(Origin, Direction, Soup[i + 0], Soup[i + 2], Soup[i + 1], Back) && Back.z <= Distance)
+			{
+				Distance = Back.z;
+				Result = true;
+			}
+		}
+		return Result;
+	}
+
+	int check_hit(std::vector<glm::vec3> const & Soup, glm::vec3 const & Origin, glm::vec3 const & Direction, bool Result, glm::bvh_hit const & Hit)
+	{
+		if(!Result)
+			return Hit.Triangle == glm::bvh_node::inner ? 0 : 1;
+
+		// The hit point computed from the barycentric coordinates is on the ray
+		glm::vec3 const & V0 = Soup[Hit.Triangle * 3 + 0];
+		glm::vec3 const & V1 = Soup[Hit.Triangle * 3 + 1];
+		glm::vec3 const & V2 = Soup[Hit.Triangle * 3 + 2];
+		glm::vec3 const Surface(V0 + (V1 - V0) * Hit.Barycentric.x + (V2 - V0) * Hit.Barycentric.y);
+		return glm::distance(Surface, Origin + Direction * Hit.Distance) < 0.001f ? 0 : 1;
+	}
+
+	// Depth of the tree, from the skip indices of the flattened nodes
+	std::size_t depth(glm::bvh const & Bvh)
+	{
+		std::vector<glm::uint32> Ends;
+		std::size_t Result(0);
+		for(glm::uint32 i = 0; i < Bvh.Nodes.size(); ++i)
+		{
+			while(!Ends.empty() && Ends.back() <= i)
+				Ends.pop_back();
+			Ends.push_back(Bvh.Nodes[i].Skip);
+			Result = std::max(Result, Ends.size());
+		}
+		return Result;
+	}
+}//namespace
+
+namespace ray
+{
+	int test(std::vector<glm::vec3> const & Soup)
+	{
+		int Error(0);
+
+		glm::bvh Bvh;
+		glm::bvhBuild(&Soup[0], Soup.size() / 3, Bvh);
+
+		glm::pcg32 Engine(2);
+		for(std::size_t i = 0; i < 2000; ++i)
+		{
+			glm::vec3 const Origin(glm::linearRand(glm::vec3(-3.0f), glm::vec3(3.0f), Engine));
+			glm::vec3 const Direction(glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine));
+
+			glm::bvh_hit Hit;
+			bool const Result = glm::bvhIntersectRay(Bvh, Origin, Direction, Hit);
+
+			float Distance(0.0f);
+			bool const Expected = brute_force(Soup, Origin, Direction, std::numeric_limits<float>::max(), Distance);
+
+			Error += Result == Expected ? 0 : 1;
+			Error += !Result || glm::abs(Hit.Distance - Distance) <= 0.0001f * Distance ? 0 : 1;
+			Error += check_hit(Soup, Origin, Direction, Result, Hit);
+		}
+
+		return Error;
+	}
+
+	int test_segment(std::vector<glm::vec3> const & Soup)
+	{
+		int Error(0);
+
+		glm::bvh Bvh;
+		glm::bvhBuild(&Soup[0], Soup.size() / 3, Bvh);
+
+		glm::pcg32 Engine(3);
+		for(std::size_t i = 0; i < 2000; ++i)
+		{
+			glm::vec3 const P0(glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine));
+			glm::vec3 const P1(P0 + glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine));
+
+			glm::bvh_hit Hit;
+			bool const Result = glm::bvhIntersectSegment(Bvh, P0, P1, Hit);
+
+			float Distance(0.0f);
+			bool const Expected = brute_force(Soup, P0, P1 - P0, 1.0f, Distance) && Distance < 1.0f;
+
+			// Ignore the segments ending on a triangle
+			if(Result != Expected && glm::abs(Distance - 1.0f) < 0.0001f)
+				continue;
+
+			Error += Result == Expected ? 0 : 1;
+			Error += !Result || glm::abs(Hit.Distance - Distance) <= 0.0001f ? 0 : 1;
+			Error += !Result || Hit.Distance <= 1.0f ? 0 : 1;
+			Error += check_hit(Soup, P0, P1 - P0, Result, Hit);
+		}
+
+		return Error;
+	}
+
+	int test_indexed()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> Vertices;
+		std::vector<glm::uint32> Indices;
+		make_torus(24, 24, Vertices, Indices);
+		std::vector<glm::vec3> const Soup = make_soup(Vertices, Indices);
+
+		glm::bvh Indexed, Unindexed;
+		glm::bvhBuild(&Vertices[0], &Indices[0], Indices.size() / 3, Indexed);
+		glm::bvhBuild(&Soup[0], Soup.size() / 3, Unindexed);
+
+		Error += Indexed.Nodes.size() == Unindexed.Nodes.size() ? 0 : 1;
+		Error += Indexed.Leaves.size() == Unindexed.Leaves.size() ? 0 : 1;
+
+		// A ray along the y axis through the tube hits the top of the torus
+		glm::bvh_hit Hit;
+		Error += glm::bvhIntersectRay(Indexed, glm::vec3(1.0f, 2.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f), Hit) ? 0 : 1;
+		Error += glm::abs(Hit.Distance - 1.6f) < 0.01f ? 0 : 1;
+
+		// Through the hole
+		Error += glm::bvhIntersectRay(Indexed, glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f), Hit) ? 1 : 0;
+		Error += Hit.Triangle == glm::bvh_node::inner ? 0 : 1;
+
+		// Empty mesh
+		glm::bvh Empty;
+		glm::bvhBuild(&Vertices[0], 0, Empty);
+		Error += glm::bvhIntersectRay(Empty, glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f), Hit) ? 1 : 0;
+
+		return Error;
+	}
+
+	// Triangles sharing one centroid, groups of triangles spaced geometrically so that the surface
+	// area heuristic peels a few groups at each level, and centroids a denormal apart
+	int test_degenerate()
+	{
+		int Error(0);
+
+		std::size_t const Count = 20000;
+		std::vector<glm::vec3> Soup;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Soup.push_back(glm::vec3(-0.5f, -0.5f, 0.0f));
+			Soup.push_back(glm::vec3(0.5f, -0.5f, 0.0f));
+			Soup.push_back(glm::vec3(0.0f, 0.5f, 0.0f));
+		}
+
+		glm::bvh Bvh;
+		glm::bvhBuild(&Soup[0], Count, Bvh);
+		Error += Bvh.Leaves.size() >= Count / 4 ? 0 : 1;
+		Error += depth(Bvh) <= 14 ? 0 : 1;
+
+		glm::bvh_hit Hit;
+		Error += glm::bvhIntersectRay(Bvh, glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), Hit) ? 0 : 1;
+		Error += glm::abs(Hit.Distance - 1.0f) < 0.0001f ? 0 : 1;
+		Error += Hit.Triangle < Count ? 0 : 1;
+
+		std::size_t const Groups = 120;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const x = glm::exp2(static_cast<float>(i % Groups));
+			Soup[i * 3 + 0] = glm::vec3(x - 0.5f, -0.5f, 0.0f);
+			Soup[i * 3 + 1] = glm::vec3(x + 0.5f, -0.5f, 0.0f);
+			Soup[i * 3 + 2] = glm::vec3(x, 0.5f, 0.0f);
+		}
+
+		glm::bvhBuild(&Soup[0], Count, Bvh);
+		Error += depth(Bvh) <= glm::detail::BVH_SAH_DEPTH + 16 ? 0 : 1;
+
+		for(std::size_t i = 0; i < 16; ++i)
+		{
+			glm::vec3 const Origin(glm::exp2(static_cast<float>(i)), 0.0f, 1.0f);
+			Error += glm::bvhIntersectRay(Bvh, Origin, glm::vec3(0.0f, 0.0f, -1.0f), Hit) ? 0 : 1;
+			Error += glm::abs(Hit.Distance - 1.0f) < 0.0001f ? 0 : 1;
+			Error += check_hit(Soup, Origin, glm::vec3(0.0f, 0.0f, -1.0f), true, Hit);
+		}
+
+		// Centroids closer than the range of the bins, in planes x = 0 and x = the smallest denormal
+		float const Denormal = std::numeric_limits<float>::denorm_min();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const x = i & 1 ? Denormal : 0.0f;
+			Soup[i * 3 + 0] = glm::vec3(x, -0.5f, -0.5f);
+			Soup[i * 3 + 1] = glm::vec3(x, 0.5f, -0.5f);
+			Soup[i * 3 + 2] = glm::vec3(x, 0.0f, 0.5f);
+		}
+
+		glm::bvhBuild(&Soup[0], Count, Bvh);
+		Error += depth(Bvh) <= 14 ? 0 : 1;
+		Error += glm::bvhIntersectRay(Bvh, glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f), Hit) ? 0 : 1;
+		Error += glm::abs(Hit.Distance - 1.0f) < 0.0001f ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_batch(std::vector<glm::vec3> const & Soup)
+	{
+		int Error(0);
+
+		glm::bvh Bvh;
+		glm::bvhBuild(&Soup[0], Soup.size() / 3, Bvh);
+
+		std::size_t const Count = 1000;
+		glm::pcg32 Engine(4);
+		std::vector<glm::vec3> Origins(Count), Directions(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Origins[i] = glm::linearRand(glm::vec3(-3.0f), glm::vec3(3.0f), Engine);
+			Directions[i] = -Origins[i] + glm::linearRand(glm::vec3(-0.5f), glm::vec3(0.5f), Engine);
+		}
+
+		std::vector<glm::bvh_hit> Hits(Count);
+		std::size_t const HitCount = glm::bvhIntersectRayBatch(Bvh, &Origins[0], &Directions[0], &Hits[0], Count);
+
+		std::size_t Expected(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::bvh_hit Hit;
+			bool const Result = glm::bvhIntersectRay(Bvh, Origins[i], Directions[i], Hit);
+			Expected += Result ? 1 : 0;
+			Error += Hits[i].Triangle == Hit.Triangle ? 0 : 1;
+			Error += !Result || Hits[i].Distance == Hit.Distance ? 0 : 1;
+		}
+		Error += HitCount == Expected ? 0 : 1;
+		Error += HitCount > 0 ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> Vertices;
+		std::vector<glm::uint32> Indices;
+		make_torus(24, 24, Vertices, Indices);
+		std::vector<glm::vec3> const Torus = make_soup(Vertices, Indices);
+		std::vector<glm::vec3> const Random = make_random_soup(1000);
+
+		Error += test(Torus);
+		Error += test(Random);
+		Error += test_segment(Torus);
+		Error += test_segment(Random);
+		Error += test_indexed();
+		Error += test_degenerate();
+		Error += test_batch(Random);
+
+		return Error;
+	}
+}//namespace ray
+
+namespace overlap
+{
+	int test(std::vector<glm::vec3> const & Soup)
+	{
+		int Error(0);
+
+		glm::bvh Bvh;
+		glm::bvhBuild(&Soup[0], Soup.size() / 3, Bvh);
+
+		glm::pcg32 Engine(5);
+		std::vector<glm::uint32> Triangles, Expected;
+		for(std::size_t i = 0; i < 200; ++i)
+		{
+			glm::vec3 const Center(glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine));
+			float const Radius = glm::linearRand(0.0f, 0.5f, Engine);
+			glm::vec3 const Extent(glm::linearRand(glm::vec3(0.0f), glm::vec3(0.5f), Engine));
+
+			Triangles.clear();
+			Expected.clear();
+			std::size_t const Count = glm::bvhIntersectSphere(Bvh, Center, Radius, Triangles);
+			for(std::size_t t = 0; t < Soup.size() / 3; ++t)
+			{
+				glm::vec3 const Closest = glm::detail::bvh_closest_point(Center, Soup[t * 3 + 0], Soup[t * 3 + 1], Soup[t * 3 + 2]);
+				if(glm::distance(Closest, Center) <= Radius)
+					Expected.push_back(static_cast<glm::uint32>(t));
+			}
+			std::sort(Triangles.begin(), Triangles.end());
+			Error += Count == Triangles.size() ? 0 : 1;
+			Error += Triangles == Expected ? 0 : 1;
+
+			Triangles.clear();
+			Expected.clear();
+			glm::bvhIntersectAABB(Bvh, Center - Extent, Center + Extent, Triangles);
+			for(std::size_t t = 0; t < Soup.size() / 3; ++t)
+				if(glm::detail::bvh_triangle_box(Center, Extent, Soup[t * 3 + 0], Soup[t * 3 + 1], Soup[t * 3 + 2]))
+					Expected.push_back(static_cast<glm::uint32>(t));
+			std::sort(Triangles.begin(), Triangles.end());
+			Error += Triangles == Expected ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_primitives()
+	{
+		int Error(0);
+
+		glm::vec3 const A(0.0f, 0.0f, 0.0f), B(1.0f, 0.0f, 0.0f), C(0.0f, 1.0f, 0.0f);
+
+		Error += glm::all(glm::equal(glm::detail::bvh_closest_point(glm::vec3(0.25f, 0.25f, 1.0f), A, B, C), glm::vec3(0.25f, 0.25f, 0.0f))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::detail::bvh_closest_point(glm::vec3(-1.0f, -1.0f, 0.0f), A, B, C), A)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::detail::bvh_closest_point(glm::vec3(1.0f, 1.0f, 0.0f), A, B, C), glm::vec3(0.5f, 0.5f, 0.0f))) ? 0 : 1;
+
+		Error += glm::detail::bvh_triangle_box(glm::vec3(0.2f, 0.2f, 0.0f), glm::vec3(0.1f), A, B, C) ? 0 : 1;
+		Error += glm::detail::bvh_triangle_box(glm::vec3(0.2f, 0.2f, 0.5f), glm::vec3(0.1f), A, B, C) ? 1 : 0;
+		// Separated by the hypotenuse only
+		Error += glm::detail::bvh_triangle_box(glm::vec3(0.7f, 0.7f, 0.0f), glm::vec3(0.15f), A, B, C) ? 1 : 0;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> Vertices;
+		std::vector<glm::uint32> Indices;
+		make_torus(24, 24, Vertices, Indices);
+
+		Error += test_primitives();
+		Error += test(make_soup(Vertices, Indices));
+		Error += test(make_random_soup(1000));
+
+		return Error;
+	}
+}//namespace overlap
+
+int perf()
+{
+	std::vector<glm::vec3> Vertices;
+	std::vector<glm::uint32> Indices;
+	make_torus(1024, 512, Vertices, Indices);
+	std::vector<glm::vec3> const Large = make_soup(Vertices, Indices);
+
+	Vertices.clear();
+	Indices.clear();
+	make_torus(24, 24, Vertices, Indices);
+	std::vector<glm::vec3> const Small = make_soup(Vertices, Indices);
+
+	// clock() adds up the time of all the threads
+	glm::bvh Bvh;
+	std::clock_t const TimeBuildStart = std::clock();
+	glm::bvhBuild(&Large[0], Large.size() / 3, Bvh);
+	std::clock_t const TimeBuildEnd = std::clock();
+	std::printf("bvhBuild of %d triangles: %d ms of CPU time\n", static_cast<int>(Large.size() / 3), static_cast<int>((TimeBuildEnd - TimeBuildStart) * 1000 / CLOCKS_PER_SEC));
+
+	std::size_t const Count = 1 << 18;
+	glm::pcg32 Engine(6);
+	std::vector<glm::vec3> Origins(Count), Directions(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Origins[i] = glm::linearRand(glm::vec3(-3.0f), glm::vec3(3.0f), Engine);
+		Directions[i] = glm::linearRand(glm::vec3(-0.5f), glm::vec3(0.5f), Engine) - Origins[i];
+	}
+	std::vector<glm::bvh_hit> Hits(Count);
+
+	std::clock_t const TimeLargeStart = std::clock();
+	glm::bvhIntersectRayBatch(Bvh, &Origins[0], &Directions[0], &Hits[0], Count);
+	std::clock_t const TimeLargeEnd = std::clock();
+
+	glm::bvhBuild(&Small[0], Small.size() / 3, Bvh);
+	std::clock_t const TimeSmallStart = std::clock();
+	glm::bvhIntersectRayBatch(Bvh, &Origins[0], &Directions[0], &Hits[0], Count);
+	std::clock_t const TimeSmallEnd = std::clock();
+
+	std::size_t const BruteCount = Count / 64;
+	std::clock_t const TimeBruteStart = std::clock();
+	std::size_t BruteHits(0);
+	for(std::size_t i = 0; i < BruteCount; ++i)
+	{
+		float Distance;
+		BruteHits += brute_force(Small, Origins[i], Directions[i], std::numeric_limits<float>::max(), Distance) ? 1 : 0;
+	}
+	std::clock_t const TimeBruteEnd = std::clock();
+
+	double const LargeTime = static_cast<double>(TimeLargeEnd - TimeLargeStart) / CLOCKS_PER_SEC;
+	double const SmallTime = static_cast<double>(TimeSmallEnd - TimeSmallStart) / CLOCKS_PER_SEC;
+	double const BruteTime = static_cast<double>(TimeBruteEnd - TimeBruteStart) / CLOCKS_PER_SEC;
+	std::printf("bvhIntersectRayBatch, %d triangles: %.2f M rays/s per thread\n", static_cast<int>(Large.size() / 3), LargeTime > 0.0 ? static_cast<double>(Count) / LargeTime * 1e-6 : 0.0);
+	std::printf("bvhIntersectRayBatch, %d triangles: %.2f M rays/s per thread\n", static_cast<int>(Small.size() / 3), SmallTime > 0.0 ? static_cast<double>(Count) / SmallTime * 1e-6 : 0.0);
+	std::printf("intersectRayTriangle brute force, %d triangles: %.2f M rays/s\n", static_cast<int>(Small.size() / 3), BruteTime > 0.0 ? static_cast<double>(BruteCount) / BruteTime * 1e-6 : 0.0);
+
+	return BruteHits > 0 ? 0 : 1;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += ray::test();
+	Error += overlap::test();
+
+#	ifdef NDEBUG
+		Error += perf();
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -0,0 +1,423 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_color_space_batch.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/color_space_batch.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	void make_colors(std::size_t Count, std::vector<glm::vec3> & Colors)
+	{
+		glm::pcg32 Engine(1);
+		Colors.resize(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Colors[i] = glm::linearRand(glm::vec3(0.0f), glm::vec3(1.0f), Engine);
+		Colors[0] = glm::vec3(0.0f);
+		Colors[1] = glm::vec3(1.0f, 0.0f, 0.0f);
+		Colors[2] = glm::vec3(0.25f, 1.0f, 0.25f);
+		Colors[3] = glm::vec3(0.0f, 0.5f, 1.0f);
+	}
+
+	bool equal(glm::u8vec4 const & x, glm::u8vec4 const & y)
+	{
+		return x.x == y.x && x.y == y.y && x.z == y.z && x.w == y.w;
+	}
+
+	// The bytes of packUnorm4x8, the first component in the least significant bits
+	glm::u8vec4 unpack(glm::uint Packed)
+	{
+		return glm::u8vec4(Packed & 0xff, (Packed >> 8) & 0xff, (Packed >> 16) & 0xff, Packed >> 24);
+	}
+
+	double rate(std::clock_t Start, std::clock_t End, std::size_t Count)
+	{
+		double const Time = static_cast<double>(End - Start) / CLOCKS_PER_SEC;
+		return Time > 0.0 ? static_cast<double>(Count) / Time * 1e-6 : 0.0;
+	}
+}//namespace
+
+namespace srgb8
+{
+	int test_decode()
+	{
+		int Error(0);
+
+		// Every code in every channel
+		std::vector<glm::u8vec4> Src(256 + 3);
+		for(std::size_t i = 0; i < Src.size(); ++i)
+			Src[i] = glm::u8vec4(i & 255, (255 - i) & 255, (i * 7) & 255, (i * 13) & 255);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::vec4> Dst(Src.size());
+			glm::convertSRGBToLinearBatch(&Src[0], &Dst[0], Src.size());
+
+			for(std::size_t i = 0; i < Src.size(); ++i)
+			{
+				glm::vec4 const Expected = glm::convertSRGBToLinear(glm::vec4(Src[i]) / 255.0f);
+				Error += glm::all(glm::equal(Dst[i], Expected)) ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	// Compares the encoding of the values to packUnorm4x8(convertLinearToSRGB(v)) at each level
+	int check_encode(std::vector<float> const & Values)
+	{
+		int Error(0);
+
+		std::vector<glm::vec4> Src(Values.size());
+		for(std::size_t i = 0; i < Values.size(); ++i)
+			Src[i] = glm::vec4(Values[i], Values[(i + 1) % Values.size()], Values[(i + 2) % Values.size()], Values[(i + 3) % Values.size()]);
+
+		std::vector<glm::u8vec4> Expected(Src.size());
+		for(std::size_t i = 0; i < Src.size(); ++i)
+			Expected[i] = unpack(glm::packUnorm4x8(glm::convertLinearToSRGB(Src[i])));
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::u8vec4> Dst(Src.size());
+			glm::convertLinearToSRGBBatch(&Src[0], &Dst[0], Src.size());
+
+			for(std::size_t i = 0; i < Src.size(); ++i)
+				Error += equal(Dst[i], Expected[i]) ? 0 : 1;
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	int test_encode()
+	{
+		int Error(0);
+
+		// A sweep of the bit patterns from 0 to 1, out of range values
+		std::vector<float> Values;
+		for(glm::uint Bits = 0; Bits <= glm::floatBitsToUint(1.0f); Bits += 997)
+			Values.push_back(glm::uintBitsToFloat(Bits));
+		Values.push_back(-1.0f);
+		Values.push_back(-0.0f);
+		Values.push_back(1.0f);
+		Values.push_back(1.5f);
+		Values.push_back(1e30f);
+		Error += check_encode(Values);
+
+		// Around each step of the codes
+		Values.clear();
+		for(int Code = 0; Code < 255; ++Code)
+		{
+			glm::uint const Threshold = glm::floatBitsToUint(glm::detail::srgb_get_tables().Thresholds[Code]);
+			for(glm::uint Bits = Threshold - 16; Bits <= Threshold + 16; ++Bits)
+				Values.push_back(glm::uintBitsToFloat(Bits));
+		}
+		Error += check_encode(Values);
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 20;
+		std::vector<glm::vec3> Colors;
+		make_colors(Count, Colors);
+
+		std::vector<glm::vec4> Linear(Count);
+		std::vector<glm::u8vec4> Encoded(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Linear[i] = glm::vec4(Colors[i], 0.5f);
+
+		glm::uint Sum(0);
+		std::clock_t const TimeEncodeStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Sum += glm::packUnorm4x8(glm::convertLinearToSRGB(Linear[i]));
+		std::clock_t const TimeEncodeEnd = std::clock();
+
+		std::clock_t const TimeDecodeStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Linear[i] = glm::convertSRGBToLinear(glm::unpackUnorm4x8(Sum + static_cast<glm::uint>(i)));
+		std::clock_t const TimeDecodeEnd = std::clock();
+
+		std::printf("packUnorm4x8(convertLinearToSRGB): %.1f Mpixel/s\n", rate(TimeEncodeStart, TimeEncodeEnd, Count));
+		std::printf("convertSRGBToLinear(unpackUnorm4x8): %.1f Mpixel/s\n", rate(TimeDecodeStart, TimeDecodeEnd, Count));
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeEncodeBatchStart = std::clock();
+			glm::convertLinearToSRGBBatch(&Linear[0], &Encoded[0], Count);
+			std::clock_t const TimeEncodeBatchEnd = std::clock();
+
+			std::clock_t const TimeDecodeBatchStart = std::clock();
+			glm::convertSRGBToLinearBatch(&Encoded[0], &Linear[0], Count);
+			std::clock_t const TimeDecodeBatchEnd = std::clock();
+
+			char const * Name = glm::simdLevelName(glm::simdLevel());
+			std::printf("convertLinearToSRGBBatch 8 bit at the %s level: %.1f Mpixel/s\n", Name, rate(TimeEncodeBatchStart, TimeEncodeBatchEnd, Count));
+			std::printf("convertSRGBToLinearBatch 8 bit at the %s level: %.1f Mpixel/s\n", Name, rate(TimeDecodeBatchStart, TimeDecodeBatchEnd, Count));
+		}
+		glm::simdForceLevel(Max);
+
+		return Sum == 0 ? 1 : 0;
+	}
+}//namespace srgb8
+
+namespace srgb
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		std::vector<glm::vec3> Colors;
+		make_colors(Count, Colors);
+
+		// Slightly out of range values, alpha out of range kept as is
+		std::vector<glm::vec4> Src(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Src[i] = glm::vec4(Colors[i] * 1.2f - 0.1f, Colors[(i + 1) % Count].x * 2.0f);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::vec4> Linear(Count), SRGB(Count);
+			glm::convertSRGBToLinearBatch(&Src[0], &Linear[0], Count);
+			glm::convertLinearToSRGBBatch(&Src[0], &SRGB[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += glm::all(glm::epsilonEqual(Linear[i], glm::convertSRGBToLinear(Src[i]), 1e-6f)) ? 0 : 1;
+				Error += glm::all(glm::epsilonEqual(SRGB[i], glm::convertLinearToSRGB(Src[i]), 1e-6f)) ? 0 : 1;
+				Error += Linear[i].w == Src[i].w && SRGB[i].w == Src[i].w ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 20;
+		std::vector<glm::vec3> Colors;
+		make_colors(Count, Colors);
+
+		std::vector<glm::vec4> Src(Count), Dst(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Src[i] = glm::vec4(Colors[i], 1.0f);
+
+		std::clock_t const TimeEncodeStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = glm::convertLinearToSRGB(Src[i]);
+		std::clock_t const TimeEncodeEnd = std::clock();
+
+		std::clock_t const TimeDecodeStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = glm::convertSRGBToLinear(Src[i]);
+		std::clock_t const TimeDecodeEnd = std::clock();
+
+		std::printf("convertLinearToSRGB: %.1f Mpixel/s\n", rate(TimeEncodeStart, TimeEncodeEnd, Count));
+		std::printf("convertSRGBToLinear: %.1f Mpixel/s\n", rate(TimeDecodeStart, TimeDecodeEnd, Count));
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeEncodeBatchStart = std::clock();
+			glm::convertLinearToSRGBBatch(&Src[0], &Dst[0], Count);
+			std::clock_t const TimeEncodeBatchEnd = std::clock();
+
+			std::clock_t const TimeDecodeBatchStart = std::clock();
+			glm::convertSRGBToLinearBatch(&Src[0], &Dst[0], Count);
+			std::clock_t const TimeDecodeBatchEnd = std::clock();
+
+			char const * Name = glm::simdLevelName(glm::simdLevel());
+			std::printf("convertLinearToSRGBBatch at the %s level: %.1f Mpixel/s\n", Name, rate(TimeEncodeBatchStart, TimeEncodeBatchEnd, Count));
+			std::printf("convertSRGBToLinearBatch at the %s level: %.1f Mpixel/s\n", Name, rate(TimeDecodeBatchStart, TimeDecodeBatchEnd, Count));
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace srgb
+
+namespace convert
+{
+	typedef glm::vec3 (*scalar_func)(glm::vec3 const &);
+	typedef void (*batch_func)(glm::vec3 const *, glm::vec3 *, std::size_t);
+
+	glm::vec3 rgb2YCoCg(glm::vec3 const & x){return glm::rgb2YCoCg(x);}
+	glm::vec3 YCoCg2rgb(glm::vec3 const & x){return glm::YCoCg2rgb(x);}
+	glm::vec3 rgb2YCoCgR(glm::vec3 const & x){return glm::rgb2YCoCgR(x);}
+	glm::vec3 YCoCgR2rgb(glm::vec3 const & x){return glm::YCoCgR2rgb(x);}
+	glm::vec3 hsvColor(glm::vec3 const & x){return glm::hsvColor(x);}
+	glm::vec3 rgbColor(glm::vec3 const & x){return glm::rgbColor(x);}
+
+	struct conversion
+	{
+		char const * Name;
+		scalar_func Scalar;
+		batch_func Batch;
+		scalar_func Inverse;
+	};
+
+	conversion const Conversions[] =
+	{
+		{"rgb2YCoCg", rgb2YCoCg, glm::rgb2YCoCgBatch, YCoCg2rgb},
+		{"YCoCg2rgb", YCoCg2rgb, glm::YCoCg2rgbBatch, rgb2YCoCg},
+		{"rgb2YCoCgR", rgb2YCoCgR, glm::rgb2YCoCgRBatch, YCoCgR2rgb},
+		{"YCoCgR2rgb", YCoCgR2rgb, glm::YCoCgR2rgbBatch, rgb2YCoCgR},
+		{"hsvColor", hsvColor, glm::hsvColorBatch, rgbColor},
+		{"rgbColor", rgbColor, glm::rgbColorBatch, hsvColor}
+	};
+
+	std::size_t const ConversionCount = sizeof(Conversions) / sizeof(Conversions[0]);
+
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		std::vector<glm::vec3> Colors;
+		make_colors(Count, Colors);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(std::size_t k = 0; k < ConversionCount; ++k)
+		{
+			conversion const & Conversion = Conversions[k];
+
+			// The inverse conversions start from the results of the forward ones
+			std::vector<glm::vec3> Src(Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Src[i] = k % 2 ? Conversion.Inverse(Colors[i]) : Colors[i];
+
+			for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+			{
+				if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+					continue;
+
+				std::vector<glm::vec3> Dst(Count);
+				Conversion.Batch(&Src[0], &Dst[0], Count);
+
+				int LevelError(0);
+				for(std::size_t i = 0; i < Count; ++i)
+					LevelError += glm::all(glm::equal(Dst[i], Conversion.Scalar(Src[i]))) ? 0 : 1;
+				if(LevelError)
+					std::printf("%s at the %s level: %d errors\n", Conversion.Name, glm::simdLevelName(glm::simdLevel()), LevelError);
+				Error += LevelError;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		// Achromatic colors, the hue is ignored
+		glm::vec3 const Greys[] = {glm::vec3(0.0f, 0.0f, 0.5f), glm::vec3(120.0f, 0.0f, 0.25f), glm::vec3(360.0f, 0.0f, 1.0f)};
+		glm::vec3 Rgb[3];
+		glm::rgbColorBatch(Greys, Rgb, 3);
+		for(std::size_t i = 0; i < 3; ++i)
+			Error += glm::all(glm::equal(Rgb[i], glm::vec3(Greys[i].z))) ? 0 : 1;
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 20;
+		std::vector<glm::vec3> Colors;
+		make_colors(Count, Colors);
+		std::vector<glm::vec3> Dst(Count);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(std::size_t k = 0; k < ConversionCount; ++k)
+		{
+			conversion const & Conversion = Conversions[k];
+
+			std::clock_t const TimeScalarStart = std::clock();
+			for(std::size_t i = 0; i < Count; ++i)
+				Dst[i] = Conversion.Scalar(Colors[i]);
+			std::clock_t const TimeScalarEnd = std::clock();
+			std::printf("%s: %.1f Mpixel/s\n", Conversion.Name, rate(TimeScalarStart, TimeScalarEnd, Count));
+
+			for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+			{
+				if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+					continue;
+
+				std::clock_t const TimeStart = std::clock();
+				Conversion.Batch(&Colors[0], &Dst[0], Count);
+				std::clock_t const TimeEnd = std::clock();
+				std::printf("%sBatch at the %s level: %.1f Mpixel/s\n", Conversion.Name, glm::simdLevelName(glm::simdLevel()), rate(TimeStart, TimeEnd, Count));
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace convert
+
+int main()
+{
+	int Error(0);
+
+	Error += srgb8::test_decode();
+	Error += srgb8::test_encode();
+	Error += srgb::test();
+	Error += convert::test();
+
+#	ifdef NDEBUG
+		Error += srgb8::perf();
+		Error += srgb::perf();
+		Error += convert::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -30,10 +30,49 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <glm/gtx/fast_exponential.hpp>
+#include <glm/gtc/ulp.hpp>
+#include <cmath>
+#include <cstdio>
+
+namespace fastExp
+{
+	// Expanded polynomial of the previous implementation, the Horner form is compared to
+	float exp_expanded(float x)
+	{
+		float x2 = x * x;
+		float x3 = x2 * x;
+		float x4 = x3 * x;
+		float x5 = x4 * x;
+		return 1.0f + x + (x2 * 0.5f) + (x3 * 0.1666666667f) + (x4 * 0.041666667f) + (x5 * 0.008333333333f);
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		float MaxError = 0.0f;
+		glm::uint MaxUlp = 0;
+		for(float x = -1.0f; x < 1.0f; x += 0.001f)
+		{
+			float const Result = glm::fastExp(x);
+			MaxError = glm::max(MaxError, glm::abs(Result - std::exp(x)) / std::exp(x));
+			MaxUlp = glm::max(MaxUlp, glm::float_distance(Result, exp_expanded(x)));
+		}
+
+		std::printf("fastExp: %f max relative error, %u ULP to expanded polynomial\n", MaxError, MaxUlp);
+
+		Error += MaxError < 0.005f ? 0 : 1;
+		Error += MaxUlp <= 8 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace fastExp
 
 int main()
 {
 	int Error(0);
 
+	Error += fastExp::test();
+
 	return Error;
 }
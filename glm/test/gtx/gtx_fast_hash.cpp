@@ -0,0 +1,473 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @file test/gtx/gtx_fast_hash.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/fast_hash.hpp>
+// GLM_HAS_CXX11_STL doesn't know the recent versions of GCC
+#define GLM_TEST_CXX11_STL (GLM_HAS_CXX11_STL || __cplusplus >= 201103L)
+#if GLM_TEST_CXX11_STL
+#	include <functional>
+#	include <unordered_map>
+#endif
+#include <algorithm>
+#include <ctime>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	// Points of a lattice of spacing 0.5, the worst case of hashes combining the bits of the components
+	void make_lattice(int Size, std::vector<glm::vec3> & Points)
+	{
+		Points.clear();
+		for(int z = 0; z < Size; ++z)
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+			Points.push_back(glm::vec3(x, y, z) * 0.5f);
+	}
+
+	// Cells of a lattice of spacing Stride
+	void make_cells(int Size, int Stride, std::vector<glm::ivec3> & Cells)
+	{
+		Cells.clear();
+		for(int z = 0; z < Size; ++z)
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+			Cells.push_back(glm::ivec3(x, y, z) * Stride);
+	}
+
+	// Average number of keys in the bucket of a key, for 2^Bits buckets indexed by the low bits of the hashes.
+	// 1 + keys / buckets with random hashes.
+	template <typename hashType>
+	double bucket_load(std::vector<hashType> const & Hashes, int Bits)
+	{
+		std::vector<std::size_t> Load(std::size_t(1) << Bits, 0);
+		for(std::size_t i = 0; i < Hashes.size(); ++i)
+			++Load[static_cast<std::size_t>(Hashes[i]) & ((std::size_t(1) << Bits) - 1)];
+
+		double Sum = 0.0;
+		for(std::size_t i = 0; i < Load.size(); ++i)
+			Sum += static_cast<double>(Load[i]) * static_cast<double>(Load[i]);
+		return Sum / static_cast<double>(Hashes.size());
+	}
+
+#	if GLM_TEST_CXX11_STL
+		// The hashes of GLM_GTX_hash, std::hash of the components combined
+		void hash_combine(std::size_t & Seed, std::size_t Hash)
+		{
+			Hash += 0x9e3779b9 + (Seed << 6) + (Seed >> 2);
+			Seed ^= Hash;
+		}
+
+		std::size_t combined_hash(glm::vec3 const & v)
+		{
+			std::hash<float> const Hasher;
+			std::size_t Seed = 0;
+			hash_combine(Seed, Hasher(v.x));
+			hash_combine(Seed, Hasher(v.y));
+			hash_combine(Seed, Hasher(v.z));
+			return Seed;
+		}
+
+		std::size_t combined_hash(glm::ivec3 const & v)
+		{
+			std::hash<int> const Hasher;
+			std::size_t Seed = 0;
+			hash_combine(Seed, Hasher(v.x));
+			hash_combine(Seed, Hasher(v.y));
+			hash_combine(Seed, Hasher(v.z));
+			return Seed;
+		}
+
+		std::size_t combined_hash(glm::mat4 const & m)
+		{
+			std::hash<float> const Hasher;
+			std::size_t Seed = 0;
+			for(glm::length_t i = 0; i < 4; ++i)
+			{
+				std::size_t Column = 0;
+				for(glm::length_t j = 0; j < 4; ++j)
+					hash_combine(Column, Hasher(m[i][j]));
+				hash_combine(Seed, Column);
+			}
+			return Seed;
+		}
+#	endif//GLM_TEST_CXX11_STL
+
+	double rate(std::clock_t Start, std::clock_t End, std::size_t Count)
+	{
+		double const Time = static_cast<double>(End - Start) / CLOCKS_PER_SEC;
+		return Time > 0.0 ? static_cast<double>(Count) / Time * 1e-6 : 0.0;
+	}
+}//namespace
+
+namespace canonical
+{
+	int test()
+	{
+		int Error(0);
+
+		float const NaN = std::numeric_limits<float>::quiet_NaN();
+		float const OtherNaN = -std::numeric_limits<float>::signaling_NaN();
+
+		Error += glm::fastHash(glm::vec3(-0.0f, 0.0f, 1.0f)) == glm::fastHash(glm::vec3(0.0f, 0.0f, 1.0f)) ? 0 : 1;
+		Error += glm::fastHash(glm::vec2(NaN, 1.0f)) == glm::fastHash(glm::vec2(OtherNaN, 1.0f)) ? 0 : 1;
+		Error += glm::fastHash(glm::dvec3(-0.0, 2.0, 3.0)) == glm::fastHash(glm::dvec3(0.0, 2.0, 3.0)) ? 0 : 1;
+		Error += glm::fastHash(glm::vec3(1.0f, 2.0f, 3.0f)) != glm::fastHash(glm::vec3(3.0f, 2.0f, 1.0f)) ? 0 : 1;
+		Error += glm::fastHash(glm::vec3(1.0f, 2.0f, 3.0f)) != glm::fastHash(glm::vec3(1.0f, 2.0f, 3.0f), 1) ? 0 : 1;
+		Error += glm::fastHash(glm::vec3(-1.0f)) != glm::fastHash(glm::vec3(1.0f)) ? 0 : 1;
+
+		// Same bytes, different sizes
+		Error += glm::fastHash(glm::ivec2(0)) != glm::fastHash(glm::ivec3(0)) ? 0 : 1;
+
+		Error += glm::fastHash(glm::mat4(1.0f)) == glm::fastHash(glm::mat4(1.0f)) ? 0 : 1;
+		Error += glm::fastHash(glm::mat4(1.0f)) != glm::fastHash(glm::mat4(2.0f)) ? 0 : 1;
+		Error += glm::fastHash(glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) != glm::fastHash(glm::quat(0.0f, 1.0f, 0.0f, 0.0f)) ? 0 : 1;
+
+		glm::fast_hash<glm::vec3> const Hash;
+		Error += Hash(glm::vec3(1.0f)) == static_cast<std::size_t>(glm::fastHash(glm::vec3(1.0f))) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace canonical
+
+namespace quantized
+{
+	int test()
+	{
+		int Error(0);
+
+		Error += glm::all(glm::equal(glm::quantizeCell(glm::vec3(0.3f, -0.1f, 2.0f), 0.25f), glm::ivec3(1, -1, 8))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::quantizeCell(glm::dvec2(-0.0, 0.75), 0.25), glm::ivec2(0, 3))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::quantizeCell(glm::vec2(1e20f, -1e20f), 0.5f), glm::ivec2(2147483520, -2147483647 - 1))) ? 0 : 1;
+
+		Error += glm::quantizedHash(glm::vec3(0.3f, 0.1f, 0.2f), 0.25f) == glm::quantizedHash(glm::vec3(0.26f, 0.01f, 0.24f), 0.25f) ? 0 : 1;
+		Error += glm::quantizedHash(glm::vec3(0.3f, 0.1f, 0.2f), 0.25f) != glm::quantizedHash(glm::vec3(0.3f, 0.1f, 0.26f), 0.25f) ? 0 : 1;
+
+		glm::quantized_hash<glm::vec3> const Hash(0.25f);
+		glm::quantized_equal<glm::vec3> const Equal(0.25f);
+		Error += Hash(glm::vec3(0.3f)) == Hash(glm::vec3(0.4f)) ? 0 : 1;
+		Error += Equal(glm::vec3(0.3f), glm::vec3(0.4f)) ? 0 : 1;
+		Error += !Equal(glm::vec3(0.3f), glm::vec3(0.5f)) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Welding of the vertices of a grid of quads, each vertex shared by up to 4 quads and slightly moved
+	int test_weld()
+	{
+		int Error(0);
+
+#		if GLM_TEST_CXX11_STL
+			int const Size = 64;
+			float const Epsilon = 1e-3f;
+
+			glm::pcg32 Engine(1);
+			std::vector<glm::vec3> Vertices;
+			for(int y = 0; y < Size; ++y)
+			for(int x = 0; x < Size; ++x)
+			for(int Corner = 0; Corner < 4; ++Corner)
+			{
+				// Centered in the cells, within Epsilon / 4 of the grid point
+				glm::vec3 const Jitter = glm::linearRand(glm::vec3(-0.25f * Epsilon), glm::vec3(0.25f * Epsilon), Engine);
+				Vertices.push_back(glm::vec3(x + (Corner & 1), y + (Corner >> 1), 0) + Epsilon * 0.5f + Jitter);
+			}
+
+			typedef std::unordered_map<glm::vec3, std::size_t, glm::quantized_hash<glm::vec3>, glm::quantized_equal<glm::vec3> > weld_map;
+			weld_map Map(Vertices.size(), glm::quantized_hash<glm::vec3>(Epsilon), glm::quantized_equal<glm::vec3>(Epsilon));
+			for(std::size_t i = 0; i < Vertices.size(); ++i)
+				Map.insert(weld_map::value_type(Vertices[i], Map.size()));
+
+			Error += Map.size() == static_cast<std::size_t>((Size + 1) * (Size + 1)) ? 0 : 1;
+#		endif//GLM_TEST_CXX11_STL
+
+		return Error;
+	}
+}//namespace quantized
+
+namespace batch
+{
+	template <typename genType>
+	int check(std::vector<genType> const & Values)
+	{
+		int Error(0);
+
+		std::vector<glm::uint64> Hashes(Values.size());
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			glm::fastHashBatch(&Values[0], &Hashes[0], Values.size(), 7);
+			for(std::size_t i = 0; i < Values.size(); ++i)
+				Error += Hashes[i] == glm::fastHash(Values[i], 7) ? 0 : 1;
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	template <typename genType>
+	int check_quantized(std::vector<genType> const & Values, typename genType::value_type Epsilon)
+	{
+		int Error(0);
+
+		std::vector<glm::uint64> Hashes(Values.size());
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			glm::quantizedHashBatch(&Values[0], Epsilon, &Hashes[0], Values.size(), 7);
+			for(std::size_t i = 0; i < Values.size(); ++i)
+				Error += Hashes[i] == glm::quantizedHash(Values[i], Epsilon, 7) ? 0 : 1;
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		// Not a multiple of the 4 keys of the AVX2 kernels
+		std::size_t const Count = 1021;
+		float const NaN = std::numeric_limits<float>::quiet_NaN();
+
+		glm::pcg32 Engine(2);
+		std::vector<glm::vec4> Values(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Values[i] = glm::linearRand(glm::vec4(-50.0f), glm::vec4(50.0f), Engine);
+		Values[1] = glm::vec4(-0.0f, 0.0f, -0.0f, 1.0f);
+		Values[2] = glm::vec4(NaN, -NaN, 1.0f, std::numeric_limits<float>::infinity());
+
+		std::vector<glm::vec3> Values3(Count);
+		std::vector<glm::ivec3> ValuesI3(Count);
+		std::vector<glm::uvec4> ValuesU4(Count);
+		std::vector<glm::vec2> Values2(Count);
+		std::vector<glm::dvec3> ValuesD3(Count);
+		std::vector<glm::mat4> Matrices(Count / 4);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Values3[i] = glm::vec3(Values[i]);
+			ValuesI3[i] = glm::ivec3(glm::floor(Values[i] * 1e6f));
+			ValuesU4[i] = glm::uvec4(glm::abs(Values[i]) * 1e6f);
+			Values2[i] = glm::vec2(Values[i]);
+			ValuesD3[i] = glm::dvec3(Values[i]);
+		}
+		for(std::size_t i = 0; i < Count / 4; ++i)
+			Matrices[i] = glm::mat4(Values[i * 4 + 0], Values[i * 4 + 1], Values[i * 4 + 2], Values[i * 4 + 3]);
+
+		Error += check(Values);
+		Error += check(Values3);
+		Error += check(ValuesI3);
+		Error += check(ValuesU4);
+		Error += check(Values2);
+		Error += check(ValuesD3);
+		Error += check(Matrices);
+
+		// Cells on both sides of 0 and clamped cells
+		Values[3] = glm::vec4(1e30f, -1e30f, -0.0f, -1e-3f);
+		Values3[3] = glm::vec3(Values[3]);
+		Error += check_quantized(Values, 0.01f);
+		Error += check_quantized(Values3, 0.01f);
+		Error += check_quantized(Values2, 0.01f);
+		Error += check_quantized(ValuesD3, 0.01);
+
+		return Error;
+	}
+}//namespace batch
+
+namespace collision
+{
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> Points;
+		make_lattice(64, Points);
+
+		std::vector<glm::uint64> Hashes(Points.size());
+		glm::fastHashBatch(&Points[0], &Hashes[0], Points.size());
+
+		// No collision of the 64 bits hashes
+		std::vector<glm::uint64> Sorted(Hashes);
+		std::sort(Sorted.begin(), Sorted.end());
+		Error += std::adjacent_find(Sorted.begin(), Sorted.end()) == Sorted.end() ? 0 : 1;
+
+		// As loaded as with random hashes, whatever the spacing of the keys
+		Error += bucket_load(Hashes, 18) < 2.05 ? 0 : 1;
+		for(int Stride = 1; Stride <= 256; Stride *= 16)
+		{
+			std::vector<glm::ivec3> Cells;
+			make_cells(64, Stride, Cells);
+			glm::fastHashBatch(&Cells[0], &Hashes[0], Cells.size());
+			Error += bucket_load(Hashes, 18) < 2.05 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::printf("Average number of keys in the bucket of a key, 64^3 keys in 2^18 buckets, 2 with random hashes:\n");
+
+		std::vector<glm::vec3> Points;
+		make_lattice(64, Points);
+
+		std::vector<glm::uint64> Hashes(Points.size());
+#		if GLM_TEST_CXX11_STL
+			std::vector<std::size_t> CombinedHashes(Points.size());
+#		endif//GLM_TEST_CXX11_STL
+
+		for(std::size_t i = 0; i < Points.size(); ++i)
+			Hashes[i] = glm::fastHash(Points[i]);
+		std::printf("- points spaced by 0.5, fastHash: %.2f\n", bucket_load(Hashes, 18));
+#		if GLM_TEST_CXX11_STL
+			for(std::size_t i = 0; i < Points.size(); ++i)
+				CombinedHashes[i] = combined_hash(Points[i]);
+			std::printf("- points spaced by 0.5, GLM_GTX_hash: %.2f\n", bucket_load(CombinedHashes, 18));
+#		endif//GLM_TEST_CXX11_STL
+
+		for(int Stride = 1; Stride <= 256; Stride *= 4)
+		{
+			std::vector<glm::ivec3> Cells;
+			make_cells(64, Stride, Cells);
+
+			for(std::size_t i = 0; i < Cells.size(); ++i)
+				Hashes[i] = glm::fastHash(Cells[i]);
+			std::printf("- cells spaced by %d, fastHash: %.2f\n", Stride, bucket_load(Hashes, 18));
+#			if GLM_TEST_CXX11_STL
+				// std::hash<int> is the identity with libstdc++ and libc++
+				for(std::size_t i = 0; i < Cells.size(); ++i)
+					CombinedHashes[i] = combined_hash(Cells[i]);
+				std::printf("- cells spaced by %d, GLM_GTX_hash: %.2f\n", Stride, bucket_load(CombinedHashes, 18));
+#			endif//GLM_TEST_CXX11_STL
+		}
+
+		return 0;
+	}
+}//namespace collision
+
+namespace throughput
+{
+	template <typename genType>
+	void perf_type(char const * Name, std::vector<genType> const & Values)
+	{
+		std::size_t const Count = Values.size();
+		std::vector<glm::uint64> Hashes(Count);
+
+		std::clock_t const TimeScalarStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Hashes[i] = glm::fastHash(Values[i]);
+		std::clock_t const TimeScalarEnd = std::clock();
+		std::printf("fastHash(%s): %.1f Mkey/s\n", Name, rate(TimeScalarStart, TimeScalarEnd, Count));
+
+#		if GLM_TEST_CXX11_STL
+			std::vector<std::size_t> StdHashes(Count);
+			std::clock_t const TimeStdStart = std::clock();
+			for(std::size_t i = 0; i < Count; ++i)
+				StdHashes[i] = combined_hash(Values[i]);
+			std::clock_t const TimeStdEnd = std::clock();
+			std::printf("GLM_GTX_hash(%s): %.1f Mkey/s\n", Name, rate(TimeStdStart, TimeStdEnd, Count));
+#		endif//GLM_TEST_CXX11_STL
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeStart = std::clock();
+			glm::fastHashBatch(&Values[0], &Hashes[0], Count);
+			std::clock_t const TimeEnd = std::clock();
+			std::printf("fastHashBatch(%s) at the %s level: %.1f Mkey/s\n", Name, glm::simdLevelName(glm::simdLevel()), rate(TimeStart, TimeEnd, Count));
+		}
+		glm::simdForceLevel(Max);
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 22;
+
+		glm::pcg32 Engine(3);
+		std::vector<glm::vec3> Points(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Points[i] = glm::linearRand(glm::vec3(0.0f), glm::vec3(100.0f), Engine);
+
+		std::vector<glm::mat4> Matrices(Count / 16);
+		for(std::size_t i = 0; i < Matrices.size(); ++i)
+			Matrices[i] = glm::mat4(glm::vec4(Points[i * 4 + 0], 0.0f), glm::vec4(Points[i * 4 + 1], 0.0f), glm::vec4(Points[i * 4 + 2], 0.0f), glm::vec4(Points[i * 4 + 3], 1.0f));
+
+		perf_type("vec3", Points);
+		perf_type("mat4", Matrices);
+
+		std::vector<glm::uint64> Hashes(Count);
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeStart = std::clock();
+			glm::quantizedHashBatch(&Points[0], 0.01f, &Hashes[0], Count);
+			std::clock_t const TimeEnd = std::clock();
+			std::printf("quantizedHashBatch(vec3) at the %s level: %.1f Mkey/s\n", glm::simdLevelName(glm::simdLevel()), rate(TimeStart, TimeEnd, Count));
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace throughput
+
+int main()
+{
+	int Error(0);
+
+	Error += canonical::test();
+	Error += quantized::test();
+	Error += quantized::test_weld();
+	Error += batch::test();
+	Error += collision::test();
+
+#	ifdef NDEBUG
+		Error += collision::perf();
+		Error += throughput::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
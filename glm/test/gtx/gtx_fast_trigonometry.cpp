@@ -457,12 +457,72 @@ namespace taylorCos
 	}
 }//namespace taylorCos
 
+namespace accuracy
+{
+	// Expanded polynomials of the previous implementation, the Horner forms are compared to
+	float cos_52s_expanded(float x)
+	{
+		float const xx(x * x);
+		return (0.9999932946f + xx * (-0.4999124376f + xx * (0.0414877472f + xx * -0.0012712095f)));
+	}
+
+	float tan_expanded(float x)
+	{
+		return x + (x * x * x * 0.3333333333f) + (x * x * x * x * x * 0.1333333333333f) + (x * x * x * x * x * x * x * 0.0539682539f);
+	}
+
+	float asin_expanded(float x)
+	{
+		return x + (x * x * x * 0.166666667f) + (x * x * x * x * x * 0.075f) + (x * x * x * x * x * x * x * 0.0446428571f) + (x * x * x * x * x * x * x * x * x * 0.0303819444f);
+	}
+
+	float atan_expanded(float x)
+	{
+		return x - (x * x * x * 0.333333333333f) + (x * x * x * x * x * 0.2f) - (x * x * x * x * x * x * x * 0.1428571429f) + (x * x * x * x * x * x * x * x * x * 0.111111111111f) - (x * x * x * x * x * x * x * x * x * x * x * 0.0909090909f);
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		float MaxCosError = 0.0f;
+		glm::uint MaxCosUlp = 0;
+		for(float Angle = 0.0f; Angle < glm::half_pi<float>(); Angle += 0.001f)
+		{
+			MaxCosError = glm::max(MaxCosError, glm::abs(glm::fastCos(Angle) - std::cos(Angle)));
+			MaxCosUlp = glm::max(MaxCosUlp, glm::float_distance(glm::fastCos(Angle), cos_52s_expanded(Angle)));
+		}
+
+		glm::uint MaxTanUlp = 0;
+		glm::uint MaxAsinUlp = 0;
+		glm::uint MaxAtanUlp = 0;
+		for(float x = 0.05f; x < 0.8f; x += 0.001f)
+		{
+			MaxTanUlp = glm::max(MaxTanUlp, glm::float_distance(glm::fastTan(x), tan_expanded(x)));
+			MaxAsinUlp = glm::max(MaxAsinUlp, glm::float_distance(glm::fastAsin(x), asin_expanded(x)));
+			MaxAtanUlp = glm::max(MaxAtanUlp, glm::float_distance(glm::fastAtan(x), atan_expanded(x)));
+		}
+
+		std::printf("fastCos: %f max error, ULP to expanded polynomials: cos %u, tan %u, asin %u, atan %u\n",
+			MaxCosError, MaxCosUlp, MaxTanUlp, MaxAsinUlp, MaxAtanUlp);
+
+		Error += MaxCosError < 0.00001f ? 0 : 1;
+		Error += MaxCosUlp <= 4 ? 0 : 1;
+		Error += MaxTanUlp <= 4 ? 0 : 1;
+		Error += MaxAsinUlp <= 4 ? 0 : 1;
+		Error += MaxAtanUlp <= 4 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace accuracy
+
 int main()
 {
 	int Error(0);
 
 	Error += ::taylorCos::test();
 	Error += ::taylorCos::perf();
+	Error += ::accuracy::test();
 
 #	ifdef NDEBUG
 		Error += ::fastCos::perf();
@@ -0,0 +1,628 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_fixed_point.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/fixed_point.hpp>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	template <typename fixedType>
+	double ulp()
+	{
+		return 1.0 / static_cast<double>(1 << (sizeof(typename fixedType::storage_type) * 4));
+	}
+
+	template <typename fixedType>
+	double to_double(fixedType x)
+	{
+		return static_cast<double>(x.value) * ulp<fixedType>();
+	}
+
+	template <typename fixedType>
+	bool saturated(fixedType x)
+	{
+		return x.value == std::numeric_limits<typename fixedType::storage_type>::max() || x.value == std::numeric_limits<typename fixedType::storage_type>::min();
+	}
+
+	// Error of Result against Reference, in units of the last place
+	template <typename fixedType>
+	double error(fixedType Result, double Reference)
+	{
+		return std::abs(to_double(Result) - Reference) / ulp<fixedType>();
+	}
+
+#	if GLM_HAS_UNRESTRICTED_UNIONS
+	glm::fixed16_16 next_fixed16_16(glm::pcg32 & Engine, double Range)
+	{
+		return glm::fixed16_16(glm::linearRand(-Range, Range, Engine));
+	}
+
+	glm::fixed16_16vec4 next_fixed16_16vec4(glm::pcg32 & Engine, double Range)
+	{
+		glm::fixed16_16 const x = next_fixed16_16(Engine, Range);
+		glm::fixed16_16 const y = next_fixed16_16(Engine, Range);
+		glm::fixed16_16 const z = next_fixed16_16(Engine, Range);
+		glm::fixed16_16 const w = next_fixed16_16(Engine, Range);
+		return glm::fixed16_16vec4(x, y, z, w);
+	}
+
+	// Any raw value, to cover the saturation of the kernels
+	glm::fixed16_16vec4 next_raw_fixed16_16vec4(glm::pcg32 & Engine)
+	{
+		glm::fixed16_16vec4 Result;
+		for(glm::length_t i = 0; i < 4; ++i)
+			Result[i] = glm::fixed16_16::fromRaw(static_cast<glm::int32>(Engine()));
+		return Result;
+	}
+
+	glm::fixed8_8vec4 next_raw_fixed8_8vec4(glm::pcg32 & Engine)
+	{
+		glm::fixed8_8vec4 Result;
+		for(glm::length_t i = 0; i < 4; ++i)
+			Result[i] = glm::fixed8_8::fromRaw(static_cast<glm::int16>(Engine() >> 16));
+		return Result;
+	}
+
+	// Sums of products are rounded once, after each of the 4 products lost its 2 lowest bits: 2^-14 ulp each
+	double const DotTolerance = 0.5 + 4.0 / 16384.0;
+
+	template <typename vecType>
+	bool equal_raw(vecType const & a, vecType const & b)
+	{
+		for(glm::length_t i = 0; i < a.length(); ++i)
+			if(a[i].value != b[i].value)
+				return false;
+		return true;
+	}
+#	endif//GLM_HAS_UNRESTRICTED_UNIONS
+}//namespace
+
+namespace conversion
+{
+	int test()
+	{
+		int Error(0);
+
+		Error += glm::fixed16_16(1.5).value == 98304 ? 0 : 1;
+		Error += glm::fixed16_16(-1.5f).value == -98304 ? 0 : 1;
+		Error += glm::fixed16_16(3).value == 3 << 16 ? 0 : 1;
+		Error += glm::fixed8_8(-2).value == -512 ? 0 : 1;
+
+		// Round to nearest, ties up
+		Error += glm::fixed16_16(0.5 / 65536.0).value == 1 ? 0 : 1;
+		Error += glm::fixed16_16(-0.5 / 65536.0).value == 0 ? 0 : 1;
+		Error += glm::fixed16_16(0.49 / 65536.0).value == 0 ? 0 : 1;
+		Error += glm::fixed16_16(-0.51 / 65536.0).value == -1 ? 0 : 1;
+
+		// Saturation
+		Error += glm::fixed16_16(1e10).value == std::numeric_limits<glm::int32>::max() ? 0 : 1;
+		Error += glm::fixed16_16(-1e10f).value == std::numeric_limits<glm::int32>::min() ? 0 : 1;
+		Error += glm::fixed16_16(40000).value == std::numeric_limits<glm::int32>::max() ? 0 : 1;
+		Error += glm::fixed8_8(200).value == std::numeric_limits<glm::int16>::max() ? 0 : 1;
+		Error += glm::fixed8_8(-200.0).value == std::numeric_limits<glm::int16>::min() ? 0 : 1;
+		Error += glm::fixed16_16(std::numeric_limits<double>::quiet_NaN()).value == 0 ? 0 : 1;
+
+		// Between formats
+		Error += glm::fixed8_8(glm::fixed16_16(1.25)).value == 320 ? 0 : 1;
+		Error += glm::fixed8_8(glm::fixed16_16::fromRaw(128)).value == 1 ? 0 : 1;
+		Error += glm::fixed16_16(glm::fixed8_8(-0.75)).value == -49152 ? 0 : 1;
+		Error += glm::fixed8_8(glm::fixed16_16(1000)).value == std::numeric_limits<glm::int16>::max() ? 0 : 1;
+
+#		if GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+			Error += static_cast<float>(glm::fixed16_16::fromRaw(98304)) == 1.5f ? 0 : 1;
+			Error += static_cast<double>(glm::fixed8_8::fromRaw(-1)) == -1.0 / 256.0 ? 0 : 1;
+#		endif//GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+
+		return Error;
+	}
+}//namespace conversion
+
+namespace arithmetic
+{
+	template <typename fixedType>
+	int test_random(double Range)
+	{
+		int Error(0);
+
+		glm::pcg32 Engine(1);
+		for(int i = 0; i < 1 << 16; ++i)
+		{
+			fixedType const a(glm::linearRand(-Range, Range, Engine));
+			fixedType const b(glm::linearRand(-Range, Range, Engine));
+			double const x = to_double(a);
+			double const y = to_double(b);
+
+			fixedType const Sum = a + b;
+			Error += saturated(Sum) || error(Sum, x + y) == 0.0 ? 0 : 1;
+			fixedType const Diff = a - b;
+			Error += saturated(Diff) || error(Diff, x - y) == 0.0 ? 0 : 1;
+			fixedType const Prod = a * b;
+			Error += saturated(Prod) || error(Prod, x * y) <= 0.5 ? 0 : 1;
+			if(b.value != 0)
+			{
+				fixedType const Quot = a / b;
+				Error += saturated(Quot) || error(Quot, x / y) <= 0.5 ? 0 : 1;
+			}
+
+			fixedType c = a;
+			c += b;
+			c *= b;
+			Error += c == (a + b) * b ? 0 : 1;
+			c -= a;
+			c /= b;
+			Error += c == ((a + b) * b - a) / b ? 0 : 1;
+
+			Error += (a < b) == (x < y) ? 0 : 1;
+			Error += (a >= b) == (x >= y) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template <typename fixedType>
+	int test_saturation()
+	{
+		typedef typename fixedType::storage_type storage_type;
+		fixedType const Max = fixedType::fromRaw(std::numeric_limits<storage_type>::max());
+		fixedType const Min = fixedType::fromRaw(std::numeric_limits<storage_type>::min());
+		fixedType const One(1);
+		fixedType const Zero(0);
+
+		int Error(0);
+
+		Error += Max + One == Max ? 0 : 1;
+		Error += Min - One == Min ? 0 : 1;
+		Error += -Min == Max ? 0 : 1;
+		Error += Max * Max == Max ? 0 : 1;
+		Error += Max * Min == Min ? 0 : 1;
+		Error += One / Zero == Max ? 0 : 1;
+		Error += -One / Zero == Min ? 0 : 1;
+		Error += glm::abs(Min) == Max ? 0 : 1;
+		Error += glm::ceil(Max) == Max ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		Error += test_random<glm::fixed16_16>(300.0);
+		Error += test_random<glm::fixed8_8>(20.0);
+		Error += test_saturation<glm::fixed16_16>();
+		Error += test_saturation<glm::fixed8_8>();
+
+		// Ties of the division are rounded away from zero
+		Error += (glm::fixed16_16::fromRaw(1) / glm::fixed16_16(2)).value == 1 ? 0 : 1;
+		Error += (glm::fixed16_16::fromRaw(-1) / glm::fixed16_16(2)).value == -1 ? 0 : 1;
+
+		Error += glm::floor(glm::fixed16_16(-1.25)) == glm::fixed16_16(-2) ? 0 : 1;
+		Error += glm::ceil(glm::fixed16_16(-1.25)) == glm::fixed16_16(-1) ? 0 : 1;
+		Error += glm::floor(glm::fixed8_8(2.5)) == glm::fixed8_8(2) ? 0 : 1;
+		Error += glm::ceil(glm::fixed8_8(2.5)) == glm::fixed8_8(3) ? 0 : 1;
+		Error += glm::clamp(glm::fixed16_16(5), glm::fixed16_16(0), glm::fixed16_16(1)) == glm::fixed16_16(1) ? 0 : 1;
+		Error += glm::min(glm::fixed16_16(-5), glm::fixed16_16(1)) == glm::fixed16_16(-5) ? 0 : 1;
+		Error += glm::max(glm::fixed16_16(-5), glm::fixed16_16(1)) == glm::fixed16_16(1) ? 0 : 1;
+
+		if(Error)
+			std::printf("arithmetic: %d errors\n", Error);
+
+		return Error;
+	}
+}//namespace arithmetic
+
+namespace sqrt_reciprocal
+{
+	template <typename fixedType>
+	int test_value(typename fixedType::storage_type Raw)
+	{
+		fixedType const x = fixedType::fromRaw(Raw);
+		double const Exact = std::floor(std::sqrt(static_cast<double>(Raw) / ulp<fixedType>()) + 0.5);
+
+		int Error(0);
+
+		fixedType const Sqrt = glm::sqrt(x);
+		Error += Sqrt.value == static_cast<typename fixedType::storage_type>(Exact) ? 0 : 1;
+		fixedType const FastSqrt = glm::fastSqrt(x);
+		Error += std::abs(FastSqrt.value - Sqrt.value) <= 1 ? 0 : 1;
+
+		fixedType const Reciprocal = glm::reciprocal(x);
+		Error += Reciprocal == fixedType(1) / x ? 0 : 1;
+		fixedType const FastReciprocal = glm::fastReciprocal(x);
+		Error += std::abs(static_cast<double>(FastReciprocal.value) - static_cast<double>(Reciprocal.value)) <= 1.0 ? 0 : 1;
+		fixedType const NegReciprocal = glm::fastReciprocal(-x);
+		Error += std::abs(static_cast<double>(NegReciprocal.value) - static_cast<double>(glm::reciprocal(-x).value)) <= 1.0 ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		// Every Q8.8 number
+		for(glm::int32 Raw = 1; Raw <= std::numeric_limits<glm::int16>::max(); ++Raw)
+			Error += test_value<glm::fixed8_8>(static_cast<glm::int16>(Raw));
+
+		// Small Q16.16 numbers and a sweep of the range
+		for(glm::int32 Raw = 1; Raw <= 1 << 17; ++Raw)
+			Error += test_value<glm::fixed16_16>(Raw);
+		for(glm::int64 Raw = 1 << 17; Raw <= std::numeric_limits<glm::int32>::max(); Raw += 4099)
+			Error += test_value<glm::fixed16_16>(static_cast<glm::int32>(Raw));
+		Error += test_value<glm::fixed16_16>(std::numeric_limits<glm::int32>::max());
+
+		Error += glm::sqrt(glm::fixed16_16(-4)) == glm::fixed16_16(0) ? 0 : 1;
+		Error += glm::fastSqrt(glm::fixed16_16(-4)) == glm::fixed16_16(0) ? 0 : 1;
+		Error += glm::sqrt(glm::fixed16_16(0)) == glm::fixed16_16(0) ? 0 : 1;
+		Error += glm::fastReciprocal(glm::fixed16_16(0)).value == std::numeric_limits<glm::int32>::max() ? 0 : 1;
+		Error += glm::fastReciprocal(glm::fixed16_16(4)) == glm::fixed16_16(0.25) ? 0 : 1;
+
+#		if GLM_HAS_UNRESTRICTED_UNIONS
+			glm::fixed16_16vec3 const v(glm::fixed16_16(4), glm::fixed16_16(9), glm::fixed16_16(0.25));
+			Error += glm::all(glm::equal(glm::sqrt(v), glm::fixed16_16vec3(glm::fixed16_16(2), glm::fixed16_16(3), glm::fixed16_16(0.5)))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::fastSqrt(v), glm::sqrt(v))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::reciprocal(v), glm::fastReciprocal(v))) ? 0 : 1;
+#		endif//GLM_HAS_UNRESTRICTED_UNIONS
+
+		if(Error)
+			std::printf("sqrt_reciprocal: %d errors\n", Error);
+
+		return Error;
+	}
+}//namespace sqrt_reciprocal
+
+// The vectors and matrices of tfixed need the unrestricted unions of C++11
+#if GLM_HAS_UNRESTRICTED_UNIONS
+namespace vector
+{
+	int test()
+	{
+		int Error(0);
+
+		glm::fixed16_16vec3 const a(glm::fixed16_16(1.5), glm::fixed16_16(-2), glm::fixed16_16(0.25));
+		glm::fixed16_16vec3 const b(glm::fixed16_16(2));
+
+		Error += sizeof(glm::fixed16_16vec4) == 16 ? 0 : 1;
+		Error += sizeof(glm::fixed8_8vec4) == 8 ? 0 : 1;
+
+		Error += glm::all(glm::equal(a + b, glm::fixed16_16vec3(glm::fixed16_16(3.5), glm::fixed16_16(0), glm::fixed16_16(2.25)))) ? 0 : 1;
+		Error += glm::all(glm::equal(a * b, glm::fixed16_16vec3(glm::fixed16_16(3), glm::fixed16_16(-4), glm::fixed16_16(0.5)))) ? 0 : 1;
+		Error += glm::all(glm::equal(a * glm::fixed16_16(2), a * b)) ? 0 : 1;
+		Error += glm::all(glm::equal(-a, glm::fixed16_16vec3(glm::fixed16_16(0)) - a)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::abs(a), glm::fixed16_16vec3(glm::fixed16_16(1.5), glm::fixed16_16(2), glm::fixed16_16(0.25)))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::floor(a), glm::fixed16_16vec3(glm::fixed16_16(1), glm::fixed16_16(-2), glm::fixed16_16(0)))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::clamp(a, glm::fixed16_16vec3(glm::fixed16_16(0)), glm::fixed16_16vec3(glm::fixed16_16(1))), glm::fixed16_16vec3(glm::fixed16_16(1), glm::fixed16_16(0), glm::fixed16_16(0.25)))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::vec3(a), glm::vec3(1.5f, -2.0f, 0.25f))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::fixed8_8vec3(glm::vec3(1.5f, -2.0f, 0.25f)), glm::fixed8_8vec3(glm::fixed8_8(1.5), glm::fixed8_8(-2), glm::fixed8_8(0.25)))) ? 0 : 1;
+
+		// Products accumulated in the wide type and rounded once
+		glm::pcg32 Engine(2);
+		for(int i = 0; i < 1 << 12; ++i)
+		{
+			glm::fixed16_16vec4 const x = next_fixed16_16vec4(Engine, 50.0);
+			glm::fixed16_16vec4 const y = next_fixed16_16vec4(Engine, 50.0);
+			glm::dvec4 const dx(to_double(x.x), to_double(x.y), to_double(x.z), to_double(x.w));
+			glm::dvec4 const dy(to_double(y.x), to_double(y.y), to_double(y.z), to_double(y.w));
+
+			Error += error(glm::dot(x, y), glm::dot(dx, dy)) <= DotTolerance ? 0 : 1;
+			Error += error(glm::dot(glm::fixed16_16vec2(x), glm::fixed16_16vec2(y)), glm::dot(glm::dvec2(dx), glm::dvec2(dy))) <= DotTolerance ? 0 : 1;
+
+			glm::fixed16_16vec3 const Cross = glm::cross(glm::fixed16_16vec3(x), glm::fixed16_16vec3(y));
+			glm::dvec3 const DCross = glm::cross(glm::dvec3(dx), glm::dvec3(dy));
+			for(glm::length_t j = 0; j < 3; ++j)
+				Error += error(Cross[j], DCross[j]) <= DotTolerance ? 0 : 1;
+
+			Error += error(glm::length(glm::fixed16_16vec3(x)), glm::length(glm::dvec3(dx))) <= 1.0 ? 0 : 1;
+		}
+
+		if(Error)
+			std::printf("vector: %d errors\n", Error);
+
+		return Error;
+	}
+}//namespace vector
+
+namespace matrix
+{
+	int test()
+	{
+		int Error(0);
+
+		glm::pcg32 Engine(3);
+		for(int i = 0; i < 1 << 10; ++i)
+		{
+			glm::fixed16_16mat4 const m(next_fixed16_16vec4(Engine, 4.0), next_fixed16_16vec4(Engine, 4.0), next_fixed16_16vec4(Engine, 4.0), next_fixed16_16vec4(Engine, 4.0));
+			glm::fixed16_16vec4 const v = next_fixed16_16vec4(Engine, 100.0);
+
+			glm::dmat4 dm;
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t r = 0; r < 4; ++r)
+				dm[c][r] = to_double(m[c][r]);
+			glm::dvec4 const dv(to_double(v.x), to_double(v.y), to_double(v.z), to_double(v.w));
+
+			glm::fixed16_16vec4 const Transformed = m * v;
+			glm::dvec4 const DTransformed = dm * dv;
+			for(glm::length_t j = 0; j < 4; ++j)
+				Error += error(Transformed[j], DTransformed[j]) <= DotTolerance ? 0 : 1;
+
+			glm::fixed16_16mat4 const Product = m * m;
+			glm::dmat4 const DProduct = dm * dm;
+			for(glm::length_t c = 0; c < 4; ++c)
+			for(glm::length_t r = 0; r < 4; ++r)
+				Error += error(Product[c][r], DProduct[c][r]) <= DotTolerance ? 0 : 1;
+
+			glm::fixed16_16mat3 const m3(m);
+			Error += equal_raw(m3 * glm::fixed16_16vec3(v), glm::fixed16_16vec3(m * glm::fixed16_16vec4(glm::fixed16_16vec3(v), glm::fixed16_16(0)))) ? 0 : 1;
+		}
+
+		glm::fixed8_8mat2 const m2(glm::fixed8_8(0.5), glm::fixed8_8(1), glm::fixed8_8(-1), glm::fixed8_8(2));
+		glm::fixed8_8vec2 const v2(glm::fixed8_8(2), glm::fixed8_8(3));
+		Error += glm::all(glm::equal(m2 * v2, glm::fixed8_8vec2(glm::fixed8_8(-2), glm::fixed8_8(8)))) ? 0 : 1;
+		Error += glm::all(glm::equal((m2 * m2)[0], m2 * m2[0])) ? 0 : 1;
+
+		if(Error)
+			std::printf("matrix: %d errors\n", Error);
+
+		return Error;
+	}
+}//namespace matrix
+
+namespace batch
+{
+	// Every level matches the scalar operators exactly, saturation included
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1027;
+		glm::pcg32 Engine(4);
+
+		std::vector<glm::fixed16_16vec4> A16(Count), B16(Count), Src16(Count), Dst16(Count);
+		std::vector<glm::fixed8_8vec4> A8(Count), B8(Count), Dst8(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A16[i] = i & 1 ? next_raw_fixed16_16vec4(Engine) : next_fixed16_16vec4(Engine, 200.0);
+			B16[i] = i & 2 ? next_raw_fixed16_16vec4(Engine) : next_fixed16_16vec4(Engine, 200.0);
+			Src16[i] = i & 4 ? next_raw_fixed16_16vec4(Engine) : next_fixed16_16vec4(Engine, 1000.0);
+			A8[i] = next_raw_fixed8_8vec4(Engine);
+			B8[i] = next_raw_fixed8_8vec4(Engine);
+		}
+		glm::fixed16_16mat4 const Matrices[] =
+		{
+			glm::fixed16_16mat4(next_fixed16_16vec4(Engine, 4.0), next_fixed16_16vec4(Engine, 4.0), next_fixed16_16vec4(Engine, 4.0), next_fixed16_16vec4(Engine, 4.0)),
+			glm::fixed16_16mat4(next_raw_fixed16_16vec4(Engine), next_raw_fixed16_16vec4(Engine), next_raw_fixed16_16vec4(Engine), next_raw_fixed16_16vec4(Engine))
+		};
+
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= glm::simdMaxLevel(); ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			int LevelError = 0;
+
+			glm::addBatch(&A16[0], &B16[0], &Dst16[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				LevelError += equal_raw(Dst16[i], A16[i] + B16[i]) ? 0 : 1;
+			glm::subBatch(&A16[0], &B16[0], &Dst16[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				LevelError += equal_raw(Dst16[i], A16[i] - B16[i]) ? 0 : 1;
+			glm::mulBatch(&A16[0], &B16[0], &Dst16[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				LevelError += equal_raw(Dst16[i], A16[i] * B16[i]) ? 0 : 1;
+			for(std::size_t m = 0; m < sizeof(Matrices) / sizeof(Matrices[0]); ++m)
+			{
+				glm::transformBatch(Matrices[m], &Src16[0], &Dst16[0], Count);
+				for(std::size_t i = 0; i < Count; ++i)
+					LevelError += equal_raw(Dst16[i], Matrices[m] * Src16[i]) ? 0 : 1;
+			}
+
+			glm::addBatch(&A8[0], &B8[0], &Dst8[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				LevelError += equal_raw(Dst8[i], A8[i] + B8[i]) ? 0 : 1;
+			glm::subBatch(&A8[0], &B8[0], &Dst8[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				LevelError += equal_raw(Dst8[i], A8[i] - B8[i]) ? 0 : 1;
+			glm::mulBatch(&A8[0], &B8[0], &Dst8[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				LevelError += equal_raw(Dst8[i], A8[i] * B8[i]) ? 0 : 1;
+
+			if(LevelError)
+				std::printf("batch %s: %d errors\n", glm::simdLevelName(static_cast<glm::simd_level>(Level)), LevelError);
+			Error += LevelError;
+		}
+
+		glm::simdForceLevel(glm::simdMaxLevel());
+
+		return Error;
+	}
+}//namespace batch
+
+namespace bench
+{
+	// Throughput of the fixed-point paths against float, on arrays fitting in the caches, then their accuracy against double
+	int perf()
+	{
+		std::size_t const Count = 1 << 10;
+		int const Repeat = 4096;
+
+		glm::pcg32 Engine(5);
+		std::vector<glm::fixed16_16vec4> A16(Count), B16(Count), Dst16(Count);
+		std::vector<glm::fixed8_8vec4> A8(Count), B8(Count), Dst8(Count);
+		std::vector<glm::vec4> AF(Count), BF(Count), DstF(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A16[i] = next_fixed16_16vec4(Engine, 100.0);
+			B16[i] = next_fixed16_16vec4(Engine, 100.0);
+			A8[i] = glm::fixed8_8vec4(A16[i] * glm::fixed16_16(0.25));
+			B8[i] = glm::fixed8_8vec4(B16[i] * glm::fixed16_16(0.25));
+			AF[i] = glm::vec4(A16[i]);
+			BF[i] = glm::vec4(B16[i]);
+		}
+		glm::fixed16_16mat4 const M16(next_fixed16_16vec4(Engine, 2.0), next_fixed16_16vec4(Engine, 2.0), next_fixed16_16vec4(Engine, 2.0), next_fixed16_16vec4(Engine, 2.0));
+		glm::mat4 const MF(M16);
+
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= glm::simdMaxLevel(); ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::clock_t Time[6];
+			Time[0] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::mulBatch(&A16[0], &B16[0], &Dst16[0], Count);
+			Time[1] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::mulBatch(&A8[0], &B8[0], &Dst8[0], Count);
+			Time[2] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::addBatch(&A16[0], &B16[0], &Dst16[0], Count);
+			Time[3] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::transformBatch(M16, &A16[0], &Dst16[0], Count);
+			Time[4] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::transformBatch(MF, &AF[0], &DstF[0], Count);
+			Time[5] = std::clock();
+
+			std::printf("%s mul fixed16_16vec4: %d, mul fixed8_8vec4: %d, add fixed16_16vec4: %d, transform fixed16_16mat4: %d, transform mat4: %d clocks\n",
+				glm::simdLevelName(static_cast<glm::simd_level>(Level)),
+				static_cast<int>(Time[1] - Time[0]), static_cast<int>(Time[2] - Time[1]), static_cast<int>(Time[3] - Time[2]),
+				static_cast<int>(Time[4] - Time[3]), static_cast<int>(Time[5] - Time[4]));
+		}
+
+		glm::simdForceLevel(glm::simdMaxLevel());
+
+		{
+			std::clock_t Time[4];
+			Time[0] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				DstF[j] = AF[j] * BF[j];
+			Time[1] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				Dst16[j] = A16[j] * B16[j];
+			Time[2] = std::clock();
+			for(int i = 0; i < Repeat / 16; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				Dst16[j] = A16[j] / B16[j];
+			Time[3] = std::clock();
+
+			std::printf("scalar mul vec4: %d, mul fixed16_16vec4: %d, div fixed16_16vec4 (1/16 of the iterations): %d clocks\n",
+				static_cast<int>(Time[1] - Time[0]), static_cast<int>(Time[2] - Time[1]), static_cast<int>(Time[3] - Time[2]));
+		}
+
+		{
+			std::clock_t Time[7];
+			Time[0] = std::clock();
+			for(int i = 0; i < Repeat / 16; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				Dst16[j] = glm::sqrt(glm::abs(A16[j]));
+			Time[1] = std::clock();
+			for(int i = 0; i < Repeat / 16; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				Dst16[j] = glm::fastSqrt(glm::abs(A16[j]));
+			Time[2] = std::clock();
+			for(int i = 0; i < Repeat / 16; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				DstF[j] = glm::sqrt(glm::abs(AF[j]));
+			Time[3] = std::clock();
+			for(int i = 0; i < Repeat / 16; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				Dst16[j] = glm::reciprocal(A16[j]);
+			Time[4] = std::clock();
+			for(int i = 0; i < Repeat / 16; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				Dst16[j] = glm::fastReciprocal(A16[j]);
+			Time[5] = std::clock();
+			for(int i = 0; i < Repeat / 16; ++i)
+			for(std::size_t j = 0; j < Count; ++j)
+				DstF[j] = 1.0f / AF[j];
+			Time[6] = std::clock();
+
+			std::printf("sqrt fixed16_16vec4: %d, fastSqrt fixed16_16vec4: %d, sqrt vec4: %d, reciprocal fixed16_16vec4: %d, fastReciprocal fixed16_16vec4: %d, 1 / vec4: %d clocks\n",
+				static_cast<int>(Time[1] - Time[0]), static_cast<int>(Time[2] - Time[1]), static_cast<int>(Time[3] - Time[2]),
+				static_cast<int>(Time[4] - Time[3]), static_cast<int>(Time[5] - Time[4]), static_cast<int>(Time[6] - Time[5]));
+		}
+
+		// Largest absolute error against double, in units of 2^-16
+		{
+			glm::transformBatch(M16, &A16[0], &Dst16[0], Count);
+			glm::transformBatch(MF, &AF[0], &DstF[0], Count);
+
+			glm::dmat4 const MD(MF);
+			double MaxFixed = 0, MaxFloat = 0, MaxFixedMul = 0, MaxFloatMul = 0;
+			for(std::size_t j = 0; j < Count; ++j)
+			{
+				glm::dvec4 const Reference = MD * glm::dvec4(AF[j]);
+				glm::dvec4 const ReferenceMul = glm::dvec4(AF[j]) * glm::dvec4(BF[j]);
+				glm::vec4 const ProdF = AF[j] * BF[j];
+				glm::fixed16_16vec4 const Prod16 = A16[j] * B16[j];
+				for(glm::length_t k = 0; k < 4; ++k)
+				{
+					MaxFixed = glm::max(MaxFixed, error(Dst16[j][k], Reference[k]));
+					MaxFloat = glm::max(MaxFloat, std::abs(static_cast<double>(DstF[j][k]) - Reference[k]) * 65536.0);
+					MaxFixedMul = glm::max(MaxFixedMul, error(Prod16[k], ReferenceMul[k]));
+					MaxFloatMul = glm::max(MaxFloatMul, std::abs(static_cast<double>(ProdF[k]) - ReferenceMul[k]) * 65536.0);
+				}
+			}
+
+			std::printf("max error against double in units of 2^-16, mul: fixed16_16 %f, float %f, transform: fixed16_16 %f, float %f\n",
+				MaxFixedMul, MaxFloatMul, MaxFixed, MaxFloat);
+		}
+
+		return 0;
+	}
+}//namespace bench
+#endif//GLM_HAS_UNRESTRICTED_UNIONS
+
+int main()
+{
+	int Error(0);
+
+	Error += conversion::test();
+	Error += arithmetic::test();
+	Error += sqrt_reciprocal::test();
+#	if GLM_HAS_UNRESTRICTED_UNIONS
+		Error += vector::test();
+		Error += matrix::test();
+		Error += batch::test();
+
+#		ifdef NDEBUG
+			Error += bench::perf();
+#		endif//NDEBUG
+#	endif//GLM_HAS_UNRESTRICTED_UNIONS
+
+	return Error;
+}
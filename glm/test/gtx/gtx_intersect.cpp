@@ -30,10 +30,90 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <glm/gtx/intersect.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+int test_intersectRayAABB()
+{
+	int Error(0);
+
+	glm::vec3 const Min(-1.0f), Max(1.0f);
+	float Distance(0.0f);
+
+	Error += glm::intersectRayAABB(glm::vec3(-3.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), Min, Max, Distance) ? 0 : 1;
+	Error += glm::epsilonEqual(Distance, 2.0f, 0.0001f) ? 0 : 1;
+
+	Error += glm::intersectRayAABB(glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f), Min, Max, Distance) ? 0 : 1;
+	Error += glm::epsilonEqual(Distance, 0.0f, 0.0001f) ? 0 : 1;
+
+	Error += glm::intersectRayAABB(glm::vec3(-3.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f), Min, Max, Distance) ? 1 : 0;
+	Error += glm::intersectRayAABB(glm::vec3(-3.0f, 2.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), Min, Max, Distance) ? 1 : 0;
+
+	return Error;
+}
+
+int test_intersectAABBAABB()
+{
+	int Error(0);
+
+	Error += glm::intersectAABBAABB(glm::vec3(0.0f), glm::vec3(1.0f), glm::vec3(0.5f), glm::vec3(2.0f)) ? 0 : 1;
+	Error += glm::intersectAABBAABB(glm::vec3(0.0f), glm::vec3(1.0f), glm::vec3(1.0f), glm::vec3(2.0f)) ? 0 : 1;
+	Error += glm::intersectAABBAABB(glm::vec3(0.0f), glm::vec3(1.0f), glm::vec3(1.5f, 0.0f, 0.0f), glm::vec3(2.0f)) ? 1 : 0;
+
+	return Error;
+}
+
+int test_intersectSphereFrustum()
+{
+	int Error(0);
+
+	// The unit cube as a frustum
+	glm::vec4 const Planes[] =
+	{
+		glm::vec4( 1, 0, 0, 1), glm::vec4(-1, 0, 0, 1),
+		glm::vec4( 0, 1, 0, 1), glm::vec4( 0,-1, 0, 1),
+		glm::vec4( 0, 0, 1, 1), glm::vec4( 0, 0,-1, 1)
+	};
+
+	Error += glm::intersectSphereFrustum(glm::vec3(0.0f), 0.5f, Planes) ? 0 : 1;
+	Error += glm::intersectSphereFrustum(glm::vec3(1.4f, 0.0f, 0.0f), 0.5f, Planes) ? 0 : 1;
+	Error += glm::intersectSphereFrustum(glm::vec3(1.6f, 0.0f, 0.0f), 0.5f, Planes) ? 1 : 0;
+	Error += glm::intersectSphereFrustum(glm::vec3(0.0f, 0.0f, -3.0f), 0.5f, Planes) ? 1 : 0;
+
+	return Error;
+}
+
+int test_intersectOBB()
+{
+	int Error(0);
+
+	glm::mat3 const Rotation(glm::rotate(glm::mat4(1.0f), glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
+	glm::vec3 const Extent(1.0f, 0.1f, 1.0f);
+	float Distance(0.0f);
+
+	// A thin box rotated by 45 degrees along the diagonal of the xy plane
+	Error += glm::intersectRayOBB(glm::vec3(2.0f, 2.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f), Extent, Rotation, Distance) ? 1 : 0;
+	Error += glm::intersectRayOBB(glm::vec3(0.5f, 3.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f), Extent, Rotation, Distance) ? 0 : 1;
+	Error += glm::epsilonEqual(Distance, 2.5f - 0.1f * glm::sqrt(2.0f), 0.0001f) ? 0 : 1;
+
+	glm::mat3 const Identity(1.0f);
+	Error += glm::intersectOBBOBB(glm::vec3(0.0f), Extent, Rotation, glm::vec3(0.5f, 0.5f, 0.0f), glm::vec3(0.1f), Identity) ? 0 : 1;
+	Error += glm::intersectOBBOBB(glm::vec3(0.0f), Extent, Rotation, glm::vec3(0.5f, -0.5f, 0.0f), glm::vec3(0.1f), Identity) ? 1 : 0;
+	// Parallel boxes
+	Error += glm::intersectOBBOBB(glm::vec3(0.0f), Extent, Rotation, glm::vec3(0.0f, 0.0f, 1.5f), Extent, Rotation) ? 0 : 1;
+	Error += glm::intersectOBBOBB(glm::vec3(0.0f), Extent, Rotation, glm::vec3(0.0f, 0.0f, 2.5f), Extent, Rotation) ? 1 : 0;
+
+	return Error;
+}
 
 int main()
 {
 	int Error(0);
 
+	Error += test_intersectRayAABB();
+	Error += test_intersectAABBAABB();
+	Error += test_intersectSphereFrustum();
+	Error += test_intersectOBB();
+
 	return Error;
 }
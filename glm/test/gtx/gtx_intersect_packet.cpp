@@ -0,0 +1,428 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @file test/gtx/gtx_intersect_packet.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_access.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/closest_point.hpp>
+#include <glm/gtx/intersect_packet.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+#if(GLM_ARCH != GLM_ARCH_PURE)
+
+namespace
+{
+	glm::mat3 next_rotation(glm::pcg32 & Engine)
+	{
+		glm::vec3 const Axis(glm::normalize(glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine) + glm::vec3(0.0f, 0.0f, 0.01f)));
+		return glm::mat3(glm::rotate(glm::mat4(1.0f), glm::linearRand(0.0f, 6.28f, Engine), Axis));
+	}
+
+	template <typename vecType>
+	vecType pack(std::vector<glm::vec3> const & Src)
+	{
+		vecType Dst;
+		glm::gather(&Src[0], Dst);
+		return Dst;
+	}
+
+	template <typename packType>
+	packType pack(std::vector<float> const & Src)
+	{
+		return packType::load(&Src[0]);
+	}
+
+	bool lane(int Mask, glm::length_t i)
+	{
+		return ((Mask >> i) & 1) != 0;
+	}
+
+	// Planes of the frustum of a camera at the origin looking at -z, normals pointing inside
+	void make_frustum(glm::vec4 * Planes)
+	{
+		glm::mat4 const m = glm::perspective(glm::radians(60.0f), 1.5f, 0.5f, 20.0f);
+		Planes[0] = glm::row(m, 3) + glm::row(m, 0);
+		Planes[1] = glm::row(m, 3) - glm::row(m, 0);
+		Planes[2] = glm::row(m, 3) + glm::row(m, 1);
+		Planes[3] = glm::row(m, 3) - glm::row(m, 1);
+		Planes[4] = glm::row(m, 3) + glm::row(m, 2);
+		Planes[5] = glm::row(m, 3) - glm::row(m, 2);
+		for(std::size_t i = 0; i < 6; ++i)
+			Planes[i] /= glm::length(glm::vec3(Planes[i]));
+	}
+}//namespace
+
+template <typename vecType>
+int test_ray()
+{
+	typedef typename vecType::value_type packType;
+	glm::length_t const Lanes = vecType::lanes;
+
+	int Error(0);
+	glm::pcg32 Engine(1);
+	std::vector<glm::vec3> Orig(Lanes), Dir(Lanes), A(Lanes), B(Lanes), C(Lanes);
+	std::vector<float> Radius(Lanes);
+
+	for(std::size_t Iteration = 0; Iteration < 256; ++Iteration)
+	{
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			Orig[i] = glm::linearRand(glm::vec3(-4.0f), glm::vec3(4.0f), Engine);
+			Dir[i] = glm::normalize(glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine) - Orig[i] * 0.2f);
+			A[i] = glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine);
+			B[i] = glm::normalize(glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine));
+			C[i] = glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine);
+			Radius[i] = glm::linearRand(0.0f, 2.0f, Engine);
+		}
+
+		vecType const PackOrig(pack<vecType>(Orig)), PackDir(pack<vecType>(Dir));
+		vecType const PackA(pack<vecType>(A)), PackB(pack<vecType>(B)), PackC(pack<vecType>(C));
+
+		// Planes through A of normal B
+		packType PlaneDistance;
+		int const PlaneMask = glm::movemask(glm::intersectRayPlane(PackOrig, PackDir, PackA, PackB, PlaneDistance));
+
+		// Triangles A, A + B, C
+		vecType Bary;
+		int const TriangleMask = glm::movemask(glm::intersectRayTriangle(PackOrig, PackDir, PackA, PackA + PackB, PackC, Bary));
+
+		// Spheres of center A
+		packType SphereDistance;
+		int const SphereMask = glm::movemask(glm::intersectRaySphere(PackOrig, PackDir, PackA, pack<packType>(Radius) * pack<packType>(Radius), SphereDistance));
+
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			float Distance(0.0f);
+			bool const Plane = glm::intersectRayPlane(Orig[i], Dir[i], A[i], B[i], Distance);
+			Error += lane(PlaneMask, i) == Plane ? 0 : 1;
+			Error += !Plane || glm::epsilonEqual(PlaneDistance[i], Distance, 0.001f * glm::max(1.0f, glm::abs(Distance))) ? 0 : 1;
+
+			glm::vec3 Position;
+			bool const Triangle = glm::intersectRayTriangle(Orig[i], Dir[i], A[i], A[i] + B[i], C[i], Position);
+			Error += lane(TriangleMask, i) == Triangle ? 0 : 1;
+			Error += !Triangle || glm::all(glm::epsilonEqual(Bary[i], Position, 0.001f)) ? 0 : 1;
+
+			bool const Sphere = glm::intersectRaySphere(Orig[i], Dir[i], A[i], Radius[i] * Radius[i], Distance);
+			Error += lane(SphereMask, i) == Sphere ? 0 : 1;
+			Error += !Sphere || glm::epsilonEqual(SphereDistance[i], Distance, 0.001f) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template <typename vecType>
+int test_box()
+{
+	typedef typename vecType::value_type packType;
+	glm::length_t const Lanes = vecType::lanes;
+
+	int Error(0);
+	glm::pcg32 Engine(2);
+	std::vector<glm::vec3> MinA(Lanes), MaxA(Lanes), MinB(Lanes), MaxB(Lanes);
+
+	for(std::size_t Iteration = 0; Iteration < 256; ++Iteration)
+	{
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			MinA[i] = glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine);
+			MaxA[i] = MinA[i] + glm::linearRand(glm::vec3(0.0f), glm::vec3(1.0f), Engine);
+			MinB[i] = glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine);
+			MaxB[i] = MinB[i] + glm::linearRand(glm::vec3(0.0f), glm::vec3(1.0f), Engine);
+		}
+
+		// One ray against the boxes A
+		glm::vec3 const Orig(glm::linearRand(glm::vec3(-4.0f), glm::vec3(4.0f), Engine));
+		glm::vec3 const Dir(glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine) - Orig * 0.25f);
+
+		packType Distance;
+		int const RayMask = glm::movemask(glm::intersectRayAABB(vecType(Orig), vecType(Dir), pack<vecType>(MinA), pack<vecType>(MaxA), Distance));
+		int const BoxMask = glm::movemask(glm::intersectAABBAABB(pack<vecType>(MinA), pack<vecType>(MaxA), pack<vecType>(MinB), pack<vecType>(MaxB)));
+
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			float Expected(0.0f);
+			bool const Ray = glm::intersectRayAABB(Orig, Dir, MinA[i], MaxA[i], Expected);
+			Error += lane(RayMask, i) == Ray ? 0 : 1;
+			Error += !Ray || glm::epsilonEqual(Distance[i], Expected, 0.0001f) ? 0 : 1;
+
+			Error += lane(BoxMask, i) == glm::intersectAABBAABB(MinA[i], MaxA[i], MinB[i], MaxB[i]) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template <typename vecType>
+int test_frustum()
+{
+	typedef typename vecType::value_type packType;
+	glm::length_t const Lanes = vecType::lanes;
+
+	int Error(0);
+	glm::pcg32 Engine(3);
+	std::vector<glm::vec3> Center(Lanes);
+	std::vector<float> Radius(Lanes);
+
+	glm::vec4 Planes[6];
+	make_frustum(Planes);
+
+	int Inside(0);
+	for(std::size_t Iteration = 0; Iteration < 256; ++Iteration)
+	{
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			Center[i] = glm::linearRand(glm::vec3(-10.0f), glm::vec3(10.0f), Engine) - glm::vec3(0.0f, 0.0f, 8.0f);
+			Radius[i] = glm::linearRand(0.0f, 1.0f, Engine);
+		}
+
+		int const Mask = glm::movemask(glm::intersectSphereFrustum(pack<vecType>(Center), pack<packType>(Radius), Planes));
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			bool const Expected = glm::intersectSphereFrustum(Center[i], Radius[i], Planes);
+			Error += lane(Mask, i) == Expected ? 0 : 1;
+			Inside += Expected ? 1 : 0;
+		}
+	}
+
+	// Both cases are covered
+	Error += Inside > 0 && Inside < static_cast<int>(256 * Lanes) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename vecType>
+int test_obb()
+{
+	typedef typename vecType::value_type packType;
+	glm::length_t const Lanes = vecType::lanes;
+
+	int Error(0);
+	glm::pcg32 Engine(4);
+	std::vector<glm::vec3> CenterA(Lanes), ExtentA(Lanes), CenterB(Lanes), ExtentB(Lanes), Orig(Lanes), Dir(Lanes);
+	std::vector<glm::vec3> AxesA[3], AxesB[3];
+	std::vector<glm::mat3> RotationA(Lanes), RotationB(Lanes);
+	for(glm::length_t j = 0; j < 3; ++j)
+	{
+		AxesA[j].resize(Lanes);
+		AxesB[j].resize(Lanes);
+	}
+
+	int Overlaps(0);
+	for(std::size_t Iteration = 0; Iteration < 256; ++Iteration)
+	{
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			CenterA[i] = glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine);
+			ExtentA[i] = glm::linearRand(glm::vec3(0.0f), glm::vec3(1.0f), Engine) + 0.05f;
+			CenterB[i] = glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine);
+			ExtentB[i] = glm::linearRand(glm::vec3(0.0f), glm::vec3(1.0f), Engine) + 0.05f;
+			RotationA[i] = next_rotation(Engine);
+			// Some boxes share their orientation to cover the parallel edges
+			RotationB[i] = i % 4 == 0 ? RotationA[i] : next_rotation(Engine);
+			Orig[i] = glm::linearRand(glm::vec3(-4.0f), glm::vec3(4.0f), Engine);
+			Dir[i] = glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine) - Orig[i] * 0.25f;
+			for(glm::length_t j = 0; j < 3; ++j)
+			{
+				AxesA[j][i] = RotationA[i][j];
+				AxesB[j][i] = RotationB[i][j];
+			}
+		}
+
+		vecType const PackAxesA[] = {pack<vecType>(AxesA[0]), pack<vecType>(AxesA[1]), pack<vecType>(AxesA[2])};
+		vecType const PackAxesB[] = {pack<vecType>(AxesB[0]), pack<vecType>(AxesB[1]), pack<vecType>(AxesB[2])};
+
+		packType Distance;
+		int const RayMask = glm::movemask(glm::intersectRayOBB(pack<vecType>(Orig), pack<vecType>(Dir), pack<vecType>(CenterA), pack<vecType>(ExtentA), PackAxesA, Distance));
+		int const BoxMask = glm::movemask(glm::intersectOBBOBB(
+			pack<vecType>(CenterA), pack<vecType>(ExtentA), PackAxesA,
+			pack<vecType>(CenterB), pack<vecType>(ExtentB), PackAxesB));
+
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			float Expected(0.0f);
+			bool const Ray = glm::intersectRayOBB(Orig[i], Dir[i], CenterA[i], ExtentA[i], RotationA[i], Expected);
+			Error += lane(RayMask, i) == Ray ? 0 : 1;
+			Error += !Ray || glm::epsilonEqual(Distance[i], Expected, 0.0001f) ? 0 : 1;
+
+			bool const Box = glm::intersectOBBOBB(CenterA[i], ExtentA[i], RotationA[i], CenterB[i], ExtentB[i], RotationB[i]);
+			Error += lane(BoxMask, i) == Box ? 0 : 1;
+			Overlaps += Box ? 1 : 0;
+		}
+	}
+
+	Error += Overlaps > 0 && Overlaps < static_cast<int>(256 * Lanes) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename vecType>
+int test_closest_point()
+{
+	glm::length_t const Lanes = vecType::lanes;
+
+	int Error(0);
+	glm::pcg32 Engine(5);
+	std::vector<glm::vec3> Point(Lanes), A(Lanes), B(Lanes);
+
+	for(std::size_t Iteration = 0; Iteration < 256; ++Iteration)
+	{
+		for(glm::length_t i = 0; i < Lanes; ++i)
+		{
+			Point[i] = glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine);
+			A[i] = glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine);
+			B[i] = glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine);
+		}
+
+		vecType const Closest(glm::closestPointOnLine(pack<vecType>(Point), pack<vecType>(A), pack<vecType>(B)));
+		for(glm::length_t i = 0; i < Lanes; ++i)
+			Error += glm::all(glm::epsilonEqual(Closest[i], glm::closestPointOnLine(Point[i], A[i], B[i]), 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename vecType>
+int test()
+{
+	int Error(0);
+
+	Error += test_ray<vecType>();
+	Error += test_box<vecType>();
+	Error += test_frustum<vecType>();
+	Error += test_obb<vecType>();
+	Error += test_closest_point<vecType>();
+
+	return Error;
+}
+
+int perf()
+{
+	std::size_t const Count = 1 << 20;
+
+	glm::pcg32 Engine(6);
+	std::vector<glm::vec3> Center(Count), Extent(Count);
+	std::vector<float> Radius(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Center[i] = glm::linearRand(glm::vec3(-10.0f), glm::vec3(10.0f), Engine) - glm::vec3(0.0f, 0.0f, 8.0f);
+		Extent[i] = glm::linearRand(glm::vec3(0.0f), glm::vec3(0.5f), Engine);
+		Radius[i] = glm::linearRand(0.0f, 1.0f, Engine);
+	}
+
+	glm::vec4 Planes[6];
+	make_frustum(Planes);
+	glm::vec3 const Orig(0.0f);
+	glm::vec3 const Dir(0.1f, 0.2f, -1.0f);
+
+	// Culling of spheres by a frustum
+	std::clock_t const TimeFrustumScalarStart = std::clock();
+	int FrustumScalar(0);
+	for(std::size_t i = 0; i < Count; ++i)
+		FrustumScalar += glm::intersectSphereFrustum(Center[i], Radius[i], Planes) ? 1 : 0;
+	std::clock_t const TimeFrustumScalarEnd = std::clock();
+
+	std::clock_t const TimeFrustumPacketStart = std::clock();
+	int FrustumPacket(0);
+	for(std::size_t i = 0; i < Count; i += glm::vec3x4::lanes)
+	{
+		glm::vec3x4 P;
+		glm::gather(&Center[i], P);
+		FrustumPacket += glm::bitCount(glm::movemask(glm::intersectSphereFrustum(P, glm::simdPacket4::load(&Radius[i]), Planes)));
+	}
+	std::clock_t const TimeFrustumPacketEnd = std::clock();
+
+	// One ray against boxes
+	std::clock_t const TimeRayScalarStart = std::clock();
+	int RayScalar(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float Distance;
+		RayScalar += glm::intersectRayAABB(Orig, Dir, Center[i] - Extent[i], Center[i] + Extent[i], Distance) ? 1 : 0;
+	}
+	std::clock_t const TimeRayScalarEnd = std::clock();
+
+	std::clock_t const TimeRayPacketStart = std::clock();
+	int RayPacket(0);
+	glm::vec3x4 const PackOrig(Orig), PackDir(Dir);
+	for(std::size_t i = 0; i < Count; i += glm::vec3x4::lanes)
+	{
+		glm::vec3x4 C, E;
+		glm::gather(&Center[i], C);
+		glm::gather(&Extent[i], E);
+		glm::simdPacket4 Distance;
+		RayPacket += glm::bitCount(glm::movemask(glm::intersectRayAABB(PackOrig, PackDir, C - E, C + E, Distance)));
+	}
+	std::clock_t const TimeRayPacketEnd = std::clock();
+
+	double const Tests = static_cast<double>(Count) * 1e-6;
+	double const FrustumScalarTime = static_cast<double>(TimeFrustumScalarEnd - TimeFrustumScalarStart) / CLOCKS_PER_SEC;
+	double const FrustumPacketTime = static_cast<double>(TimeFrustumPacketEnd - TimeFrustumPacketStart) / CLOCKS_PER_SEC;
+	double const RayScalarTime = static_cast<double>(TimeRayScalarEnd - TimeRayScalarStart) / CLOCKS_PER_SEC;
+	double const RayPacketTime = static_cast<double>(TimeRayPacketEnd - TimeRayPacketStart) / CLOCKS_PER_SEC;
+	std::printf("intersectSphereFrustum vec3: %.1f M/s\n", FrustumScalarTime > 0.0 ? Tests / FrustumScalarTime : 0.0);
+	std::printf("intersectSphereFrustum vec3x4: %.1f M/s\n", FrustumPacketTime > 0.0 ? Tests / FrustumPacketTime : 0.0);
+	std::printf("intersectRayAABB vec3: %.1f M/s\n", RayScalarTime > 0.0 ? Tests / RayScalarTime : 0.0);
+	std::printf("intersectRayAABB vec3x4: %.1f M/s\n", RayPacketTime > 0.0 ? Tests / RayPacketTime : 0.0);
+
+	return FrustumScalar == FrustumPacket && RayScalar == RayPacket ? 0 : 1;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test<glm::vec3x4>();
+#	if GLM_ARCH & GLM_ARCH_AVX
+		Error += test<glm::vec3x8>();
+#	endif//GLM_ARCH & GLM_ARCH_AVX
+
+#	ifdef NDEBUG
+		Error += perf();
+#	endif//NDEBUG
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	int Error(0);
+
+	return Error;
+}
+
+#endif//(GLM_ARCH != GLM_ARCH_PURE)
@@ -0,0 +1,308 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_matrix_trs.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/matrix_decompose.hpp>
+#include <glm/gtx/matrix_trs.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	// Bones with any orientation, scales between 0.1 and 10 and, when Mirror is set,
+	// a reflection on every fourth bone
+	void make_bones(std::size_t Count, bool Mirror, std::vector<glm::trs> & Bones, std::vector<glm::mat4> & Matrices)
+	{
+		glm::pcg32 Engine(1);
+		Bones.resize(Count);
+		Matrices.resize(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::trs & Bone = Bones[i];
+			Bone.Translation = glm::linearRand(glm::vec3(-100.0f), glm::vec3(100.0f), Engine);
+			Bone.Rotation = glm::normalize(glm::quat(glm::linearRand(-1.0f, 1.0f, Engine), glm::linearRand(-1.0f, 1.0f, Engine), glm::linearRand(-1.0f, 1.0f, Engine), glm::linearRand(-1.0f, 1.0f, Engine)));
+			Bone.Scale = glm::pow(glm::vec3(10.0f), glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine));
+			if(Mirror && i % 4 == 3)
+				Bone.Scale.x = -Bone.Scale.x;
+			Matrices[i] = glm::translate(glm::mat4(1.0f), Bone.Translation) * glm::mat4_cast(Bone.Rotation) * glm::scale(glm::mat4(1.0f), Bone.Scale);
+		}
+	}
+
+	bool equal(glm::mat4 const & x, glm::mat4 const & y, float Epsilon)
+	{
+		for(glm::length_t c = 0; c < 4; ++c)
+			if(!glm::all(glm::epsilonEqual(x[c], y[c], Epsilon)))
+				return false;
+		return true;
+	}
+
+	// The rotations are equal up to the sign of the quaternions
+	bool equal(glm::quat const & x, glm::quat const & y, float Epsilon)
+	{
+		return glm::abs(glm::dot(x, y)) > 1.0f - Epsilon;
+	}
+
+	bool equal(glm::trs const & x, glm::trs const & y, float Epsilon)
+	{
+		return
+			glm::all(glm::epsilonEqual(x.Translation, y.Translation, Epsilon)) &&
+			glm::all(glm::epsilonEqual(x.Scale, y.Scale, Epsilon * glm::max(glm::abs(x.Scale.x), glm::max(glm::abs(x.Scale.y), glm::abs(x.Scale.z))))) &&
+			equal(x.Rotation, y.Rotation, Epsilon);
+	}
+
+	// A skeleton small enough to stay in the cache, evaluated for many frames
+	std::size_t const PerfBones = 1024;
+	std::size_t const PerfFrames = 512;
+
+	double rate(std::clock_t Start, std::clock_t End)
+	{
+		double const Time = static_cast<double>(End - Start) / CLOCKS_PER_SEC;
+		return Time > 0.0 ? Time / static_cast<double>(PerfBones * PerfFrames) * 1e9 : 0.0;
+	}
+}//namespace
+
+namespace decompose
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		std::vector<glm::trs> Bones;
+		std::vector<glm::mat4> Matrices;
+		make_bones(Count, true, Bones, Matrices);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::trs const Bone = glm::decomposeTRS(Matrices[i]);
+
+			// The decomposition of the bone matrices gives back the bones, and the round trip the matrices
+			Error += equal(Bone, Bones[i], 1e-4f) ? 0 : 1;
+			Error += equal(glm::composeTRS(Bone), Matrices[i], 1e-3f) ? 0 : 1;
+			Error += equal(glm::composeTRS(Bones[i]), Matrices[i], 1e-3f) ? 0 : 1;
+
+			// Same translation and scale as decompose, which doesn't handle reflections
+			if(Bones[i].Scale.x > 0.0f)
+			{
+				glm::vec3 Scale, Translation, Skew;
+				glm::quat Orientation;
+				glm::vec4 Perspective;
+				glm::decompose(Matrices[i], Scale, Orientation, Translation, Skew, Perspective);
+				Error += glm::all(glm::epsilonEqual(Bone.Translation, Translation, 1e-4f)) ? 0 : 1;
+				Error += glm::all(glm::epsilonEqual(Bone.Scale, Scale, 1e-4f * Scale)) ? 0 : 1;
+			}
+		}
+
+		// A reflection of any axis is reported along x, the rotation absorbing the rest
+		glm::mat4 const Mirror(glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, -3.0f, 4.0f)));
+		glm::trs const MirrorBone = glm::decomposeTRS(Mirror);
+		Error += glm::all(glm::epsilonEqual(MirrorBone.Scale, glm::vec3(-2.0f, 3.0f, 4.0f), 1e-6f)) ? 0 : 1;
+		Error += equal(glm::composeTRS(MirrorBone), Mirror, 1e-6f) ? 0 : 1;
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::trs> Results(Count);
+			glm::decomposeTRSBatch(&Matrices[0], &Results[0], Count);
+
+			std::vector<glm::mat4> Composed(Count);
+			glm::composeTRSBatch(&Results[0], &Composed[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += equal(Results[i], glm::decomposeTRS(Matrices[i]), 1e-5f) ? 0 : 1;
+				Error += equal(Composed[i], glm::composeTRS(Results[i]), 1e-4f) ? 0 : 1;
+				Error += equal(Composed[i], Matrices[i], 1e-3f) ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = PerfBones;
+		std::vector<glm::trs> Bones;
+		std::vector<glm::mat4> Matrices;
+		make_bones(Count, false, Bones, Matrices);
+		std::vector<glm::trs> Results(Count);
+		std::vector<glm::mat4> Composed(Count);
+
+		glm::vec3 Scale, Translation, Skew;
+		glm::quat Orientation;
+		glm::vec4 Perspective;
+		float Sum(0);
+
+		std::clock_t const TimeDecomposeStart = std::clock();
+		for(std::size_t Frame = 0; Frame < PerfFrames; ++Frame)
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::decompose(Matrices[i], Scale, Orientation, Translation, Skew, Perspective);
+			Sum += Orientation.w;
+		}
+		std::clock_t const TimeDecomposeEnd = std::clock();
+
+		std::clock_t const TimeDecomposeTRSStart = std::clock();
+		for(std::size_t Frame = 0; Frame < PerfFrames; ++Frame)
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = glm::decomposeTRS(Matrices[i]);
+		std::clock_t const TimeDecomposeTRSEnd = std::clock();
+
+		std::clock_t const TimeComposeTRSStart = std::clock();
+		for(std::size_t Frame = 0; Frame < PerfFrames; ++Frame)
+		for(std::size_t i = 0; i < Count; ++i)
+			Composed[i] = glm::composeTRS(Results[i]);
+		std::clock_t const TimeComposeTRSEnd = std::clock();
+
+		std::printf("decompose: %.1f ns per bone (%f)\n", rate(TimeDecomposeStart, TimeDecomposeEnd), Sum);
+		std::printf("decomposeTRS: %.1f ns per bone\n", rate(TimeDecomposeTRSStart, TimeDecomposeTRSEnd));
+		std::printf("composeTRS: %.1f ns per bone\n", rate(TimeComposeTRSStart, TimeComposeTRSEnd));
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeDecomposeBatchStart = std::clock();
+			for(std::size_t Frame = 0; Frame < PerfFrames; ++Frame)
+				glm::decomposeTRSBatch(&Matrices[0], &Results[0], Count);
+			std::clock_t const TimeDecomposeBatchEnd = std::clock();
+
+			std::clock_t const TimeComposeBatchStart = std::clock();
+			for(std::size_t Frame = 0; Frame < PerfFrames; ++Frame)
+				glm::composeTRSBatch(&Results[0], &Composed[0], Count);
+			std::clock_t const TimeComposeBatchEnd = std::clock();
+
+			char const * Name = glm::simdLevelName(glm::simdLevel());
+			std::printf("decomposeTRSBatch at the %s level: %.1f ns per bone\n", Name, rate(TimeDecomposeBatchStart, TimeDecomposeBatchEnd));
+			std::printf("composeTRSBatch at the %s level: %.1f ns per bone\n", Name, rate(TimeComposeBatchStart, TimeComposeBatchEnd));
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace decompose
+
+namespace blend
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		std::vector<glm::trs> X, Y;
+		std::vector<glm::mat4> Matrices;
+		make_bones(Count, false, X, Matrices);
+		Y.resize(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Y[i] = X[(i * 7 + 3) % Count];
+			if(i % 2)
+				Y[i].Rotation = -Y[i].Rotation;
+		}
+
+		// The end points of the blend are the poses
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += equal(glm::mixTRS(X[i], Y[i], 0.0f), X[i], 1e-5f) ? 0 : 1;
+			Error += equal(glm::mixTRS(X[i], Y[i], 1.0f), Y[i], 1e-5f) ? 0 : 1;
+		}
+
+		float const Weights[] = {0.0f, 0.25f, 0.5f, 1.0f};
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			for(std::size_t k = 0; k < sizeof(Weights) / sizeof(Weights[0]); ++k)
+			{
+				std::vector<glm::trs> Results(Count);
+				glm::mixTRSBatch(&X[0], &Y[0], Weights[k], &Results[0], Count);
+
+				for(std::size_t i = 0; i < Count; ++i)
+					Error += equal(Results[i], glm::mixTRS(X[i], Y[i], Weights[k]), 1e-5f) ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = PerfBones;
+		std::vector<glm::trs> X, Y, Results(Count);
+		std::vector<glm::mat4> Matrices;
+		make_bones(Count, false, X, Matrices);
+		Y.assign(X.rbegin(), X.rend());
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeStart = std::clock();
+			for(std::size_t Frame = 0; Frame < PerfFrames; ++Frame)
+				glm::mixTRSBatch(&X[0], &Y[0], 0.3f, &Results[0], Count);
+			std::clock_t const TimeEnd = std::clock();
+
+			std::printf("mixTRSBatch at the %s level: %.1f ns per bone\n", glm::simdLevelName(glm::simdLevel()), rate(TimeStart, TimeEnd));
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace blend
+
+int main()
+{
+	int Error(0);
+
+	Error += decompose::test();
+	Error += blend::test();
+
+#	ifdef NDEBUG
+		Error += decompose::perf();
+		Error += blend::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
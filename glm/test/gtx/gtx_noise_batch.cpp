@@ -0,0 +1,244 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_noise_batch.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/noise.hpp>
+#include <glm/gtx/noise_batch.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	float const Tolerance = 0.0001f;
+
+	// Deterministic points spread over [-40, 40], away from the origin where the noise is trivial
+	float make_coord(std::size_t i, std::size_t Axis)
+	{
+		unsigned int const Hash = static_cast<unsigned int>(i * 2654435761u + Axis * 40503u);
+		return static_cast<float>(Hash % 80000u) * 0.001f - 40.0f;
+	}
+
+	std::vector<glm::vec2> make_vec2(std::size_t Count)
+	{
+		std::vector<glm::vec2> Data(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Data[i] = glm::vec2(make_coord(i, 0), make_coord(i, 1));
+		return Data;
+	}
+
+	std::vector<glm::vec3> make_vec3(std::size_t Count)
+	{
+		std::vector<glm::vec3> Data(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Data[i] = glm::vec3(make_coord(i, 0), make_coord(i, 1), make_coord(i, 2));
+		return Data;
+	}
+
+	// perlin(vec3) picks its gradients with comparisons to 0 of values that are exactly 0 on some
+	// lattice points, so when the compiler may contract the scalar functions into FMA a few percent
+	// of the points may use another gradient. A wrong kernel fails on most of the points.
+#	if GLM_HAS_FMA || defined(__FMA__) || defined(__AVX2__)
+		std::size_t const Perlin3Divisor = 20;
+#	else
+		std::size_t const Perlin3Divisor = 0;
+#	endif
+
+	// Every point must be within Tolerance except for Results.size() / Divisor of them when Divisor isn't 0.
+	// The last points, computed from a padded packet, must always be within Tolerance.
+	int compare(std::vector<float> const & Results, std::vector<float> const & Expected, std::size_t Divisor = 0)
+	{
+		std::size_t const Tail = Results.size() & ~static_cast<std::size_t>(7);
+
+		int Error(0);
+		std::size_t Mismatches(0);
+		for(std::size_t i = 0; i < Results.size(); ++i)
+		{
+			if(glm::abs(Results[i] - Expected[i]) <= Tolerance)
+				continue;
+			if(i >= Tail)
+				++Error;
+			++Mismatches;
+		}
+
+		std::size_t const Allowed = Divisor ? Results.size() / Divisor : 0;
+		return Error + (Mismatches <= Allowed ? 0 : 1);
+	}
+}//namespace
+
+namespace batch
+{
+	// An odd count to exercise the remaining points of the SIMD paths
+	std::size_t const Count = 4099;
+
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec2> const P2 = make_vec2(Count);
+		std::vector<glm::vec3> const P3 = make_vec3(Count);
+		glm::vec2 const Rep2(4.0f, 7.0f);
+		glm::vec3 const Rep3(4.0f, 7.0f, 5.0f);
+
+		std::vector<float> Perlin2(Count), Perlin3(Count), Periodic2(Count), Periodic3(Count), Simplex2(Count), Simplex3(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Perlin2[i] = glm::perlin(P2[i]);
+			Perlin3[i] = glm::perlin(P3[i]);
+			Periodic2[i] = glm::perlin(P2[i], Rep2);
+			Periodic3[i] = glm::perlin(P3[i], Rep3);
+			Simplex2[i] = glm::simplex(P2[i]);
+			Simplex3[i] = glm::simplex(P3[i]);
+		}
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<float> Results(Count);
+
+			glm::perlinBatch(&P2[0], &Results[0], Count);
+			Error += compare(Results, Perlin2);
+			glm::perlinBatch(&P3[0], &Results[0], Count);
+			Error += compare(Results, Perlin3, Perlin3Divisor);
+			glm::perlinBatch(&P2[0], Rep2, &Results[0], Count);
+			Error += compare(Results, Periodic2);
+			glm::perlinBatch(&P3[0], Rep3, &Results[0], Count);
+			Error += compare(Results, Periodic3);
+			glm::simplexBatch(&P2[0], &Results[0], Count);
+			Error += compare(Results, Simplex2);
+			glm::simplexBatch(&P3[0], &Results[0], Count);
+			Error += compare(Results, Simplex3);
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+}//namespace batch
+
+namespace grid
+{
+	std::size_t const Width = 67;
+	std::size_t const Height = 13;
+
+	int test()
+	{
+		int Error(0);
+
+		glm::vec3 const Origin(-3.5f, 2.25f, 0.75f);
+		glm::vec3 const AxisX(0.13f, 0.0f, 0.02f);
+		glm::vec3 const AxisY(0.0f, 0.17f, 0.05f);
+		glm::vec2 const Rep(3.0f, 5.0f);
+
+		std::vector<float> Perlin2(Width * Height), Perlin3(Width * Height), Periodic2(Width * Height), Simplex2(Width * Height), Simplex3(Width * Height);
+		for(std::size_t y = 0; y < Height; ++y)
+		for(std::size_t x = 0; x < Width; ++x)
+		{
+			glm::vec3 const Position = Origin + AxisY * static_cast<float>(y) + AxisX * static_cast<float>(x);
+			Perlin2[y * Width + x] = glm::perlin(glm::vec2(Position));
+			Perlin3[y * Width + x] = glm::perlin(Position);
+			Periodic2[y * Width + x] = glm::perlin(glm::vec2(Position), Rep);
+			Simplex2[y * Width + x] = glm::simplex(glm::vec2(Position));
+			Simplex3[y * Width + x] = glm::simplex(Position);
+		}
+
+		std::vector<float> Results(Width * Height);
+
+		glm::perlinGrid(glm::vec2(Origin), glm::vec2(AxisX), glm::vec2(AxisY), Width, Height, &Results[0]);
+		Error += compare(Results, Perlin2);
+		glm::perlinGrid(Origin, AxisX, AxisY, Width, Height, &Results[0]);
+		Error += compare(Results, Perlin3, Perlin3Divisor);
+		glm::perlinGrid(glm::vec2(Origin), glm::vec2(AxisX), glm::vec2(AxisY), Rep, Width, Height, &Results[0]);
+		Error += compare(Results, Periodic2);
+		glm::simplexGrid(glm::vec2(Origin), glm::vec2(AxisX), glm::vec2(AxisY), Width, Height, &Results[0]);
+		Error += compare(Results, Simplex2);
+		glm::simplexGrid(Origin, AxisX, AxisY, Width, Height, &Results[0]);
+		Error += compare(Results, Simplex3);
+
+		return Error;
+	}
+
+	void print(char const * Name, std::clock_t Time, std::size_t Samples)
+	{
+		double const Seconds = static_cast<double>(Time) / static_cast<double>(CLOCKS_PER_SEC);
+		std::printf("%s: %d clocks, %.1f Msamples/s\n", Name, static_cast<int>(Time), Seconds > 0.0 ? static_cast<double>(Samples) / Seconds * 1e-6 : 0.0);
+	}
+
+	int perf()
+	{
+		std::size_t const Size = 1024;
+		std::vector<float> Results(Size * Size);
+		glm::vec2 const Step(1.0f / 64.0f);
+
+		std::clock_t const TimePerlinStart = std::clock();
+		for(std::size_t y = 0; y < Size; ++y)
+		for(std::size_t x = 0; x < Size; ++x)
+			Results[y * Size + x] = glm::perlin(glm::vec2(x, y) * Step);
+		std::clock_t const TimePerlinEnd = std::clock();
+
+		std::clock_t const TimePerlinGridStart = std::clock();
+		glm::perlinGrid(glm::vec2(0), glm::vec2(Step.x, 0), glm::vec2(0, Step.y), Size, Size, &Results[0]);
+		std::clock_t const TimePerlinGridEnd = std::clock();
+
+		std::clock_t const TimeSimplexStart = std::clock();
+		for(std::size_t y = 0; y < Size; ++y)
+		for(std::size_t x = 0; x < Size; ++x)
+			Results[y * Size + x] = glm::simplex(glm::vec3(glm::vec2(x, y) * Step, 0.5f));
+		std::clock_t const TimeSimplexEnd = std::clock();
+
+		std::clock_t const TimeSimplexGridStart = std::clock();
+		glm::simplexGrid(glm::vec3(0, 0, 0.5f), glm::vec3(Step.x, 0, 0), glm::vec3(0, Step.y, 0), Size, Size, &Results[0]);
+		std::clock_t const TimeSimplexGridEnd = std::clock();
+
+		// std::clock measures the CPU time of all the threads when OpenMP is used
+		std::printf("noise at the %s level\n", glm::simdLevelName(glm::simdLevel()));
+		print("perlin(vec2) 1024x1024", TimePerlinEnd - TimePerlinStart, Size * Size);
+		print("perlinGrid(vec2) 1024x1024", TimePerlinGridEnd - TimePerlinGridStart, Size * Size);
+		print("simplex(vec3) 1024x1024", TimeSimplexEnd - TimeSimplexStart, Size * Size);
+		print("simplexGrid(vec3) 1024x1024", TimeSimplexGridEnd - TimeSimplexGridStart, Size * Size);
+
+		return 0;
+	}
+}//namespace grid
+
+int main()
+{
+	int Error(0);
+
+	Error += batch::test();
+	Error += grid::test();
+
+#	ifdef NDEBUG
+		Error += grid::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
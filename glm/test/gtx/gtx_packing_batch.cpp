@@ -0,0 +1,593 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_packing_batch.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtx/packing_batch.hpp>
+#include <ctime>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	float make_float(glm::uint32 Bits)
+	{
+		float Result;
+		std::memcpy(&Result, &Bits, sizeof(Result));
+		return Result;
+	}
+
+	glm::uint32 make_bits(float Value)
+	{
+		glm::uint32 Result;
+		std::memcpy(&Result, &Value, sizeof(Result));
+		return Result;
+	}
+}//namespace
+
+namespace half
+{
+	// Values probing the rounding of packHalf1x16: the middles between consecutive halves, one
+	// float ulp around them, the special values and a sweep over the float bit patterns.
+	std::vector<float> make_floats()
+	{
+		std::vector<float> Data;
+		for(glm::uint32 h = 0; h < 0x7c00; ++h)
+		{
+			float const Low = glm::unpackHalf1x16(static_cast<glm::uint16>(h));
+			float const High = glm::unpackHalf1x16(static_cast<glm::uint16>(h + 1));
+			glm::uint32 const Middle = make_bits((Low + High) * 0.5f);
+			for(glm::uint32 Offset = 0; Offset < 3; ++Offset)
+			{
+				Data.push_back(make_float(Middle + Offset - 1));
+				Data.push_back(-make_float(Middle + Offset - 1));
+			}
+		}
+
+		glm::uint32 const Specials[] = {
+			0x00000000, 0x00000001, 0x007fffff, 0x33000000, 0x32ffffff, 0x38800000, 0x387fffff,
+			0x477fe000, 0x477fefff, 0x477ff000, 0x47800000, 0x7f7fffff, 0x7f800000,
+			0x7f800001, 0x7f801fff, 0x7f802000, 0x7fc00000, 0x7fffffff};
+		for(std::size_t i = 0; i < sizeof(Specials) / sizeof(Specials[0]); ++i)
+		{
+			Data.push_back(make_float(Specials[i]));
+			Data.push_back(make_float(Specials[i] | 0x80000000));
+		}
+
+		for(glm::uint64 Bits = 0; Bits < 0x100000000ull; Bits += 0x10001)
+			Data.push_back(make_float(static_cast<glm::uint32>(Bits)));
+
+		return Data;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		// An odd count to exercise the remaining values of the SIMD paths
+		std::vector<float> const Floats = make_floats();
+		std::vector<glm::uint16> Halves(0x10000 + 3);
+		for(std::size_t i = 0; i < Halves.size(); ++i)
+			Halves[i] = static_cast<glm::uint16>(i);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<glm::uint16> Packed(Floats.size());
+			glm::packHalfBatch(&Floats[0], &Packed[0], Floats.size());
+			for(std::size_t i = 0; i < Floats.size(); ++i)
+				Error += Packed[i] == glm::packHalf1x16(Floats[i]) ? 0 : 1;
+
+			std::vector<float> Unpacked(Halves.size());
+			glm::unpackHalfBatch(&Halves[0], &Unpacked[0], Halves.size());
+			for(std::size_t i = 0; i < Halves.size(); ++i)
+				Error += make_bits(Unpacked[i]) == make_bits(glm::unpackHalf1x16(Halves[i])) ? 0 : 1;
+		}
+		glm::simdForceLevel(Max);
+
+		// The 4 components functions use the same conversions
+		for(std::size_t i = 0; i + 4 <= Floats.size(); i += 4)
+		{
+			glm::uint64 const Packed = glm::packHalf4x16(glm::vec4(Floats[i], Floats[i + 1], Floats[i + 2], Floats[i + 3]));
+			for(std::size_t j = 0; j < 4; ++j)
+				Error += static_cast<glm::uint16>(Packed >> (j * 16)) == glm::packHalf1x16(Floats[i + j]) ? 0 : 1;
+		}
+
+		for(std::size_t i = 0; i + 4 <= 0x10000; i += 4)
+		{
+			glm::uint64 const Packed = Halves[i] | (glm::uint64(Halves[i + 1]) << 16) | (glm::uint64(Halves[i + 2]) << 32) | (glm::uint64(Halves[i + 3]) << 48);
+			glm::vec4 const Unpacked = glm::unpackHalf4x16(Packed);
+			for(glm::length_t j = 0; j < 4; ++j)
+				Error += make_bits(Unpacked[j]) == make_bits(glm::unpackHalf1x16(Halves[i + j])) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 22;
+		std::size_t const Passes = 16;
+
+		std::vector<float> Floats(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Floats[i] = static_cast<float>(i % 2047) * 0.37f - 300.0f;
+		std::vector<glm::uint16> Halves(Count);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimePackStart = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::packHalfBatch(&Floats[0], &Halves[0], Count);
+			std::clock_t const TimePackEnd = std::clock();
+
+			std::clock_t const TimeUnpackStart = std::clock();
+			for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+				glm::unpackHalfBatch(&Halves[0], &Floats[0], Count);
+			std::clock_t const TimeUnpackEnd = std::clock();
+
+			// Bytes read and written
+			double const Bytes = static_cast<double>(Count * Passes * (sizeof(float) + sizeof(glm::uint16)));
+			double const PackTime = static_cast<double>(TimePackEnd - TimePackStart) / CLOCKS_PER_SEC;
+			double const UnpackTime = static_cast<double>(TimeUnpackEnd - TimeUnpackStart) / CLOCKS_PER_SEC;
+			std::printf("packHalfBatch at the %s level: %.2f GB/s\n", glm::simdLevelName(glm::simdLevel()), PackTime > 0.0 ? Bytes / PackTime * 1e-9 : 0.0);
+			std::printf("unpackHalfBatch at the %s level: %.2f GB/s\n", glm::simdLevelName(glm::simdLevel()), UnpackTime > 0.0 ? Bytes / UnpackTime * 1e-9 : 0.0);
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace half
+
+namespace normalized
+{
+	// Values around the rounding points of the 8 and 16 bit formats, out of range values and special values
+	std::vector<float> make_floats()
+	{
+		std::vector<float> Data;
+		for(int i = -1024; i <= 1024; ++i)
+		{
+			float const Scales[] = {255.0f, 127.0f, 1023.0f, 511.0f, 3.0f};
+			for(std::size_t j = 0; j < sizeof(Scales) / sizeof(Scales[0]); ++j)
+			{
+				float const Middle = (static_cast<float>(i) + 0.5f) / Scales[j];
+				Data.push_back(Middle);
+				Data.push_back(make_float(make_bits(Middle) + 1));
+				Data.push_back(make_float(make_bits(Middle) - 1));
+			}
+		}
+		for(int i = -70000; i <= 70000; ++i)
+			Data.push_back((static_cast<float>(i) + 0.5f) / 65535.0f);
+		for(int i = -40000; i <= 40000; ++i)
+			Data.push_back((static_cast<float>(i) + 0.5f) / 32767.0f);
+
+		glm::uint32 const Specials[] = {0x00000000, 0x80000000, 0x3f800000, 0xbf800000, 0x7f800000, 0xff800000, 0x7fc00000, 0xffc00001, 0x7f800001, 0x00000001, 0x4b000000, 0x7f7fffff};
+		for(std::size_t i = 0; i < sizeof(Specials) / sizeof(Specials[0]); ++i)
+			Data.push_back(make_float(Specials[i]));
+
+		// An odd count to exercise the remaining values of the SIMD paths
+		while(Data.size() % 16 != 13)
+			Data.push_back(0.25f);
+
+		return Data;
+	}
+
+	template <typename packType>
+	int compare(std::vector<packType> const & A, std::vector<packType> const & B)
+	{
+		return A == B ? 0 : 1;
+	}
+
+	int compare(std::vector<float> const & A, std::vector<float> const & B)
+	{
+		return A.size() == B.size() && std::memcmp(&A[0], &B[0], A.size() * sizeof(float)) == 0 ? 0 : 1;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		std::vector<float> const Floats = normalized::make_floats();
+		std::vector<glm::vec4> const Vec4s(reinterpret_cast<glm::vec4 const*>(&Floats[0]), reinterpret_cast<glm::vec4 const*>(&Floats[0]) + Floats.size() / 4);
+		std::size_t const Count = Floats.size();
+		std::size_t const Count4 = Vec4s.size();
+
+		std::vector<glm::uint8> Bytes(0x100 + 3);
+		for(std::size_t i = 0; i < Bytes.size(); ++i)
+			Bytes[i] = static_cast<glm::uint8>(i);
+		std::vector<glm::uint16> Shorts(0x10000 + 3);
+		for(std::size_t i = 0; i < Shorts.size(); ++i)
+			Shorts[i] = static_cast<glm::uint16>(i);
+		std::vector<glm::uint32> Words(0x10000 + 3);
+		for(std::size_t i = 0; i < Words.size(); ++i)
+			Words[i] = static_cast<glm::uint32>(i * 2654435761u);
+
+		// Scalar references
+		std::vector<glm::uint8> Unorm8(Count), Snorm8(Count);
+		std::vector<glm::uint16> Unorm16(Count), Snorm16(Count);
+		std::vector<glm::uint32> Unorm3x10(Count4), Snorm3x10(Count4);
+		std::vector<float> UnpackUnorm8(Bytes.size()), UnpackSnorm8(Bytes.size()), UnpackUnorm16(Shorts.size()), UnpackSnorm16(Shorts.size());
+		std::vector<glm::vec4> UnpackUnorm3x10(Words.size()), UnpackSnorm3x10(Words.size());
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Unorm8[i] = glm::packUnorm1x8(Floats[i]);
+			Snorm8[i] = glm::packSnorm1x8(Floats[i]);
+			Unorm16[i] = glm::packUnorm1x16(Floats[i]);
+			Snorm16[i] = glm::packSnorm1x16(Floats[i]);
+		}
+		for(std::size_t i = 0; i < Count4; ++i)
+		{
+			Unorm3x10[i] = glm::packUnorm3x10_1x2(Vec4s[i]);
+			Snorm3x10[i] = glm::packSnorm3x10_1x2(Vec4s[i]);
+		}
+		for(std::size_t i = 0; i < Bytes.size(); ++i)
+		{
+			UnpackUnorm8[i] = glm::unpackUnorm1x8(Bytes[i]);
+			UnpackSnorm8[i] = glm::unpackSnorm1x8(Bytes[i]);
+		}
+		for(std::size_t i = 0; i < Shorts.size(); ++i)
+		{
+			UnpackUnorm16[i] = glm::unpackUnorm1x16(Shorts[i]);
+			UnpackSnorm16[i] = glm::unpackSnorm1x16(Shorts[i]);
+		}
+		for(std::size_t i = 0; i < Words.size(); ++i)
+		{
+			UnpackUnorm3x10[i] = glm::unpackUnorm3x10_1x2(Words[i]);
+			UnpackSnorm3x10[i] = glm::unpackSnorm3x10_1x2(Words[i]);
+		}
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<glm::uint8> Result8(Count);
+			glm::packUnorm1x8Batch(&Floats[0], &Result8[0], Count);
+			Error += compare(Result8, Unorm8);
+			glm::packSnorm1x8Batch(&Floats[0], &Result8[0], Count);
+			Error += compare(Result8, Snorm8);
+
+			std::vector<glm::uint16> Result16(Count);
+			glm::packUnorm1x16Batch(&Floats[0], &Result16[0], Count);
+			Error += compare(Result16, Unorm16);
+			glm::packSnorm1x16Batch(&Floats[0], &Result16[0], Count);
+			Error += compare(Result16, Snorm16);
+
+			std::vector<glm::uint32> Result32(Count4);
+			glm::packUnorm3x10_1x2Batch(&Vec4s[0], &Result32[0], Count4);
+			Error += compare(Result32, Unorm3x10);
+			glm::packSnorm3x10_1x2Batch(&Vec4s[0], &Result32[0], Count4);
+			Error += compare(Result32, Snorm3x10);
+
+			std::vector<float> ResultFloat(Bytes.size());
+			glm::unpackUnorm1x8Batch(&Bytes[0], &ResultFloat[0], Bytes.size());
+			Error += compare(ResultFloat, UnpackUnorm8);
+			glm::unpackSnorm1x8Batch(&Bytes[0], &ResultFloat[0], Bytes.size());
+			Error += compare(ResultFloat, UnpackSnorm8);
+
+			ResultFloat.resize(Shorts.size());
+			glm::unpackUnorm1x16Batch(&Shorts[0], &ResultFloat[0], Shorts.size());
+			Error += compare(ResultFloat, UnpackUnorm16);
+			glm::unpackSnorm1x16Batch(&Shorts[0], &ResultFloat[0], Shorts.size());
+			Error += compare(ResultFloat, UnpackSnorm16);
+
+			std::vector<glm::vec4> ResultVec4(Words.size());
+			glm::unpackUnorm3x10_1x2Batch(&Words[0], &ResultVec4[0], Words.size());
+			Error += ResultVec4 == UnpackUnorm3x10 ? 0 : 1;
+			glm::unpackSnorm3x10_1x2Batch(&Words[0], &ResultVec4[0], Words.size());
+			Error += ResultVec4 == UnpackSnorm3x10 ? 0 : 1;
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+}//namespace normalized
+
+namespace packed
+{
+	int test()
+	{
+		int Error(0);
+
+		// Float bit patterns over the whole range, with the special values
+		std::vector<glm::vec3> Vec3s;
+		for(glm::uint64 Bits = 0; Bits < 0x100000000ull; Bits += 0x3001)
+		{
+			glm::uint32 const b = static_cast<glm::uint32>(Bits);
+			Vec3s.push_back(glm::vec3(make_float(b), make_float(b * 7u), make_float(~b)));
+		}
+		glm::uint32 const Specials[] = {0x00000000, 0x80000000, 0x7f800000, 0xff800000, 0x7fc00000, 0xffffffff, 0x3f800000, 0x477fe000, 0x38800000};
+		for(std::size_t i = 0; i < sizeof(Specials) / sizeof(Specials[0]); ++i)
+		for(std::size_t j = 0; j < sizeof(Specials) / sizeof(Specials[0]); ++j)
+			Vec3s.push_back(glm::vec3(make_float(Specials[i]), make_float(Specials[j]), make_float(Specials[(i + j) % 9])));
+
+		// Every 11 bits value in both 11 bits fields, every 10 bits value in the 10 bits field
+		std::vector<glm::uint32> Words;
+		for(glm::uint32 i = 0; i < 0x800; ++i)
+		{
+			Words.push_back(i | (((i * 5u) & 0x7ff) << 11) | ((i & 0x3ff) << 22));
+			Words.push_back((i << 11) | (((i * 3u) & 0x3ff) << 22));
+		}
+		Words.push_back(0);
+
+		std::vector<glm::uint32> Pack(Vec3s.size());
+		for(std::size_t i = 0; i < Vec3s.size(); ++i)
+			Pack[i] = glm::packF2x11_1x10(Vec3s[i]);
+		std::vector<glm::vec3> Unpack(Words.size());
+		for(std::size_t i = 0; i < Words.size(); ++i)
+			Unpack[i] = glm::unpackF2x11_1x10(Words[i]);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<glm::uint32> ResultPack(Vec3s.size());
+			glm::packF2x11_1x10Batch(&Vec3s[0], &ResultPack[0], Vec3s.size());
+			Error += ResultPack == Pack ? 0 : 1;
+
+			std::vector<glm::vec3> ResultUnpack(Words.size());
+			glm::unpackF2x11_1x10Batch(&Words[0], &ResultUnpack[0], Words.size());
+			Error += std::memcmp(&ResultUnpack[0], &Unpack[0], Unpack.size() * sizeof(glm::vec3)) == 0 ? 0 : 1;
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+}//namespace packed
+
+namespace encoding
+{
+	// Directions and quaternions with random components, the axes, ties between components and null vectors
+	std::vector<glm::vec4> make_vec4s()
+	{
+		std::vector<glm::vec4> Data;
+		glm::uint32 Seed = 1;
+		for(std::size_t i = 0; i < 100000; ++i)
+		{
+			glm::vec4 v;
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				Seed = Seed * 1664525u + 1013904223u;
+				v[j] = static_cast<float>(Seed >> 8) / 8388608.0f - 1.0f;
+			}
+			Data.push_back(v);
+		}
+
+		float const Values[] = {0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -0.5f};
+		for(std::size_t i = 0; i < 6 * 6 * 6 * 6; ++i)
+			Data.push_back(glm::vec4(Values[i % 6], Values[i / 6 % 6], Values[i / 36 % 6], Values[i / 216]));
+		return Data;
+	}
+
+	template <typename genType>
+	int compare(std::vector<genType> const & a, std::vector<genType> const & b)
+	{
+		return std::memcmp(&a[0], &b[0], a.size() * sizeof(genType)) == 0 ? 0 : 1;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec4> const Vec4s = make_vec4s();
+		std::vector<glm::vec3> Directions;
+		std::vector<glm::quat> Quats;
+		for(std::size_t i = 0; i < Vec4s.size(); ++i)
+		{
+			if(glm::vec3(Vec4s[i]) != glm::vec3(0.0f))
+				Directions.push_back(glm::vec3(Vec4s[i]));
+			if(Vec4s[i] != glm::vec4(0.0f))
+			{
+				glm::vec4 const q = glm::normalize(Vec4s[i]);
+				Quats.push_back(glm::quat(q.w, q.x, q.y, q.z));
+			}
+		}
+
+		std::vector<glm::uint16> Oct8(Directions.size());
+		std::vector<glm::uint32> Oct16(Directions.size());
+		std::vector<glm::vec3> UnpackOct8(Directions.size());
+		std::vector<glm::vec3> UnpackOct16(Directions.size());
+		for(std::size_t i = 0; i < Directions.size(); ++i)
+		{
+			Oct8[i] = glm::packOctahedral2x8(Directions[i]);
+			Oct16[i] = glm::packOctahedral2x16(Directions[i]);
+			UnpackOct8[i] = glm::unpackOctahedral2x8(Oct8[i]);
+			UnpackOct16[i] = glm::unpackOctahedral2x16(Oct16[i]);
+		}
+
+		std::vector<glm::uint32> Quat10(Quats.size());
+		std::vector<glm::uint64> Quat20(Quats.size());
+		std::vector<glm::quat> UnpackQuat10(Quats.size());
+		std::vector<glm::quat> UnpackQuat20(Quats.size());
+		for(std::size_t i = 0; i < Quats.size(); ++i)
+		{
+			Quat10[i] = glm::packQuat3x10_1x2(Quats[i]);
+			Quat20[i] = glm::packQuat3x20_1x2(Quats[i]);
+			UnpackQuat10[i] = glm::unpackQuat3x10_1x2(Quat10[i]);
+			UnpackQuat20[i] = glm::unpackQuat3x20_1x2(Quat20[i]);
+		}
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<glm::uint16> Result16(Directions.size());
+			std::vector<glm::uint32> Result32(glm::max(Directions.size(), Quats.size()));
+			std::vector<glm::uint64> Result64(Quats.size());
+			std::vector<glm::vec3> ResultVec3(Directions.size());
+			std::vector<glm::quat> ResultQuat(Quats.size());
+
+			glm::packOctahedral2x8Batch(&Directions[0], &Result16[0], Directions.size());
+			Error += compare(Result16, Oct8);
+			glm::unpackOctahedral2x8Batch(&Oct8[0], &ResultVec3[0], Oct8.size());
+			Error += compare(ResultVec3, UnpackOct8);
+
+			Result32.resize(Directions.size());
+			glm::packOctahedral2x16Batch(&Directions[0], &Result32[0], Directions.size());
+			Error += compare(Result32, Oct16);
+			glm::unpackOctahedral2x16Batch(&Oct16[0], &ResultVec3[0], Oct16.size());
+			Error += compare(ResultVec3, UnpackOct16);
+
+			Result32.resize(Quats.size());
+			glm::packQuat3x10_1x2Batch(&Quats[0], &Result32[0], Quats.size());
+			Error += compare(Result32, Quat10);
+			glm::unpackQuat3x10_1x2Batch(&Quat10[0], &ResultQuat[0], Quat10.size());
+			Error += compare(ResultQuat, UnpackQuat10);
+
+			glm::packQuat3x20_1x2Batch(&Quats[0], &Result64[0], Quats.size());
+			Error += compare(Result64, Quat20);
+			glm::unpackQuat3x20_1x2Batch(&Quat20[0], &ResultQuat[0], Quat20.size());
+			Error += compare(ResultQuat, UnpackQuat20);
+		}
+		glm::simdForceLevel(Max);
+
+		// Spherical Fibonacci
+		glm::uint32 const Points = 1 << 16;
+		std::vector<glm::vec3> Normalized(Directions.size());
+		for(std::size_t i = 0; i < Directions.size(); ++i)
+			Normalized[i] = glm::normalize(Directions[i]);
+		std::vector<glm::uint32> Indices(Directions.size());
+		glm::packSphericalFibonacciBatch(&Normalized[0], &Indices[0], Normalized.size(), Points);
+		std::vector<glm::vec3> Unpack(Directions.size());
+		glm::unpackSphericalFibonacciBatch(&Indices[0], &Unpack[0], Indices.size(), Points);
+		for(std::size_t i = 0; i < Directions.size(); i += 13)
+		{
+			Error += Indices[i] == glm::packSphericalFibonacci(Normalized[i], Points) ? 0 : 1;
+			Error += Unpack[i] == glm::unpackSphericalFibonacci(Indices[i], Points) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace encoding
+
+namespace bulk
+{
+	std::size_t const Count = 1 << 20;
+	std::size_t const Passes = 16;
+
+	template <typename srcType, typename dstType>
+	void print(char const * Name, void (*Batch)(srcType const *, dstType *, std::size_t), std::vector<srcType> const & Src, std::vector<dstType> & Dst)
+	{
+		std::clock_t const TimeStart = std::clock();
+		for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+			Batch(&Src[0], &Dst[0], Src.size());
+		std::clock_t const TimeEnd = std::clock();
+
+		double const Time = static_cast<double>(TimeEnd - TimeStart) / CLOCKS_PER_SEC;
+		double const Elements = static_cast<double>(Src.size() * Passes);
+		std::printf("%s at the %s level: %.1f M/s\n", Name, glm::simdLevelName(glm::simdLevel()), Time > 0.0 ? Elements / Time * 1e-6 : 0.0);
+	}
+
+	int perf()
+	{
+		std::vector<float> Floats(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Floats[i] = static_cast<float>(i % 4093) / 2046.0f - 1.0f;
+		std::vector<glm::vec4> Vec4s(Count);
+		std::vector<glm::vec3> Vec3s(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Vec4s[i] = glm::vec4(Floats[i], Floats[(i * 7) % Count], Floats[(i * 13) % Count], Floats[(i * 17) % Count]);
+			Vec3s[i] = glm::abs(glm::vec3(Vec4s[i])) * 100.0f;
+		}
+
+		std::vector<glm::vec3> Directions(Count);
+		std::vector<glm::quat> Quats(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Directions[i] = glm::normalize(glm::vec3(Vec4s[i]) + glm::vec3(0.0f, 0.0f, 0.001f));
+			glm::vec4 const q = glm::normalize(Vec4s[i] + glm::vec4(0.001f));
+			Quats[i] = glm::quat(q.w, q.x, q.y, q.z);
+		}
+
+		std::vector<glm::uint8> Bytes(Count);
+		std::vector<glm::uint16> Shorts(Count);
+		std::vector<glm::uint32> Words(Count);
+		std::vector<glm::uint64> Longs(Count);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= glm::SIMD_LEVEL_SSE2 && Level <= Max; ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			print("packUnorm1x8Batch", glm::packUnorm1x8Batch, Floats, Bytes);
+			print("unpackUnorm1x8Batch", glm::unpackUnorm1x8Batch, Bytes, Floats);
+			print("packSnorm1x8Batch", glm::packSnorm1x8Batch, Floats, Bytes);
+			print("unpackSnorm1x8Batch", glm::unpackSnorm1x8Batch, Bytes, Floats);
+			print("packUnorm1x16Batch", glm::packUnorm1x16Batch, Floats, Shorts);
+			print("unpackUnorm1x16Batch", glm::unpackUnorm1x16Batch, Shorts, Floats);
+			print("packSnorm1x16Batch", glm::packSnorm1x16Batch, Floats, Shorts);
+			print("unpackSnorm1x16Batch", glm::unpackSnorm1x16Batch, Shorts, Floats);
+			print("packUnorm3x10_1x2Batch", glm::packUnorm3x10_1x2Batch, Vec4s, Words);
+			print("unpackUnorm3x10_1x2Batch", glm::unpackUnorm3x10_1x2Batch, Words, Vec4s);
+			print("packSnorm3x10_1x2Batch", glm::packSnorm3x10_1x2Batch, Vec4s, Words);
+			print("unpackSnorm3x10_1x2Batch", glm::unpackSnorm3x10_1x2Batch, Words, Vec4s);
+			print("packF2x11_1x10Batch", glm::packF2x11_1x10Batch, Vec3s, Words);
+			print("unpackF2x11_1x10Batch", glm::unpackF2x11_1x10Batch, Words, Vec3s);
+			print("packOctahedral2x8Batch", glm::packOctahedral2x8Batch, Directions, Shorts);
+			print("unpackOctahedral2x8Batch", glm::unpackOctahedral2x8Batch, Shorts, Directions);
+			print("packOctahedral2x16Batch", glm::packOctahedral2x16Batch, Directions, Words);
+			print("unpackOctahedral2x16Batch", glm::unpackOctahedral2x16Batch, Words, Directions);
+			print("packQuat3x10_1x2Batch", glm::packQuat3x10_1x2Batch, Quats, Words);
+			print("unpackQuat3x10_1x2Batch", glm::unpackQuat3x10_1x2Batch, Words, Quats);
+			print("packQuat3x20_1x2Batch", glm::packQuat3x20_1x2Batch, Quats, Longs);
+			print("unpackQuat3x20_1x2Batch", glm::unpackQuat3x20_1x2Batch, Longs, Quats);
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace bulk
+
+int main()
+{
+	int Error(0);
+
+	Error += half::test();
+	Error += normalized::test();
+	Error += packed::test();
+	Error += encoding::test();
+
+#	ifdef NDEBUG
+		Error += half::perf();
+		Error += bulk::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
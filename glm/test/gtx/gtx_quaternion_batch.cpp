@@ -0,0 +1,294 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_quaternion_batch.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/quaternion_batch.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	glm::quat make_quat(glm::pcg32 & Engine)
+	{
+		glm::quat q(glm::linearRand(-1.0f, 1.0f, Engine), glm::linearRand(-1.0f, 1.0f, Engine), glm::linearRand(-1.0f, 1.0f, Engine), glm::linearRand(-1.0f, 1.0f, Engine));
+		return glm::normalize(q);
+	}
+
+	// Pairs of keys from identical to opposite, in both hemispheres
+	void make_keys(std::size_t Count, std::vector<glm::quat> & X, std::vector<glm::quat> & Y, std::vector<float> & A)
+	{
+		glm::pcg32 Engine(1);
+		X.resize(Count);
+		Y.resize(Count);
+		A.resize(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = make_quat(Engine);
+			switch(i % 4)
+			{
+			default:
+				Y[i] = make_quat(Engine);
+				break;
+			case 1:
+				Y[i] = -X[i];
+				break;
+			case 2:
+				Y[i] = glm::normalize(X[i] + glm::quat(0.0f, 0.0f, 0.0f, glm::linearRand(-0.001f, 0.001f, Engine)));
+				break;
+			case 3:
+				Y[i] = glm::normalize(X[i] * glm::angleAxis(glm::linearRand(-0.2f, 0.2f, Engine), glm::vec3(0, 0, 1)));
+				break;
+			}
+			A[i] = glm::linearRand(0.0f, 1.0f, Engine);
+		}
+	}
+
+	bool equal(glm::quat const & x, glm::quat const & y, float Epsilon)
+	{
+		return glm::all(glm::epsilonEqual(glm::vec4(x.x, x.y, x.z, x.w), glm::vec4(y.x, y.y, y.z, y.w), Epsilon));
+	}
+
+	// Approximation of the angle between the rotations, for close unit quaternions
+	float angle_error(glm::quat const & x, glm::quat const & y)
+	{
+		glm::vec4 const a(x.x, x.y, x.z, x.w);
+		glm::vec4 const b(y.x, y.y, y.z, y.w);
+		return 2.0f * glm::length(glm::dot(a, b) < 0.0f ? a + b : a - b);
+	}
+}//namespace
+
+namespace interpolate
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		std::vector<glm::quat> X, Y;
+		std::vector<float> A;
+		make_keys(Count, X, Y, A);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::quat> Nlerp(Count), FastSlerp(Count), Slerp(Count);
+			glm::nlerpBatch(&X[0], &Y[0], &A[0], &Nlerp[0], Count);
+			glm::fastSlerpBatch(&X[0], &Y[0], &A[0], &FastSlerp[0], Count);
+			glm::slerpBatch(&X[0], &Y[0], &A[0], &Slerp[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += equal(Nlerp[i], glm::nlerp(X[i], Y[i], A[i]), 1e-6f) ? 0 : 1;
+				Error += equal(FastSlerp[i], glm::fastSlerp(X[i], Y[i], A[i]), 1e-6f) ? 0 : 1;
+				Error += equal(Slerp[i], glm::slerp(X[i], Y[i], A[i]), 1e-5f) ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		// The weight correction keeps fastSlerp close to slerp, unlike nlerp
+		float FastSlerpMaxError(0), NlerpMaxError(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::quat const Slerp = glm::slerp(X[i], Y[i], A[i]);
+			FastSlerpMaxError = glm::max(FastSlerpMaxError, angle_error(Slerp, glm::fastSlerp(X[i], Y[i], A[i])));
+			NlerpMaxError = glm::max(NlerpMaxError, angle_error(Slerp, glm::nlerp(X[i], Y[i], A[i])));
+		}
+		Error += FastSlerpMaxError < 0.001f ? 0 : 1;
+		Error += NlerpMaxError > FastSlerpMaxError ? 0 : 1;
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 20;
+		std::vector<glm::quat> X, Y;
+		std::vector<float> A;
+		make_keys(Count, X, Y, A);
+		std::vector<glm::quat> Results(Count);
+
+		std::clock_t const TimeScalarStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = glm::slerp(X[i], Y[i], A[i]);
+		std::clock_t const TimeScalarEnd = std::clock();
+
+		double const ScalarTime = static_cast<double>(TimeScalarEnd - TimeScalarStart) / CLOCKS_PER_SEC;
+		std::printf("slerp: %.1f M/s\n", ScalarTime > 0.0 ? static_cast<double>(Count) / ScalarTime * 1e-6 : 0.0);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeNlerpStart = std::clock();
+			glm::nlerpBatch(&X[0], &Y[0], &A[0], &Results[0], Count);
+			std::clock_t const TimeNlerpEnd = std::clock();
+
+			std::clock_t const TimeFastSlerpStart = std::clock();
+			glm::fastSlerpBatch(&X[0], &Y[0], &A[0], &Results[0], Count);
+			std::clock_t const TimeFastSlerpEnd = std::clock();
+
+			std::clock_t const TimeSlerpStart = std::clock();
+			glm::slerpBatch(&X[0], &Y[0], &A[0], &Results[0], Count);
+			std::clock_t const TimeSlerpEnd = std::clock();
+
+			double const NlerpTime = static_cast<double>(TimeNlerpEnd - TimeNlerpStart) / CLOCKS_PER_SEC;
+			double const FastSlerpTime = static_cast<double>(TimeFastSlerpEnd - TimeFastSlerpStart) / CLOCKS_PER_SEC;
+			double const SlerpTime = static_cast<double>(TimeSlerpEnd - TimeSlerpStart) / CLOCKS_PER_SEC;
+			char const * Name = glm::simdLevelName(glm::simdLevel());
+			std::printf("nlerpBatch at the %s level: %.1f M/s\n", Name, NlerpTime > 0.0 ? static_cast<double>(Count) / NlerpTime * 1e-6 : 0.0);
+			std::printf("fastSlerpBatch at the %s level: %.1f M/s\n", Name, FastSlerpTime > 0.0 ? static_cast<double>(Count) / FastSlerpTime * 1e-6 : 0.0);
+			std::printf("slerpBatch at the %s level: %.1f M/s\n", Name, SlerpTime > 0.0 ? static_cast<double>(Count) / SlerpTime * 1e-6 : 0.0);
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace interpolate
+
+namespace squad
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 257;
+		std::vector<glm::quat> Q1, Q2, S1, S2;
+		std::vector<float> H, Unused;
+		make_keys(Count, Q1, Q2, H);
+		make_keys(Count, S1, S2, Unused);
+
+		// Consecutive keys of a smooth animation, mix doesn't take the shortest path
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Q2[i] = glm::normalize(Q1[i] * glm::angleAxis(0.5f, glm::vec3(1, 0, 0)));
+			S1[i] = glm::normalize(Q1[i] * glm::angleAxis(0.1f, glm::vec3(0, 1, 0)));
+			S2[i] = glm::normalize(Q2[i] * glm::angleAxis(-0.1f, glm::vec3(0, 1, 0)));
+		}
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::quat> Results(Count);
+			glm::squadBatch(&Q1[0], &Q2[0], &S1[0], &S2[0], &H[0], &Results[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += equal(Results[i], glm::squad(Q1[i], Q2[i], S1[i], S2[i], H[i]), 1e-5f) ? 0 : 1;
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+}//namespace squad
+
+namespace cast
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		std::vector<glm::quat> X, Y;
+		std::vector<float> A;
+		make_keys(Count, X, Y, A);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::mat4> Results(Count);
+			glm::mat4_castBatch(&X[0], &Results[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				glm::mat4 const Expected = glm::mat4_cast(X[i]);
+				for(glm::length_t c = 0; c < 4; ++c)
+					Error += glm::all(glm::epsilonEqual(Results[i][c], Expected[c], 1e-6f)) ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 20;
+		std::vector<glm::quat> X, Y;
+		std::vector<float> A;
+		make_keys(Count, X, Y, A);
+		std::vector<glm::mat4> Results(Count);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::clock_t const TimeStart = std::clock();
+			glm::mat4_castBatch(&X[0], &Results[0], Count);
+			std::clock_t const TimeEnd = std::clock();
+
+			double const Time = static_cast<double>(TimeEnd - TimeStart) / CLOCKS_PER_SEC;
+			std::printf("mat4_castBatch at the %s level: %.1f M/s\n", glm::simdLevelName(glm::simdLevel()), Time > 0.0 ? static_cast<double>(Count) / Time * 1e-6 : 0.0);
+		}
+		glm::simdForceLevel(Max);
+
+		return 0;
+	}
+}//namespace cast
+
+int main()
+{
+	int Error(0);
+
+	Error += interpolate::test();
+	Error += squad::test();
+	Error += cast::test();
+
+#	ifdef NDEBUG
+		Error += interpolate::perf();
+		Error += cast::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
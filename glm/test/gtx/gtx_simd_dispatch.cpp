@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_simd_dispatch.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtx/simd_dispatch.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	glm::mat4 make_mat4(std::size_t i)
+	{
+		float const f = static_cast<float>(i);
+		glm::mat4 const R = glm::rotate(glm::mat4(1.0f), 0.1f + f * 0.37f, glm::normalize(glm::vec3(1.0f, f, 2.0f)));
+		return glm::scale(glm::translate(R, glm::vec3(f, -2.0f, 0.5f * f)), glm::vec3(1.0f + 0.1f * f, 2.0f, 0.5f));
+	}
+}//namespace
+
+namespace levels
+{
+	int test()
+	{
+		int Error(0);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		Error += glm::simdLevel() == Max ? 0 : 1;
+
+		Error += glm::simdForceLevel(glm::SIMD_LEVEL_PURE) == glm::SIMD_LEVEL_PURE ? 0 : 1;
+		Error += glm::simdLevel() == glm::SIMD_LEVEL_PURE ? 0 : 1;
+
+		// Levels above the maximum supported are clamped
+		Error += glm::simdForceLevel(glm::SIMD_LEVEL_AVX2) == Max ? 0 : 1;
+
+		glm::simd_features const & Features = glm::simdFeatures();
+		Error += Features.AVX2 && !Features.AVX ? 1 : 0;
+		Error += Features.SSE41 && !Features.SSE2 ? 1 : 0;
+
+		std::printf("SIMD level: %s\n", glm::simdLevelName(Max));
+
+		return Error;
+	}
+}//namespace levels
+
+namespace kernels
+{
+	// Every level must agree with the platform independent kernels
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 37;
+
+		glm::mat4 const M = make_mat4(3);
+		std::vector<glm::vec4> Vec4(Count);
+		std::vector<glm::vec3> Vec3(Count);
+		std::vector<glm::mat4> Mat4(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const f = static_cast<float>(i);
+			Vec4[i] = glm::vec4(f - 10.0f, f * 0.5f, 3.0f - f, 1.0f + f * 0.1f);
+			Vec3[i] = glm::vec3(Vec4[i]);
+			Mat4[i] = make_mat4(i);
+		}
+
+		glm::simdForceLevel(glm::SIMD_LEVEL_PURE);
+		std::vector<glm::vec4> RefVec4(Count);
+		std::vector<glm::vec3> RefVec3(Count);
+		std::vector<glm::mat4> RefMat4(Count);
+		glm::transformBatch(M, &Vec4[0], &RefVec4[0], Count);
+		glm::transformPointBatch(M, &Vec3[0], &RefVec3[0], Count);
+		glm::inverseBatch(&Mat4[0], &RefMat4[0], Count);
+
+		for(int Level = glm::SIMD_LEVEL_SSE2; Level <= glm::simdMaxLevel(); ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<glm::vec4> ResVec4(Count);
+			std::vector<glm::vec3> ResVec3(Count);
+			std::vector<glm::mat4> ResMat4(Count);
+			glm::transformBatch(M, &Vec4[0], &ResVec4[0], Count);
+			glm::transformPointBatch(M, &Vec3[0], &ResVec3[0], Count);
+			glm::inverseBatch(&Mat4[0], &ResMat4[0], Count);
+
+			int LevelError(0);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				LevelError += glm::all(glm::epsilonEqual(ResVec4[i], RefVec4[i], 0.001f)) ? 0 : 1;
+				LevelError += glm::all(glm::epsilonEqual(ResVec3[i], RefVec3[i], 0.001f)) ? 0 : 1;
+				for(glm::length_t c = 0; c < 4; ++c)
+					LevelError += glm::all(glm::epsilonEqual(ResMat4[i][c], RefMat4[i][c], 0.001f)) ? 0 : 1;
+			}
+
+			if(LevelError)
+				std::printf("%s kernels: %d errors\n", glm::simdLevelName(static_cast<glm::simd_level>(Level)), LevelError);
+			Error += LevelError;
+		}
+
+		glm::simdForceLevel(glm::simdMaxLevel());
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 20;
+
+		glm::mat4 const M = make_mat4(3);
+		std::vector<glm::vec3> const Src(Count, glm::vec3(1.0f, 2.0f, 3.0f));
+		std::vector<glm::vec3> Dst(Count);
+		std::vector<glm::mat4> const SrcMat(Count / 16, M);
+		std::vector<glm::mat4> DstMat(Count / 16);
+
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= glm::simdMaxLevel(); ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::clock_t const TimeTransformStart = std::clock();
+			glm::transformPointBatch(M, &Src[0], &Dst[0], Count);
+			std::clock_t const TimeTransformEnd = std::clock();
+
+			std::clock_t const TimeInverseStart = std::clock();
+			glm::inverseBatch(&SrcMat[0], &DstMat[0], SrcMat.size());
+			std::clock_t const TimeInverseEnd = std::clock();
+
+			std::printf("%s transformPointBatch: %d clocks, inverseBatch: %d clocks\n",
+				glm::simdLevelName(static_cast<glm::simd_level>(Level)),
+				static_cast<int>(TimeTransformEnd - TimeTransformStart),
+				static_cast<int>(TimeInverseEnd - TimeInverseStart));
+		}
+
+		glm::simdForceLevel(glm::simdMaxLevel());
+
+		return 0;
+	}
+}//namespace kernels
+
+int main()
+{
+	int Error(0);
+
+	Error += levels::test();
+	Error += kernels::test();
+
+#	ifdef NDEBUG
+		Error += kernels::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -0,0 +1,329 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_simd_double.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtx/simd_double.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/component_wise.hpp>
+#include <cfloat>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	// Well conditioned affine matrices
+	glm::dmat4 next_dmat4(glm::pcg32 & Engine)
+	{
+		double const Angle = glm::linearRand(-3.0, 3.0, Engine);
+		glm::dvec3 const Axis = glm::normalize(glm::linearRand(glm::dvec3(-100.0), glm::dvec3(100.0), Engine) + glm::dvec3(0.0, 0.0, 200.0));
+		glm::dmat4 const R = glm::rotate(glm::dmat4(1.0), Angle, Axis);
+		glm::dvec3 const Scale(glm::linearRand(glm::dvec3(0.5), glm::dvec3(2.5), Engine));
+		return glm::scale(glm::translate(R, glm::linearRand(glm::dvec3(-100.0), glm::dvec3(100.0), Engine)), Scale);
+	}
+
+	// Error of Result against the scalar double path, in units of DBL_EPSILON relative to the magnitude of the terms
+	double error(double Result, double Reference, double Magnitude)
+	{
+		return std::abs(Result - Reference) / (Magnitude * DBL_EPSILON);
+	}
+
+	template <typename vecType>
+	double error(vecType const & Result, vecType const & Reference, double Magnitude)
+	{
+		double Max = 0;
+		for(glm::length_t i = 0; i < Result.length(); ++i)
+			Max = glm::max(Max, error(Result[i], Reference[i], Magnitude));
+		return Max;
+	}
+
+	double error(glm::dmat4 const & Result, glm::dmat4 const & Reference, double Magnitude)
+	{
+		double Max = 0;
+		for(glm::length_t i = 0; i < 4; ++i)
+			Max = glm::max(Max, error(Result[i], Reference[i], Magnitude));
+		return Max;
+	}
+
+	double magnitude(glm::dmat4 const & m)
+	{
+		double Max = 0;
+		for(glm::length_t c = 0; c < 4; ++c)
+		for(glm::length_t r = 0; r < 4; ++r)
+			Max = glm::max(Max, std::abs(m[c][r]));
+		return Max;
+	}
+
+	glm::dmat4 abs(glm::dmat4 const & m)
+	{
+		return glm::dmat4(glm::abs(m[0]), glm::abs(m[1]), glm::abs(m[2]), glm::abs(m[3]));
+	}
+
+	struct data
+	{
+		explicit data(std::size_t Count)
+			: Vec3A(Count), Vec3B(Count), Vec4A(Count), Vec4B(Count), Mat4A(Count), Mat4B(Count)
+		{
+			glm::pcg32 Engine(1);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Vec3A[i] = glm::linearRand(glm::dvec3(-100.0), glm::dvec3(100.0), Engine);
+				Vec3B[i] = glm::linearRand(glm::dvec3(-100.0), glm::dvec3(100.0), Engine);
+				Vec4A[i] = glm::linearRand(glm::dvec4(-100.0), glm::dvec4(100.0), Engine);
+				Vec4B[i] = glm::linearRand(glm::dvec4(-100.0), glm::dvec4(100.0), Engine) + glm::dvec4(300.0);
+				Mat4A[i] = next_dmat4(Engine);
+				Mat4B[i] = next_dmat4(Engine);
+			}
+		}
+
+		std::vector<glm::dvec3> Vec3A, Vec3B;
+		std::vector<glm::dvec4> Vec4A, Vec4B;
+		std::vector<glm::dmat4> Mat4A, Mat4B;
+	};
+}//namespace
+
+namespace arithmetic
+{
+	// The component-wise operations are correctly rounded, every level matches the scalar path exactly
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 39;
+		data const Data(Count);
+		glm::dvec4 const * A = &Data.Vec4A[0];
+		glm::dvec4 const * B = &Data.Vec4B[0];
+
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= glm::simdMaxLevel(); ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<glm::dvec4> Add(Count), Sub(Count), Mul(Count), Div(Count);
+			glm::addBatch(A, B, &Add[0], Count);
+			glm::subBatch(A, B, &Sub[0], Count);
+			glm::mulBatch(A, B, &Mul[0], Count);
+			glm::divBatch(A, B, &Div[0], Count);
+
+			int LevelError(0);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				LevelError += Add[i] == A[i] + B[i] ? 0 : 1;
+				LevelError += Sub[i] == A[i] - B[i] ? 0 : 1;
+				LevelError += Mul[i] == A[i] * B[i] ? 0 : 1;
+				LevelError += Div[i] == A[i] / B[i] ? 0 : 1;
+			}
+
+			if(LevelError)
+				std::printf("%s arithmetic: %d errors\n", glm::simdLevelName(static_cast<glm::simd_level>(Level)), LevelError);
+			Error += LevelError;
+		}
+
+		glm::simdForceLevel(glm::simdMaxLevel());
+
+		return Error;
+	}
+}//namespace arithmetic
+
+namespace geometric
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 39;
+		data const Data(Count);
+		glm::dvec3 const * A3 = &Data.Vec3A[0];
+		glm::dvec3 const * B3 = &Data.Vec3B[0];
+		glm::dvec4 const * A4 = &Data.Vec4A[0];
+		glm::dvec4 const * B4 = &Data.Vec4B[0];
+
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= glm::simdMaxLevel(); ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<double> Dot3(Count), Dot4(Count);
+			std::vector<glm::dvec3> Cross(Count), Normalize3(Count);
+			std::vector<glm::dvec4> Normalize4(Count);
+			glm::dotBatch(A3, B3, &Dot3[0], Count);
+			glm::dotBatch(A4, B4, &Dot4[0], Count);
+			glm::crossBatch(A3, B3, &Cross[0], Count);
+			glm::normalizeBatch(A3, &Normalize3[0], Count);
+			glm::normalizeBatch(A4, &Normalize4[0], Count);
+
+			double MaxDot(0), MaxCross(0), MaxNormalize(0);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				MaxDot = glm::max(MaxDot, error(Dot3[i], glm::dot(A3[i], B3[i]), glm::dot(glm::abs(A3[i]), glm::abs(B3[i]))));
+				MaxDot = glm::max(MaxDot, error(Dot4[i], glm::dot(A4[i], B4[i]), glm::dot(glm::abs(A4[i]), glm::abs(B4[i]))));
+				MaxCross = glm::max(MaxCross, error(Cross[i], glm::cross(A3[i], B3[i]), glm::length(A3[i]) * glm::length(B3[i])));
+				MaxNormalize = glm::max(MaxNormalize, error(Normalize3[i], glm::normalize(A3[i]), 1.0));
+				MaxNormalize = glm::max(MaxNormalize, error(Normalize4[i], glm::normalize(A4[i]), 1.0));
+			}
+
+			std::printf("%s dot: %.2f, cross: %.2f, normalize: %.2f epsilons\n",
+				glm::simdLevelName(static_cast<glm::simd_level>(Level)), MaxDot, MaxCross, MaxNormalize);
+
+			Error += MaxDot <= 4.0 ? 0 : 1;
+			Error += MaxCross <= 4.0 ? 0 : 1;
+			Error += MaxNormalize <= 4.0 ? 0 : 1;
+		}
+
+		glm::simdForceLevel(glm::simdMaxLevel());
+
+		return Error;
+	}
+}//namespace geometric
+
+namespace matrix
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 39;
+		data const Data(Count);
+		glm::dmat4 const * A = &Data.Mat4A[0];
+		glm::dmat4 const * B = &Data.Mat4B[0];
+		glm::dvec3 const * V3 = &Data.Vec3A[0];
+		glm::dvec4 const * V4 = &Data.Vec4A[0];
+
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= glm::simdMaxLevel(); ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::vector<glm::dmat4> Mul(Count), Inverse(Count);
+			std::vector<glm::dvec3> Point(Count);
+			std::vector<glm::dvec4> Transform(Count);
+			glm::mulBatch(A, B, &Mul[0], Count);
+			glm::inverseBatch(A, &Inverse[0], Count);
+			glm::transformBatch(A[0], V4, &Transform[0], Count);
+			glm::transformPointBatch(A[0], V3, &Point[0], Count);
+
+			double MaxMul(0), MaxInverse(0), MaxTransform(0);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				MaxMul = glm::max(MaxMul, error(Mul[i], A[i] * B[i], magnitude(abs(A[i]) * abs(B[i]))));
+				MaxTransform = glm::max(MaxTransform, error(Transform[i], A[0] * V4[i], glm::compMax(abs(A[0]) * glm::abs(V4[i]))));
+				MaxTransform = glm::max(MaxTransform, error(Point[i], glm::dvec3(A[0] * glm::dvec4(V3[i], 1.0)), glm::compMax(abs(A[0]) * glm::abs(glm::dvec4(V3[i], 1.0)))));
+
+				// The matrices are well conditioned, the inverse doesn't amplify the rounding errors much
+				glm::dmat4 const Reference = glm::inverse(A[i]);
+				MaxInverse = glm::max(MaxInverse, error(Inverse[i], Reference, magnitude(Reference)));
+				MaxInverse = glm::max(MaxInverse, error(Inverse[i] * A[i], glm::dmat4(1.0), 1.0) / 64.0);
+			}
+
+			std::printf("%s mul: %.2f, transform: %.2f, inverse: %.2f epsilons\n",
+				glm::simdLevelName(static_cast<glm::simd_level>(Level)), MaxMul, MaxTransform, MaxInverse);
+
+			Error += MaxMul <= 4.0 ? 0 : 1;
+			Error += MaxTransform <= 4.0 ? 0 : 1;
+			Error += MaxInverse <= 64.0 ? 0 : 1;
+		}
+
+		glm::simdForceLevel(glm::simdMaxLevel());
+
+		return Error;
+	}
+}//namespace matrix
+
+namespace bench
+{
+	// Throughput of each level against the scalar double path, on arrays fitting in the caches
+	int perf()
+	{
+		std::size_t const Count = 1 << 10;
+		int const Repeat = 4096;
+		data const Data(Count);
+
+		std::vector<double> Scalar(Count);
+		std::vector<glm::dvec3> Vec3(Count);
+		std::vector<glm::dvec4> Vec4(Count);
+		std::vector<glm::dmat4> Mat4(Count);
+
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= glm::simdMaxLevel(); ++Level)
+		{
+			glm::simdForceLevel(static_cast<glm::simd_level>(Level));
+
+			std::clock_t Time[8];
+			Time[0] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::addBatch(&Data.Vec4A[0], &Data.Vec4B[0], &Vec4[0], Count);
+			Time[1] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::mulBatch(&Data.Mat4A[0], &Data.Mat4B[0], &Mat4[0], Count);
+			Time[2] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::inverseBatch(&Data.Mat4A[0], &Mat4[0], Count);
+			Time[3] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::transformBatch(Data.Mat4A[0], &Data.Vec4A[0], &Vec4[0], Count);
+			Time[4] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::transformPointBatch(Data.Mat4A[0], &Data.Vec3A[0], &Vec3[0], Count);
+			Time[5] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+				glm::dotBatch(&Data.Vec4A[0], &Data.Vec4B[0], &Scalar[0], Count);
+			Time[6] = std::clock();
+			for(int i = 0; i < Repeat; ++i)
+			{
+				glm::crossBatch(&Data.Vec3A[0], &Data.Vec3B[0], &Vec3[0], Count);
+				glm::normalizeBatch(&Vec3[0], &Vec3[0], Count);
+			}
+			Time[7] = std::clock();
+
+			std::printf("%s add: %d, mul dmat4: %d, inverse: %d, transform: %d, transformPoint: %d, dot: %d, cross + normalize: %d clocks\n",
+				glm::simdLevelName(static_cast<glm::simd_level>(Level)),
+				static_cast<int>(Time[1] - Time[0]), static_cast<int>(Time[2] - Time[1]), static_cast<int>(Time[3] - Time[2]),
+				static_cast<int>(Time[4] - Time[3]), static_cast<int>(Time[5] - Time[4]), static_cast<int>(Time[6] - Time[5]),
+				static_cast<int>(Time[7] - Time[6]));
+		}
+
+		glm::simdForceLevel(glm::simdMaxLevel());
+
+		return 0;
+	}
+}//namespace bench
+
+int main()
+{
+	int Error(0);
+
+	Error += arithmetic::test();
+	Error += geometric::test();
+	Error += matrix::test();
+
+#	ifdef NDEBUG
+		Error += bench::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -0,0 +1,265 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_simd_packet.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtx/simd_packet.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+#if(GLM_ARCH != GLM_ARCH_PURE)
+
+namespace
+{
+	std::vector<glm::vec3> make_vec3(std::size_t Count)
+	{
+		std::vector<glm::vec3> Data(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Data[i] = glm::vec3(
+				static_cast<float>(i % 7) - 3.0f,
+				static_cast<float>(i % 5) * 0.5f + 0.25f,
+				static_cast<float>(i % 11) - 5.5f);
+		return Data;
+	}
+}//namespace
+
+namespace gather_scatter
+{
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> const A = make_vec3(4);
+
+		glm::vec3x4 P;
+		glm::gather(&A[0], P);
+
+		for(glm::length_t i = 0; i < glm::vec3x4::lanes; ++i)
+			Error += glm::all(glm::equal(P[i], A[i])) ? 0 : 1;
+
+		std::vector<glm::vec3> B(4);
+		glm::scatter(P, &B[0]);
+		for(std::size_t i = 0; i < B.size(); ++i)
+			Error += glm::all(glm::equal(A[i], B[i])) ? 0 : 1;
+
+		glm::vec4 const C[] = {glm::vec4(1, 2, 3, 4), glm::vec4(5, 6, 7, 8), glm::vec4(9, 10, 11, 12), glm::vec4(13, 14, 15, 16)};
+		glm::vec4x4 Q;
+		glm::gather(C, Q);
+		Error += glm::all(glm::equal(Q[2], C[2])) ? 0 : 1;
+
+		glm::vec4 D[4];
+		glm::scatter(Q, D);
+		for(std::size_t i = 0; i < 4; ++i)
+			Error += glm::all(glm::equal(C[i], D[i])) ? 0 : 1;
+
+		unsigned int const Indices[] = {3, 0, 2, 1};
+		glm::vec3x4 R;
+		glm::gather(&A[0], Indices, R);
+		for(glm::length_t i = 0; i < glm::vec3x4::lanes; ++i)
+			Error += glm::all(glm::equal(R[i], A[Indices[i]])) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace gather_scatter
+
+namespace geometric
+{
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> const A = make_vec3(8);
+		std::vector<glm::vec3> const B(A.rbegin(), A.rend());
+
+		glm::vec3x4 PA, PB;
+		glm::gather(&A[0], PA);
+		glm::gather(&B[0], PB);
+
+		glm::simdPacket4 const Dot = glm::dot(PA, PB);
+		glm::simdPacket4 const Length = glm::length(PA);
+		glm::vec3x4 const Cross = glm::cross(PA, PB);
+		glm::vec3x4 const Normalize = glm::normalize(PA);
+		glm::vec3x4 const Mix = glm::mix(PA, PB, glm::simdPacket4(0.25f));
+
+		for(glm::length_t i = 0; i < glm::vec3x4::lanes; ++i)
+		{
+			Error += glm::epsilonEqual(Dot[i], glm::dot(A[i], B[i]), 0.0001f) ? 0 : 1;
+			Error += glm::epsilonEqual(Length[i], glm::length(A[i]), 0.0001f) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Cross[i], glm::cross(A[i], B[i]), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Normalize[i], glm::normalize(A[i]), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Mix[i], glm::mix(A[i], B[i], 0.25f), 0.0001f)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace geometric
+
+namespace relational
+{
+	int test()
+	{
+		int Error(0);
+
+		glm::vec3x4 const A(glm::simdPacket4(0, 1, 2, 3), glm::simdPacket4(0.0f), glm::simdPacket4(1.0f));
+		glm::vec3x4 const B(glm::vec3(1.5f, 0.0f, 1.0f));
+
+		glm::vec3x4 const Less = glm::lessThan(A, B);
+		Error += glm::movemask(Less.x) == 0x3 ? 0 : 1;
+		Error += glm::movemask(Less.y) == 0x0 ? 0 : 1;
+
+		glm::vec3x4 const Equal = glm::equal(A, B);
+		Error += glm::all(Equal.y & Equal.z) ? 0 : 1;
+		Error += glm::any(Equal.x) ? 1 : 0;
+
+		glm::vec3x4 const Select = glm::select(Less.x, A, B);
+		Error += glm::all(glm::equal(Select[0], glm::vec3(0.0f, 0.0f, 1.0f))) ? 0 : 1;
+		Error += glm::all(glm::equal(Select[3], glm::vec3(1.5f, 0.0f, 1.0f))) ? 0 : 1;
+
+		glm::simdPacket4 const Floor = glm::floor(glm::simdPacket4(-1.5f, -1.0f, 0.5f, 2.0f));
+		Error += glm::all(Floor == glm::simdPacket4(-2.0f, -1.0f, 0.0f, 2.0f)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace relational
+
+namespace transform
+{
+	int test()
+	{
+		int Error(0);
+
+		glm::mat4 const M = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3)), 0.7f, glm::vec3(0, 1, 0));
+		std::vector<glm::vec3> const A = make_vec3(4);
+
+		glm::vec3x4 P;
+		glm::gather(&A[0], P);
+
+		glm::vec3x4 const Point = glm::transformPoint(M, P);
+		glm::vec3x4 const Vector = glm::transformVector(M, P);
+		glm::vec4x4 const Homogeneous = M * glm::vec4x4(P, glm::simdPacket4(1.0f));
+		glm::vec3x4 const Rotated = glm::mat3(M) * P;
+
+		for(glm::length_t i = 0; i < glm::vec3x4::lanes; ++i)
+		{
+			Error += glm::all(glm::epsilonEqual(Point[i], glm::vec3(M * glm::vec4(A[i], 1.0f)), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Vector[i], glm::vec3(M * glm::vec4(A[i], 0.0f)), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Homogeneous[i], M * glm::vec4(A[i], 1.0f), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Rotated[i], glm::mat3(M) * A[i], 0.0001f)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 20;
+
+		glm::mat4 const M = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3)), 0.7f, glm::vec3(0, 1, 0));
+		std::vector<glm::vec3> const Src = make_vec3(Count);
+		std::vector<glm::vec3> Dst(Count);
+
+		std::clock_t const TimeScalarStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Dst[i] = glm::vec3(M * glm::vec4(Src[i], 1.0f));
+		std::clock_t const TimeScalarEnd = std::clock();
+
+		std::clock_t const TimePacketStart = std::clock();
+		for(std::size_t i = 0; i < Count; i += glm::vec3x4::lanes)
+		{
+			glm::vec3x4 P;
+			glm::gather(&Src[i], P);
+			glm::scatter(glm::transformPoint(M, P), &Dst[i]);
+		}
+		std::clock_t const TimePacketEnd = std::clock();
+
+		std::printf("transform vec3: %d clocks\n", static_cast<int>(TimeScalarEnd - TimeScalarStart));
+		std::printf("transform vec3x4: %d clocks\n", static_cast<int>(TimePacketEnd - TimePacketStart));
+
+		return 0;
+	}
+}//namespace transform
+
+#if GLM_ARCH & GLM_ARCH_AVX
+namespace packet8
+{
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> const A = make_vec3(8);
+
+		glm::vec3x8 P;
+		glm::gather(&A[0], P);
+		glm::simdPacket8 const Length = glm::length(P);
+
+		for(glm::length_t i = 0; i < glm::vec3x8::lanes; ++i)
+			Error += glm::epsilonEqual(Length[i], glm::length(A[i]), 0.0001f) ? 0 : 1;
+
+		std::vector<glm::vec3> B(8);
+		glm::scatter(P, &B[0]);
+		for(std::size_t i = 0; i < B.size(); ++i)
+			Error += glm::all(glm::equal(A[i], B[i])) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace packet8
+#endif//GLM_ARCH & GLM_ARCH_AVX
+
+int main()
+{
+	int Error(0);
+
+	Error += gather_scatter::test();
+	Error += geometric::test();
+	Error += relational::test();
+	Error += transform::test();
+#	if GLM_ARCH & GLM_ARCH_AVX
+		Error += packet8::test();
+#	endif//GLM_ARCH & GLM_ARCH_AVX
+
+#	ifdef NDEBUG
+		Error += transform::perf();
+#	endif//NDEBUG
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	int Error(0);
+
+	return Error;
+}
+
+#endif//(GLM_ARCH != GLM_ARCH_PURE)
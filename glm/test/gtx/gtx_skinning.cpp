@@ -0,0 +1,222 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @file test/gtx/gtx_skinning.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/skinning.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	struct skeleton
+	{
+		std::vector<glm::mat4> Matrices;
+		std::vector<glm::dualquat> DualQuats;
+	};
+
+	// Rigid joint transformations, the same in both representations
+	skeleton make_skeleton(std::size_t Count)
+	{
+		glm::pcg32 Engine(1);
+		skeleton Skeleton;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::quat const Orientation = glm::normalize(glm::quat(glm::linearRand(-0.5f, 0.5f, Engine), glm::linearRand(-0.5f, 0.5f, Engine), glm::linearRand(-0.5f, 0.5f, Engine), glm::linearRand(-0.5f, 0.5f, Engine)));
+			glm::vec3 const Translation(glm::linearRand(glm::vec3(-2.0f), glm::vec3(2.0f), Engine));
+			Skeleton.Matrices.push_back(glm::translate(glm::mat4(1.0f), Translation) * glm::mat4_cast(Orientation));
+			Skeleton.DualQuats.push_back(glm::dualquat(Orientation, Translation));
+		}
+		return Skeleton;
+	}
+
+	struct mesh
+	{
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::vec3> Normals;
+		std::vector<glm::u16vec4> Joints;
+		std::vector<glm::vec4> Weights;
+	};
+
+	// Vertices influenced by 1 to 4 joints, with weights summing to 1
+	mesh make_mesh(std::size_t Count, std::size_t Joints)
+	{
+		glm::pcg32 Engine(2);
+		mesh Mesh;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Mesh.Positions.push_back(glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f), Engine));
+			Mesh.Normals.push_back(glm::normalize(glm::linearRand(glm::vec3(-0.5f), glm::vec3(0.5f), Engine)));
+
+			glm::u16vec4 Influences;
+			glm::vec4 Weights(0.0f);
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				Influences[k] = glm::linearRand(glm::u16(0), static_cast<glm::u16>(Joints - 1), Engine);
+				Weights[k] = static_cast<std::size_t>(k) <= i % 4 ? glm::linearRand(0.1f, 1.1f, Engine) : 0.0f;
+			}
+			Mesh.Joints.push_back(Influences);
+			Mesh.Weights.push_back(Weights / (Weights.x + Weights.y + Weights.z + Weights.w));
+		}
+		return Mesh;
+	}
+}//namespace
+
+namespace linear
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		skeleton const Skeleton = make_skeleton(64);
+		mesh const Mesh = make_mesh(Count, 64);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::vec3> Positions(Count), Normals(Count);
+			glm::skinLinearBatch(&Skeleton.Matrices[0], &Mesh.Joints[0], &Mesh.Weights[0], &Mesh.Positions[0], &Mesh.Normals[0], &Positions[0], &Normals[0], Count);
+
+			std::vector<glm::vec3> PositionsOnly(Count);
+			glm::skinLinearBatch(&Skeleton.Matrices[0], &Mesh.Joints[0], &Mesh.Weights[0], &Mesh.Positions[0], 0, &PositionsOnly[0], 0, Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				glm::mat4 const m = glm::blendLinear(&Skeleton.Matrices[0], Mesh.Joints[i], Mesh.Weights[i]);
+				Error += glm::all(glm::epsilonEqual(Positions[i], glm::vec3(m * glm::vec4(Mesh.Positions[i], 1.0f)), 1e-5f)) ? 0 : 1;
+				Error += glm::all(glm::epsilonEqual(Normals[i], glm::normalize(glm::mat3(m) * Mesh.Normals[i]), 1e-5f)) ? 0 : 1;
+				Error += glm::all(glm::equal(Positions[i], PositionsOnly[i])) ? 0 : 1;
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+}//namespace linear
+
+namespace dual_quat
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1031;
+		skeleton const Skeleton = make_skeleton(64);
+		mesh const Mesh = make_mesh(Count, 64);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::vec3> Positions(Count), Normals(Count);
+			glm::skinDualQuatBatch(&Skeleton.DualQuats[0], &Mesh.Joints[0], &Mesh.Weights[0], &Mesh.Positions[0], &Mesh.Normals[0], &Positions[0], &Normals[0], Count);
+
+			std::vector<glm::vec3> LinearPositions(Count), LinearNormals(Count);
+			glm::skinLinearBatch(&Skeleton.Matrices[0], &Mesh.Joints[0], &Mesh.Weights[0], &Mesh.Positions[0], &Mesh.Normals[0], &LinearPositions[0], &LinearNormals[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				glm::dualquat const q = glm::blendDualQuat(&Skeleton.DualQuats[0], Mesh.Joints[i], Mesh.Weights[i]);
+				Error += glm::all(glm::epsilonEqual(Positions[i], q * Mesh.Positions[i], 1e-5f)) ? 0 : 1;
+				Error += glm::all(glm::epsilonEqual(Normals[i], q.real * Mesh.Normals[i], 1e-5f)) ? 0 : 1;
+
+				// Both methods agree on rigidly skinned vertices
+				if(i % 4 == 0)
+				{
+					Error += glm::all(glm::epsilonEqual(Positions[i], LinearPositions[i], 1e-5f)) ? 0 : 1;
+					Error += glm::all(glm::epsilonEqual(Normals[i], LinearNormals[i], 1e-5f)) ? 0 : 1;
+				}
+			}
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+}//namespace dual_quat
+
+int perf()
+{
+	std::size_t const Count = 1 << 20;
+	std::size_t const Passes = 4;
+	skeleton const Skeleton = make_skeleton(128);
+	mesh const Mesh = make_mesh(Count, 128);
+	std::vector<glm::vec3> Positions(Count), Normals(Count);
+	double const Vertices = static_cast<double>(Count * Passes);
+
+	glm::simd_level const Max = glm::simdMaxLevel();
+	for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+	{
+		if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+			continue;
+
+		std::clock_t const TimeLinearStart = std::clock();
+		for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+			glm::skinLinearBatch(&Skeleton.Matrices[0], &Mesh.Joints[0], &Mesh.Weights[0], &Mesh.Positions[0], &Mesh.Normals[0], &Positions[0], &Normals[0], Count);
+		std::clock_t const TimeLinearEnd = std::clock();
+
+		std::clock_t const TimeDualQuatStart = std::clock();
+		for(std::size_t Pass = 0; Pass < Passes; ++Pass)
+			glm::skinDualQuatBatch(&Skeleton.DualQuats[0], &Mesh.Joints[0], &Mesh.Weights[0], &Mesh.Positions[0], &Mesh.Normals[0], &Positions[0], &Normals[0], Count);
+		std::clock_t const TimeDualQuatEnd = std::clock();
+
+		// clock() adds up the time of all the threads
+		double const LinearTime = static_cast<double>(TimeLinearEnd - TimeLinearStart) / CLOCKS_PER_SEC;
+		double const DualQuatTime = static_cast<double>(TimeDualQuatEnd - TimeDualQuatStart) / CLOCKS_PER_SEC;
+		char const * Name = glm::simdLevelName(glm::simdLevel());
+		std::printf("skinLinearBatch at the %s level: %.1f M vertices/s per thread\n", Name, LinearTime > 0.0 ? Vertices / LinearTime * 1e-6 : 0.0);
+		std::printf("skinDualQuatBatch at the %s level: %.1f M vertices/s per thread\n", Name, DualQuatTime > 0.0 ? Vertices / DualQuatTime * 1e-6 : 0.0);
+	}
+	glm::simdForceLevel(Max);
+
+	return 0;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += linear::test();
+	Error += dual_quat::test();
+
+#	ifdef NDEBUG
+		Error += perf();
+#	endif//NDEBUG
+
+	return Error;
+}
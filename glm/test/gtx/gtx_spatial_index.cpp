@@ -0,0 +1,354 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @file test/gtx/gtx_spatial_index.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/spatial_index.hpp>
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	// Uniform points in a box of size 10, a dense cluster and duplicated points
+	void make_points(std::vector<glm::vec3> & Points)
+	{
+		glm::pcg32 Engine(1);
+		Points.clear();
+		for(std::size_t i = 0; i < 20000; ++i)
+			Points.push_back(glm::linearRand(glm::vec3(0.0f), glm::vec3(10.0f), Engine));
+		for(std::size_t i = 0; i < 1000; ++i)
+			Points.push_back(glm::vec3(3.0f, 4.0f, 5.0f) + glm::linearRand(glm::vec3(0.0f), glm::vec3(0.01f), Engine));
+		for(std::size_t i = 0; i < 100; ++i)
+			Points.push_back(Points[i * 7]);
+	}
+
+	void brute_radius(std::vector<glm::vec3> const & Points, glm::vec3 const & Center, float Radius, std::vector<glm::uint32> & Indices)
+	{
+		Indices.clear();
+		for(std::size_t i = 0; i < Points.size(); ++i)
+		{
+			glm::vec3 const d = Points[i] - Center;
+			if(glm::dot(d, d) <= Radius * Radius)
+				Indices.push_back(static_cast<glm::uint32>(i));
+		}
+	}
+
+	void brute_nearest(std::vector<glm::vec3> const & Points, glm::vec3 const & Center, std::size_t K, std::vector<glm::uint32> & Indices)
+	{
+		std::vector<std::pair<float, glm::uint32> > Sorted(Points.size());
+		for(std::size_t i = 0; i < Points.size(); ++i)
+		{
+			glm::vec3 const d = Points[i] - Center;
+			Sorted[i] = std::make_pair(glm::dot(d, d), static_cast<glm::uint32>(i));
+		}
+		Indices.resize(std::min(K, Points.size()));
+		std::partial_sort(Sorted.begin(), Sorted.begin() + Indices.size(), Sorted.end());
+
+		for(std::size_t i = 0; i < Indices.size(); ++i)
+			Indices[i] = Sorted[i].second;
+	}
+
+	double elapsed(std::clock_t Start, std::clock_t End)
+	{
+		return static_cast<double>(End - Start) / CLOCKS_PER_SEC * 1000.0;
+	}
+}//namespace
+
+namespace radius
+{
+	template <typename indexType, typename queryFunc>
+	int check(std::vector<glm::vec3> const & Points, indexType const & Index, queryFunc Query)
+	{
+		int Error(0);
+
+		glm::pcg32 Engine(2);
+		float const Radii[] = {0.0f, 0.1f, 0.5f, 3.0f, 100.0f};
+
+		std::vector<glm::uint32> Result;
+		std::vector<glm::uint32> Expected;
+		for(std::size_t i = 0; i < 100; ++i)
+		{
+			// Some queries out of the points, some on the points
+			glm::vec3 const Center = i % 4 == 0 ? Points[i * 13] : glm::linearRand(glm::vec3(-1.0f), glm::vec3(11.0f), Engine);
+			float const Radius = Radii[i % 5];
+
+			Result.assign(1, 0xFFFFFFFF);
+			std::size_t const Count = Query(Index, Center, Radius, Result);
+			Error += Count == Result.size() - 1 ? 0 : 1;
+			Result.erase(Result.begin());
+			std::sort(Result.begin(), Result.end());
+
+			brute_radius(Points, Center, Radius, Expected);
+			Error += Result == Expected ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	std::size_t grid_radius(glm::point_grid const & Grid, glm::vec3 const & Center, float Radius, std::vector<glm::uint32> & Indices)
+	{
+		return glm::pointGridRadius(Grid, Center, Radius, Indices);
+	}
+
+	std::size_t octree_radius(glm::point_octree const & Octree, glm::vec3 const & Center, float Radius, std::vector<glm::uint32> & Indices)
+	{
+		return glm::pointOctreeRadius(Octree, Center, Radius, Indices);
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> Points;
+		make_points(Points);
+
+		glm::point_grid Grid;
+		glm::pointGridBuild(&Points[0], Points.size(), 0.25f, Grid);
+		Error += check(Points, Grid, grid_radius);
+
+		// Cells much larger than the queries and the opposite
+		glm::pointGridBuild(&Points[0], Points.size(), 4.0f, Grid);
+		Error += check(Points, Grid, grid_radius);
+		glm::pointGridBuild(&Points[0], Points.size(), 0.01f, Grid);
+		Error += check(Points, Grid, grid_radius);
+
+		glm::point_octree Octree;
+		glm::pointOctreeBuild(&Points[0], Points.size(), Octree);
+		Error += check(Points, Octree, octree_radius);
+
+		return Error;
+	}
+}//namespace radius
+
+namespace nearest
+{
+	template <typename indexType, typename queryFunc, typename batchFunc>
+	int check(std::vector<glm::vec3> const & Points, indexType const & Index, queryFunc Query, batchFunc Batch)
+	{
+		int Error(0);
+
+		glm::pcg32 Engine(3);
+		std::size_t const Ks[] = {1, 8, 32};
+
+		std::vector<glm::vec3> Queries(100);
+		for(std::size_t i = 0; i < Queries.size(); ++i)
+			Queries[i] = i % 4 == 0 ? Points[(i * 13) % Points.size()] : glm::linearRand(glm::vec3(-2.0f), glm::vec3(12.0f), Engine);
+
+		std::vector<glm::uint32> Expected;
+		for(std::size_t k = 0; k < sizeof(Ks) / sizeof(Ks[0]); ++k)
+		{
+			std::size_t const K = Ks[k];
+			std::vector<glm::uint32> Result(K);
+			std::vector<glm::uint32> BatchResult(Queries.size() * K);
+
+			if(K <= Points.size())
+				Batch(Index, &Queries[0], Queries.size(), K, &BatchResult[0]);
+
+			for(std::size_t i = 0; i < Queries.size(); ++i)
+			{
+				std::size_t const Count = Query(Index, Queries[i], K, &Result[0]);
+				brute_nearest(Points, Queries[i], K, Expected);
+				Error += Count == Expected.size() ? 0 : 1;
+				Error += std::equal(Expected.begin(), Expected.end(), Result.begin()) ? 0 : 1;
+				if(K <= Points.size())
+					Error += std::equal(Expected.begin(), Expected.end(), BatchResult.begin() + i * K) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	std::size_t grid_nearest(glm::point_grid const & Grid, glm::vec3 const & Center, std::size_t K, glm::uint32 * Indices)
+	{
+		return glm::pointGridNearest(Grid, Center, K, Indices);
+	}
+
+	void grid_nearest_batch(glm::point_grid const & Grid, glm::vec3 const * Queries, std::size_t Count, std::size_t K, glm::uint32 * Indices)
+	{
+		glm::pointGridNearestBatch(Grid, Queries, Count, K, Indices);
+	}
+
+	std::size_t octree_nearest(glm::point_octree const & Octree, glm::vec3 const & Center, std::size_t K, glm::uint32 * Indices)
+	{
+		return glm::pointOctreeNearest(Octree, Center, K, Indices);
+	}
+
+	void octree_nearest_batch(glm::point_octree const & Octree, glm::vec3 const * Queries, std::size_t Count, std::size_t K, glm::uint32 * Indices)
+	{
+		glm::pointOctreeNearestBatch(Octree, Queries, Count, K, Indices);
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> Points;
+		make_points(Points);
+
+		glm::point_grid Grid;
+		glm::pointGridBuild(&Points[0], Points.size(), 0.25f, Grid);
+		Error += check(Points, Grid, grid_nearest, grid_nearest_batch);
+		glm::pointGridBuild(&Points[0], Points.size(), 4.0f, Grid);
+		Error += check(Points, Grid, grid_nearest, grid_nearest_batch);
+
+		glm::point_octree Octree;
+		glm::pointOctreeBuild(&Points[0], Points.size(), Octree);
+		Error += check(Points, Octree, octree_nearest, octree_nearest_batch);
+
+		return Error;
+	}
+
+	// Less points than neighbors searched, a single position and no point
+	int test_degenerate()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> Points(20, glm::vec3(1.0f, 2.0f, 3.0f));
+		Points[5] = glm::vec3(1.5f, 2.0f, 3.0f);
+
+		glm::point_grid Grid;
+		glm::pointGridBuild(&Points[0], Points.size(), 0.25f, Grid);
+		Error += check(Points, Grid, grid_nearest, grid_nearest_batch);
+		Error += radius::check(Points, Grid, radius::grid_radius);
+
+		glm::point_octree Octree;
+		glm::pointOctreeBuild(&Points[0], Points.size(), Octree);
+		Error += check(Points, Octree, octree_nearest, octree_nearest_batch);
+		Error += radius::check(Points, Octree, radius::octree_radius);
+
+		Points.resize(5);
+		glm::pointOctreeBuild(&Points[0], Points.size(), Octree);
+		Error += check(Points, Octree, octree_nearest, octree_nearest_batch);
+		Error += radius::check(Points, Octree, radius::octree_radius);
+
+		glm::pointGridBuild(0, 0, 1.0f, Grid);
+		glm::pointOctreeBuild(0, 0, Octree);
+		std::vector<glm::uint32> Indices;
+		glm::uint32 Nearest[4];
+		Error += glm::pointGridRadius(Grid, glm::vec3(0.0f), 10.0f, Indices) == 0 ? 0 : 1;
+		Error += glm::pointOctreeRadius(Octree, glm::vec3(0.0f), 10.0f, Indices) == 0 ? 0 : 1;
+		Error += glm::pointGridNearest(Grid, glm::vec3(0.0f), 4, Nearest) == 0 ? 0 : 1;
+		Error += glm::pointOctreeNearest(Octree, glm::vec3(0.0f), 4, Nearest) == 0 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace nearest
+
+namespace perf
+{
+	int run(std::size_t Count)
+	{
+		std::size_t const QueryCount = 100000;
+		std::size_t const K = 16;
+
+		// About 32 points within Radius in a box of size 100
+		float const Radius = static_cast<float>(std::pow(32.0 * 1e6 / (4.18879 * static_cast<double>(Count)), 1.0 / 3.0));
+
+		glm::pcg32 Engine(4);
+		std::vector<glm::vec3> Points(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Points[i] = glm::linearRand(glm::vec3(0.0f), glm::vec3(100.0f), Engine);
+		std::vector<glm::vec3> Queries(QueryCount);
+		for(std::size_t i = 0; i < QueryCount; ++i)
+			Queries[i] = glm::linearRand(glm::vec3(0.0f), glm::vec3(100.0f), Engine);
+
+		std::vector<glm::uint32> Indices;
+		std::vector<glm::uint32> Nearest(QueryCount * K);
+		std::size_t Found = 0;
+
+		std::printf("%d points, radius %.2f, %d queries:\n", static_cast<int>(Count), Radius, static_cast<int>(QueryCount));
+
+		glm::point_grid Grid;
+		std::clock_t const TimeGridBuildStart = std::clock();
+		glm::pointGridBuild(&Points[0], Count, Radius, Grid);
+		std::clock_t const TimeGridBuildEnd = std::clock();
+
+		std::clock_t const TimeGridRadiusStart = std::clock();
+		for(std::size_t i = 0; i < QueryCount; ++i)
+		{
+			Indices.clear();
+			Found += glm::pointGridRadius(Grid, Queries[i], Radius, Indices);
+		}
+		std::clock_t const TimeGridRadiusEnd = std::clock();
+
+		std::clock_t const TimeGridNearestStart = std::clock();
+		glm::pointGridNearestBatch(Grid, &Queries[0], QueryCount, K, &Nearest[0]);
+		std::clock_t const TimeGridNearestEnd = std::clock();
+
+		std::printf("- grid: build %.1f ms, radius %.1f ms, %d nearest %.1f ms\n",
+			elapsed(TimeGridBuildStart, TimeGridBuildEnd), elapsed(TimeGridRadiusStart, TimeGridRadiusEnd),
+			static_cast<int>(K), elapsed(TimeGridNearestStart, TimeGridNearestEnd));
+
+		glm::point_octree Octree;
+		std::clock_t const TimeOctreeBuildStart = std::clock();
+		glm::pointOctreeBuild(&Points[0], Count, Octree);
+		std::clock_t const TimeOctreeBuildEnd = std::clock();
+
+		std::clock_t const TimeOctreeRadiusStart = std::clock();
+		for(std::size_t i = 0; i < QueryCount; ++i)
+		{
+			Indices.clear();
+			Found += glm::pointOctreeRadius(Octree, Queries[i], Radius, Indices);
+		}
+		std::clock_t const TimeOctreeRadiusEnd = std::clock();
+
+		std::clock_t const TimeOctreeNearestStart = std::clock();
+		glm::pointOctreeNearestBatch(Octree, &Queries[0], QueryCount, K, &Nearest[0]);
+		std::clock_t const TimeOctreeNearestEnd = std::clock();
+
+		std::printf("- octree: build %.1f ms, radius %.1f ms, %d nearest %.1f ms\n",
+			elapsed(TimeOctreeBuildStart, TimeOctreeBuildEnd), elapsed(TimeOctreeRadiusStart, TimeOctreeRadiusEnd),
+			static_cast<int>(K), elapsed(TimeOctreeNearestStart, TimeOctreeNearestEnd));
+		std::printf("- %.1f points per radius query\n", static_cast<double>(Found) / static_cast<double>(2 * QueryCount));
+
+		return 0;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error(0);
+
+	Error += radius::test();
+	Error += nearest::test();
+	Error += nearest::test_degenerate();
+
+#	ifdef NDEBUG
+		Error += perf::run(1000000);
+		Error += perf::run(10000000);
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -0,0 +1,321 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+///
+/// @file test/gtx/gtx_spline_curve.cpp
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/spline_curve.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	// Control points of a helix of radius 2 and pitch 1 over Turns turns
+	std::vector<glm::vec3> make_helix(std::size_t Count, float Turns)
+	{
+		std::vector<glm::vec3> Points(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const a = glm::two_pi<float>() * Turns * static_cast<float>(i) / static_cast<float>(Count - 1);
+			Points[i] = glm::vec3(glm::cos(a) * 2.0f, glm::sin(a) * 2.0f, a / glm::two_pi<float>());
+		}
+		return Points;
+	}
+
+	// Length of the curve between 0 and t measured on a fine polyline
+	float polyline_length(glm::spline_curve const & Curve, float t, std::size_t Steps)
+	{
+		double Length = 0.0;
+		glm::vec3 Previous(glm::splineEvaluate(Curve, 0.0f));
+		for(std::size_t i = 1; i <= Steps; ++i)
+		{
+			glm::vec3 const Current(glm::splineEvaluate(Curve, t * static_cast<float>(i) / static_cast<float>(Steps)));
+			Length += static_cast<double>(glm::distance(Previous, Current));
+			Previous = Current;
+		}
+		return static_cast<float>(Length);
+	}
+}//namespace
+
+namespace coefficients
+{
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> const Points = make_helix(12, 2.0f);
+		std::vector<glm::vec3> Tangents(Points.size());
+		for(std::size_t i = 0; i < Points.size(); ++i)
+			Tangents[i] = glm::vec3(-Points[i].y, Points[i].x, 1.0f) * 0.5f;
+
+		glm::spline_curve CatmullRom, Hermite;
+		glm::splineCatmullRom(&Points[0], Points.size(), CatmullRom);
+		glm::splineHermite(&Points[0], &Tangents[0], Points.size(), Hermite);
+
+		Error += glm::splineSegmentCount(CatmullRom) == Points.size() - 3 ? 0 : 1;
+		Error += glm::splineSegmentCount(Hermite) == Points.size() - 1 ? 0 : 1;
+
+		for(std::size_t Segment = 0; Segment < glm::splineSegmentCount(CatmullRom); ++Segment)
+		for(std::size_t Step = 0; Step < 8; ++Step)
+		{
+			float const s = static_cast<float>(Step) / 8.0f;
+			float const t = static_cast<float>(Segment) + s;
+
+			glm::vec3 const Expected(glm::catmullRom(Points[Segment], Points[Segment + 1], Points[Segment + 2], Points[Segment + 3], s));
+			Error += glm::all(glm::epsilonEqual(glm::splineEvaluate(CatmullRom, t), Expected, 0.0001f)) ? 0 : 1;
+
+			// Central difference of the position
+			float const h = 0.001f;
+			glm::vec3 const Difference((glm::splineEvaluate(CatmullRom, t + h) - glm::splineEvaluate(CatmullRom, t - h)) / (2.0f * h));
+			Error += Step == 0 || glm::all(glm::epsilonEqual(glm::splineDerivative(CatmullRom, t), Difference, 0.01f)) ? 0 : 1;
+		}
+
+		for(std::size_t Segment = 0; Segment < glm::splineSegmentCount(Hermite); ++Segment)
+		for(std::size_t Step = 0; Step < 8; ++Step)
+		{
+			float const s = static_cast<float>(Step) / 8.0f;
+			glm::vec3 const Expected(glm::hermite(Points[Segment], Tangents[Segment], Points[Segment + 1], Tangents[Segment + 1], s));
+			Error += glm::all(glm::epsilonEqual(glm::splineEvaluate(Hermite, static_cast<float>(Segment) + s), Expected, 0.0001f)) ? 0 : 1;
+		}
+
+		// The parameter is clamped to the curve
+		Error += glm::all(glm::epsilonEqual(glm::splineEvaluate(CatmullRom, -1.0f), Points[1], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::splineEvaluate(CatmullRom, 100.0f), Points[Points.size() - 2], 0.0001f)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace coefficients
+
+namespace batch
+{
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> const Points = make_helix(32, 3.0f);
+		glm::spline_curve Curve;
+		glm::splineCatmullRom(&Points[0], Points.size(), Curve);
+
+		// An odd count covers the tails of the packets, the range covers the clamping
+		std::size_t const Count = 1001;
+		glm::pcg32 Engine(1);
+		std::vector<float> Parameters(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Parameters[i] = glm::linearRand(-1.0f, 30.0f, Engine);
+
+		glm::simd_level const Max = glm::simdMaxLevel();
+		for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+		{
+			if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+				continue;
+
+			std::vector<glm::vec3> Positions(Count);
+			glm::splineEvaluateBatch(Curve, &Parameters[0], &Positions[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::all(glm::epsilonEqual(Positions[i], glm::splineEvaluate(Curve, Parameters[i]), 0.0001f)) ? 0 : 1;
+		}
+		glm::simdForceLevel(Max);
+
+		return Error;
+	}
+}//namespace batch
+
+namespace arc_length
+{
+	int test()
+	{
+		int Error(0);
+
+		// Evenly spaced collinear points give a line at constant speed
+		glm::vec3 const Line[] = {glm::vec3(-1, 0, 0), glm::vec3(0, 0, 0), glm::vec3(1, 0, 0), glm::vec3(2, 0, 0), glm::vec3(3, 0, 0)};
+		glm::spline_curve Straight;
+		glm::splineCatmullRom(Line, 5, Straight);
+		glm::splineBuildArcLength(Straight, 4);
+		Error += glm::epsilonEqual(glm::splineLength(Straight), 2.0f, 0.0001f) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::splineParameterAtLength(Straight, 0.3f), 0.3f, 0.0001f) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::splineParameterAtLength(Straight, 5.0f), 2.0f, 0.0001f) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::splineParameterAtLength(Straight, -1.0f), 0.0f, 0.0001f) ? 0 : 1;
+
+		// The length of a helix, a turn being sqrt((2 * pi * 2)^2 + 1) long
+		std::vector<glm::vec3> const Points = make_helix(67, 2.0f);
+		glm::spline_curve Helix;
+		glm::splineCatmullRom(&Points[0], Points.size(), Helix);
+		glm::splineBuildArcLength(Helix);
+
+		float const Turn = glm::sqrt(glm::pow(glm::two_pi<float>() * 2.0f, 2.0f) + 1.0f);
+		float const Length = glm::splineLength(Helix);
+		Error += glm::epsilonEqual(Length, polyline_length(Helix, static_cast<float>(glm::splineSegmentCount(Helix)), 100000), Length * 0.0001f) ? 0 : 1;
+		Error += glm::abs(Length - Turn * 2.0f * 62.0f / 64.0f) < Length * 0.002f ? 0 : 1;
+
+		// Points at regular distances
+		std::vector<float> Lengths(64), Parameters(64);
+		for(std::size_t i = 0; i < Lengths.size(); ++i)
+			Lengths[i] = Length * static_cast<float>(i) / static_cast<float>(Lengths.size() - 1);
+		glm::splineParameterAtLengthBatch(Helix, &Lengths[0], &Parameters[0], Lengths.size());
+
+		for(std::size_t i = 0; i < Lengths.size(); ++i)
+		{
+			Error += glm::abs(polyline_length(Helix, Parameters[i], 20000) - Lengths[i]) < Length * 0.0001f ? 0 : 1;
+			Error += i == 0 || Parameters[i] > Parameters[i - 1] ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace arc_length
+
+namespace tessellate
+{
+	// Largest distance on screen between the curve and the polyline of the parameters
+	float screen_error(glm::spline_curve const & Curve, glm::mat4 const & ViewProjection, glm::vec2 const & Viewport, std::vector<float> const & Parameters)
+	{
+		float Max = 0.0f;
+		for(std::size_t i = 0; i + 1 < Parameters.size(); ++i)
+		{
+			glm::vec4 const c0(ViewProjection * glm::vec4(glm::splineEvaluate(Curve, Parameters[i]), 1.0f));
+			glm::vec4 const c1(ViewProjection * glm::vec4(glm::splineEvaluate(Curve, Parameters[i + 1]), 1.0f));
+			glm::vec2 const p0((glm::vec2(c0) / c0.w * 0.5f + 0.5f) * Viewport);
+			glm::vec2 const p1((glm::vec2(c1) / c1.w * 0.5f + 0.5f) * Viewport);
+
+			for(std::size_t j = 1; j < 16; ++j)
+			{
+				float const t = glm::mix(Parameters[i], Parameters[i + 1], static_cast<float>(j) / 16.0f);
+				glm::vec4 const c(ViewProjection * glm::vec4(glm::splineEvaluate(Curve, t), 1.0f));
+				glm::vec2 const p((glm::vec2(c) / c.w * 0.5f + 0.5f) * Viewport);
+
+				glm::vec2 const ab(p1 - p0);
+				float const h = glm::clamp(glm::dot(p - p0, ab) / glm::max(glm::dot(ab, ab), 1e-12f), 0.0f, 1.0f);
+				Max = glm::max(Max, glm::distance(p, p0 + ab * h));
+			}
+		}
+		return Max;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		std::vector<glm::vec3> const Points = make_helix(20, 2.0f);
+		glm::spline_curve Curve;
+		glm::splineCatmullRom(&Points[0], Points.size(), Curve);
+
+		glm::vec2 const Viewport(1280.0f, 720.0f);
+		glm::mat4 const ViewProjection =
+			glm::perspective(glm::radians(60.0f), Viewport.x / Viewport.y, 0.1f, 100.0f) *
+			glm::lookAt(glm::vec3(0.0f, -8.0f, 1.0f), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+
+		std::vector<float> Coarse, Fine;
+		std::size_t const CoarseCount = glm::splineTessellate(Curve, ViewProjection, Viewport, 2.0f, Coarse);
+		std::size_t const FineCount = glm::splineTessellate(Curve, ViewProjection, Viewport, 0.25f, Fine);
+
+		Error += CoarseCount == Coarse.size() ? 0 : 1;
+		Error += FineCount > CoarseCount ? 0 : 1;
+		Error += Coarse.front() == 0.0f && Coarse.back() == static_cast<float>(glm::splineSegmentCount(Curve)) ? 0 : 1;
+		for(std::size_t i = 1; i < Coarse.size(); ++i)
+			Error += Coarse[i] > Coarse[i - 1] ? 0 : 1;
+
+		Error += screen_error(Curve, ViewProjection, Viewport, Coarse) < 2.0f * 1.5f ? 0 : 1;
+		Error += screen_error(Curve, ViewProjection, Viewport, Fine) < 0.25f * 1.5f ? 0 : 1;
+
+		// Behind the viewer, nothing is refined
+		glm::mat4 const Behind = glm::perspective(glm::radians(60.0f), Viewport.x / Viewport.y, 0.1f, 100.0f) *
+			glm::lookAt(glm::vec3(0.0f, -8.0f, 1.0f), glm::vec3(0.0f, -16.0f, 1.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+		std::vector<float> Hidden;
+		Error += glm::splineTessellate(Curve, Behind, Viewport, 0.25f, Hidden) == glm::splineSegmentCount(Curve) + 1 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace tessellate
+
+int perf()
+{
+	std::vector<glm::vec3> const Points = make_helix(1024, 64.0f);
+	glm::spline_curve Curve;
+	glm::splineCatmullRom(&Points[0], Points.size(), Curve);
+	glm::splineBuildArcLength(Curve);
+
+	std::size_t const Count = 1 << 20;
+	glm::pcg32 Engine(2);
+	std::vector<float> Parameters(Count), Lengths(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Parameters[i] = glm::linearRand(0.0f, static_cast<float>(glm::splineSegmentCount(Curve)), Engine);
+		Lengths[i] = glm::linearRand(0.0f, glm::splineLength(Curve), Engine);
+	}
+	std::vector<glm::vec3> Positions(Count);
+
+	std::clock_t const TimeScalarStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Positions[i] = glm::catmullRom(Points[1], Points[2], Points[3], Points[4], Parameters[i] - glm::floor(Parameters[i]));
+	std::clock_t const TimeScalarEnd = std::clock();
+	std::printf("catmullRom: %.1f M/s\n", static_cast<double>(Count) * 1e-6 / glm::max(static_cast<double>(TimeScalarEnd - TimeScalarStart) / CLOCKS_PER_SEC, 1e-6));
+
+	glm::simd_level const Max = glm::simdMaxLevel();
+	for(int Level = glm::SIMD_LEVEL_PURE; Level <= Max; ++Level)
+	{
+		if(glm::simdForceLevel(static_cast<glm::simd_level>(Level)) != Level)
+			continue;
+
+		std::clock_t const TimeStart = std::clock();
+		glm::splineEvaluateBatch(Curve, &Parameters[0], &Positions[0], Count);
+		std::clock_t const TimeEnd = std::clock();
+
+		double const Time = static_cast<double>(TimeEnd - TimeStart) / CLOCKS_PER_SEC;
+		std::printf("splineEvaluateBatch at the %s level: %.1f M/s\n", glm::simdLevelName(glm::simdLevel()), Time > 0.0 ? static_cast<double>(Count) / Time * 1e-6 : 0.0);
+	}
+	glm::simdForceLevel(Max);
+
+	std::clock_t const TimeLengthStart = std::clock();
+	glm::splineParameterAtLengthBatch(Curve, &Lengths[0], &Parameters[0], Count);
+	std::clock_t const TimeLengthEnd = std::clock();
+	double const LengthTime = static_cast<double>(TimeLengthEnd - TimeLengthStart) / CLOCKS_PER_SEC;
+	std::printf("splineParameterAtLengthBatch, %d samples: %.1f M/s\n", static_cast<int>(Curve.Lengths.size()), LengthTime > 0.0 ? static_cast<double>(Count) / LengthTime * 1e-6 : 0.0);
+
+	return 0;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += coefficients::test();
+	Error += batch::test();
+	Error += arc_length::test();
+	Error += tessellate::test();
+
+#	ifdef NDEBUG
+		Error += perf();
+#	endif//NDEBUG
+
+	return Error;
+}